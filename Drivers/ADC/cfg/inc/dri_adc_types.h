@@ -0,0 +1,134 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ADC data types Header
+* Filename:		dri_adc_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_adc_types.h
+ *  @brief:	This file contains data types definitions for VADC scan with
+ *  		DMA sample blocks
+ */
+#ifndef DRI_ADC_TYPES_H_
+#define DRI_ADC_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_vadc.h>
+#include <xmc_ccu4.h>
+#include <xmc_ccu8.h>
+#include <xmc_gpio.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_adc_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Samples per block */
+#define ADC_BLOCK_SIZE				( ADC_CHANNELS * ADC_SCANS_PER_BLOCK )
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of ADC
+ * */
+enum class eADC_Status_/*	:	unsigned char	*/
+{
+	ADC_STATUS_SUCCESS = 0,
+	ADC_STATUS_FAILED,
+	ADC_STATUS_BUSY,
+	ADC_STATUS_INVALID_ARGUMENT
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eADC_Init_/*	:	unsigned char	*/
+{
+	ADC_INIT_CLOSE = 0,
+	ADC_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for events of callback
+ * */
+enum class eADC_Event_/*	:	unsigned char	*/
+{
+	ADC_EVENT_BLOCK = 0,			/**< Sample block filled */
+	ADC_EVENT_ERROR					/**< DMA bus error, sampling stopped */
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for ADC
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	Structure for scan trigger and gate
+ *
+ * <i>Imp Note:</i>
+ * 			Edge XMC_VADC_TRIGGER_EDGE_NONE keeps software started autoscan,
+ * 			any other edge converts one scan per trigger. Inputs are named
+ * 			in xmc_vadc_map.h, e.g. XMC_VADC_REQ_TR_CCU80_SR2
+ * */
+typedef struct tStADC_Trigger_
+{
+	XMC_VADC_TRIGGER_INPUT_SELECT_t input = XMC_VADC_REQ_TR_A;		/**< Trigger input of group */
+	XMC_VADC_TRIGGER_EDGE_t edge = XMC_VADC_TRIGGER_EDGE_NONE;		/**< Active edge of trigger */
+	XMC_VADC_GATE_INPUT_SELECT_t gate_input = XMC_VADC_REQ_GT_A;	/**< Gate input of group */
+	XMC_VADC_GATEMODE_t gate_mode = XMC_VADC_GATEMODE_IGNORE;		/**< Gate level passing requests */
+} tStADC_Trigger;
+
+/*
+ * @brief	Structure for statistics
+ */
+typedef struct tStADC_Counters_
+{
+	unsigned long blocks = 0U;				/**< Blocks handed to callback */
+	unsigned long errors = 0U;				/**< DMA errors */
+} tStADC_Counters;
+
+
+#endif /* DRI_ADC_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,109 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ADC Configuration Header
+* Filename:		dri_adc_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_adc_conf.h
+ *  @brief:	This file contains static configurations for VADC scan with
+ *  		DMA sample blocks
+ */
+#ifndef DRI_ADC_CONF_H_
+#define DRI_ADC_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* ADC used in system, 0 - not used */
+#define ADC_USED					1
+
+/* Callback function used in system */
+#define ADC_CALLBACK_HANDLER_USED	1
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Group scan of G0, channel n on P14.n */
+#define ADC_GROUP					VADC_G0
+#define ADC_GROUP_NUM				0U
+#define ADC_PORT					XMC_GPIO_PORT14
+#define ADC_CHANNEL_MASK			0xFFU
+#define ADC_CHANNELS				8U
+
+/* Scans per sample block, block holds ADC_CHANNELS samples per scan */
+#define ADC_SCANS_PER_BLOCK			32U
+
+/*
+ * Converter clock fADCI = fPERIPH / ( ADC_ANALOG_DIVIDER + 1 ), 24 MHz.
+ * Sample phase is 2 + STC fADCI cycles, STC 16 gives 16 additional cycles
+ * and some 1.5 us per conversion with 12 bit results.
+ */
+#define ADC_ANALOG_DIVIDER			4U
+#define ADC_SAMPLE_TIME				16U
+
+/*
+ * Result FIFO, channels write into ADC_RESULT_INPUT, samples move down to
+ * ADC_RESULT_OUTPUT which requests DMA. FIFO covers DMA latency of up to
+ * ADC_RESULT_INPUT conversions.
+ */
+#define ADC_RESULT_INPUT			3U
+#define ADC_RESULT_OUTPUT			0U
+#define ADC_SR						XMC_VADC_SR_GROUP_SR0
+
+/* DMA channel with linked list support and request line of G0 SR0,
+ * see xmc_dma_map.h */
+#define ADC_DMA						XMC_DMA0
+#define ADC_DMA_CHANNEL				0U
+#define ADC_DMA_REQUEST				DMA0_PERIPHERAL_REQUEST_VADC_G0SR0_5
+
+/*
+ * Synchronized conversion, 0 - not used
+ * Slave group converts its channels of ADC_CHANNEL_MASK at the same instant
+ * as ADC_GROUP, result of channel n stays in slave result register n.
+ */
+#define ADC_SYNC_USED				0
+#define ADC_SYNC_GROUP				VADC_G1
+#define ADC_SYNC_GROUP_NUM			1U
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_ADC_CONF_H_ */
+
+/********************************** End of File ******************************/
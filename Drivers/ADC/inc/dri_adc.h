@@ -0,0 +1,250 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ADC API Header
+* Filename:		dri_adc.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_adc.h
+ *  @brief:	This file contains API function declarations for VADC scan
+ *  		with DMA sample blocks
+ */
+#ifndef DRI_ADC_H_
+#define DRI_ADC_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_adc_types.h>
+#include <dri_dma.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+#if( 1 == ADC_USED )
+#if( 1 == ADC_CALLBACK_HANDLER_USED )
+/* Callback handler for user, called in DMA interrupt */
+extern void adc_callback_handler( const eADC_Event_ event, const unsigned short * p_block );
+#endif
+#endif
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for VADC scan with DMA sample blocks
+ *
+ * 			A group scan converts ADC_CHANNEL_MASK over and over. Results
+ * 			pass a result FIFO and are moved by a linked list DMA channel
+ * 			into two sample blocks in turn, CPU is only interrupted once
+ * 			per filled block. Scans can be paced by compare events of
+ * 			CCU4/CCU8 slices instead of running back to back.
+ *
+ ******************************************************************************/
+
+/* Check ADC usage in system */
+#if( 1 == ADC_USED )
+
+class ADC__
+{
+/* public members */
+public:
+	/* Constructors */
+	ADC__() = delete;
+	ADC__( ADC__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for ADC
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eADC_Init_	-	ADC_INIT_OPEN
+	 * 										ADC_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eADC_Status_
+	 *          	ADC_STATUS_SUCCESS:		Operation successful.<BR>
+	 *          	ADC_STATUS_FAILED:		Operation failed.<BR>
+	 *          	ADC_STATUS_BUSY:		DMA channel owned by other driver.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function calibrates VADC, sets up scan, result FIFO
+	 * 				and DMA channel. Sampling starts with start()
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eADC_Status_ init( const eADC_Init_& init = eADC_Init_::ADC_INIT_OPEN );
+
+	/**
+	 * @function	start
+	 *
+	 * @brief		Start continuous sampling into first block
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eADC_Status_
+	 *          	ADC_STATUS_SUCCESS:		Sampling started.<BR>
+	 *          	ADC_STATUS_FAILED:		Not initialized.<BR>
+	 *          	ADC_STATUS_BUSY:		Already running.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Samples of a scan are stored in descending channel order,
+	 * 				as converted by scan request source
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eADC_Status_ start( void );
+
+	/**
+	 * @function	stop
+	 *
+	 * @brief		Stop sampling
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Partly filled block is dropped
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static void stop( void );
+
+	/**
+	 * @function	set_trigger
+	 *
+	 * @brief		Select hardware trigger and gate of scan
+	 *
+	 * @param[in]	config	-	trigger input, edge, gate input and mode
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eADC_Status_
+	 *          	ADC_STATUS_SUCCESS:		Taken over by next start().<BR>
+	 *          	ADC_STATUS_BUSY:		Sampling is running.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				With an edge selected each trigger converts ADC_CHANNELS
+	 * 				samples, a block then holds ADC_SCANS_PER_BLOCK trigger
+	 * 				periods
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Timer owner routes its event to the trigger input with
+	 * 				route_ccu4() or route_ccu8()
+	 *
+	 */
+	static eADC_Status_ set_trigger( const tStADC_Trigger& config );
+
+	/**
+	 * @function	route_ccu4
+	 *
+	 * @brief		Route event of a CCU4 slice to a service request line
+	 *
+	 * @param[in]	p_slice	-	timer slice
+	 * 				event	-	e.g. XMC_CCU4_SLICE_IRQ_ID_COMPARE_MATCH_UP
+	 * 				sr		-	service request line wired to VADC, e.g. SR2
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Lines SR2 and SR3 of a module reach VADC trigger inputs,
+	 * 				see xmc_vadc_map.h
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static inline void route_ccu4( XMC_CCU4_SLICE_t * const p_slice, const XMC_CCU4_SLICE_IRQ_ID_t event,
+									const XMC_CCU4_SLICE_SR_ID_t sr )
+	{
+		XMC_CCU4_SLICE_SetInterruptNode( p_slice, event, sr );
+		XMC_CCU4_SLICE_EnableEvent( p_slice, event );
+	}
+
+	/* Same as route_ccu4() for a CCU8 slice */
+	static inline void route_ccu8( XMC_CCU8_SLICE_t * const p_slice, const XMC_CCU8_SLICE_IRQ_ID_t event,
+									const XMC_CCU8_SLICE_SR_ID_t sr )
+	{
+		XMC_CCU8_SLICE_SetInterruptNode( p_slice, event, sr );
+		XMC_CCU8_SLICE_EnableEvent( p_slice, event );
+	}
+
+	/******* Setters and Getters *******/
+	static inline bool is_running( void ){ return ( 0U != running ); }
+	/* Statistics */
+	static const tStADC_Counters& get_counters( void ) { return counters; }
+#if( 1 == ADC_SYNC_USED )
+	/* Last result of slave group channel, converted with same channel of ADC_GROUP */
+	static inline unsigned short get_sync_sample( const unsigned char channel )
+	{
+		return static_cast<unsigned short>( XMC_VADC_GROUP_GetResult( ADC_SYNC_GROUP, channel ) );
+	}
+#endif
+
+/* private members */
+private:
+	/** Data Members **/
+	static unsigned short blocks[2][ADC_BLOCK_SIZE];
+	static XMC_DMA_LLI_t lli[2];
+	static tStADC_Counters counters;
+	static tStADC_Trigger trigger;
+	static volatile unsigned char block_index;
+	static volatile unsigned char running;
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static void vadc_init( void );
+	static void finish( void );
+	static void dma_event( XMC_DMA_CH_EVENT_t event );
+};
+
+#endif	/* ADC_USED */
+
+
+#endif /* DRI_ADC_H_ */
+
+/********************************** End of File *******************************/
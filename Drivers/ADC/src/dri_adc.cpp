@@ -0,0 +1,468 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ADC API Source
+* Filename:		dri_adc.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_adc.cpp
+ *  @brief:	This source file contains API function definitions for
+ *  		VADC scan with DMA sample blocks.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_adc.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* DLR line of DMA request */
+#define ADC_DMA_LINE		( ADC_DMA_REQUEST & 0x0FU )
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check ADC usage in system */
+#if( 1 == ADC_USED )
+
+/* Declare static data member
+ *
+ * Note: Tell linker to take variable from this source file
+ * */
+unsigned short ADC__::blocks[2][ADC_BLOCK_SIZE];
+XMC_DMA_LLI_t ADC__::lli[2];
+tStADC_Counters ADC__::counters;
+tStADC_Trigger ADC__::trigger;
+volatile unsigned char ADC__::block_index = 0;
+volatile unsigned char ADC__::running = 0;
+unsigned char ADC__::init_state = 0;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/******* Public Member function for ADC__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for ADC
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eADC_Status_ ADC__::init( const eADC_Init_& init )
+{
+	/* Local Variables */
+	eADC_Status_ ret_status = eADC_Status_::ADC_STATUS_FAILED;
+	XMC_DMA_CH_CONFIG_t dma_cfg = {};
+	eDMA_Status_ dma_status_l;
+	unsigned char index = 0;
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open ADC */
+		case eADC_Init_::ADC_INIT_OPEN:
+			/* Check for initialization */
+			if( init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			/* Two blocks chained in a ring, each one raises block event */
+			for( index = 0; index < 2U; ++index )
+			{
+				lli[index] = {};
+				lli[index].src_addr = (unsigned long) &( ADC_GROUP->RES[ADC_RESULT_OUTPUT] );
+				lli[index].dst_addr = (unsigned long) &( blocks[index][0] );
+				lli[index].llp = &lli[1U - index];
+				lli[index].enable_interrupt = 1U;
+				lli[index].dst_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_16;
+				lli[index].src_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_16;
+				lli[index].dst_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+				lli[index].src_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+				lli[index].dst_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+				lli[index].src_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+				lli[index].transfer_flow = (unsigned long) XMC_DMA_CH_TRANSFER_FLOW_P2M_DMA;
+				lli[index].enable_dst_linked_list = 1U;
+				lli[index].enable_src_linked_list = 1U;
+				lli[index].block_size = ADC_BLOCK_SIZE;
+			}
+
+			/* Result FIFO output to memory, one 16 bit result per request */
+			dma_cfg.enable_interrupt = 1U;
+			dma_cfg.dst_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_16;
+			dma_cfg.src_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_16;
+			dma_cfg.dst_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+			dma_cfg.src_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+			dma_cfg.dst_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+			dma_cfg.src_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+			dma_cfg.transfer_flow = (unsigned long) XMC_DMA_CH_TRANSFER_FLOW_P2M_DMA;
+			dma_cfg.src_addr = lli[0].src_addr;
+			dma_cfg.dst_addr = lli[0].dst_addr;
+			dma_cfg.linked_list_pointer = &lli[0];
+			dma_cfg.block_size = ADC_BLOCK_SIZE;
+			dma_cfg.transfer_type = XMC_DMA_CH_TRANSFER_TYPE_MULTI_BLOCK_SRCADR_LINKED_DSTADR_LINKED;
+			dma_cfg.priority = XMC_DMA_CH_PRIORITY_7;
+			dma_cfg.src_handshaking = XMC_DMA_CH_SRC_HANDSHAKING_HARDWARE;
+			dma_cfg.dst_handshaking = XMC_DMA_CH_DST_HANDSHAKING_SOFTWARE;
+			dma_cfg.src_peripheral_request = ADC_DMA_REQUEST;
+
+			dma_status_l = DMA__::channel_open( ADC_DMA, ADC_DMA_CHANNEL, dma_cfg,
+										( (unsigned long) XMC_DMA_CH_EVENT_BLOCK_TRANSFER_COMPLETE |
+										  (unsigned long) XMC_DMA_CH_EVENT_ERROR ),
+										dma_event );
+
+			/* Leave converter untouched without DMA channel */
+			if( eDMA_Status_::DMA_STATUS_BUSY == dma_status_l )
+			{
+				ret_status = eADC_Status_::ADC_STATUS_BUSY;
+				break;
+			}
+			else if( eDMA_Status_::DMA_STATUS_SUCCESS != dma_status_l ){ break; }
+			else{	/* Not required */	}
+
+			/* Converter, scan and result FIFO */
+			vadc_init();
+
+			counters = {};
+
+			/* Set initialize state */
+			init_state = 1;
+			/* Update return status */
+			ret_status = eADC_Status_::ADC_STATUS_SUCCESS;
+			break;
+
+		/* Close ADC */
+		case eADC_Init_::ADC_INIT_CLOSE:
+			stop();
+
+			if( init_state > 0 )
+			{
+				XMC_DMA_DisableRequestLine( ADC_DMA, ADC_DMA_LINE );
+				(void) DMA__::channel_close( ADC_DMA, ADC_DMA_CHANNEL );
+				XMC_VADC_GROUP_SetPowerMode( ADC_GROUP, XMC_VADC_GROUP_POWERMODE_OFF );
+			}
+			else{	/* Not required */	}
+
+			/* Reset control state */
+			init_state = 0;
+			/* Update return status */
+			ret_status = eADC_Status_::ADC_STATUS_SUCCESS;
+			break;
+
+		/* Default parameters, invalid argument */
+		default:
+			ret_status = eADC_Status_::ADC_STATUS_INVALID_ARGUMENT;
+			break;
+	}
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/**
+ * @function	start
+ *
+ * @brief		Start continuous sampling into first block
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eADC_Status_ ADC__::start( void )
+{
+	/* Local Variables */
+	unsigned char res = 0;
+
+	/* Check ADC state */
+	DRIVER_ASSERT( (0 == init_state), eADC_Status_::ADC_STATUS_FAILED );
+	DRIVER_ASSERT( (0U != running), eADC_Status_::ADC_STATUS_BUSY );
+
+	block_index = 0U;
+
+	/* Drop results left in FIFO by stop, they would shift channel order */
+	for( res = ADC_RESULT_OUTPUT; res <= ADC_RESULT_INPUT; ++res )
+	{
+		(void) XMC_VADC_GROUP_GetResult( ADC_GROUP, res );
+	}
+
+	/* Arm channel on first block, it waits for result of first conversion */
+	XMC_DMA_CH_SetLinkedListPointer( ADC_DMA, ADC_DMA_CHANNEL, &lli[0] );
+	XMC_DMA_ClearRequestLine( ADC_DMA, ADC_DMA_LINE );
+	XMC_DMA_CH_Enable( ADC_DMA, ADC_DMA_CHANNEL );
+
+	running = 1U;
+
+	/* Gate inputs pass or hold requests of either mode */
+	XMC_VADC_GROUP_ScanSelectGating( ADC_GROUP, trigger.gate_input );
+
+	if( XMC_VADC_TRIGGER_EDGE_NONE == trigger.edge )
+	{
+		/* Autoscan reloads sequence from now on */
+		XMC_VADC_GROUP_ScanDisableExternalTrigger( ADC_GROUP );
+		XMC_VADC_GROUP_ScanEnableContinuousMode( ADC_GROUP );
+		XMC_VADC_GROUP_ScanSetGatingMode( ADC_GROUP, trigger.gate_mode );
+		XMC_VADC_GROUP_ScanTriggerConversion( ADC_GROUP );
+	}
+	else
+	{
+		/* Every trigger edge loads one sequence, no CPU per scan */
+		XMC_VADC_GROUP_ScanDisableContinuousMode( ADC_GROUP );
+		XMC_VADC_GROUP_ScanSelectTrigger( ADC_GROUP, trigger.input );
+		XMC_VADC_GROUP_ScanSelectTriggerEdge( ADC_GROUP, trigger.edge );
+		XMC_VADC_GROUP_ScanEnableExternalTrigger( ADC_GROUP );
+		/* Gating is switched off by abort, requests pass from now on */
+		XMC_VADC_GROUP_ScanSetGatingMode( ADC_GROUP, trigger.gate_mode );
+	}
+
+	/* Return status */
+	return eADC_Status_::ADC_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	stop
+ *
+ * @brief		Stop sampling
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void ADC__::stop( void )
+{
+	/* Local Variables */
+	const unsigned long primask_l = __get_PRIMASK();
+
+	/* DMA interrupt must not see half stopped channel */
+	__disable_irq();
+	if( (init_state > 0) && (0U != running) )
+	{
+		finish();
+	}
+	else{	/* Not required */	}
+	__set_PRIMASK( primask_l );
+}
+
+
+/**
+ * @function	set_trigger
+ *
+ * @brief		Select hardware trigger and gate of scan
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eADC_Status_ ADC__::set_trigger( const tStADC_Trigger& config )
+{
+	/* Scan source is reprogrammed by start() only */
+	DRIVER_ASSERT( (0U != running), eADC_Status_::ADC_STATUS_BUSY );
+
+	trigger = config;
+
+	/* Return status */
+	return eADC_Status_::ADC_STATUS_SUCCESS;
+}
+
+
+/******* Private Member function for ADC__ class *******/
+
+/**
+ * @function	vadc_init
+ *
+ * @brief		Configure converter, scan source and result FIFO
+ *
+ * \par<b>Description:</b><br>
+ * 				All channels of mask write into FIFO input register, new
+ * 				result in FIFO output raises service request routed to DMA
+ * 				line router
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void ADC__::vadc_init( void )
+{
+	/* Local Variables */
+	XMC_VADC_GLOBAL_CONFIG_t global_cfg = {};
+	XMC_VADC_GROUP_CONFIG_t group_cfg = {};
+	XMC_VADC_SCAN_CONFIG_t scan_cfg = {};
+	XMC_VADC_CHANNEL_CONFIG_t channel_cfg = {};
+	XMC_VADC_RESULT_CONFIG_t result_cfg = {};
+	unsigned char index = 0;
+
+	/* Converter clock and input class, same for global and group */
+	global_cfg.clock_config.analog_clock_divider = ADC_ANALOG_DIVIDER;
+	global_cfg.class0.sample_time_std_conv = ADC_SAMPLE_TIME;
+	global_cfg.class0.conversion_mode_standard = (unsigned long) XMC_VADC_CONVMODE_12BIT;
+	XMC_VADC_GLOBAL_Init( VADC, &global_cfg );
+
+	group_cfg.class0.sample_time_std_conv = ADC_SAMPLE_TIME;
+	group_cfg.class0.conversion_mode_standard = (unsigned long) XMC_VADC_CONVMODE_12BIT;
+	group_cfg.arbiter_mode = (unsigned long) XMC_VADC_GROUP_ARBMODE_ALWAYS;
+	XMC_VADC_GROUP_Init( ADC_GROUP, &group_cfg );
+
+#if( 1 == ADC_SYNC_USED )
+	/* Slave takes requests from master arbiter, each one waits for the other to be ready */
+	XMC_VADC_GROUP_Init( ADC_SYNC_GROUP, &group_cfg );
+	XMC_VADC_GROUP_SetSyncSlave( ADC_SYNC_GROUP, ADC_GROUP_NUM, ADC_SYNC_GROUP_NUM );
+	XMC_VADC_GROUP_CheckSlaveReadiness( ADC_SYNC_GROUP, ADC_GROUP_NUM );
+	XMC_VADC_GROUP_SetSyncMaster( ADC_GROUP );
+	XMC_VADC_GROUP_CheckSlaveReadiness( ADC_GROUP, ADC_SYNC_GROUP_NUM );
+	XMC_VADC_GROUP_SetPowerMode( ADC_SYNC_GROUP, XMC_VADC_GROUP_POWERMODE_NORMAL );
+#endif
+
+	XMC_VADC_GROUP_SetPowerMode( ADC_GROUP, XMC_VADC_GROUP_POWERMODE_NORMAL );
+	XMC_VADC_GLOBAL_StartupCalibration( VADC );
+
+	/* Software started scan, end of sequence loads it again */
+	scan_cfg.conv_start_mode = (unsigned long) XMC_VADC_STARTMODE_WFS;
+	scan_cfg.req_src_priority = (unsigned long) XMC_VADC_GROUP_RS_PRIORITY_0;
+	scan_cfg.trigger_edge = (unsigned long) XMC_VADC_TRIGGER_EDGE_NONE;
+	scan_cfg.enable_auto_scan = 1U;
+	XMC_VADC_GROUP_ScanInit( ADC_GROUP, &scan_cfg );
+
+	/* Channels and their pins */
+	channel_cfg.input_class = (unsigned long) XMC_VADC_CHANNEL_CONV_GROUP_CLASS0;
+	channel_cfg.result_reg_number = ADC_RESULT_INPUT;
+	channel_cfg.result_alignment = (unsigned long) XMC_VADC_RESULT_ALIGN_RIGHT;
+	channel_cfg.alias_channel = -1;
+
+	for( index = 0; index < 16U; ++index )
+	{
+		if( 0U != ( ADC_CHANNEL_MASK & (0x1UL << index) ) )
+		{
+#if( 1 == ADC_SYNC_USED )
+			/* Slave channel n keeps its result in register n */
+			channel_cfg.sync_conversion = 0U;
+			channel_cfg.result_reg_number = index;
+			XMC_VADC_GROUP_ChannelInit( ADC_SYNC_GROUP, index, &channel_cfg );
+			channel_cfg.sync_conversion = 1U;
+			channel_cfg.result_reg_number = ADC_RESULT_INPUT;
+#endif
+			XMC_VADC_GROUP_ChannelInit( ADC_GROUP, index, &channel_cfg );
+			XMC_GPIO_DisableDigitalInput( ADC_PORT, index );
+		}
+		else{	/* Not required */	}
+	}
+
+	/* Input down to output + 1 forward results, output keeps them until read */
+	result_cfg.wait_for_read_mode = 1U;
+	result_cfg.part_of_fifo = 1U;
+	for( index = ADC_RESULT_OUTPUT + 1U; index <= ADC_RESULT_INPUT; ++index )
+	{
+		XMC_VADC_GROUP_ResultInit( ADC_GROUP, index, &result_cfg );
+	}
+
+	result_cfg.part_of_fifo = 0U;
+	result_cfg.event_gen_enable = 1U;
+	XMC_VADC_GROUP_ResultInit( ADC_GROUP, ADC_RESULT_OUTPUT, &result_cfg );
+	XMC_VADC_GROUP_SetResultInterruptNode( ADC_GROUP, ADC_RESULT_OUTPUT, ADC_SR );
+
+	XMC_VADC_GROUP_ScanAddMultipleChannels( ADC_GROUP, ADC_CHANNEL_MASK );
+}
+
+
+/**
+ * @function	finish
+ *
+ * @brief		Abort scan and stop channel, mark ADC idle
+ *
+ * <i>Imp Note:</i>
+ * 				Called with interrupts masked or from DMA interrupt
+ *
+ */
+void ADC__::finish( void )
+{
+	XMC_VADC_GROUP_ScanSequenceAbort( ADC_GROUP );
+	XMC_DMA_CH_Disable( ADC_DMA, ADC_DMA_CHANNEL );
+	/* Drop request of result that raced with abort */
+	XMC_DMA_ClearRequestLine( ADC_DMA, ADC_DMA_LINE );
+	running = 0U;
+}
+
+
+/******* ISR entries for ADC__ class *******/
+
+/**
+ * @function	dma_event
+ *
+ * @brief		Handler function for ADC DMA channel events
+ *
+ * @param[in]	event	-	channel event from DMA module interrupt
+ *
+ * \par<b>Description:</b><br>
+ * 				Channel already fills other block while user gets the
+ * 				completed one, it has to be consumed within one block time
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void ADC__::dma_event( XMC_DMA_CH_EVENT_t event )
+{
+	/* Local Variables */
+	const unsigned short * p_block = nullptr;
+
+	/* Stopped in between by user */
+	if( 0U == running ){ return; }
+	else{	/* Not required */	}
+
+	if( XMC_DMA_CH_EVENT_BLOCK_TRANSFER_COMPLETE == event )
+	{
+		p_block = &( blocks[block_index][0] );
+		block_index = static_cast<unsigned char>( 1U - block_index );
+		counters.blocks = counters.blocks + 1U;
+
+#if( 1 == ADC_CALLBACK_HANDLER_USED )
+		adc_callback_handler( eADC_Event_::ADC_EVENT_BLOCK, p_block );
+#endif
+	}
+	else
+	{
+		finish();
+		counters.errors = counters.errors + 1U;
+
+#if( 1 == ADC_CALLBACK_HANDLER_USED )
+		adc_callback_handler( eADC_Event_::ADC_EVENT_ERROR, p_block );
+#endif
+	}
+
+	(void) p_block;
+}
+
+#endif	/* ADC_USED */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,196 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		CAN data types Header
+* Filename:		dri_can_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_can_types.h
+ *  @brief:	This file contains data types definitions for MultiCAN nodes
+ */
+#ifndef DRI_CAN_TYPES_H_
+#define DRI_CAN_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_can.h>
+#include <xmc_can_map.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_can_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Filter index of frames not matched by a table entry */
+#define CAN_NO_FILTER			0xFFU
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of CAN
+ * */
+enum class eCAN_Status_/*	:	unsigned char	*/
+{
+	CAN_STATUS_SUCCESS = 0,
+	CAN_STATUS_FAILED,
+	CAN_STATUS_BUSY,
+	CAN_STATUS_INVALID_ARGUMENT,
+	CAN_STATUS_EMPTY
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eCAN_Init_/*	:	unsigned char	*/
+{
+	CAN_INIT_CLOSE = 0,
+	CAN_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for CAN node Information
+ * */
+enum class eCAN_Node_	:	unsigned char
+{
+	CAN_NODE_0 = 0,
+	CAN_NODE_1,
+	CAN_NODE_2
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for CAN instance
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	Structure for one CAN frame
+ */
+typedef struct tStCAN_Frame_
+{
+	unsigned long id = 0U;					/**< 11 or 29 bit identifier */
+	unsigned long long timestamp = 0U;		/**< Receive time, CLOCK__::now() cycles */
+	union
+	{
+		unsigned char data[8];				/**< Payload bytes */
+		unsigned long data_word[2];			/**< Payload as MODATAL and MODATAH */
+	};
+	unsigned short frame_counter = 0U;		/**< Node frame counter captured at end of frame */
+	unsigned char dlc = 0U;					/**< Payload length, 0 to 8 */
+	unsigned char extended = 0U;			/**< 1 - 29 bit identifier */
+	unsigned char filter = CAN_NO_FILTER;	/**< Table entry which accepted the frame */
+	unsigned char reserved[3] = { 0U };
+} tStCAN_Frame;
+
+/*
+ * @brief	Structure for one acceptance filter
+ *
+ * <i>Imp Note:</i>
+ * 			Frame is accepted when ( received id & mask ) == ( id & mask ),
+ * 			depth above 1 chains message objects into a receive FIFO
+ */
+typedef struct tStCAN_Filter_
+{
+	unsigned long id;				/**< Identifier to compare */
+	unsigned long mask;				/**< 1 - bit compared */
+	unsigned char extended;			/**< 1 - 29 bit identifier */
+	unsigned char depth;			/**< Frames held in hardware, 1 to 31 */
+} tStCAN_Filter;
+
+/*
+ * @brief	Structure for CAN control
+ */
+typedef struct tStCAN_Control_
+{
+	unsigned char init_state = 0U;				/**< Node state */
+	unsigned char tx_first = 0U;				/**< First transmit object, relative to mo_base */
+	unsigned char tx_next = 0U;					/**< Transmit object tried first, round robin */
+	unsigned char mo_used = 0U;					/**< Objects allocated to node list */
+	unsigned long lost = 0U;					/**< Frames overwritten in message objects */
+	unsigned long received = 0U;				/**< Frames moved to receive queue */
+	unsigned char mo_filter[CAN_NODE_MAX_MO];	/**< Filter of each receiving object */
+} tStCAN_Control;
+
+/*
+ * @brief Structure used for Node Context
+ */
+typedef struct tStCAN_Context_
+{
+	/**< node information for current context */
+	XMC_CAN_NODE_t * p_node;
+} tStCAN_Context;
+
+/*
+ * @brief Structure for CAN node configuration
+ */
+typedef struct tStCAN_Configuration_
+{
+	/**< Nominal bit time, frequency is overwritten by CAN_MODULE_FREQUENCY */
+	XMC_CAN_NODE_NOMINAL_BIT_TIME_CONFIG_t bit_time = { CAN_MODULE_FREQUENCY, 500000U, 8000U, 1U };
+	/**< Receive input of node, see xmc_can_map.h */
+	XMC_CAN_NODE_RECEIVE_INPUT_t rx_input = XMC_CAN_NODE_RECEIVE_INPUT_RXDCA;
+	/**< First message object of node, multiple of 32 */
+	unsigned char mo_base = 0U;
+	/**< Message objects owned by node */
+	unsigned char mo_count = CAN_NODE_MAX_MO;
+	/**< Message objects used for transmission */
+	unsigned char tx_count = 4U;
+	/**< Acceptance filter table of node */
+	const tStCAN_Filter * p_filters = nullptr;
+	unsigned char filter_count = 0U;
+} tStCAN_Configuration;
+
+/*
+ * @brief Structure for CAN node interrupt configuration
+ */
+typedef struct tStCAN_InterruptConfiguration_
+{
+	/**< Interrupt configuration for receive */
+	tStInterruptConfig rx_irq;
+	/**< Service request of receive interrupt */
+	unsigned long rx_sr;
+} tStCAN_InterruptConfiguration;
+
+
+#endif /* DRI_CAN_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,111 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		CAN Configuration Header
+* Filename:		dri_can_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_can_conf.h
+ *  @brief:	This file contains static configurations for MultiCAN nodes
+ */
+#ifndef DRI_CAN_CONF_H_
+#define DRI_CAN_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Receive timestamp from CLOCK__::now(), 0 - frames carry frame counter only */
+#define CAN_TIMESTAMP_USED		1
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+#define CAN_MAX_NODES			3
+
+/* Total CAN nodes used in system */
+#define CAN_NODES_USED			2
+
+/* CAN nodes used in system */
+#define CAN_NODE_0_USED
+#define CAN_NODE_1_USED
+//#define CAN_NODE_2_USED
+
+/* MultiCAN kernel clock fCAN */
+#define CAN_MODULE_FREQUENCY	120000000U
+
+/* Message objects owned by one node, pending bits of a node share one MSPND register */
+#define CAN_NODE_MAX_MO			32U
+
+/* Received frames buffered per node, power of 2 */
+#define CAN_RX_QUEUE_SIZE		64
+
+/* Message objects in MultiCAN module */
+#define CAN_MODULE_MO			64U
+
+
+/* Check nodes availability */
+#if (CAN_NODES_USED > CAN_MAX_NODES)
+	#error	"Cannot instantiate more than available nodes"
+#endif
+
+/* Check queue size */
+#if ( 0 != (CAN_RX_QUEUE_SIZE & (CAN_RX_QUEUE_SIZE - 1)) )
+	#error	"CAN receive queue size must be power of 2"
+#endif
+
+/* Check message object budget */
+#if ( (CAN_NODES_USED * CAN_NODE_MAX_MO) > CAN_MODULE_MO )
+	#error	"Message objects of nodes exceed module"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Defining functions for CAN receive ISR handlers and service requests */
+#ifdef CAN_NODE_0_USED
+#define CAN_0_HANDLER			IRQ_Hdlr_76		/* CAN SR0 */
+#define CAN_0_SR				0
+#endif
+
+#ifdef CAN_NODE_1_USED
+#define CAN_1_HANDLER			IRQ_Hdlr_77		/* CAN SR1 */
+#define CAN_1_SR				1
+#endif
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_CAN_CONF_H_ */
+
+/********************************** End of File ******************************/
@@ -0,0 +1,222 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		CAN Configuration Source
+* Filename:		dri_can_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_can_conf.cpp
+ *  @brief:	This source file contains configuration function definitions for
+ *  		MultiCAN nodes and their acceptance filter tables
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_can.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check CAN Usage in system */
+#if( CAN_NODES_USED > 0 )
+
+#ifdef CAN_NODE_0_USED
+/*
+ * @brief	Acceptance filters of node 0
+ *
+ * <i>Imp Note:</i>
+ * 			Entry takes depth objects, plus one base object when depth is
+ * 			above 1. Filters and transmit objects share 32 objects of node
+ */
+static const tStCAN_Filter sg_can_filters_node0[] =
+{
+		{/**< Process data 0x100 - 0x10F */
+				0x100U, 0x7F0U, 0U, 8U
+		},
+		{/**< Diagnostic requests 0x7E0 - 0x7E7 */
+				0x7E0U, 0x7F8U, 0U, 4U
+		},
+		{/**< Extended physical requests to address 0xF1 */
+				0x18DAF100U, 0x1FFFFF00U, 1U, 4U
+		}
+};
+#endif	/* CAN_NODE_0_USED */
+
+#ifdef CAN_NODE_1_USED
+/*
+ * @brief	Acceptance filters of node 1
+ */
+static const tStCAN_Filter sg_can_filters_node1[] =
+{
+		{/**< Sensor data 0x200 - 0x2FF */
+				0x200U, 0x700U, 0U, 16U
+		},
+		{/**< Diagnostic responses 0x7E8 - 0x7EF */
+				0x7E8U, 0x7F8U, 0U, 4U
+		}
+};
+#endif	/* CAN_NODE_1_USED */
+
+/*
+ * @brief	Objects for CAN Class
+ */
+#ifdef CAN_NODE_0_USED
+static CAN__ sg_can_obj_node0 (eCAN_Node_::CAN_NODE_0 );
+#endif
+#ifdef CAN_NODE_1_USED
+static CAN__ sg_can_obj_node1 (eCAN_Node_::CAN_NODE_1 );
+#endif
+
+CAN__ * g_p_can_obj[CAN_NODES_USED] =
+{ &sg_can_obj_node0, &sg_can_obj_node1 };
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/**
+ * @function	initialize_can_objects
+ *
+ * @brief		Initialize CAN Objects with specific properties
+ *
+ * <i>Imp Note:</i>
+ * 				Do not call this function more than once!
+ */
+void CAN__::initialize_can_objects( void )
+{
+	/* Local Variables */
+	tStCAN_Configuration config;
+	tStCAN_InterruptConfiguration irq_config = {
+			.rx_irq = { .irq_num = 76, .irq_priority = 48 },
+			.rx_sr = 0
+	};
+
+	#ifdef CAN_NODE_0_USED
+	/* 500 kbit/s, TX on P3.2 and RX on P1.5, objects 0 - 31 */
+	config.rx_input = CAN_NODE0_RXD_P1_5;
+	config.mo_base = 0U;
+	config.p_filters = sg_can_filters_node0;
+	config.filter_count = (unsigned char)( sizeof(sg_can_filters_node0) / sizeof(sg_can_filters_node0[0]) );
+
+	irq_config.rx_irq.irq_num = 76;
+	irq_config.rx_sr = CAN_0_SR;
+
+	/* Initialize CAN__ Object node 0 parameters */
+	sg_can_obj_node0.set( irq_config, config );
+
+	__asm("NOP");
+	#endif	/* CAN_NODE_0_USED */
+
+	#ifdef CAN_NODE_1_USED
+	/* 500 kbit/s, TX on P1.12 and RX on P1.13, objects 32 - 63 */
+	config.rx_input = CAN_NODE1_RXD_P1_13;
+	config.mo_base = 32U;
+	config.p_filters = sg_can_filters_node1;
+	config.filter_count = (unsigned char)( sizeof(sg_can_filters_node1) / sizeof(sg_can_filters_node1[0]) );
+
+	irq_config.rx_irq.irq_num = 77;
+	irq_config.rx_sr = CAN_1_SR;
+
+	/* Initialize CAN__ Object node 1 parameters */
+	sg_can_obj_node1.set( irq_config, config );
+
+	__asm("NOP");
+	#endif	/* CAN_NODE_1_USED */
+}
+
+
+/******* ISR Handlers for CAN__ nodes *******/
+
+extern "C"
+{
+
+#ifdef CAN_0_HANDLER
+/**
+ * @function	CAN_0_HANDLER
+ *
+ * @brief		CAN node 0 receive handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void CAN_0_HANDLER( void )
+{
+	/* Call ISR entry function */
+	CAN__::isr_entry( &sg_can_obj_node0 );
+}
+#endif	/* CAN_0_HANDLER */
+
+#ifdef CAN_1_HANDLER
+/**
+ * @function	CAN_1_HANDLER
+ *
+ * @brief		CAN node 1 receive handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void CAN_1_HANDLER( void )
+{
+	/* Call ISR entry function */
+	CAN__::isr_entry( &sg_can_obj_node1 );
+}
+#endif	/* CAN_1_HANDLER */
+
+
+}	/* extern "C"{ */
+
+
+/**
+ * @function		initialize_can_objects_c
+ *
+ * @brief			CAN objects initialization function
+ *
+ * <i>Imp Note:</i> To be called before main entry
+ *
+ */
+extern "C" void initialize_can_objects_c( void )
+		{
+			CAN__::initialize_can_objects();
+		}
+
+#endif	/* CAN_NODES_USED */
+
+
+/*********************************** End of File ******************************/
@@ -0,0 +1,257 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		CAN API Header
+* Filename:		dri_can.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_can.h
+ *  @brief:	This file contains API function declarations for MultiCAN node
+ *  		with hardware acceptance filters and receive FIFOs
+ */
+#ifndef DRI_CAN_H_
+#define DRI_CAN_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_can_types.h>
+#include <dri_ring.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for CAN node Instance
+ *
+ ******************************************************************************/
+
+/* Check CAN Usage in system */
+#if( CAN_NODES_USED > 0 )
+
+class CAN__
+{
+/* public members */
+public:
+	/** Constructors and Destructors */
+	CAN__() = delete;
+
+	explicit CAN__( const eCAN_Node_& node_l ) : node(node_l)
+	{
+		/* Assign context */
+		context.p_node = ( eCAN_Node_::CAN_NODE_0 == this->node ) ? CAN_NODE0 :
+						 ( eCAN_Node_::CAN_NODE_1 == this->node ) ? CAN_NODE1 :
+						 CAN_NODE2;
+	}
+
+	/* Destructor for class, not required but still present */
+	~CAN__()
+	{
+		/* Close CAN node */
+		init( eCAN_Init_::CAN_INIT_CLOSE );
+	}
+
+	/******* API Member functions *******/
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for CAN node
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eCAN_Init_	-	CAN_INIT_OPEN
+	 * 											CAN_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eCAN_Status_
+	 *          	CAN_STATUS_SUCCESS:				Operation successful.<BR>
+	 *          	CAN_STATUS_FAILED:				Bit timing not possible.<BR>
+	 *          	CAN_STATUS_INVALID_ARGUMENT:	Filter table exceeds message objects.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function will initialize CAN node and program filter
+	 * 				table into message objects. Entry with depth 1 is a single
+	 * 				receive object, deeper entry is a base object with a chain
+	 * 				of slave objects filled in FIFO order by MultiCAN
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Frames matching no entry are never stored, transmit objects
+	 * 				are taken from end of node range
+	 *
+	 */
+	eCAN_Status_ init( const eCAN_Init_& init = eCAN_Init_::CAN_INIT_OPEN );
+
+	/**
+	 * @function	transmit
+	 *
+	 * @brief		Send one frame
+	 *
+	 * @param[in]	frame	-	frame to send, copied into message object
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eCAN_Status_
+	 *          	CAN_STATUS_SUCCESS:				Frame handed to node.<BR>
+	 *          	CAN_STATUS_FAILED:				Node not initialized.<BR>
+	 *          	CAN_STATUS_BUSY:				All transmit objects pending.<BR>
+	 *          	CAN_STATUS_INVALID_ARGUMENT:	Wrong length.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Transmit objects are used in turn, pending objects of node
+	 * 				are arbitrated by identifier
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Can be called from thread and interrupt context
+	 *
+	 */
+	eCAN_Status_ transmit( const tStCAN_Frame& frame );
+
+	/**
+	 * @function	receive
+	 *
+	 * @brief		Take oldest received frame
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	frame	-	copy of received frame
+	 *
+	 * @return  	eCAN_Status_
+	 *          	CAN_STATUS_SUCCESS:	Frame copied.<BR>
+	 *          	CAN_STATUS_EMPTY:	No frame received.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Frames are queued by receive interrupt, queue has one
+	 * 				consumer
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	eCAN_Status_ receive( tStCAN_Frame& frame )
+	{
+		return ( rx_queue.pop( frame ) ? eCAN_Status_::CAN_STATUS_SUCCESS :
+											eCAN_Status_::CAN_STATUS_EMPTY );
+	}
+
+	/* Oldest received frame in place, nullptr when empty */
+	const tStCAN_Frame * peek( void ) const { return rx_queue.peek(); }
+	/* Drop frame returned by peek */
+	void release( void ) { rx_queue.release(); }
+
+	/******* Setters and Getters *******/
+	/**
+	 * @function	set
+	 *
+	 * @brief		setter function for CAN__ class
+	 *
+	 * @param[in]	irq_config_l	-	interrupt configurations for CAN object
+	 * @param[in]	node_cfg_l		-	CAN node configurations
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function will set the configuration parameters
+	 * 				for CAN__ class object
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	void set( const tStCAN_InterruptConfiguration& irq_config_l,
+				const tStCAN_Configuration& node_cfg_l )
+	{
+		/* Set parameters */
+		irq_config = irq_config_l;
+		config = node_cfg_l;
+	}
+
+	/* Frames waiting in receive queue */
+	unsigned long get_pending( void ) const { return rx_queue.get_count(); }
+	/* Frames dropped because receive queue was full */
+	unsigned long get_dropped( void ) const { return rx_queue.get_dropped(); }
+	/* Frames overwritten in message objects before interrupt read them */
+	unsigned long get_lost( void ) const { return control.lost; }
+	/* Frames received since init */
+	unsigned long get_received( void ) const { return control.received; }
+	/* Node status register, bus off and error warning */
+	unsigned long get_node_status( void ) const { return context.p_node->NSR; }
+	/* Node error counters, REC in bits 0-7 and TEC in bits 8-15 */
+	unsigned long get_error_counters( void ) const { return context.p_node->NECNT; }
+
+	/* ISR entry function for receive */
+	static void isr_entry( CAN__* p_object )
+	{
+		p_object->isr_handler();
+	}
+
+	/* Object initializer for CAN class */
+	static void initialize_can_objects( void );
+
+/* private members */
+private:
+	/** Data Members **/
+	eCAN_Node_ node;
+	tStCAN_Configuration config;
+	tStCAN_Context context;
+	tStCAN_InterruptConfiguration irq_config;
+	tStCAN_Control control;
+	Ring__<tStCAN_Frame, CAN_RX_QUEUE_SIZE> rx_queue;
+
+	/* Nodes holding MultiCAN module enabled */
+	static unsigned char module_users;
+
+	/******* Private Member Functions *******/
+	eCAN_Status_ program_filters( void );
+	void receive_object( const unsigned char mo );
+	void isr_handler( void );
+
+/* protected members, if any */
+protected:
+
+};
+
+#endif	/* CAN_NODES_USED */
+
+
+#endif /* DRI_CAN_H_ */
+
+/********************************** End of File *******************************/
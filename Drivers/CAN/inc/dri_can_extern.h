@@ -0,0 +1,70 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		CAN Extern Header
+* Filename:		dri_can_extern.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_can_extern.h
+ *  @brief:	This file contains extern variable for CAN and CAN API header
+ */
+#ifndef DRI_CAN_EXTERN_H_
+#define DRI_CAN_EXTERN_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_can.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+#if( CAN_NODES_USED > 0 )
+
+/*
+ * @brief	Objects for CAN Class
+ */
+extern CAN__ * g_p_can_obj[CAN_NODES_USED];
+
+#endif
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+
+#endif /* DRI_CAN_EXTERN_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,518 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		CAN API Source
+* Filename:		dri_can.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_can.cpp
+ *  @brief:	This source file contains API function definitions for
+ *  		MultiCAN node with hardware filters and receive FIFOs.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_can.h>
+
+#if( 1 == CAN_TIMESTAMP_USED )
+#include <dri_clock.h>
+#endif
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Message index value when no pending bit is set */
+#define CAN_MSID_NONE			0x20U
+
+/* Receive FIFO chain limit, one base object and slave objects */
+#define CAN_FIFO_MAX_DEPTH		( CAN_NODE_MAX_MO - 1U )
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Message object n of module */
+#define CAN_MO( n )				( &((CAN_MO_TypeDef *) CAN_MO0_BASE)[(n)] )
+
+/* Arbitration by identifier between pending transmit objects */
+#define CAN_MO_PRIORITY			( 2UL )
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Check CAN Usage in system */
+#if( CAN_NODES_USED > 0 )
+
+/* Nodes holding MultiCAN module enabled */
+unsigned char CAN__::module_users = 0U;
+
+
+/******* Public Member function for CAN__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for CAN node
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eCAN_Status_ CAN__::init( const eCAN_Init_& init )
+{
+	/* Local Variables */
+	eCAN_Status_ ret_status = eCAN_Status_::CAN_STATUS_FAILED;
+	XMC_CAN_NODE_FRAME_COUNTER_t frame_counter_l;
+	unsigned char mo_l = 0U;
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open CAN Node */
+		case eCAN_Init_::CAN_INIT_OPEN:
+			/* Check for initialization */
+			if( control.init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			/* Node owns complete pending register, transmit objects fit in range */
+			if( (0U != (config.mo_base % CAN_NODE_MAX_MO)) ||
+				((config.mo_base + config.mo_count) > CAN_MODULE_MO) ||
+				(config.mo_count > CAN_NODE_MAX_MO) ||
+				(config.tx_count > config.mo_count) )
+			{
+				ret_status = eCAN_Status_::CAN_STATUS_INVALID_ARGUMENT;
+				break;
+			}
+			else{	/* Not required */	}
+
+			/* First node enables module clock and kernel */
+			if( 0U == module_users )
+			{
+				XMC_CAN_Init( CAN, CAN_MODULE_FREQUENCY );
+				/* Message index reports every pending bit */
+				CAN->MSIMASK = 0xFFFFFFFFUL;
+			}
+			else{	/* Not required */	}
+			++module_users;
+			control.init_state = 1U;
+
+			XMC_CAN_NODE_EnableConfigurationChange( context.p_node );
+			XMC_CAN_NODE_SetInitBit( context.p_node );
+
+			config.bit_time.can_frequency = CAN_MODULE_FREQUENCY;
+			if( 0 != XMC_CAN_NODE_NominalBitTimeConfigureEx( context.p_node, &config.bit_time ) )
+			{
+				(void) this->init( eCAN_Init_::CAN_INIT_CLOSE );
+				break;
+			}
+			else{	/* Not required */	}
+
+			XMC_CAN_NODE_SetReceiveInput( context.p_node, config.rx_input );
+
+			/* Frame counter runs on bit time and is captured at end of each received frame */
+			frame_counter_l.nfcr = 0U;
+			frame_counter_l.can_frame_count_mode = XMC_CAN_FRAME_COUNT_MODE_TIME_STAMP;
+			frame_counter_l.can_frame_count_selection = 1U;
+			XMC_CAN_NODE_FrameCounterConfigure( context.p_node, &frame_counter_l );
+
+			control.lost = 0U;
+			control.received = 0U;
+			control.mo_used = 0U;
+			rx_queue.flush();
+
+			ret_status = program_filters();
+			if( eCAN_Status_::CAN_STATUS_SUCCESS != ret_status )
+			{
+				(void) this->init( eCAN_Init_::CAN_INIT_CLOSE );
+				break;
+			}
+			else{	/* Not required */	}
+
+			/* Set priority and enable NVIC node for receive events */
+			NVIC_ClearPendingIRQ( static_cast<IRQn_Type>(irq_config.rx_irq.irq_num) );
+			NVIC_SetPriority( static_cast<IRQn_Type>(irq_config.rx_irq.irq_num),
+								NVIC_EncodePriority(NVIC_GetPriorityGrouping(),
+								irq_config.rx_irq.irq_priority,
+								0U)
+							);
+			NVIC_EnableIRQ( static_cast<IRQn_Type>(irq_config.rx_irq.irq_num) );
+
+			/* Join the bus */
+			XMC_CAN_NODE_DisableConfigurationChange( context.p_node );
+			XMC_CAN_NODE_ResetInitBit( context.p_node );
+
+			/* Update return status */
+			ret_status = eCAN_Status_::CAN_STATUS_SUCCESS;
+			break;
+
+		/* Close CAN Node */
+		case eCAN_Init_::CAN_INIT_CLOSE:
+			if( 0U == control.init_state )
+			{
+				ret_status = eCAN_Status_::CAN_STATUS_SUCCESS;
+				break;
+			}
+			else{	/* Not required */	}
+
+			/* Leave the bus */
+			XMC_CAN_NODE_SetInitBit( context.p_node );
+			NVIC_DisableIRQ( static_cast<IRQn_Type>(irq_config.rx_irq.irq_num) );
+
+			/* Return message objects to list of unallocated objects */
+			for( mo_l = config.mo_base; mo_l < (config.mo_base + control.mo_used); ++mo_l )
+			{
+				CAN_MO( mo_l )->MOCTR = CAN_MO_MOCTR_RESMSGVAL_Msk;
+				CAN_MO( mo_l )->MOFCR = 0U;
+
+				while( false == XMC_CAN_IsPanelControlReady( CAN ) )
+				{
+					/* Wait for list controller */
+				}
+				XMC_CAN_PanelControl( CAN, XMC_CAN_PANCMD_STATIC_ALLOCATE, mo_l, 0U );
+			}
+			CAN->MSPND[config.mo_base / CAN_NODE_MAX_MO] = 0U;
+			control.mo_used = 0U;
+
+			/* Last node disables module */
+			if( 1U == module_users )
+			{
+				XMC_CAN_Disable( CAN );
+			}
+			else{	/* Not required */	}
+			--module_users;
+
+			/* Reset initialization state */
+			control.init_state = 0U;
+			/* Update return status */
+			ret_status = eCAN_Status_::CAN_STATUS_SUCCESS;
+			break;
+
+		/* Default parameters, invalid argument */
+		default:
+			/* Update return status */
+			ret_status = eCAN_Status_::CAN_STATUS_INVALID_ARGUMENT;
+			break;
+	}
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/**
+ * @function	transmit
+ *
+ * @brief		Send one frame
+ *
+ * <i>Imp Note:</i>
+ * 				Object search and update are done with interrupts masked, so
+ * 				thread and interrupt context never pick the same object
+ *
+ */
+eCAN_Status_ CAN__::transmit( const tStCAN_Frame& frame )
+{
+	/* Input argument validity */
+	DRIVER_ASSERT( 0U == control.init_state, eCAN_Status_::CAN_STATUS_FAILED );
+	DRIVER_ASSERT( 0U == config.tx_count, eCAN_Status_::CAN_STATUS_FAILED );
+	DRIVER_ASSERT( frame.dlc > 8U, eCAN_Status_::CAN_STATUS_INVALID_ARGUMENT );
+
+	/* Local Variables */
+	eCAN_Status_ ret_status = eCAN_Status_::CAN_STATUS_BUSY;
+	CAN_MO_TypeDef * p_mo = nullptr;
+	unsigned char slot_l = 0U;
+	unsigned char count_l = 0U;
+	const unsigned long primask_l = __get_PRIMASK();
+
+	__disable_irq();
+
+	/* Next object without pending request, round robin */
+	for( count_l = 0U; count_l < config.tx_count; ++count_l )
+	{
+		slot_l = (unsigned char)( (control.tx_next + count_l) % config.tx_count );
+		p_mo = CAN_MO( config.mo_base + control.tx_first + slot_l );
+
+		if( 0U == (p_mo->MOSTAT & CAN_MO_MOSTAT_TXRQ_Msk) )
+		{
+			break;
+		}
+		else{	/* Not required */	}
+	}
+
+	if( count_l < config.tx_count )
+	{
+		/* Object must be invalid while identifier and data change */
+		p_mo->MOCTR = CAN_MO_MOCTR_RESMSGVAL_Msk;
+
+		p_mo->MOAR = ( CAN_MO_PRIORITY << CAN_MO_MOAR_PRI_Pos ) |
+					 ( (0U != frame.extended) ?
+						( CAN_MO_MOAR_IDE_Msk | (frame.id & CAN_MO_MOAR_ID_Msk) ) :
+						( (frame.id << XMC_CAN_MO_MOAR_STDID_Pos) & XMC_CAN_MO_MOAR_STDID_Msk ) );
+		p_mo->MOFCR = ( p_mo->MOFCR & ~CAN_MO_MOFCR_DLC_Msk ) |
+					  ( (unsigned long) frame.dlc << CAN_MO_MOFCR_DLC_Pos );
+		p_mo->MODATAL = frame.data_word[0];
+		p_mo->MODATAH = frame.data_word[1];
+
+		p_mo->MOCTR = CAN_MO_MOCTR_SETNEWDAT_Msk | CAN_MO_MOCTR_SETMSGVAL_Msk | CAN_MO_MOCTR_SETTXRQ_Msk;
+
+		control.tx_next = (unsigned char)( (slot_l + 1U) % config.tx_count );
+		ret_status = eCAN_Status_::CAN_STATUS_SUCCESS;
+	}
+	else{	/* Not required */	}
+
+	__set_PRIMASK( primask_l );
+
+	return ret_status;
+}
+
+
+/******* Private Member function for CAN__ class *******/
+
+/**
+ * @function	program_filters
+ *
+ * @brief		Allocate message objects from filter table
+ *
+ * <i>Imp Note:</i>
+ * 				Node must be in init mode. Objects are allocated in table
+ * 				order, transmit objects follow at end of node range
+ *
+ */
+eCAN_Status_ CAN__::program_filters( void )
+{
+	/* Local Variables */
+	XMC_CAN_MO_t mo_cfg = {};
+	XMC_CAN_FIFO_CONFIG_t fifo_l;
+	const unsigned char tx_first_l = (unsigned char)( config.mo_count - config.tx_count );
+	const unsigned char node_l = static_cast<unsigned char>( this->node );
+	unsigned char filter_l = 0U;
+	unsigned char depth_l = 0U;
+	unsigned char slave_l = 0U;
+	unsigned char mo_l = 0U;
+
+	/* Check filter table against object budget before touching hardware */
+	for( filter_l = 0U; filter_l < config.filter_count; ++filter_l )
+	{
+		depth_l = config.p_filters[filter_l].depth;
+		DRIVER_ASSERT( ( (0U == depth_l) || (depth_l > CAN_FIFO_MAX_DEPTH) ),
+						eCAN_Status_::CAN_STATUS_INVALID_ARGUMENT );
+
+		mo_l = (unsigned char)( mo_l + depth_l + ((depth_l > 1U) ? 1U : 0U) );
+	}
+	DRIVER_ASSERT( mo_l > tx_first_l, eCAN_Status_::CAN_STATUS_INVALID_ARGUMENT );
+
+	/* Receive objects */
+	mo_l = 0U;
+	for( filter_l = 0U; filter_l < config.filter_count; ++filter_l )
+	{
+		const tStCAN_Filter& filter = config.p_filters[filter_l];
+
+		mo_cfg.can_identifier = filter.id;
+		mo_cfg.can_id_mode = (0U != filter.extended) ? (unsigned long) XMC_CAN_FRAME_TYPE_EXTENDED_29BITS :
+														(unsigned long) XMC_CAN_FRAME_TYPE_STANDARD_11BITS;
+		mo_cfg.can_priority = CAN_MO_PRIORITY;
+		mo_cfg.can_id_mask = filter.mask;
+		/* Standard and extended frames never match each other */
+		mo_cfg.can_ide_mask = 1U;
+		mo_cfg.can_mo_type = XMC_CAN_MO_TYPE_RECMSGOBJ;
+
+		if( filter.depth > 1U )
+		{
+			/* Base object accepts frames and stores them in slave at CUR */
+			mo_cfg.can_mo_ptr = CAN_MO( config.mo_base + mo_l );
+			XMC_CAN_MO_Config( &mo_cfg );
+
+			fifo_l.fifo_bottom = (unsigned char)( config.mo_base + mo_l + 1U );
+			fifo_l.fifo_top = (unsigned char)( config.mo_base + mo_l + filter.depth );
+			fifo_l.fifo_base = fifo_l.fifo_bottom;
+			XMC_CAN_RXFIFO_ConfigMOBaseObject( &mo_cfg, fifo_l );
+
+			control.mo_filter[mo_l] = CAN_NO_FILTER;
+			XMC_CAN_AllocateMOtoNodeList( CAN, node_l, (unsigned char)( config.mo_base + mo_l ) );
+			++mo_l;
+
+			for( slave_l = 0U; slave_l < filter.depth; ++slave_l )
+			{
+				mo_cfg.can_mo_ptr = CAN_MO( config.mo_base + mo_l );
+				XMC_CAN_MO_Config( &mo_cfg );
+
+				/* Slave is filled by base only, its own acceptance is off */
+				mo_cfg.can_mo_ptr->MOCTR = CAN_MO_MOCTR_RESRXEN_Msk;
+				mo_cfg.can_mo_ptr->MOFGPR = ( mo_cfg.can_mo_ptr->MOFGPR & ~CAN_MO_MOFGPR_CUR_Msk ) |
+											( ((unsigned long) fifo_l.fifo_bottom - 1U) << CAN_MO_MOFGPR_CUR_Pos );
+
+				XMC_CAN_MO_SetEventNodePointer( &mo_cfg, XMC_CAN_MO_POINTER_EVENT_RECEIVE, irq_config.rx_sr );
+				XMC_CAN_MO_EnableEvent( &mo_cfg, XMC_CAN_MO_EVENT_RECEIVE );
+
+				control.mo_filter[mo_l] = filter_l;
+				XMC_CAN_AllocateMOtoNodeList( CAN, node_l, (unsigned char)( config.mo_base + mo_l ) );
+				++mo_l;
+			}
+		}
+		else
+		{
+			/* Single object accepts and stores */
+			mo_cfg.can_mo_ptr = CAN_MO( config.mo_base + mo_l );
+			XMC_CAN_MO_Config( &mo_cfg );
+
+			XMC_CAN_MO_SetEventNodePointer( &mo_cfg, XMC_CAN_MO_POINTER_EVENT_RECEIVE, irq_config.rx_sr );
+			XMC_CAN_MO_EnableEvent( &mo_cfg, XMC_CAN_MO_EVENT_RECEIVE );
+
+			control.mo_filter[mo_l] = filter_l;
+			XMC_CAN_AllocateMOtoNodeList( CAN, node_l, (unsigned char)( config.mo_base + mo_l ) );
+			++mo_l;
+		}
+	}
+
+	/* Unused objects between filters and transmit objects stay unallocated */
+	control.tx_first = tx_first_l;
+	control.tx_next = 0U;
+
+	/* Transmit objects, identifier and data are written by transmit */
+	mo_cfg = {};
+	mo_cfg.can_priority = CAN_MO_PRIORITY;
+	mo_cfg.can_id_mask = 0x7FFU;
+	mo_cfg.can_mo_type = XMC_CAN_MO_TYPE_TRANSMSGOBJ;
+
+	for( mo_l = tx_first_l; mo_l < config.mo_count; ++mo_l )
+	{
+		mo_cfg.can_mo_ptr = CAN_MO( config.mo_base + mo_l );
+		XMC_CAN_MO_Config( &mo_cfg );
+		/* Keep object invalid until first transmit */
+		mo_cfg.can_mo_ptr->MOCTR = CAN_MO_MOCTR_RESMSGVAL_Msk;
+
+		control.mo_filter[mo_l] = CAN_NO_FILTER;
+		XMC_CAN_AllocateMOtoNodeList( CAN, node_l, (unsigned char)( config.mo_base + mo_l ) );
+	}
+
+	control.mo_used = config.mo_count;
+
+	return eCAN_Status_::CAN_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	receive_object
+ *
+ * @brief		Move frame of one message object into receive queue
+ *
+ * @param[in]	mo	-	message object, relative to mo_base
+ *
+ * <i>Imp Note:</i>
+ * 				Object is read again if MultiCAN updated it while reading,
+ * 				frame is released to hardware even when queue is full
+ *
+ */
+void CAN__::receive_object( const unsigned char mo )
+{
+	/* Local Variables */
+	CAN_MO_TypeDef * const p_mo = CAN_MO( config.mo_base + mo );
+	tStCAN_Frame * const p_frame = rx_queue.claim();
+	unsigned long ar_l;
+	unsigned long fcr_l;
+	unsigned long data_l;
+	unsigned long data_h;
+	unsigned long ipr_l;
+
+	do
+	{
+		p_mo->MOCTR = CAN_MO_MOCTR_RESNEWDAT_Msk | CAN_MO_MOCTR_RESRXPND_Msk;
+		ar_l = p_mo->MOAR;
+		fcr_l = p_mo->MOFCR;
+		data_l = p_mo->MODATAL;
+		data_h = p_mo->MODATAH;
+		ipr_l = p_mo->MOIPR;
+	} while( 0U != (p_mo->MOSTAT & (CAN_MO_MOSTAT_NEWDAT_Msk | CAN_MO_MOSTAT_RXUPD_Msk)) );
+
+	/* Previous frame of object was overwritten before it was read */
+	if( 0U != (p_mo->MOSTAT & CAN_MO_MOSTAT_MSGLST_Msk) )
+	{
+		p_mo->MOCTR = CAN_MO_MOCTR_RESMSGLST_Msk;
+		++control.lost;
+	}
+	else{	/* Not required */	}
+
+	/* Queue full, frame is counted as dropped by ring */
+	if( nullptr == p_frame ){ return; }
+	else{	/* Not required */	}
+
+	#if( 1 == CAN_TIMESTAMP_USED )
+	p_frame->timestamp = CLOCK__::now();
+	#else
+	p_frame->timestamp = 0U;
+	#endif
+
+	p_frame->extended = ( 0U != (ar_l & CAN_MO_MOAR_IDE_Msk) ) ? 1U : 0U;
+	p_frame->id = ( 0U != p_frame->extended ) ? ( ar_l & CAN_MO_MOAR_ID_Msk ) :
+						( (ar_l & XMC_CAN_MO_MOAR_STDID_Msk) >> XMC_CAN_MO_MOAR_STDID_Pos );
+	p_frame->dlc = (unsigned char)( (fcr_l & CAN_MO_MOFCR_DLC_Msk) >> CAN_MO_MOFCR_DLC_Pos );
+	p_frame->data_word[0] = data_l;
+	p_frame->data_word[1] = data_h;
+	p_frame->frame_counter = (unsigned short)( ipr_l >> CAN_MO_MOIPR_CFCVAL_Pos );
+	p_frame->filter = control.mo_filter[mo];
+
+	rx_queue.commit();
+	++control.received;
+}
+
+
+/**
+ * @function	isr_handler
+ *
+ * @brief		Receive interrupt of node
+ *
+ * <i>Imp Note:</i>
+ * 				Pending bits are served lowest object first until register
+ * 				is empty, filter table order is receive priority
+ *
+ */
+void CAN__::isr_handler( void )
+{
+	/* Local Variables */
+	const unsigned long reg_l = config.mo_base / CAN_NODE_MAX_MO;
+	unsigned long index_l;
+
+	while( CAN_MSID_NONE != (index_l = (CAN->MSID[reg_l] & CAN_MSID_INDEX_Msk)) )
+	{
+		/* Writing 0 clears pending bit, 1 leaves others untouched */
+		CAN->MSPND[reg_l] = ~(1UL << index_l);
+
+		receive_object( (unsigned char) index_l );
+	}
+}
+
+#endif	/* CAN_NODES_USED */
+
+
+/*********************************** End of File ******************************/
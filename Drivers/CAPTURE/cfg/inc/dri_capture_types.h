@@ -0,0 +1,138 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Capture data types Header
+* Filename:		dri_capture_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_capture_types.h
+ *  @brief:	This file contains data types definitions for CCU4 input
+ *  		capture with DMA timestamp ring
+ */
+#ifndef DRI_CAPTURE_TYPES_H_
+#define DRI_CAPTURE_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_ccu4.h>
+#include <xmc_gpio.h>
+#include <xmc_scu.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_capture_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Timestamps per DMA block */
+#define CAPTURE_BLOCK_SIZE			( CAPTURE_RING_SIZE / 2U )
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of capture
+ * */
+enum class eCapture_Status_/*	:	unsigned char	*/
+{
+	CAPTURE_STATUS_SUCCESS = 0,
+	CAPTURE_STATUS_FAILED,
+	CAPTURE_STATUS_BUSY,
+	CAPTURE_STATUS_INVALID_ARGUMENT
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eCapture_Init_/*	:	unsigned char	*/
+{
+	CAPTURE_INIT_CLOSE = 0,
+	CAPTURE_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for edge of timestamp
+ * */
+enum class eCapture_Edge_/*	:	unsigned char	*/
+{
+	CAPTURE_EDGE_RISING = 0,
+	CAPTURE_EDGE_FALLING
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for capture
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	Structure for one captured edge
+ */
+typedef struct tStCapture_Edge_
+{
+	unsigned short stamp = 0U;		/**< Timer ticks, wraps at 16 bit */
+	eCapture_Edge_ edge = eCapture_Edge_::CAPTURE_EDGE_RISING;
+} tStCapture_Edge;
+
+/*
+ * @brief	Structure for one measured pulse, rising edge to rising edge
+ */
+typedef struct tStCapture_Pulse_
+{
+	unsigned short period = 0U;		/**< Ticks between rising edges */
+	unsigned short high = 0U;		/**< Ticks from rising to falling edge */
+	unsigned short duty = 0U;		/**< High time over period, unsigned Q15 */
+	unsigned long frequency = 0U;	/**< Hz */
+} tStCapture_Pulse;
+
+/*
+ * @brief	Structure for statistics
+ */
+typedef struct tStCapture_Counters_
+{
+	unsigned long edges = 0U;		/**< Timestamps read from ring */
+	unsigned long overruns = 0U;	/**< Ring or request line overruns, edges lost */
+	unsigned long errors = 0U;		/**< DMA errors */
+} tStCapture_Counters;
+
+
+#endif /* DRI_CAPTURE_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,102 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Capture Configuration Header
+* Filename:		dri_capture_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_capture_conf.h
+ *  @brief:	This file contains static configurations for CCU4 input
+ *  		capture with DMA timestamp ring
+ */
+#ifndef DRI_CAPTURE_CONF_H_
+#define DRI_CAPTURE_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Capture used in system, 0 - not used */
+#define CAPTURE_USED				1
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Slice left out by PWM, CCU42 CC40, CC42 and CC43 drive PWM channels.
+ * Extended capture read register of module serves this slice only */
+#define CAPTURE_MODULE				CCU42
+#define CAPTURE_SLICE				CCU42_CC41
+#define CAPTURE_SLICE_NUM			1U
+
+/* Input CCU42.IN1B on P2.15, see xmc4_ccu4_map.h */
+#define CAPTURE_INPUT				XMC_CCU4_SLICE_INPUT_B
+#define CAPTURE_PORT				XMC_GPIO_PORT2
+#define CAPTURE_PIN					15U
+#define CAPTURE_FILTER				XMC_CCU4_SLICE_EVENT_FILTER_3_CYCLES
+
+/*
+ * Free running 16 bit timestamp, fCCU4 / 4 gives 30 MHz. Two edges of
+ * one period must lie within 2^16 ticks, i.e. signals above 458 Hz.
+ */
+#define CAPTURE_PRESCALER			XMC_CCU4_SLICE_PRESCALER_4
+
+/* Both capture events raise service request line routed to DMA */
+#define CAPTURE_SR					XMC_CCU4_SLICE_SR_ID_1
+
+/* DMA channel and request line, request has to match module and service
+ * request line, see xmc_dma_map.h. CCU42 SR1 reaches GPDMA0 on line 2
+ * or 3, line 2 serves SPI receive */
+#define CAPTURE_DMA					XMC_DMA0
+#define CAPTURE_DMA_CHANNEL			6U
+#define CAPTURE_DMA_REQUEST			DMA0_PERIPHERAL_REQUEST_CCU42_SR1_3
+
+/* Timestamps in ring, power of 2, each half is one DMA block */
+#define CAPTURE_RING_SIZE			256U
+
+
+/* Check ring size */
+#if ( (0U != (CAPTURE_RING_SIZE & (CAPTURE_RING_SIZE - 1U))) || (4U > CAPTURE_RING_SIZE) || \
+	  (8190U < CAPTURE_RING_SIZE) )
+	#error	"Capture ring size must be power of 2, halves limited by DMA block size"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_CAPTURE_CONF_H_ */
+
+/********************************** End of File ******************************/
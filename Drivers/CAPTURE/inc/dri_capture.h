@@ -0,0 +1,228 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Capture API Header
+* Filename:		dri_capture.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_capture.h
+ *  @brief:	This file contains API function declarations for CCU4 input
+ *  		capture with DMA timestamp ring
+ */
+#ifndef DRI_CAPTURE_H_
+#define DRI_CAPTURE_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_capture_types.h>
+#include <dri_dma.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for CCU4 input capture with DMA timestamp ring
+ *
+ * 			Slice runs free in extended capture mode, rising edges are
+ * 			captured by capture trigger 0 and falling edges by trigger 1.
+ * 			Each capture requests DMA, which moves extended capture read
+ * 			register (value, edge and full flag) into a ring. No CPU is
+ * 			involved per edge.
+ *
+ * 			Full flag marks a ring entry as valid, reader clears it after
+ * 			use, so ring needs no shared index. DMA interrupt only
+ * 			re-arms channel once per half ring.
+ *
+ ******************************************************************************/
+
+/* Check capture usage in system */
+#if( 1 == CAPTURE_USED )
+
+class CAPTURE__
+{
+/* public members */
+public:
+	/* Constructors */
+	CAPTURE__() = delete;
+	CAPTURE__( CAPTURE__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for capture
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eCapture_Init_	-	CAPTURE_INIT_OPEN
+	 * 											CAPTURE_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eCapture_Status_
+	 *          	CAPTURE_STATUS_SUCCESS:		Operation successful.<BR>
+	 *          	CAPTURE_STATUS_FAILED:		Operation failed.<BR>
+	 *          	CAPTURE_STATUS_BUSY:		DMA channel owned by other driver.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function sets up input pin, slice and DMA channel.
+	 * 				Capturing starts with start()
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eCapture_Status_ init( const eCapture_Init_& init = eCapture_Init_::CAPTURE_INIT_OPEN );
+
+	/**
+	 * @function	start
+	 *
+	 * @brief		Start capturing into empty ring
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eCapture_Status_
+	 *          	CAPTURE_STATUS_SUCCESS:		Capturing started.<BR>
+	 *          	CAPTURE_STATUS_FAILED:		Not initialized.<BR>
+	 *          	CAPTURE_STATUS_BUSY:		Already running.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eCapture_Status_ start( void );
+
+	/**
+	 * @function	stop
+	 *
+	 * @brief		Stop capturing
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Timestamps still in ring can be read
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static void stop( void );
+
+	/**
+	 * @function	read
+	 *
+	 * @brief		Take timestamps out of ring
+	 *
+	 * @param[in]	count	-	size of p_edges
+	 *
+	 * @param[out]	p_edges	-	edges in order of occurrence
+	 *
+	 * @return  	number of edges written
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 * 				read() and measure() share ring, to be called from one
+	 * 				context only, at least once per half ring of edges
+	 *
+	 */
+	static unsigned short read( tStCapture_Edge * const p_edges, const unsigned short count );
+
+	/**
+	 * @function	measure
+	 *
+	 * @brief		Turn timestamps of ring into pulses
+	 *
+	 * @param[in]	count	-	size of p_pulses
+	 *
+	 * @param[out]	p_pulses	-	period, high time, duty and frequency
+	 *
+	 * @return  	number of pulses written
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				A pulse is completed by each rising edge that follows a
+	 * 				rising and a falling edge. Last edges are kept between
+	 * 				calls, so pulses spanning two calls are not lost.
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Same context rule as read()
+	 *
+	 */
+	static unsigned short measure( tStCapture_Pulse * const p_pulses, const unsigned short count );
+
+	/******* Setters and Getters *******/
+	static inline bool is_running( void ){ return ( 0U != running ); }
+	/* Timestamp ticks per second */
+	static inline unsigned long get_clock( void ){ return clock; }
+	/* Statistics */
+	static const tStCapture_Counters& get_counters( void ) { return counters; }
+
+/* private members */
+private:
+	/** Data Members **/
+	static volatile unsigned long ring[CAPTURE_RING_SIZE];
+	static tStCapture_Counters counters;
+	static unsigned long clock;
+	static unsigned short tail;
+	static unsigned short last_rise;
+	static unsigned short last_fall;
+	static unsigned char edges_seen;
+	static volatile unsigned char half;
+	static volatile unsigned char running;
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static void slice_init( void );
+	static bool pop( tStCapture_Edge& edge );
+	static void finish( void );
+	static void dma_event( XMC_DMA_CH_EVENT_t event );
+};
+
+#endif	/* CAPTURE_USED */
+
+
+#endif /* DRI_CAPTURE_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,515 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Capture API Source
+* Filename:		dri_capture.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_capture.cpp
+ *  @brief:	This source file contains API function definitions for CCU4
+ *  		input capture with DMA timestamp ring.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_capture.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* DLR line of DMA request */
+#define CAPTURE_DMA_LINE		( CAPTURE_DMA_REQUEST & 0x0FU )
+
+/* Capture registers 2 and 3 belong to capture trigger 1, falling edge */
+#define CAPTURE_VPTR_FALLING	( 0x2UL << CCU4_ECRD_VPTR_Pos )
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check capture usage in system */
+#if( 1 == CAPTURE_USED )
+
+/* Declare static data member
+ *
+ * Note: Tell linker to take variable from this source file
+ * */
+volatile unsigned long CAPTURE__::ring[CAPTURE_RING_SIZE];
+tStCapture_Counters CAPTURE__::counters;
+unsigned long CAPTURE__::clock = 0;
+unsigned short CAPTURE__::tail = 0;
+unsigned short CAPTURE__::last_rise = 0;
+unsigned short CAPTURE__::last_fall = 0;
+unsigned char CAPTURE__::edges_seen = 0;
+volatile unsigned char CAPTURE__::half = 0;
+volatile unsigned char CAPTURE__::running = 0;
+unsigned char CAPTURE__::init_state = 0;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/******* Public Member function for CAPTURE__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for capture
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eCapture_Status_ CAPTURE__::init( const eCapture_Init_& init )
+{
+	/* Local Variables */
+	eCapture_Status_ ret_status = eCapture_Status_::CAPTURE_STATUS_FAILED;
+	XMC_DMA_CH_CONFIG_t dma_cfg = {};
+	eDMA_Status_ dma_status_l;
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open capture */
+		case eCapture_Init_::CAPTURE_INIT_OPEN:
+			/* Check for initialization */
+			if( init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			/* Extended capture read register to ring, one 32 bit word per capture */
+			dma_cfg.enable_interrupt = 1U;
+			dma_cfg.dst_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_32;
+			dma_cfg.src_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_32;
+			dma_cfg.dst_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+			dma_cfg.src_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+			dma_cfg.dst_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+			dma_cfg.src_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+			dma_cfg.transfer_flow = (unsigned long) XMC_DMA_CH_TRANSFER_FLOW_P2M_DMA;
+			dma_cfg.src_addr = (unsigned long) &( CAPTURE_MODULE->ECRD );
+			dma_cfg.dst_addr = (unsigned long) &( ring[0] );
+			dma_cfg.block_size = CAPTURE_BLOCK_SIZE;
+			dma_cfg.transfer_type = XMC_DMA_CH_TRANSFER_TYPE_SINGLE_BLOCK;
+			dma_cfg.priority = XMC_DMA_CH_PRIORITY_7;
+			dma_cfg.src_handshaking = XMC_DMA_CH_SRC_HANDSHAKING_HARDWARE;
+			dma_cfg.dst_handshaking = XMC_DMA_CH_DST_HANDSHAKING_SOFTWARE;
+			dma_cfg.src_peripheral_request = CAPTURE_DMA_REQUEST;
+
+			dma_status_l = DMA__::channel_open( CAPTURE_DMA, CAPTURE_DMA_CHANNEL, dma_cfg,
+										( (unsigned long) XMC_DMA_CH_EVENT_TRANSFER_COMPLETE |
+										  (unsigned long) XMC_DMA_CH_EVENT_ERROR ),
+										dma_event );
+
+			/* Leave pin and slice untouched without DMA channel */
+			if( eDMA_Status_::DMA_STATUS_BUSY == dma_status_l )
+			{
+				ret_status = eCapture_Status_::CAPTURE_STATUS_BUSY;
+				break;
+			}
+			else if( eDMA_Status_::DMA_STATUS_SUCCESS != dma_status_l ){ break; }
+			else{	/* Not required */	}
+
+			/* Input pin and capture slice */
+			slice_init();
+
+			counters = {};
+
+			/* Set initialize state */
+			init_state = 1;
+			/* Update return status */
+			ret_status = eCapture_Status_::CAPTURE_STATUS_SUCCESS;
+			break;
+
+		/* Close capture */
+		case eCapture_Init_::CAPTURE_INIT_CLOSE:
+			stop();
+
+			if( init_state > 0 )
+			{
+				XMC_CCU4_SLICE_DisableEvent( CAPTURE_SLICE, XMC_CCU4_SLICE_IRQ_ID_EVENT0 );
+				XMC_CCU4_SLICE_DisableEvent( CAPTURE_SLICE, XMC_CCU4_SLICE_IRQ_ID_EVENT1 );
+				XMC_CCU4_DisableClock( CAPTURE_MODULE, CAPTURE_SLICE_NUM );
+				XMC_DMA_DisableRequestLine( CAPTURE_DMA, CAPTURE_DMA_LINE );
+				(void) DMA__::channel_close( CAPTURE_DMA, CAPTURE_DMA_CHANNEL );
+			}
+			else{	/* Not required */	}
+
+			/* Reset control state */
+			init_state = 0;
+			/* Update return status */
+			ret_status = eCapture_Status_::CAPTURE_STATUS_SUCCESS;
+			break;
+
+		/* Default parameters, invalid argument */
+		default:
+			ret_status = eCapture_Status_::CAPTURE_STATUS_INVALID_ARGUMENT;
+			break;
+	}
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/**
+ * @function	start
+ *
+ * @brief		Start capturing into empty ring
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eCapture_Status_ CAPTURE__::start( void )
+{
+	/* Local Variables */
+	unsigned short index = 0;
+
+	/* Check capture state */
+	DRIVER_ASSERT( (0 == init_state), eCapture_Status_::CAPTURE_STATUS_FAILED );
+	DRIVER_ASSERT( (0U != running), eCapture_Status_::CAPTURE_STATUS_BUSY );
+
+	for( index = 0; index < CAPTURE_RING_SIZE; ++index )
+	{
+		ring[index] = 0U;
+	}
+	tail = 0U;
+	half = 0U;
+	edges_seen = 0U;
+
+	/* Drop captures of an earlier run still held in capture registers */
+	while( 0U != (CAPTURE_MODULE->ECRD & CCU4_ECRD_FFL_Msk) ){}
+
+	/* Arm channel on first half, it waits for first capture */
+	XMC_DMA_ClearRequestLine( CAPTURE_DMA, CAPTURE_DMA_LINE );
+	XMC_DMA_ClearOverrunStatus( CAPTURE_DMA, CAPTURE_DMA_LINE );
+	XMC_DMA_CH_SetDestinationAddress( CAPTURE_DMA, CAPTURE_DMA_CHANNEL, (unsigned long) &( ring[0] ) );
+	XMC_DMA_CH_SetBlockSize( CAPTURE_DMA, CAPTURE_DMA_CHANNEL, CAPTURE_BLOCK_SIZE );
+	XMC_DMA_CH_Enable( CAPTURE_DMA, CAPTURE_DMA_CHANNEL );
+
+	running = 1U;
+
+	XMC_CCU4_SLICE_StartTimer( CAPTURE_SLICE );
+
+	/* Return status */
+	return eCapture_Status_::CAPTURE_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	stop
+ *
+ * @brief		Stop capturing
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void CAPTURE__::stop( void )
+{
+	/* Local Variables */
+	const unsigned long primask_l = __get_PRIMASK();
+
+	/* DMA interrupt must not see half stopped channel */
+	__disable_irq();
+	if( (init_state > 0) && (0U != running) )
+	{
+		finish();
+	}
+	else{	/* Not required */	}
+	__set_PRIMASK( primask_l );
+}
+
+
+/**
+ * @function	read
+ *
+ * @brief		Take timestamps out of ring
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short CAPTURE__::read( tStCapture_Edge * const p_edges, const unsigned short count )
+{
+	/* Local Variables */
+	unsigned short done = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( (nullptr == p_edges), 0U );
+
+	while( (done < count) && (true == pop( p_edges[done] )) )
+	{
+		++done;
+	}
+
+	return done;
+}
+
+
+/**
+ * @function	measure
+ *
+ * @brief		Turn timestamps of ring into pulses
+ *
+ * \par<b>Description:</b><br>
+ * 				Differences are taken modulo 2^16, one division each for
+ * 				duty and frequency
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short CAPTURE__::measure( tStCapture_Pulse * const p_pulses, const unsigned short count )
+{
+	/* Local Variables */
+	tStCapture_Edge edge_l;
+	unsigned short done = 0;
+	unsigned short period_l = 0;
+	unsigned short high_l = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( (nullptr == p_pulses), 0U );
+
+	while( (done < count) && (true == pop( edge_l )) )
+	{
+		if( eCapture_Edge_::CAPTURE_EDGE_FALLING == edge_l.edge )
+		{
+			/* High time needs rising edge before */
+			if( 0U != (edges_seen & 0x1U) )
+			{
+				last_fall = edge_l.stamp;
+				edges_seen = 0x3U;
+			}
+			else{	/* Not required */	}
+		}
+		else
+		{
+			if( 0x3U == edges_seen )
+			{
+				period_l = static_cast<unsigned short>( edge_l.stamp - last_rise );
+				high_l = static_cast<unsigned short>( last_fall - last_rise );
+
+				if( 0U != period_l )
+				{
+					p_pulses[done].period = period_l;
+					p_pulses[done].high = high_l;
+					p_pulses[done].duty = static_cast<unsigned short>( ((unsigned long) high_l << 15) / period_l );
+					p_pulses[done].frequency = clock / period_l;
+					++done;
+				}
+				else{	/* Not required */	}
+			}
+			else{	/* Not required */	}
+
+			last_rise = edge_l.stamp;
+			edges_seen = 0x1U;
+		}
+	}
+
+	return done;
+}
+
+
+/******* Private Member function for CAPTURE__ class *******/
+
+/**
+ * @function	slice_init
+ *
+ * @brief		Configure input pin and capture slice
+ *
+ * \par<b>Description:</b><br>
+ * 				Timer is never cleared by captures, every capture is an
+ * 				absolute timestamp. Full flags are obeyed, a capture
+ * 				register is only refilled after DMA read it.
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void CAPTURE__::slice_init( void )
+{
+	/* Local Variables */
+	XMC_CCU4_SLICE_CAPTURE_CONFIG_t capture_cfg = {};
+	XMC_CCU4_SLICE_EVENT_CONFIG_t event_cfg = {};
+	const XMC_GPIO_CONFIG_t pin_cfg =
+	{
+			XMC_GPIO_MODE_INPUT_TRISTATE,
+			XMC_GPIO_OUTPUT_LEVEL_LOW,
+			XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+	};
+
+	XMC_GPIO_Init( CAPTURE_PORT, CAPTURE_PIN, &pin_cfg );
+
+	clock = XMC_SCU_CLOCK_GetCcuClockFrequency() >> (unsigned long) CAPTURE_PRESCALER;
+
+	/* Enable module and prescaler, does not disturb other slices */
+	XMC_CCU4_Init( CAPTURE_MODULE, XMC_CCU4_SLICE_MCMS_ACTION_TRANSFER_PR_CR );
+
+	capture_cfg.fifo_enable = 1U;
+	capture_cfg.timer_clear_mode = (unsigned long) XMC_CCU4_SLICE_TIMER_CLEAR_MODE_NEVER;
+	capture_cfg.prescaler_initval = (unsigned long) CAPTURE_PRESCALER;
+	XMC_CCU4_SLICE_CaptureInit( CAPTURE_SLICE, &capture_cfg );
+
+	/* Same input on two events, one per edge */
+	event_cfg.mapped_input = CAPTURE_INPUT;
+	event_cfg.edge = XMC_CCU4_SLICE_EVENT_EDGE_SENSITIVITY_RISING_EDGE;
+	event_cfg.level = XMC_CCU4_SLICE_EVENT_LEVEL_SENSITIVITY_ACTIVE_HIGH;
+	event_cfg.duration = CAPTURE_FILTER;
+	XMC_CCU4_SLICE_ConfigureEvent( CAPTURE_SLICE, XMC_CCU4_SLICE_EVENT_0, &event_cfg );
+	XMC_CCU4_SLICE_Capture0Config( CAPTURE_SLICE, XMC_CCU4_SLICE_EVENT_0 );
+
+	event_cfg.edge = XMC_CCU4_SLICE_EVENT_EDGE_SENSITIVITY_FALLING_EDGE;
+	XMC_CCU4_SLICE_ConfigureEvent( CAPTURE_SLICE, XMC_CCU4_SLICE_EVENT_1, &event_cfg );
+	XMC_CCU4_SLICE_Capture1Config( CAPTURE_SLICE, XMC_CCU4_SLICE_EVENT_1 );
+
+	XMC_CCU4_SLICE_SetTimerPeriodMatch( CAPTURE_SLICE, 0xFFFFU );
+	XMC_CCU4_EnableShadowTransfer( CAPTURE_MODULE,
+			( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_SLICE_0 << (4U * CAPTURE_SLICE_NUM) ) |
+			( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_PRESCALER_SLICE_0 << (4U * CAPTURE_SLICE_NUM) ) );
+
+	/* Capture -> service request -> DMA */
+	XMC_CCU4_SLICE_SetInterruptNode( CAPTURE_SLICE, XMC_CCU4_SLICE_IRQ_ID_EVENT0, CAPTURE_SR );
+	XMC_CCU4_SLICE_SetInterruptNode( CAPTURE_SLICE, XMC_CCU4_SLICE_IRQ_ID_EVENT1, CAPTURE_SR );
+	XMC_CCU4_SLICE_EnableEvent( CAPTURE_SLICE, XMC_CCU4_SLICE_IRQ_ID_EVENT0 );
+	XMC_CCU4_SLICE_EnableEvent( CAPTURE_SLICE, XMC_CCU4_SLICE_IRQ_ID_EVENT1 );
+
+	XMC_CCU4_EnableClock( CAPTURE_MODULE, CAPTURE_SLICE_NUM );
+}
+
+
+/**
+ * @function	pop
+ *
+ * @brief		Take oldest valid entry out of ring
+ *
+ * \par<b>Description:</b><br>
+ * 				Entry without full flag was not written by DMA yet
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+bool CAPTURE__::pop( tStCapture_Edge& edge )
+{
+	/* Local Variables */
+	const unsigned long entry_l = ring[tail];
+
+	if( 0U == (entry_l & CCU4_ECRD_FFL_Msk) )
+	{
+		return false;
+	}
+	else{	/* Not required */	}
+
+	edge.stamp = static_cast<unsigned short>( entry_l & CCU4_ECRD_CAPV_Msk );
+	edge.edge = ( 0U != (entry_l & CAPTURE_VPTR_FALLING) ) ?
+					eCapture_Edge_::CAPTURE_EDGE_FALLING : eCapture_Edge_::CAPTURE_EDGE_RISING;
+
+	/* Free entry for next lap of DMA */
+	ring[tail] = 0U;
+	tail = static_cast<unsigned short>( (tail + 1U) & (CAPTURE_RING_SIZE - 1U) );
+	counters.edges = counters.edges + 1U;
+
+	return true;
+}
+
+
+/**
+ * @function	finish
+ *
+ * @brief		Stop slice and channel, mark capture idle
+ *
+ * <i>Imp Note:</i>
+ * 				Called with interrupts masked or from DMA interrupt
+ *
+ */
+void CAPTURE__::finish( void )
+{
+	XMC_CCU4_SLICE_StopClearTimer( CAPTURE_SLICE );
+	XMC_DMA_CH_Disable( CAPTURE_DMA, CAPTURE_DMA_CHANNEL );
+	/* Drop request of capture that raced with stop */
+	XMC_DMA_ClearRequestLine( CAPTURE_DMA, CAPTURE_DMA_LINE );
+	running = 0U;
+}
+
+
+/******* ISR entries for CAPTURE__ class *******/
+
+/**
+ * @function	dma_event
+ *
+ * @brief		Handler function for capture DMA channel events
+ *
+ * @param[in]	event	-	channel event from DMA module interrupt
+ *
+ * \par<b>Description:</b><br>
+ * 				Half done re-arms channel on other half. Its last entry
+ * 				still valid means reader is more than half a ring behind
+ * 				and edges are about to be overwritten. A capture arriving
+ * 				during re-arm waits in request line.
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void CAPTURE__::dma_event( XMC_DMA_CH_EVENT_t event )
+{
+	/* Local Variables */
+	unsigned char next_l = 0;
+
+	/* Stopped in between by user */
+	if( 0U == running ){ return; }
+	else{	/* Not required */	}
+
+	if( XMC_DMA_CH_EVENT_TRANSFER_COMPLETE == event )
+	{
+		next_l = static_cast<unsigned char>( 1U - half );
+
+		XMC_DMA_CH_SetDestinationAddress( CAPTURE_DMA, CAPTURE_DMA_CHANNEL,
+										(unsigned long) &( ring[next_l * CAPTURE_BLOCK_SIZE] ) );
+		XMC_DMA_CH_SetBlockSize( CAPTURE_DMA, CAPTURE_DMA_CHANNEL, CAPTURE_BLOCK_SIZE );
+		XMC_DMA_CH_Enable( CAPTURE_DMA, CAPTURE_DMA_CHANNEL );
+		half = next_l;
+
+		if( (0U != (ring[(next_l * CAPTURE_BLOCK_SIZE) + CAPTURE_BLOCK_SIZE - 1U] & CCU4_ECRD_FFL_Msk)) ||
+			(true == XMC_DMA_GetOverrunStatus( CAPTURE_DMA, CAPTURE_DMA_LINE )) )
+		{
+			XMC_DMA_ClearOverrunStatus( CAPTURE_DMA, CAPTURE_DMA_LINE );
+			counters.overruns = counters.overruns + 1U;
+		}
+		else{	/* Not required */	}
+	}
+	else
+	{
+		finish();
+		counters.errors = counters.errors + 1U;
+	}
+}
+
+#endif	/* CAPTURE_USED */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,109 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Clock data types Header
+* Filename:		dri_clock_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_clock_types.h
+ *  @brief:	This file contains data types definitions for monotonic system
+ *  		clock
+ */
+#ifndef DRI_CLOCK_TYPES_H_
+#define DRI_CLOCK_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_common.h>
+#include <xmc_scu.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_clock_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of clock
+ * */
+enum class eClock_Status_/*	:	unsigned char	*/
+{
+	CLOCK_STATUS_SUCCESS = 0,
+	CLOCK_STATUS_FAILED
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eClock_Init_/*	:	unsigned char	*/
+{
+	CLOCK_INIT_CLOSE = 0,
+	CLOCK_INIT_OPEN
+};
+
+/*
+ * @brief	typedef for idle budget, ticks caller can sleep without tick
+ * 			interrupt, called with interrupts masked
+ */
+typedef unsigned long (*clock_budget_pointer) ( void );
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for clock
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	Structure for time base published at each tick
+ */
+typedef struct tStClock_Base_
+{
+	unsigned long long cycles = 0U;	/**< Core cycles since init at this tick */
+	unsigned long cyccnt = 0U;		/**< DWT cycle counter at this tick */
+	unsigned long ticks = 0U;		/**< Ticks since init, wraps */
+} tStClock_Base;
+
+
+#endif /* DRI_CLOCK_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,92 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Clock Configuration Header
+* Filename:		dri_clock_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_clock_conf.h
+ *  @brief:	This file contains static configurations for monotonic system
+ *  		clock
+ */
+#ifndef DRI_CLOCK_CONF_H_
+#define DRI_CLOCK_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Clock used in system, 0 - not used */
+#define CLOCK_USED					1
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* SysTick interrupts per second, drives tick() of all modules */
+#define CLOCK_TICK_RATE				1000UL
+
+/*
+ * Tickless idle, idle() suppresses SysTick for at most CLOCK_IDLE_MAX_TICKS.
+ * Below CLOCK_IDLE_MIN_TICKS it sleeps with tick running, reprogramming
+ * would cost more than it saves.
+ */
+#define CLOCK_IDLE_MIN_TICKS		2UL
+#define CLOCK_IDLE_MAX_TICKS		10UL
+
+/* Clocks kept in sleep, PLL stays system clock so that SysTick, UART baud
+ * rates and timers run on, see XMC_SCU_CLOCK_SLEEP_MODE_CONFIG_t */
+#define CLOCK_SLEEP_CONFIG			( XMC_SCU_CLOCK_SLEEP_MODE_CONFIG_SYSCLK_FPLL | \
+										XMC_SCU_CLOCK_SLEEP_MODE_CONFIG_ENABLE_ETH | \
+										XMC_SCU_CLOCK_SLEEP_MODE_CONFIG_ENABLE_CCU )
+
+
+/* Check tick rate, tick has to come well within 2^32 core cycles */
+#if ( (0UL == CLOCK_TICK_RATE) || (1000000UL < CLOCK_TICK_RATE) )
+	#error	"Clock tick rate must be 1 Hz - 1 MHz"
+#endif
+
+/* Check idle limits */
+#if ( CLOCK_IDLE_MIN_TICKS < 2UL ) || ( CLOCK_IDLE_MAX_TICKS < CLOCK_IDLE_MIN_TICKS )
+	#error	"Clock idle needs 2 <= CLOCK_IDLE_MIN_TICKS <= CLOCK_IDLE_MAX_TICKS"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_CLOCK_CONF_H_ */
+
+/********************************** End of File ******************************/
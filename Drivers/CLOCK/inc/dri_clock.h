@@ -0,0 +1,272 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Clock API Header
+* Filename:		dri_clock.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_clock.h
+ *  @brief:	This file contains API function declarations for monotonic
+ *  		system clock
+ */
+#ifndef DRI_CLOCK_H_
+#define DRI_CLOCK_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_clock_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for monotonic system clock
+ *
+ * 			SysTick interrupt counts ticks, DWT cycle counter gives core
+ * 			cycle resolution in between. Each tick extends 32 bit cycle
+ * 			counter into 64 bit and publishes it as base, now() adds
+ * 			cycles since base. 64 bit cycles at 120 MHz last for
+ * 			thousands of years.
+ *
+ * 			Bases are double buffered with a sequence count like POSIF__
+ * 			snapshots, now() is lock free and callable from any context.
+ * 			Tick may be delayed by masked interrupts for up to 2^32
+ * 			cycles without losing time.
+ *
+ * 			idle() stops ticking while nothing is due and sleeps until
+ * 			an interrupt. Tick count and cycles are corrected on wake,
+ * 			also when it sleeps with tick running.
+ *
+ ******************************************************************************/
+
+/* Check clock usage in system */
+#if( 1 == CLOCK_USED )
+
+class CLOCK__
+{
+/* public members */
+public:
+	/* Constructors */
+	CLOCK__() = delete;
+	CLOCK__( CLOCK__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for clock
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eClock_Init_	-	CLOCK_INIT_OPEN
+	 * 											CLOCK_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eClock_Status_
+	 *          	CLOCK_STATUS_SUCCESS:	Operation successful.<BR>
+	 *          	CLOCK_STATUS_FAILED:	Tick period does not fit SysTick.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function starts DWT cycle counter and SysTick at
+	 * 				CLOCK_TICK_RATE, time starts at 0
+	 *
+	 * <i>Imp Note:</i>
+	 * 				SystemCoreClock has to be final, it is taken as
+	 * 				cycles per second
+	 *
+	 */
+	static eClock_Status_ init( const eClock_Init_& init = eClock_Init_::CLOCK_INIT_OPEN );
+
+	/**
+	 * @function	now
+	 *
+	 * @brief		Core cycles since init
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	64 bit cycle timestamp, never decreases
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Copy of base is retried only if tick() published twice
+	 * 				meanwhile
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Callable from any context
+	 *
+	 */
+	static __RAM_FUNC unsigned long long now( void );
+
+	/**
+	 * @function	tick
+	 *
+	 * @brief		Publish new base, to be called from SysTick_Handler
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	ticks since previous call, this one and those credited
+	 * 				by idle() meanwhile, 0 before init
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called first in SysTick_Handler, so that other
+	 * 				tick functions see new time. Pass return value on to
+	 * 				them, so tick counted intervals hold across idle()
+	 *
+	 */
+	static __RAM_FUNC unsigned long tick( void );
+
+	/**
+	 * @function	idle
+	 *
+	 * @brief		Sleep until next interrupt, suppressing ticks
+	 *
+	 * @param[in]	fp_budget	-	returns ticks the caller can do without,
+	 * 								e.g. ticks to next deadline. Called with
+	 * 								interrupts masked, nullptr sleeps with
+	 * 								tick running
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	ticks credited without tick interrupt
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				SysTick is reprogrammed to expire after budget ticks,
+	 * 				limited to CLOCK_IDLE_MAX_TICKS and SysTick range, and
+	 * 				core sleeps with WFI. Any interrupt, e.g. UART receive,
+	 * 				wakes it at once. Ticks passed meanwhile are credited
+	 * 				and SysTick resumes in phase with them. Below
+	 * 				CLOCK_IDLE_MIN_TICKS core sleeps with tick running.
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from main loop only. Waking interrupt runs
+	 * 				after correction. Credited ticks are returned by next
+	 * 				tick(), work sampled once per tick still sees one call
+	 * 				for a run of suppressed ticks.
+	 *
+	 */
+	static unsigned long idle( const clock_budget_pointer fp_budget );
+
+	/**
+	 * @function	to_ns
+	 *
+	 * @brief		Convert cycles to nanoseconds
+	 *
+	 * @param[in]	cycles	-	cycles, e.g. now() or difference of two
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	nanoseconds, truncated
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Whole seconds and rest are scaled separately, so no
+	 * 				intermediate result overflows
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static unsigned long long to_ns( const unsigned long long cycles );
+
+	/* Same as to_ns() in microseconds and milliseconds */
+	static unsigned long long to_us( const unsigned long long cycles );
+	static unsigned long long to_ms( const unsigned long long cycles );
+
+	/**
+	 * @function	from_us
+	 *
+	 * @brief		Convert microseconds to cycles
+	 *
+	 * @param[in]	us	-	microseconds, e.g. a timeout
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	cycles, rounded up so that a timeout never expires early
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static unsigned long long from_us( const unsigned long long us );
+
+	/* Milliseconds to cycles, rounded up */
+	static unsigned long long from_ms( const unsigned long long ms );
+
+	/******* Setters and Getters *******/
+	static inline unsigned long long now_ns( void ){ return to_ns( now() ); }
+	static inline unsigned long long now_us( void ){ return to_us( now() ); }
+	/* Cycles passed since an earlier now() */
+	static inline unsigned long long elapsed( const unsigned long long start ){ return ( now() - start ); }
+	/* Timeout check, cycles e.g. from from_us() */
+	static inline bool is_expired( const unsigned long long start, const unsigned long long cycles )
+	{
+		return ( elapsed( start ) >= cycles );
+	}
+	/* Ticks since init, wraps */
+	static inline unsigned long get_ticks( void ){ return bases[sequence & 1U].ticks; }
+	/* Cycles per second */
+	static inline unsigned long get_frequency( void ){ return frequency; }
+
+/* private members */
+private:
+	/** Data Members **/
+	static tStClock_Base bases[2];
+	static volatile unsigned long sequence;
+	static unsigned long frequency;
+	static unsigned long period;
+	static unsigned long idle_limit;
+	static unsigned long ticks_handed;
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static __RAM_FUNC void publish( const unsigned long ticks, const unsigned long lost );
+};
+
+#endif	/* CLOCK_USED */
+
+
+#endif /* DRI_CLOCK_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,518 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Clock API Source
+* Filename:		dri_clock.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_clock.cpp
+ *  @brief:	This source file contains API function definitions for
+ *  		monotonic system clock.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_clock.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/* Check clock usage in system */
+#if( 1 == CLOCK_USED )
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Scale cycles by unit / frequency, truncated */
+static unsigned long long clock_scale_down( const unsigned long long cycles,
+											const unsigned long frequency,
+											const unsigned long unit );
+
+/* Scale value by frequency / unit, rounded up */
+static unsigned long long clock_scale_up( const unsigned long long value,
+											const unsigned long frequency,
+											const unsigned long unit );
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Declare static data member
+ *
+ * Note: Tell linker to take variable from this source file
+ * */
+tStClock_Base CLOCK__::bases[2];
+volatile unsigned long CLOCK__::sequence = 0;
+unsigned long CLOCK__::frequency = 0;
+unsigned long CLOCK__::period = 0;
+unsigned long CLOCK__::idle_limit = 0;
+unsigned long CLOCK__::ticks_handed = 0;
+unsigned char CLOCK__::init_state = 0;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/******* Public Member function for CLOCK__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for clock
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eClock_Status_ CLOCK__::init( const eClock_Init_& init )
+{
+	/* Local Variables */
+	eClock_Status_ ret_status = eClock_Status_::CLOCK_STATUS_FAILED;
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open clock */
+		case eClock_Init_::CLOCK_INIT_OPEN:
+			/* Check for initialization */
+			if( init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			frequency = SystemCoreClock;
+			period = frequency / CLOCK_TICK_RATE;
+
+			/* Cycle counter, trace block has to be enabled first */
+			CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+			DWT->CYCCNT = 0U;
+			DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+			bases[0] = tStClock_Base();
+			bases[1] = tStClock_Base();
+			sequence = 0U;
+			ticks_handed = 0U;
+
+			/* Tick interrupt at lowest priority */
+			if( 0U != SysTick_Config( period ) ){ break; }
+			else{	/* Not required */	}
+
+			/* Longest tickless sleep SysTick can count */
+			idle_limit = ( SysTick_LOAD_RELOAD_Msk + 1UL ) / period;
+
+			/* Keep system clock and peripherals running in sleep */
+			XMC_SCU_CLOCK_SetSleepConfig( (int32_t) CLOCK_SLEEP_CONFIG );
+
+			/* Set initialize state */
+			init_state = 1;
+			/* Update return status */
+			ret_status = eClock_Status_::CLOCK_STATUS_SUCCESS;
+			break;
+
+		/* Close clock */
+		case eClock_Init_::CLOCK_INIT_CLOSE:
+			SysTick->CTRL = 0U;
+
+			/* Reset control state */
+			init_state = 0;
+			/* Update return status */
+			ret_status = eClock_Status_::CLOCK_STATUS_SUCCESS;
+			break;
+
+		/* Default parameters, invalid argument */
+		default:
+			break;
+	}
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/**
+ * @function	now
+ *
+ * @brief		Core cycles since init
+ *
+ * \par<b>Description:</b><br>
+ * 				Cycle counter is read after base, so it is never behind
+ * 				it. Difference is taken modulo 2^32.
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned long long CLOCK__::now( void )
+{
+	/* Local Variables */
+	unsigned long sequence_l = 0;
+	unsigned long cyccnt_l = 0;
+	tStClock_Base base_l;
+
+	do
+	{
+		sequence_l = sequence;
+		__DMB();
+		base_l = bases[sequence_l & 1U];
+		__DMB();
+		cyccnt_l = DWT->CYCCNT;
+	}
+	while( 2U <= (sequence - sequence_l) );
+
+	return ( base_l.cycles + (unsigned long) (cyccnt_l - base_l.cyccnt) );
+}
+
+
+/**
+ * @function	tick
+ *
+ * @brief		Publish new base, to be called from SysTick_Handler
+ *
+ * \par<b>Description:</b><br>
+ * 				One tick passed, see publish(). Ticks handed out so far
+ * 				are only written here, idle() only adds to the base
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned long CLOCK__::tick( void )
+{
+	/* Local Variables */
+	unsigned long ticks_l = 0;
+
+	if( 0U != init_state )
+	{
+		publish( 1U, 0U );
+		ticks_l = get_ticks() - ticks_handed;
+		ticks_handed += ticks_l;
+	}
+	else{	/* Not required */	}
+
+	return ticks_l;
+}
+
+
+/**
+ * @function	idle
+ *
+ * @brief		Sleep until next interrupt, suppressing ticks
+ *
+ * \par<b>Description:</b><br>
+ * 				Budget is asked with interrupts masked, right before WFI,
+ * 				so work an interrupt queued before is not slept over.
+ * 				With SysTick stopped, current period is stretched to end
+ * 				on tick boundary of budget. After WFI counter tells how
+ * 				many boundaries passed, SysTick is restarted to end on
+ * 				next one and passed ticks are published. If stretched period expired, its interrupt is
+ * 				pending and counts last tick.
+ *
+ * 				Below CLOCK_IDLE_MIN_TICKS SysTick keeps running and
+ * 				its tick interrupt wakes core at the latest, so counter
+ * 				wraps at most once in sleep.
+ *
+ * <i>Imp Note:</i>
+ * 				Core clock stops in sleep and with it the cycle counter,
+ * 				cycles missed are taken from SysTick on both paths.
+ *
+ */
+unsigned long CLOCK__::idle( const clock_budget_pointer fp_budget )
+{
+	/* Local Variables */
+	unsigned long ticks_l = 0;
+	unsigned long reload_l = 0;
+	unsigned long start_l = 0;
+	unsigned long value_l = 0;
+	unsigned long remaining_l = 0;
+	unsigned long credited_l = 0;
+	unsigned long slept_l = 0;
+	unsigned long cyccnt_l = 0;
+	unsigned long lost_l = 0;
+
+	/* No time base to correct */
+	if( 0U == init_state )
+	{
+		XMC_SCU_POWER_WaitForInterrupt( XMC_SCU_POWER_MODE_SLEEP, false );
+		return 0U;
+	}
+	else{	/* Not required */	}
+
+	/* Interrupts stay masked, WFI still wakes on them */
+	const unsigned long primask_l = __get_PRIMASK();
+	__disable_irq();
+
+	/* Work queued by an interrupt up to here is seen by budget */
+	if( nullptr != fp_budget ){ ticks_l = fp_budget(); }
+	else{	/* Not required */	}
+
+	/* Not worth it, sleep with tick running */
+	if( ticks_l < CLOCK_IDLE_MIN_TICKS )
+	{
+		/* Reading clears count flag */
+		(void) SysTick->CTRL;
+		start_l = SysTick->VAL;
+		cyccnt_l = DWT->CYCCNT;
+
+		XMC_SCU_POWER_WaitForInterrupt( XMC_SCU_POWER_MODE_SLEEP, false );
+		__ISB();
+
+		const bool wrapped_l = ( 0U != (SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) );
+		value_l = SysTick->VAL;
+		/* Counter above start value has wrapped after flag was read */
+		slept_l = ( wrapped_l || (value_l > start_l) ) ? ( start_l + period - value_l ) : ( start_l - value_l );
+
+		cyccnt_l = DWT->CYCCNT - cyccnt_l;
+		lost_l = ( slept_l > cyccnt_l ) ? ( slept_l - cyccnt_l ) : 0U;
+
+		/* Tick interrupt, if due, publishes from here */
+		publish( 0U, lost_l );
+
+		__set_PRIMASK( primask_l );
+		return 0U;
+	}
+	else{	/* Not required */	}
+
+	if( ticks_l > CLOCK_IDLE_MAX_TICKS ){ ticks_l = CLOCK_IDLE_MAX_TICKS; }
+	else{	/* Not required */	}
+
+	if( ticks_l > idle_limit ){ ticks_l = idle_limit; }
+	else{	/* Not required */	}
+
+	/* Stop counter, tick due already */
+	SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk;
+	if( 0U != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) )
+	{
+		SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+		__set_PRIMASK( primask_l );
+		return 0U;
+	}
+	else{	/* Not required */	}
+
+	/* Rest of current period plus whole periods up to last tick */
+	reload_l = SysTick->VAL + ( (ticks_l - 1U) * period );
+	cyccnt_l = DWT->CYCCNT;
+
+	SysTick->LOAD = reload_l;
+	SysTick->VAL = 0U;
+	SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+
+	XMC_SCU_POWER_WaitForInterrupt( XMC_SCU_POWER_MODE_SLEEP, false );
+	__ISB();
+
+	SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk;
+	value_l = SysTick->VAL;
+
+	if( 0U != (SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) )
+	{	/* Expired, pending interrupt counts last tick */
+		credited_l = ticks_l - 1U;
+		value_l = reload_l - value_l;
+		remaining_l = ( value_l < period ) ? ( period - value_l ) : period;
+		slept_l = reload_l + 1U + value_l;
+	}
+	else
+	{	/* Woken early, boundaries still ahead are not credited */
+		credited_l = ( ticks_l - 1U ) - ( value_l / period );
+		remaining_l = value_l % period;
+		slept_l = reload_l - value_l;
+	}
+
+	/* Boundary too close to count down to, take it as passed */
+	if( remaining_l < 2U )
+	{
+		++credited_l;
+		remaining_l += period;
+	}
+	else{	/* Not required */	}
+
+	/* Restart on next tick boundary */
+	SysTick->LOAD = remaining_l - 1U;
+	SysTick->VAL = 0U;
+	SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+
+	cyccnt_l = DWT->CYCCNT - cyccnt_l;
+	lost_l = ( slept_l > cyccnt_l ) ? ( slept_l - cyccnt_l ) : 0U;
+
+	publish( credited_l, lost_l );
+
+	/* Counter has taken first reload, later ones run full periods */
+	SysTick->LOAD = period - 1U;
+
+	__set_PRIMASK( primask_l );
+
+	return credited_l;
+}
+
+
+/**
+ * @function	to_ns
+ *
+ * @brief		Convert cycles to nanoseconds
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned long long CLOCK__::to_ns( const unsigned long long cycles )
+{
+	return clock_scale_down( cycles, frequency, 1000000000UL );
+}
+
+
+/**
+ * @function	to_us
+ *
+ * @brief		Convert cycles to microseconds
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned long long CLOCK__::to_us( const unsigned long long cycles )
+{
+	return clock_scale_down( cycles, frequency, 1000000UL );
+}
+
+
+/**
+ * @function	to_ms
+ *
+ * @brief		Convert cycles to milliseconds
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned long long CLOCK__::to_ms( const unsigned long long cycles )
+{
+	return clock_scale_down( cycles, frequency, 1000UL );
+}
+
+
+/**
+ * @function	from_us
+ *
+ * @brief		Convert microseconds to cycles
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned long long CLOCK__::from_us( const unsigned long long us )
+{
+	return clock_scale_up( us, frequency, 1000000UL );
+}
+
+
+/**
+ * @function	from_ms
+ *
+ * @brief		Convert milliseconds to cycles
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned long long CLOCK__::from_ms( const unsigned long long ms )
+{
+	return clock_scale_up( ms, frequency, 1000UL );
+}
+
+
+/******* Private Member function for CLOCK__ class *******/
+
+/**
+ * @function	publish
+ *
+ * @brief		Publish new base advanced by ticks
+ *
+ * \par<b>Description:</b><br>
+ * 				Next base is written into buffer not published, sequence
+ * 				count publishes it
+ *
+ * <i>Imp Note:</i>
+ * 				lost adds cycles cycle counter did not see, e.g. in sleep
+ *
+ */
+void CLOCK__::publish( const unsigned long ticks, const unsigned long lost )
+{
+	/* Local Variables */
+	const unsigned long sequence_l = sequence;
+	const tStClock_Base& last = bases[sequence_l & 1U];
+	tStClock_Base& next = bases[(sequence_l + 1U) & 1U];
+	const unsigned long cyccnt_l = DWT->CYCCNT;
+
+	next.cycles = last.cycles + (unsigned long) (cyccnt_l - last.cyccnt) + lost;
+	next.cyccnt = cyccnt_l;
+	next.ticks = last.ticks + ticks;
+
+	__DMB();
+	sequence = sequence_l + 1U;
+}
+
+
+/******* Local functions *******/
+
+/**
+ * @function	clock_scale_down
+ *
+ * @brief		Scale cycles by unit / frequency, truncated
+ *
+ * <i>Imp Note:</i>
+ * 				Rest of a second times unit stays below 2^64 for
+ * 				frequency and unit below 2^32
+ *
+ */
+static unsigned long long clock_scale_down( const unsigned long long cycles,
+											const unsigned long frequency,
+											const unsigned long unit )
+{
+	/* Not initialized */
+	DRIVER_ASSERT( (0U == frequency), 0U );
+
+	return ( ((cycles / frequency) * unit) + (((cycles % frequency) * unit) / frequency) );
+}
+
+
+/**
+ * @function	clock_scale_up
+ *
+ * @brief		Scale value by frequency / unit, rounded up
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+static unsigned long long clock_scale_up( const unsigned long long value,
+											const unsigned long frequency,
+											const unsigned long unit )
+{
+	return ( ((value / unit) * frequency) + ((((value % unit) * frequency) + (unit - 1U)) / unit) );
+}
+
+#endif	/* CLOCK_USED */
+
+/********************************** End of File *******************************/
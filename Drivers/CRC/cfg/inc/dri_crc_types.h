@@ -0,0 +1,144 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		CRC data types Header
+* Filename:		dri_crc_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_crc_types.h
+ *  @brief:	This file contains data types definitions for CRC engine
+ */
+#ifndef DRI_CRC_TYPES_H_
+#define DRI_CRC_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_fce.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_crc_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Kernels of FCE, two 32 bit, one 16 bit and one 8 bit */
+#define CRC_MAX_KERNELS				4U
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of CRC engine
+ * */
+enum class eCRC_Status_/*	:	unsigned char	*/
+{
+	CRC_STATUS_SUCCESS = 0,
+	CRC_STATUS_FAILED,
+	CRC_STATUS_BUSY,
+	CRC_STATUS_INVALID_ARGUMENT
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eCRC_Init_/*	:	unsigned char	*/
+{
+	CRC_INIT_CLOSE = 0,
+	CRC_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for kernels, polynomial is fixed per kernel
+ * */
+enum class eCRC_Kernel_	:	unsigned char
+{
+	CRC_KERNEL_32_0 = 0,			/**< 0x04C11DB7, IEEE 802.3 */
+	CRC_KERNEL_32_1,				/**< 0x04C11DB7, IEEE 802.3 */
+	CRC_KERNEL_16,					/**< 0x1021, CCITT */
+	CRC_KERNEL_8					/**< 0x1D, SAE J1850 */
+};
+
+/*
+ * @brief	Enum for DMA feed end events
+ * */
+enum class eCRC_Event_/*	:	unsigned char	*/
+{
+	CRC_EVENT_DONE = 0,				/**< Block taken by kernel */
+	CRC_EVENT_ERROR					/**< DMA bus error, result invalid */
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for CRC engine
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	Structure for kernel configuration, described in dri_crc_conf.cpp
+ */
+typedef struct tStCRC_Config_
+{
+	unsigned long seed;						/**< Start value of CRC */
+	unsigned char reflect_in;				/**< Bits of input bytes LSB first */
+	unsigned char reflect_out;				/**< Result reflected */
+	unsigned char invert_out;				/**< Result inverted */
+} tStCRC_Config;
+
+/*
+ * @brief	typedef for DMA feed end callback, called in DMA interrupt
+ */
+typedef void (*crc_callback_pointer) ( const eCRC_Event_ event, const unsigned long result );
+
+/*
+ * @brief	Structure for state of DMA feed
+ */
+typedef struct tStCRC_DmaControl_
+{
+	unsigned long address = 0U;						/**< Source of next block */
+	unsigned long remaining = 0U;					/**< Units not yet armed */
+	crc_callback_pointer fp_callback = nullptr;		/**< End notification */
+	unsigned char kernel = 0U;						/**< Kernel fed */
+	volatile unsigned char busy = 0U;				/**< Feed running */
+} tStCRC_DmaControl;
+
+
+#endif /* DRI_CRC_TYPES_H_ */
+
+/********************************** End of File *******************************/
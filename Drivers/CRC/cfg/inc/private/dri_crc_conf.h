@@ -0,0 +1,90 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		CRC Configuration Header
+* Filename:		dri_crc_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_crc_conf.h
+ *  @brief:	This file contains static configurations for CRC engine
+ */
+#ifndef DRI_CRC_CONF_H_
+#define DRI_CRC_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* CRC engine, 0 - not used, 1 - used */
+#define CRC_USED					1
+
+/*
+ * 1 - FCE kernels, 0 - table driven software with same results, e.g.
+ * build on host
+ */
+#if defined(__arm__)
+	#define CRC_FCE_USED			1
+#else
+	#define CRC_FCE_USED			0
+#endif
+
+/* Blocks fed to FCE by DMA, needs FCE, 0 - not used */
+#define CRC_DMA_USED				CRC_FCE_USED
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* DMA channel feeding kernel input register, memory to memory transfer
+ * without request line */
+#define CRC_DMA						XMC_DMA0
+#define CRC_DMA_CHANNEL				5U
+
+/* Units per DMA block, longer feeds are re-armed in DMA interrupt */
+#define CRC_DMA_MAX_BLOCK			4095U
+
+/*
+ * Bytes per step of software engine, 8 - slice-by-8 with 8 tables of 1 KB
+ * per kernel, 1 - one table per kernel
+ */
+#define CRC_SOFTWARE_SLICES			8U
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_CRC_CONF_H_ */
+
+/********************************** End of File ******************************/
@@ -0,0 +1,85 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		CRC Configuration Source
+* Filename:		dri_crc_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_crc_conf.cpp
+ *  @brief:	This source file contains kernel configurations of CRC engine
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_crc.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check CRC engine usage in system */
+#if( 1 == CRC_USED )
+
+/*
+ * @brief	Kernel configurations, indexed by eCRC_Kernel_
+ */
+const tStCRC_Config g_crc_config[CRC_MAX_KERNELS] =
+{
+		{/**< Kernel 32_0, CRC-32 of IEEE 802.3 and zlib */
+				0xFFFFFFFFUL, 1U, 1U, 1U
+		},
+		{/**< Kernel 32_1, CRC-32/MPEG-2 for word streams fed by DMA */
+				0xFFFFFFFFUL, 0U, 0U, 0U
+		},
+		{/**< Kernel 16, CRC-16/CCITT-FALSE */
+				0xFFFFUL, 0U, 0U, 0U
+		},
+		{/**< Kernel 8, CRC-8/SAE-J1850 */
+				0xFFUL, 0U, 0U, 1U
+		}
+};
+
+#endif	/* CRC_USED */
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/*********************************** End of File ******************************/
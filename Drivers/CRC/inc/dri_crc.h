@@ -0,0 +1,269 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		CRC API Header
+* Filename:		dri_crc.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_crc.h
+ *  @brief:	This file contains API function declarations for CRC engine
+ *  		on FCE kernels
+ */
+#ifndef DRI_CRC_H_
+#define DRI_CRC_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_crc_types.h>
+#if( 1 == CRC_DMA_USED )
+#include <dri_dma.h>
+#endif
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+#if( 1 == CRC_USED )
+extern const tStCRC_Config g_crc_config[CRC_MAX_KERNELS];
+#endif
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for CRC engine
+ *
+ * 			Byte streams are written to FCE kernels a full input width at a
+ * 			time, a shorter tail is folded into CRC register in software.
+ * 			Without FCE the same CRCs are computed slice-by-8 from tables
+ * 			built in init().
+ *
+ ******************************************************************************/
+
+/* Check CRC engine usage in system */
+#if( 1 == CRC_USED )
+
+class CRC__
+{
+/* public members */
+public:
+	/* Constructors */
+	CRC__() = delete;
+	CRC__( CRC__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for CRC engine
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eCRC_Init_	-	CRC_INIT_OPEN
+	 * 										CRC_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eCRC_Status_
+	 *          	CRC_STATUS_SUCCESS:		Operation successful.<BR>
+	 *          	CRC_STATUS_FAILED:		Operation failed.<BR>
+	 *          	CRC_STATUS_BUSY:		DMA channel owned by other driver.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				All kernels are configured from g_crc_config and loaded
+	 * 				with their seed
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eCRC_Status_ init( const eCRC_Init_& init = eCRC_Init_::CRC_INIT_OPEN );
+
+	/**
+	 * @function	start
+	 *
+	 * @brief		Load seed into kernel
+	 *
+	 * @param[in]	kernel	-	kernel to restart
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eCRC_Status_
+	 *          	CRC_STATUS_SUCCESS:		Operation successful.<BR>
+	 *          	CRC_STATUS_FAILED:		Engine not initialized.<BR>
+	 *          	CRC_STATUS_BUSY:		Kernel fed by DMA.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 * 				A kernel is used from one context at a time
+	 *
+	 */
+	static eCRC_Status_ start( const eCRC_Kernel_ kernel );
+
+	/**
+	 * @function	update
+	 *
+	 * @brief		Add bytes to CRC of kernel
+	 *
+	 * @param[in]	kernel	-	kernel started by start()
+	 * 				p_data	-	bytes, any alignment
+	 * 				length	-	number of bytes
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eCRC_Status_
+	 *          	CRC_STATUS_SUCCESS:				Operation successful.<BR>
+	 *          	CRC_STATUS_FAILED:				Engine not initialized.<BR>
+	 *          	CRC_STATUS_BUSY:				Kernel fed by DMA.<BR>
+	 *          	CRC_STATUS_INVALID_ARGUMENT:	Null buffer.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Bytes are taken in memory order, a buffer may be split over
+	 * 				any number of calls
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eCRC_Status_ update( const eCRC_Kernel_ kernel, const unsigned char * p_data,
+								const unsigned long length );
+
+	/**
+	 * @function	get_result
+	 *
+	 * @brief		Read CRC of bytes added since start()
+	 *
+	 * @param[in]	kernel	-	kernel to read
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	CRC after output reflection and inversion
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Kernel keeps its state, more bytes can be added
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static unsigned long get_result( const eCRC_Kernel_ kernel );
+
+	/**
+	 * @function	compute
+	 *
+	 * @brief		CRC of one buffer
+	 *
+	 * @param[in]	kernel	-	kernel to use
+	 * 				p_data	-	bytes, any alignment
+	 * 				length	-	number of bytes
+	 *
+	 * @param[out]	result	-	CRC of buffer
+	 *
+	 * @return  	eCRC_Status_, same as update()
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Shorthand of start(), update() and get_result()
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eCRC_Status_ compute( const eCRC_Kernel_ kernel, const unsigned char * p_data,
+								const unsigned long length, unsigned long& result );
+
+#if( 1 == CRC_DMA_USED )
+	/**
+	 * @function	feed
+	 *
+	 * @brief		Add block to CRC of kernel by DMA
+	 *
+	 * @param[in]	kernel		-	kernel started by start()
+	 * 				p_units		-	units of kernel input width, aligned to it
+	 * 				count		-	number of units
+	 * 				fp_callback	-	end notification with result, may be nullptr
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eCRC_Status_
+	 *          	CRC_STATUS_SUCCESS:				Feed started.<BR>
+	 *          	CRC_STATUS_FAILED:				Engine not initialized.<BR>
+	 *          	CRC_STATUS_BUSY:				Previous feed running.<BR>
+	 *          	CRC_STATUS_INVALID_ARGUMENT:	Wrong buffer or count.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Units are 32, 16 or 8 bit as kernel input. A unit is taken
+	 * 				as value, MSB first, as in XMC_FCE_CalculateCRC32(). For
+	 * 				8 bit kernel this equals update(), for wider kernels bytes
+	 * 				of a unit are taken in reverse memory order
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Buffer has to stay valid until callback
+	 *
+	 */
+	static eCRC_Status_ feed( const eCRC_Kernel_ kernel, const void * const p_units,
+								const unsigned long count,
+								crc_callback_pointer fp_callback = nullptr );
+
+	/******* Setters and Getters *******/
+	static inline bool is_busy( void ){ return ( 0U != dma_control.busy ); }
+#endif	/* CRC_DMA_USED */
+
+/* private members */
+private:
+	/** Data Members **/
+#if( 1 != CRC_FCE_USED )
+	static unsigned long state[CRC_MAX_KERNELS];
+	static unsigned long tables[CRC_MAX_KERNELS][CRC_SOFTWARE_SLICES][256];
+	static unsigned char reflected[256];
+#endif
+#if( 1 == CRC_DMA_USED )
+	static tStCRC_DmaControl dma_control;
+#endif
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static unsigned long fold( const unsigned char kernel, unsigned long crc,
+								const unsigned char * p_data, unsigned long length );
+	static bool is_available( const unsigned char kernel );
+#if( 1 == CRC_DMA_USED )
+	static void dma_arm( void );
+	static void dma_event( XMC_DMA_CH_EVENT_t event );
+#endif
+};
+
+#endif	/* CRC_USED */
+
+
+#endif /* DRI_CRC_H_ */
+
+/********************************** End of File *******************************/
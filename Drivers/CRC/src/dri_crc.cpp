@@ -0,0 +1,724 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		CRC API Source
+* Filename:		dri_crc.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_crc.cpp
+ *  @brief:	This source file contains API function definitions for CRC
+ *  		engine on FCE kernels.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_crc.h>
+#include <string.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* DMA writes to FCE input register */
+#if( (1 == CRC_DMA_USED) && (1 != CRC_FCE_USED) )
+	#error	"CRC DMA feed needs FCE"
+#endif
+
+#if( (1U != CRC_SOFTWARE_SLICES) && (8U != CRC_SOFTWARE_SLICES) )
+	#error	"CRC software engine takes 1 or 8 bytes per step"
+#endif
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Polynomials of FCE kernels */
+#define CRC_POLYNOMIAL_32			0x04C11DB7UL
+#define CRC_POLYNOMIAL_16			0x1021UL
+#define CRC_POLYNOMIAL_8			0x1DUL
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Input width of kernel in bits */
+static inline unsigned char get_width( const unsigned char kernel )
+{
+	return ( kernel < 2U ) ? 32U : ( ( 2U == kernel ) ? 16U : 8U );
+}
+
+static inline unsigned long get_polynomial( const unsigned char kernel )
+{
+	return ( kernel < 2U ) ? CRC_POLYNOMIAL_32 : ( ( 2U == kernel ) ? CRC_POLYNOMIAL_16 : CRC_POLYNOMIAL_8 );
+}
+
+static inline unsigned long get_mask( const unsigned char width )
+{
+	return ( 32U == width ) ? 0xFFFFFFFFUL : ( ( 1UL << width ) - 1UL );
+}
+
+static inline unsigned char reflect_8( const unsigned char value )
+{
+	unsigned char result = 0U;
+	unsigned char bit = 0U;
+
+	for( bit = 0U; bit < 8U; ++bit )
+	{
+		result = static_cast<unsigned char>( ( result << 1U ) | ( ( value >> bit ) & 0x1U ) );
+	}
+
+	return result;
+}
+
+#if( 1 == CRC_FCE_USED )
+/* Registers of kernel */
+static inline FCE_KE_TypeDef * get_kernel( const unsigned char kernel )
+{
+	switch( kernel )
+	{
+		case 0U:	return XMC_FCE_CRC32_0;
+		case 1U:	return XMC_FCE_CRC32_1;
+		case 2U:	return XMC_FCE_CRC16;
+		default:	return XMC_FCE_CRC8;
+	}
+}
+#else
+static inline unsigned long reflect( const unsigned long value, const unsigned char width )
+{
+	unsigned long result = 0U;
+	unsigned char bit = 0U;
+
+	for( bit = 0U; bit < width; ++bit )
+	{
+		result = ( result << 1U ) | ( ( value >> bit ) & 0x1UL );
+	}
+
+	return result;
+}
+#endif
+
+
+/* Check CRC engine usage in system */
+#if( 1 == CRC_USED )
+
+/* Static members of CRC__ */
+#if( 1 != CRC_FCE_USED )
+unsigned long CRC__::state[CRC_MAX_KERNELS];
+unsigned long CRC__::tables[CRC_MAX_KERNELS][CRC_SOFTWARE_SLICES][256];
+unsigned char CRC__::reflected[256];
+#endif
+#if( 1 == CRC_DMA_USED )
+tStCRC_DmaControl CRC__::dma_control;
+#endif
+unsigned char CRC__::init_state = 0U;
+
+
+/******* Public Member function for CRC__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for CRC engine
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eCRC_Status_ CRC__::init( const eCRC_Init_& init )
+{
+	/* Local Variables */
+	eCRC_Status_ ret_status = eCRC_Status_::CRC_STATUS_FAILED;
+	unsigned char kernel = 0U;
+#if( 1 == CRC_FCE_USED )
+	XMC_FCE_t engine = {};
+#else
+	unsigned char width = 0U;
+	unsigned long crc = 0U;
+	unsigned short index_l = 0U;
+	unsigned char bit = 0U;
+	unsigned char slice = 0U;
+#endif
+#if( 1 == CRC_DMA_USED )
+	XMC_DMA_CH_CONFIG_t dma_cfg = {};
+	eDMA_Status_ dma_status_l;
+#endif
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open CRC engine */
+		case eCRC_Init_::CRC_INIT_OPEN:
+			/* Check for initialization */
+			if( init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+#if( 1 == CRC_DMA_USED )
+			/* Memory to kernel input register, width and addresses set per feed */
+			dma_cfg.enable_interrupt = 1U;
+			dma_cfg.dst_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_32;
+			dma_cfg.src_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_32;
+			dma_cfg.dst_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+			dma_cfg.src_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+			dma_cfg.dst_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+			dma_cfg.src_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+			dma_cfg.transfer_flow = (unsigned long) XMC_DMA_CH_TRANSFER_FLOW_M2M_DMA;
+			dma_cfg.dst_addr = (unsigned long) &( XMC_FCE_CRC32_0->IR );
+			dma_cfg.block_size = 1U;
+			dma_cfg.transfer_type = XMC_DMA_CH_TRANSFER_TYPE_SINGLE_BLOCK;
+			dma_cfg.priority = XMC_DMA_CH_PRIORITY_0;
+			dma_cfg.src_handshaking = XMC_DMA_CH_SRC_HANDSHAKING_SOFTWARE;
+			dma_cfg.dst_handshaking = XMC_DMA_CH_DST_HANDSHAKING_SOFTWARE;
+
+			dma_status_l = DMA__::channel_open( CRC_DMA, CRC_DMA_CHANNEL, dma_cfg,
+										( (unsigned long) XMC_DMA_CH_EVENT_TRANSFER_COMPLETE |
+										  (unsigned long) XMC_DMA_CH_EVENT_ERROR ),
+										dma_event );
+
+			if( eDMA_Status_::DMA_STATUS_BUSY == dma_status_l )
+			{
+				ret_status = eCRC_Status_::CRC_STATUS_BUSY;
+				break;
+			}
+			else if( eDMA_Status_::DMA_STATUS_SUCCESS != dma_status_l ){ break; }
+			else{	/* Not required */	}
+
+			dma_control = tStCRC_DmaControl();
+#endif
+
+#if( 1 == CRC_FCE_USED )
+			XMC_FCE_Enable();
+
+			/* Reflection, inversion and seed, CRC check and length reload off */
+			for( kernel = 0U; kernel < CRC_MAX_KERNELS; ++kernel )
+			{
+				engine.kernel_ptr = get_kernel( kernel );
+				engine.fce_cfg_update.regval = 0U;
+				engine.fce_cfg_update.config_refin = g_crc_config[kernel].reflect_in;
+				engine.fce_cfg_update.config_refout = g_crc_config[kernel].reflect_out;
+				engine.fce_cfg_update.config_xsel = g_crc_config[kernel].invert_out;
+				engine.seedvalue = g_crc_config[kernel].seed;
+				(void) XMC_FCE_Init( &engine );
+			}
+#else
+			for( index_l = 0U; index_l < 256U; ++index_l )
+			{
+				reflected[index_l] = reflect_8( static_cast<unsigned char>( index_l ) );
+			}
+
+			/*
+			 * Tables of CRC register left aligned in 32 bits, MSB first as
+			 * in FCE. Slice n is a byte followed by n zero bytes.
+			 */
+			for( kernel = 0U; kernel < CRC_MAX_KERNELS; ++kernel )
+			{
+				width = get_width( kernel );
+				for( index_l = 0U; index_l < 256U; ++index_l )
+				{
+					crc = (unsigned long) index_l << 24U;
+					for( bit = 0U; bit < 8U; ++bit )
+					{
+						crc = ( 0U != ( crc & 0x80000000UL ) ) ?
+								( ( crc << 1U ) ^ ( get_polynomial( kernel ) << ( 32U - width ) ) ) : ( crc << 1U );
+					}
+					tables[kernel][0][index_l] = crc & 0xFFFFFFFFUL;
+				}
+				for( slice = 1U; slice < CRC_SOFTWARE_SLICES; ++slice )
+				{
+					for( index_l = 0U; index_l < 256U; ++index_l )
+					{
+						crc = tables[kernel][slice - 1U][index_l];
+						tables[kernel][slice][index_l] = ( ( crc << 8U ) & 0xFFFFFFFFUL ) ^ tables[kernel][0][crc >> 24U];
+					}
+				}
+				state[kernel] = g_crc_config[kernel].seed & get_mask( width );
+			}
+#endif
+
+			/* Set initialize state */
+			init_state = 1U;
+			/* Update return status */
+			ret_status = eCRC_Status_::CRC_STATUS_SUCCESS;
+			break;
+
+		/* Close CRC engine */
+		case eCRC_Init_::CRC_INIT_CLOSE:
+			if( init_state > 0 )
+			{
+#if( 1 == CRC_DMA_USED )
+				XMC_DMA_CH_Disable( CRC_DMA, CRC_DMA_CHANNEL );
+				dma_control.busy = 0U;
+				(void) DMA__::channel_close( CRC_DMA, CRC_DMA_CHANNEL );
+#endif
+#if( 1 == CRC_FCE_USED )
+				XMC_FCE_Disable();
+#endif
+			}
+			else{	/* Not required */	}
+
+			/* Reset initialization state */
+			init_state = 0U;
+			/* Update return status */
+			ret_status = eCRC_Status_::CRC_STATUS_SUCCESS;
+			break;
+
+		/* Default parameters, invalid argument */
+		default:
+			ret_status = eCRC_Status_::CRC_STATUS_INVALID_ARGUMENT;
+			break;
+	}
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/**
+ * @function	start
+ *
+ * @brief		Load seed into kernel
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eCRC_Status_ CRC__::start( const eCRC_Kernel_ kernel )
+{
+	/* Local Variables */
+	const unsigned char kernel_l = static_cast<unsigned char>( kernel );
+
+	/* Check engine state and input arguments */
+	DRIVER_ASSERT( (0U == init_state), eCRC_Status_::CRC_STATUS_FAILED );
+	DRIVER_ASSERT( (CRC_MAX_KERNELS <= kernel_l), eCRC_Status_::CRC_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (false == is_available( kernel_l )), eCRC_Status_::CRC_STATUS_BUSY );
+
+#if( 1 == CRC_FCE_USED )
+	get_kernel( kernel_l )->CRC = g_crc_config[kernel_l].seed;
+#else
+	state[kernel_l] = g_crc_config[kernel_l].seed & get_mask( get_width( kernel_l ) );
+#endif
+
+	/* Return status */
+	return eCRC_Status_::CRC_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	update
+ *
+ * @brief		Add bytes to CRC of kernel
+ *
+ * <i>Imp Note:</i>
+ * 				FCE takes the first byte of an input word from its MSB
+ *
+ */
+eCRC_Status_ CRC__::update( const eCRC_Kernel_ kernel, const unsigned char * p_data,
+							const unsigned long length )
+{
+	/* Local Variables */
+	const unsigned char kernel_l = static_cast<unsigned char>( kernel );
+	unsigned long length_l = length;
+#if( 1 == CRC_FCE_USED )
+	FCE_KE_TypeDef * const p_kernel = get_kernel( kernel_l );
+	unsigned long word = 0U;
+#endif
+
+	/* Check engine state and input arguments */
+	DRIVER_ASSERT( (0U == init_state), eCRC_Status_::CRC_STATUS_FAILED );
+	DRIVER_ASSERT( (CRC_MAX_KERNELS <= kernel_l), eCRC_Status_::CRC_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( ((nullptr == p_data) && (0U != length)), eCRC_Status_::CRC_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (false == is_available( kernel_l )), eCRC_Status_::CRC_STATUS_BUSY );
+
+#if( 1 == CRC_FCE_USED )
+	/* Full input words to kernel */
+	switch( get_width( kernel_l ) )
+	{
+		case 32U:
+			while( length_l >= 4U )
+			{
+				memcpy( &word, p_data, 4U );
+				p_kernel->IR = __REV( word );
+				p_data += 4U;
+				length_l -= 4U;
+			}
+			break;
+
+		case 16U:
+			while( length_l >= 2U )
+			{
+				p_kernel->IR = ( (unsigned long)p_data[0] << 8U ) | (unsigned long)p_data[1];
+				p_data += 2U;
+				length_l -= 2U;
+			}
+			break;
+
+		default:
+			while( length_l > 0U )
+			{
+				p_kernel->IR = *p_data;
+				p_data += 1U;
+				length_l -= 1U;
+			}
+			break;
+	}
+
+	/* Bytes short of a word continue from CRC register */
+	if( length_l > 0U )
+	{
+		p_kernel->CRC = fold( kernel_l, p_kernel->CRC, p_data, length_l );
+	}
+	else{	/* Not required */	}
+#else
+	state[kernel_l] = fold( kernel_l, state[kernel_l], p_data, length_l );
+#endif
+
+	/* Return status */
+	return eCRC_Status_::CRC_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	get_result
+ *
+ * @brief		Read CRC of bytes added since start()
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned long CRC__::get_result( const eCRC_Kernel_ kernel )
+{
+	/* Local Variables */
+	const unsigned char kernel_l = static_cast<unsigned char>( kernel );
+#if( 1 != CRC_FCE_USED )
+	unsigned long result = 0U;
+	unsigned char width = 0U;
+#endif
+
+	if( (0U == init_state) || (CRC_MAX_KERNELS <= kernel_l) ){ return 0U; }
+	else{	/* Not required */	}
+
+#if( 1 == CRC_FCE_USED )
+	return get_kernel( kernel_l )->RES;
+#else
+	width = get_width( kernel_l );
+	result = state[kernel_l];
+
+	if( 0U != g_crc_config[kernel_l].reflect_out )
+	{
+		result = reflect( result, width );
+	}
+	else{	/* Not required */	}
+
+	if( 0U != g_crc_config[kernel_l].invert_out )
+	{
+		result ^= get_mask( width );
+	}
+	else{	/* Not required */	}
+
+	return result;
+#endif
+}
+
+
+/**
+ * @function	compute
+ *
+ * @brief		CRC of one buffer
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eCRC_Status_ CRC__::compute( const eCRC_Kernel_ kernel, const unsigned char * p_data,
+							const unsigned long length, unsigned long& result )
+{
+	/* Local Variables */
+	eCRC_Status_ ret_status = start( kernel );
+
+	if( eCRC_Status_::CRC_STATUS_SUCCESS == ret_status )
+	{
+		ret_status = update( kernel, p_data, length );
+	}
+	else{	/* Not required */	}
+
+	if( eCRC_Status_::CRC_STATUS_SUCCESS == ret_status )
+	{
+		result = get_result( kernel );
+	}
+	else{	/* Not required */	}
+
+	return ret_status;
+}
+
+
+#if( 1 == CRC_DMA_USED )
+/**
+ * @function	feed
+ *
+ * @brief		Add block to CRC of kernel by DMA
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eCRC_Status_ CRC__::feed( const eCRC_Kernel_ kernel, const void * const p_units,
+							const unsigned long count, crc_callback_pointer fp_callback )
+{
+	/* Local Variables */
+	const unsigned char kernel_l = static_cast<unsigned char>( kernel );
+	unsigned char width = 0U;
+
+	/* Check engine state and input arguments */
+	DRIVER_ASSERT( (0U == init_state), eCRC_Status_::CRC_STATUS_FAILED );
+	DRIVER_ASSERT( (CRC_MAX_KERNELS <= kernel_l), eCRC_Status_::CRC_STATUS_INVALID_ARGUMENT );
+	width = get_width( kernel_l );
+	DRIVER_ASSERT( ((nullptr == p_units) || (0U == count)), eCRC_Status_::CRC_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (0U != ( (unsigned long) p_units & ( ( width / 8U ) - 1U ) )),
+					eCRC_Status_::CRC_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (0U != dma_control.busy), eCRC_Status_::CRC_STATUS_BUSY );
+
+	dma_control.address = (unsigned long) p_units;
+	dma_control.remaining = count;
+	dma_control.kernel = kernel_l;
+	dma_control.fp_callback = fp_callback;
+	dma_control.busy = 1U;
+
+	/* One unit per kernel input write */
+	DMA__::set_transfer_width( CRC_DMA, CRC_DMA_CHANNEL,
+								( 32U == width ) ? XMC_DMA_CH_TRANSFER_WIDTH_32 :
+								( ( 16U == width ) ? XMC_DMA_CH_TRANSFER_WIDTH_16 : XMC_DMA_CH_TRANSFER_WIDTH_8 ) );
+	XMC_DMA_CH_SetDestinationAddress( CRC_DMA, CRC_DMA_CHANNEL,
+										(unsigned long) &( get_kernel( kernel_l )->IR ) );
+	dma_arm();
+
+	/* Return status */
+	return eCRC_Status_::CRC_STATUS_SUCCESS;
+}
+#endif	/* CRC_DMA_USED */
+
+
+/******* Private Member function for CRC__ class *******/
+
+/**
+ * @function	fold
+ *
+ * @brief		Add bytes to raw CRC in software
+ *
+ * \par<b>Description:</b><br>
+ * 				CRC is kept MSB first as in FCE CRC register, input
+ * 				reflection is applied per byte
+ *
+ * <i>Imp Note:</i>
+ * 				With FCE only bytes short of an input word come here and
+ * 				are shifted bit wise. Software engine works on CRC register
+ * 				left aligned in 32 bits, 8 bytes per step with 8 tables.
+ *
+ */
+unsigned long CRC__::fold( const unsigned char kernel, unsigned long crc,
+							const unsigned char * p_data, unsigned long length )
+{
+	/* Local Variables */
+	const unsigned char width = get_width( kernel );
+	const unsigned char reflect_in = g_crc_config[kernel].reflect_in;
+#if( 1 == CRC_FCE_USED )
+	const unsigned long mask = get_mask( width );
+	const unsigned long polynomial = get_polynomial( kernel );
+	const unsigned long top = 1UL << ( width - 1U );
+	unsigned char byte = 0U;
+	unsigned char bit = 0U;
+
+	while( length > 0U )
+	{
+		byte = ( 0U != reflect_in ) ? reflect_8( *p_data ) : *p_data;
+
+		crc ^= (unsigned long) byte << ( width - 8U );
+		for( bit = 0U; bit < 8U; ++bit )
+		{
+			crc = ( 0U != ( crc & top ) ) ? ( ( crc << 1U ) ^ polynomial ) : ( crc << 1U );
+		}
+		crc &= mask;
+
+		p_data += 1U;
+		length -= 1U;
+	}
+
+	return crc;
+#else
+	const unsigned long (* const p_table)[256] = tables[kernel];
+	const unsigned char * const p_bytes = reflected;
+	unsigned long crc_l = ( crc << ( 32U - width ) ) & 0xFFFFFFFFUL;
+	unsigned long word = 0U;
+
+	if( 0U != reflect_in )
+	{
+#if( 8U == CRC_SOFTWARE_SLICES )
+		while( length >= 8U )
+		{
+			word = crc_l ^ ( ( (unsigned long) p_bytes[p_data[0]] << 24U ) | ( (unsigned long) p_bytes[p_data[1]] << 16U ) |
+							( (unsigned long) p_bytes[p_data[2]] << 8U ) | (unsigned long) p_bytes[p_data[3]] );
+			crc_l = p_table[7][word >> 24U] ^ p_table[6][( word >> 16U ) & 0xFFU] ^
+					p_table[5][( word >> 8U ) & 0xFFU] ^ p_table[4][word & 0xFFU] ^
+					p_table[3][p_bytes[p_data[4]]] ^ p_table[2][p_bytes[p_data[5]]] ^
+					p_table[1][p_bytes[p_data[6]]] ^ p_table[0][p_bytes[p_data[7]]];
+			p_data += 8U;
+			length -= 8U;
+		}
+#endif
+		while( length > 0U )
+		{
+			crc_l = ( ( crc_l << 8U ) & 0xFFFFFFFFUL ) ^ p_table[0][( crc_l >> 24U ) ^ p_bytes[*p_data]];
+			p_data += 1U;
+			length -= 1U;
+		}
+	}
+	else
+	{
+#if( 8U == CRC_SOFTWARE_SLICES )
+		while( length >= 8U )
+		{
+			word = crc_l ^ ( ( (unsigned long) p_data[0] << 24U ) | ( (unsigned long) p_data[1] << 16U ) |
+							( (unsigned long) p_data[2] << 8U ) | (unsigned long) p_data[3] );
+			crc_l = p_table[7][word >> 24U] ^ p_table[6][( word >> 16U ) & 0xFFU] ^
+					p_table[5][( word >> 8U ) & 0xFFU] ^ p_table[4][word & 0xFFU] ^
+					p_table[3][p_data[4]] ^ p_table[2][p_data[5]] ^
+					p_table[1][p_data[6]] ^ p_table[0][p_data[7]];
+			p_data += 8U;
+			length -= 8U;
+		}
+#endif
+		while( length > 0U )
+		{
+			crc_l = ( ( crc_l << 8U ) & 0xFFFFFFFFUL ) ^ p_table[0][( crc_l >> 24U ) ^ *p_data];
+			p_data += 1U;
+			length -= 1U;
+		}
+	}
+
+	return crc_l >> ( 32U - width );
+#endif
+}
+
+
+/**
+ * @function	is_available
+ *
+ * @brief		Check kernel is not fed by DMA
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+bool CRC__::is_available( const unsigned char kernel )
+{
+#if( 1 == CRC_DMA_USED )
+	return ( (0U == dma_control.busy) || (kernel != dma_control.kernel) );
+#else
+	(void) kernel;
+	return true;
+#endif
+}
+
+
+#if( 1 == CRC_DMA_USED )
+/**
+ * @function	dma_arm
+ *
+ * @brief		Start next block of DMA feed
+ *
+ * <i>Imp Note:</i>
+ * 				Memory to memory transfer runs as soon as channel is enabled
+ *
+ */
+void CRC__::dma_arm( void )
+{
+	/* Local Variables */
+	const unsigned long block = ( dma_control.remaining > CRC_DMA_MAX_BLOCK ) ?
+								CRC_DMA_MAX_BLOCK : dma_control.remaining;
+
+	XMC_DMA_CH_SetSourceAddress( CRC_DMA, CRC_DMA_CHANNEL, dma_control.address );
+	XMC_DMA_CH_SetBlockSize( CRC_DMA, CRC_DMA_CHANNEL, block );
+
+	dma_control.address += block * ( get_width( dma_control.kernel ) / 8U );
+	dma_control.remaining -= block;
+
+	XMC_DMA_CH_Enable( CRC_DMA, CRC_DMA_CHANNEL );
+}
+
+
+/******* ISR entries for CRC__ class *******/
+
+/**
+ * @function	dma_event
+ *
+ * @brief		Handler function for CRC DMA channel events
+ *
+ * @param[in]	event	-	channel event from DMA module interrupt
+ *
+ * \par<b>Description:</b><br>
+ * 				Block done arms next block until feed is complete
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void CRC__::dma_event( XMC_DMA_CH_EVENT_t event )
+{
+	/* Local Variables */
+	eCRC_Event_ event_l = eCRC_Event_::CRC_EVENT_DONE;
+
+	/* Closed in between */
+	if( 0U == dma_control.busy ){ return; }
+	else{	/* Not required */	}
+
+	if( XMC_DMA_CH_EVENT_TRANSFER_COMPLETE == event )
+	{
+		if( dma_control.remaining > 0U )
+		{
+			dma_arm();
+			return;
+		}
+		else{	/* Not required */	}
+	}
+	else
+	{
+		XMC_DMA_CH_Disable( CRC_DMA, CRC_DMA_CHANNEL );
+		event_l = eCRC_Event_::CRC_EVENT_ERROR;
+	}
+
+	dma_control.busy = 0U;
+
+	if( nullptr != dma_control.fp_callback )
+	{
+		dma_control.fp_callback( event_l, get_kernel( dma_control.kernel )->RES );
+	}
+	else{	/* Not required */	}
+}
+#endif	/* CRC_DMA_USED */
+
+#endif	/* CRC_USED */
+
+/********************************** End of File *******************************/
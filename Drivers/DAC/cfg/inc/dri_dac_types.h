@@ -0,0 +1,140 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DAC data types Header
+* Filename:		dri_dac_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_dac_types.h
+ *  @brief:	This file contains data types definitions for DAC waveform
+ *  		generator
+ */
+#ifndef DRI_DAC_TYPES_H_
+#define DRI_DAC_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_dac.h>
+#include <xmc_ccu4.h>
+#include <xmc_gpio.h>
+#include <xmc_scu.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_dac_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* 12 bit unsigned sample range */
+#define DAC_FULL_SCALE				4095U
+#define DAC_MID_SCALE				2048U
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of DAC
+ * */
+enum class eDAC_Status_/*	:	unsigned char	*/
+{
+	DAC_STATUS_SUCCESS = 0,
+	DAC_STATUS_FAILED,
+	DAC_STATUS_BUSY,
+	DAC_STATUS_INVALID_ARGUMENT
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eDAC_Init_/*	:	unsigned char	*/
+{
+	DAC_INIT_CLOSE = 0,
+	DAC_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for waveforms of pattern generator
+ * */
+enum class eDAC_Pattern_/*	:	unsigned char	*/
+{
+	DAC_PATTERN_SINE = 0,
+	DAC_PATTERN_TRIANGLE,
+	DAC_PATTERN_RECTANGLE,
+	DAC_PATTERN_MAX
+};
+
+/*
+ * @brief	Enum for events of callback
+ * */
+enum class eDAC_Event_/*	:	unsigned char	*/
+{
+	DAC_EVENT_HALF = 0,				/**< Half of ring played, free to refill */
+	DAC_EVENT_ERROR					/**< DMA bus error, stream stopped */
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for DAC
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	Table of N samples, literal type so that it can be filled by
+ * 			constexpr function
+ */
+template< unsigned short N >
+struct tStDAC_Table
+{
+	unsigned short value[N];
+};
+
+/*
+ * @brief	Structure for statistics
+ */
+typedef struct tStDAC_Counters_
+{
+	unsigned long halves = 0U;				/**< Ring halves played */
+	unsigned long errors = 0U;				/**< DMA errors */
+} tStDAC_Counters;
+
+
+#endif /* DRI_DAC_TYPES_H_ */
+
+/********************************** End of File *******************************/
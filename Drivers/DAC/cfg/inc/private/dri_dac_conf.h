@@ -0,0 +1,108 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DAC Configuration Header
+* Filename:		dri_dac_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_dac_conf.h
+ *  @brief:	This file contains static configurations for DAC waveform
+ *  		generator
+ */
+#ifndef DRI_DAC_CONF_H_
+#define DRI_DAC_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* DAC used in system, 0 - not used */
+#define DAC_USED					1
+
+/* Callback function used in system */
+#define DAC_CALLBACK_HANDLER_USED	1
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Analog outputs, DAC channel n drives P14.(8 + n) */
+#define DAC_PORT					XMC_GPIO_PORT14
+#define DAC_PIN_BASE				8U
+
+/*
+ * Pattern channel, built in generator with internal trigger. Pattern swings
+ * +/- 31 steps around mid scale, scaled by DAC_PATTERN_SCALE.
+ */
+#define DAC_PATTERN_CHANNEL			1U
+#define DAC_PATTERN_SCALE			XMC_DAC_CH_OUTPUT_SCALE_MUL_64
+
+/* Stream channel, unsigned 12 bit samples in data mode */
+#define DAC_STREAM_CHANNEL			0U
+
+/* Pacing timer, period match on service request line triggers DAC data
+ * mode, see XMC_DAC_CH_TRIGGER_t. CCU40 CC40 - CC42 are taken by POSIF */
+#define DAC_TIMER_MODULE			CCU40
+#define DAC_TIMER_SLICE				CCU40_CC43
+#define DAC_TIMER_SLICE_NUM			3U
+#define DAC_TIMER_SR				XMC_CCU4_SLICE_SR_ID_1
+#define DAC_TIMER_TRIGGER			XMC_DAC_CH_TRIGGER_EXTERNAL_CCU40_SR1
+#define DAC_TIMER_PRESCALER			XMC_CCU4_SLICE_PRESCALER_1	/* fCCU4 ticks */
+
+/* DMA channel and request line of stream channel service request,
+ * see xmc_dma_map.h */
+#define DAC_DMA						XMC_DMA1
+#define DAC_DMA_CHANNEL				2U
+#define DAC_DMA_REQUEST				DMA1_PERIPHERAL_REQUEST_DAC_SR0_10
+
+/* Samples per ring, two DMA blocks of 4095 at most */
+#define DAC_MAX_SAMPLES				8190U
+
+/* Fastest stream sample rate, limited by DAC settling */
+#define DAC_MAX_RATE				2000000UL
+
+
+/* Check channel allocation */
+#if ( (DAC_PATTERN_CHANNEL == DAC_STREAM_CHANNEL) || (1U < DAC_PATTERN_CHANNEL) || (1U < DAC_STREAM_CHANNEL) )
+	#error	"DAC pattern and stream need one of the two channels each"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_DAC_CONF_H_ */
+
+/********************************** End of File ******************************/
@@ -0,0 +1,334 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DAC API Header
+* Filename:		dri_dac.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_dac.h
+ *  @brief:	This file contains API function declarations for DAC waveform
+ *  		generator
+ */
+#ifndef DRI_DAC_H_
+#define DRI_DAC_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_dac_types.h>
+#include <dri_dma.h>
+#include <dri_math.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+#if( 1 == DAC_USED )
+#if( 1 == DAC_CALLBACK_HANDLER_USED )
+/* Callback handler for user, called in DMA interrupt */
+extern void dac_callback_handler( const eDAC_Event_ event, const unsigned short offset );
+#endif
+#endif
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for DAC waveform generator
+ *
+ * 			Pattern channel runs built in sine, triangle or rectangle
+ * 			generator, no CPU or bus load once started.
+ *
+ * 			Stream channel plays a ring of samples in data mode. A timer
+ * 			triggers DAC, each trigger takes one sample out of DAC FIFO
+ * 			and DAC requests DMA to refill it. Output timing is set by
+ * 			timer alone, DMA and interrupt latency only have to stay
+ * 			within FIFO. DMA interrupt comes once per half ring.
+ *
+ * 			make_sine(), make_triangle() and make_sawtooth() build sample
+ * 			tables in constant expressions, tables land in flash.
+ *
+ ******************************************************************************/
+
+/* Check DAC usage in system */
+#if( 1 == DAC_USED )
+
+class DAC__
+{
+/* public members */
+public:
+	/* Constructors */
+	DAC__() = delete;
+	DAC__( DAC__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for DAC
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eDAC_Init_	-	DAC_INIT_OPEN
+	 * 										DAC_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eDAC_Status_
+	 *          	DAC_STATUS_SUCCESS:		Operation successful.<BR>
+	 *          	DAC_STATUS_FAILED:		Operation failed.<BR>
+	 *          	DAC_STATUS_BUSY:		DMA channel owned by other driver.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function sets up both channels, pacing timer and
+	 * 				DMA channel. Outputs are idle until started
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eDAC_Status_ init( const eDAC_Init_& init = eDAC_Init_::DAC_INIT_OPEN );
+
+	/**
+	 * @function	pattern_start
+	 *
+	 * @brief		Start pattern generator
+	 *
+	 * @param[in]	pattern		-	waveform
+	 * 				frequency	-	waveform frequency in Hz
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eDAC_Status_
+	 *          	DAC_STATUS_SUCCESS:				Pattern running.<BR>
+	 *          	DAC_STATUS_FAILED:				Not initialized.<BR>
+	 *          	DAC_STATUS_INVALID_ARGUMENT:	Wrong pattern or frequency.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				32 steps per period, running pattern is replaced
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eDAC_Status_ pattern_start( const eDAC_Pattern_ pattern, const unsigned long frequency );
+
+	/**
+	 * @function	pattern_stop
+	 *
+	 * @brief		Stop pattern generator
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Channel goes idle
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static void pattern_stop( void );
+
+	/**
+	 * @function	stream_start
+	 *
+	 * @brief		Start playing a ring of samples
+	 *
+	 * @param[in]	p_samples	-	12 bit samples, valid until stopped
+	 * 				count		-	samples in ring, even, 2 - DAC_MAX_SAMPLES
+	 * 				rate		-	samples per second
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eDAC_Status_
+	 *          	DAC_STATUS_SUCCESS:				Stream started.<BR>
+	 *          	DAC_STATUS_FAILED:				Not initialized.<BR>
+	 *          	DAC_STATUS_BUSY:				Stream running.<BR>
+	 *          	DAC_STATUS_INVALID_ARGUMENT:	Wrong ring or rate.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Ring repeats until stopped. After each half callback
+	 * 				gets offset of the half just played, it can be refilled
+	 * 				while DMA plays the other one. A table in flash simply
+	 * 				loops.
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Rate is rounded to whole timer ticks, see get_rate()
+	 *
+	 */
+	static eDAC_Status_ stream_start( const unsigned short * const p_samples,
+										const unsigned short count,
+										const unsigned long rate );
+
+	/**
+	 * @function	stream_stop
+	 *
+	 * @brief		Stop playing samples
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Output holds last sample, no callback
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static void stream_stop( void );
+
+	/**
+	 * @function	make_sine
+	 *
+	 * @brief		Build one sine period of N samples
+	 *
+	 * @param[in]	amplitude	-	peak deviation from offset
+	 * 				offset		-	center value
+	 *
+	 * @return  	table, clipped to 0 - DAC_FULL_SCALE
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Usable in constant expressions, e.g.
+	 * 				static constexpr tStDAC_Table<64> sine = DAC__::make_sine<64>();
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	template< unsigned short N >
+	static constexpr tStDAC_Table<N> make_sine( const unsigned short amplitude = DAC_FULL_SCALE / 2U,
+												const unsigned short offset = DAC_MID_SCALE )
+	{
+		tStDAC_Table<N> table{};
+
+		for( unsigned long index = 0U; index < N; ++index )
+		{
+			table.value[index] = clip( offset + round_scaled( sine_value(index, N), amplitude ) );
+		}
+
+		return table;
+	}
+
+	/* One triangle period of N samples, starts at minimum, same rules as make_sine() */
+	template< unsigned short N >
+	static constexpr tStDAC_Table<N> make_triangle( const unsigned short amplitude = DAC_FULL_SCALE / 2U,
+													const unsigned short offset = DAC_MID_SCALE )
+	{
+		tStDAC_Table<N> table{};
+
+		for( unsigned long index = 0U; index < N; ++index )
+		{
+			const double phase = (2.0 * index) / N;
+			const double value = ( phase < 1.0 ) ? ( (2.0 * phase) - 1.0 ) : ( 3.0 - (2.0 * phase) );
+
+			table.value[index] = clip( offset + round_scaled( value, amplitude ) );
+		}
+
+		return table;
+	}
+
+	/* One rising sawtooth period of N samples, same rules as make_sine() */
+	template< unsigned short N >
+	static constexpr tStDAC_Table<N> make_sawtooth( const unsigned short amplitude = DAC_FULL_SCALE / 2U,
+													const unsigned short offset = DAC_MID_SCALE )
+	{
+		tStDAC_Table<N> table{};
+
+		for( unsigned long index = 0U; index < N; ++index )
+		{
+			table.value[index] = clip( offset + round_scaled( ((2.0 * index) / N) - 1.0, amplitude ) );
+		}
+
+		return table;
+	}
+
+	/******* Setters and Getters *******/
+	static inline bool is_streaming( void ){ return ( 0U != running ); }
+	/* Sample rate of running stream after rounding to timer ticks */
+	static inline unsigned long get_rate( void ){ return rate_actual; }
+	/* Statistics */
+	static const tStDAC_Counters& get_counters( void ) { return counters; }
+
+/* private members */
+private:
+	/** Data Members **/
+	static const unsigned short * p_ring;
+	static tStDAC_Counters counters;
+	static unsigned long rate_actual;
+	static unsigned short half_count;
+	static volatile unsigned char half;
+	static volatile unsigned char running;
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static void timer_init( void );
+	static void finish( void );
+	static void dma_event( XMC_DMA_CH_EVENT_t event );
+
+	/******* Compile time table helpers *******/
+	/* sin(2 * pi * index / size), other quadrants by symmetry */
+	static constexpr double sine_value( const unsigned long index, const unsigned long size )
+	{
+		const double position = (4.0 * index) / size;
+		const unsigned long quadrant = static_cast<unsigned long>( position );
+		const double rest = position - quadrant;
+		const double value = ( 0U == (quadrant & 1U) ) ? Math__::sine_quadrant( rest ) : Math__::sine_quadrant( 1.0 - rest );
+
+		return ( (quadrant < 2U) ? value : -value );
+	}
+
+	/* Round to nearest, half away from zero */
+	static constexpr long round_scaled( const double value, const double scale )
+	{
+		return ( (value >= 0.0) ? static_cast<long>( (value * scale) + 0.5 ) :
+								-static_cast<long>( (-value * scale) + 0.5 ) );
+	}
+
+	static constexpr unsigned short clip( const long value )
+	{
+		return ( (value < 0) ? 0U :
+				 (value > static_cast<long>(DAC_FULL_SCALE)) ? static_cast<unsigned short>( DAC_FULL_SCALE ) :
+						 static_cast<unsigned short>( value ) );
+	}
+};
+
+#endif	/* DAC_USED */
+
+
+#endif /* DRI_DAC_H_ */
+
+/********************************** End of File *******************************/
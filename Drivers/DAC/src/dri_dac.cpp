@@ -0,0 +1,447 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DAC API Source
+* Filename:		dri_dac.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_dac.cpp
+ *  @brief:	This source file contains API function definitions for DAC
+ *  		waveform generator.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_dac.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* DLR line of DMA request */
+#define DAC_DMA_LINE			( DAC_DMA_REQUEST & 0x0FU )
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check DAC usage in system */
+#if( 1 == DAC_USED )
+
+/* First quarter of each pattern, rest follows by symmetry in hardware */
+static constexpr unsigned char sg_dac_patterns[static_cast<unsigned char>(eDAC_Pattern_::DAC_PATTERN_MAX)][9] =
+{
+		XMC_DAC_PATTERN_SINE,
+		XMC_DAC_PATTERN_TRIANGLE,
+		XMC_DAC_PATTERN_RECTANGLE
+};
+
+/* Declare static data member
+ *
+ * Note: Tell linker to take variable from this source file
+ * */
+const unsigned short * DAC__::p_ring = nullptr;
+tStDAC_Counters DAC__::counters;
+unsigned long DAC__::rate_actual = 0;
+unsigned short DAC__::half_count = 0;
+volatile unsigned char DAC__::half = 0;
+volatile unsigned char DAC__::running = 0;
+unsigned char DAC__::init_state = 0;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/******* Public Member function for DAC__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for DAC
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eDAC_Status_ DAC__::init( const eDAC_Init_& init )
+{
+	/* Local Variables */
+	eDAC_Status_ ret_status = eDAC_Status_::DAC_STATUS_FAILED;
+	XMC_DMA_CH_CONFIG_t dma_cfg = {};
+	XMC_DAC_CH_CONFIG_t stream_cfg = {};
+	XMC_DAC_CH_CONFIG_t pattern_cfg = {};
+	eDMA_Status_ dma_status_l;
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open DAC */
+		case eDAC_Init_::DAC_INIT_OPEN:
+			/* Check for initialization */
+			if( init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			/* Ring to stream channel data register, one 16 bit sample per DAC request */
+			dma_cfg.enable_interrupt = 1U;
+			dma_cfg.dst_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_16;
+			dma_cfg.src_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_16;
+			dma_cfg.dst_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+			dma_cfg.src_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+			dma_cfg.dst_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+			dma_cfg.src_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+			dma_cfg.transfer_flow = (unsigned long) XMC_DMA_CH_TRANSFER_FLOW_M2P_DMA;
+			dma_cfg.dst_addr = (unsigned long) &( XMC_DAC0->DACDATA[DAC_STREAM_CHANNEL] );
+			dma_cfg.block_size = 1U;
+			dma_cfg.transfer_type = XMC_DMA_CH_TRANSFER_TYPE_SINGLE_BLOCK;
+			dma_cfg.priority = XMC_DMA_CH_PRIORITY_7;
+			dma_cfg.src_handshaking = XMC_DMA_CH_SRC_HANDSHAKING_SOFTWARE;
+			dma_cfg.dst_handshaking = XMC_DMA_CH_DST_HANDSHAKING_HARDWARE;
+			dma_cfg.dst_peripheral_request = DAC_DMA_REQUEST;
+
+			dma_status_l = DMA__::channel_open( DAC_DMA, DAC_DMA_CHANNEL, dma_cfg,
+										( (unsigned long) XMC_DMA_CH_EVENT_TRANSFER_COMPLETE |
+										  (unsigned long) XMC_DMA_CH_EVENT_ERROR ),
+										dma_event );
+
+			/* Leave DAC and timer untouched without DMA channel */
+			if( eDMA_Status_::DMA_STATUS_BUSY == dma_status_l )
+			{
+				ret_status = eDAC_Status_::DAC_STATUS_BUSY;
+				break;
+			}
+			else if( eDMA_Status_::DMA_STATUS_SUCCESS != dma_status_l ){ break; }
+			else{	/* Not required */	}
+
+			/* Analog outputs, digital input stage off */
+			XMC_GPIO_DisableDigitalInput( DAC_PORT, DAC_PIN_BASE + DAC_STREAM_CHANNEL );
+			XMC_GPIO_DisableDigitalInput( DAC_PORT, DAC_PIN_BASE + DAC_PATTERN_CHANNEL );
+
+			/* Module is released from reset by first channel init, channels stay idle */
+			stream_cfg.data_type = (unsigned long) XMC_DAC_CH_DATA_TYPE_UNSIGNED;
+			stream_cfg.output_negation = (unsigned long) XMC_DAC_CH_OUTPUT_NEGATION_DISABLED;
+			stream_cfg.output_scale = (unsigned long) XMC_DAC_CH_OUTPUT_SCALE_NONE;
+			stream_cfg.output_offset = 0U;
+			XMC_DAC_CH_Init( XMC_DAC0, DAC_STREAM_CHANNEL, &stream_cfg );
+
+			/* Signed pattern is centered on mid scale */
+			pattern_cfg.data_type = (unsigned long) XMC_DAC_CH_DATA_TYPE_SIGNED;
+			pattern_cfg.output_negation = (unsigned long) XMC_DAC_CH_OUTPUT_NEGATION_DISABLED;
+			pattern_cfg.output_scale = (unsigned long) DAC_PATTERN_SCALE;
+			pattern_cfg.output_offset = 0U;
+			XMC_DAC_CH_Init( XMC_DAC0, DAC_PATTERN_CHANNEL, &pattern_cfg );
+
+			/* Data mode service request -> DMA */
+			XMC_DAC_CH_EnableEvent( XMC_DAC0, DAC_STREAM_CHANNEL );
+
+			/* Pacing timer */
+			timer_init();
+
+			counters = {};
+
+			/* Set initialize state */
+			init_state = 1;
+			/* Update return status */
+			ret_status = eDAC_Status_::DAC_STATUS_SUCCESS;
+			break;
+
+		/* Close DAC */
+		case eDAC_Init_::DAC_INIT_CLOSE:
+			stream_stop();
+			pattern_stop();
+
+			if( init_state > 0 )
+			{
+				XMC_CCU4_SLICE_DisableEvent( DAC_TIMER_SLICE, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH );
+				XMC_CCU4_DisableClock( DAC_TIMER_MODULE, DAC_TIMER_SLICE_NUM );
+				XMC_DAC_CH_DisableEvent( XMC_DAC0, DAC_STREAM_CHANNEL );
+				XMC_DAC_CH_SetMode( XMC_DAC0, DAC_STREAM_CHANNEL, XMC_DAC_CH_MODE_IDLE );
+				XMC_DAC_Disable( XMC_DAC0 );
+				XMC_DMA_DisableRequestLine( DAC_DMA, DAC_DMA_LINE );
+				(void) DMA__::channel_close( DAC_DMA, DAC_DMA_CHANNEL );
+			}
+			else{	/* Not required */	}
+
+			/* Reset control state */
+			init_state = 0;
+			/* Update return status */
+			ret_status = eDAC_Status_::DAC_STATUS_SUCCESS;
+			break;
+
+		/* Default parameters, invalid argument */
+		default:
+			ret_status = eDAC_Status_::DAC_STATUS_INVALID_ARGUMENT;
+			break;
+	}
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/**
+ * @function	pattern_start
+ *
+ * @brief		Start pattern generator
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eDAC_Status_ DAC__::pattern_start( const eDAC_Pattern_ pattern, const unsigned long frequency )
+{
+	/* Check DAC state and input arguments */
+	DRIVER_ASSERT( (0 == init_state), eDAC_Status_::DAC_STATUS_FAILED );
+	DRIVER_ASSERT( (eDAC_Pattern_::DAC_PATTERN_MAX <= pattern), eDAC_Status_::DAC_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (0U == frequency), eDAC_Status_::DAC_STATUS_INVALID_ARGUMENT );
+
+	/* Divider of peripheral clock is checked by XMCLib */
+	if( XMC_DAC_CH_STATUS_OK != XMC_DAC_CH_StartPatternMode( XMC_DAC0, DAC_PATTERN_CHANNEL,
+										sg_dac_patterns[static_cast<unsigned char>(pattern)],
+										XMC_DAC_CH_PATTERN_SIGN_OUTPUT_DISABLED,
+										XMC_DAC_CH_TRIGGER_INTERNAL, frequency ) )
+	{
+		return eDAC_Status_::DAC_STATUS_INVALID_ARGUMENT;
+	}
+	else{	/* Not required */	}
+
+	/* Return status */
+	return eDAC_Status_::DAC_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	pattern_stop
+ *
+ * @brief		Stop pattern generator
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void DAC__::pattern_stop( void )
+{
+	if( init_state > 0 )
+	{
+		XMC_DAC_CH_SetMode( XMC_DAC0, DAC_PATTERN_CHANNEL, XMC_DAC_CH_MODE_IDLE );
+	}
+	else{	/* Not required */	}
+}
+
+
+/**
+ * @function	stream_start
+ *
+ * @brief		Start playing a ring of samples
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eDAC_Status_ DAC__::stream_start( const unsigned short * const p_samples,
+									const unsigned short count,
+									const unsigned long rate )
+{
+	/* Local Variables */
+	const unsigned long clock_l = XMC_SCU_CLOCK_GetCcuClockFrequency() >> (unsigned long) DAC_TIMER_PRESCALER;
+	unsigned long ticks = 0;
+
+	/* Check DAC state and input arguments */
+	DRIVER_ASSERT( (0 == init_state), eDAC_Status_::DAC_STATUS_FAILED );
+	DRIVER_ASSERT( (nullptr == p_samples), eDAC_Status_::DAC_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (0U != ((unsigned long) p_samples & 0x1UL)), eDAC_Status_::DAC_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( ((2U > count) || (DAC_MAX_SAMPLES < count) || (0U != (count & 1U))),
+					eDAC_Status_::DAC_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( ((0U == rate) || (DAC_MAX_RATE < rate)), eDAC_Status_::DAC_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (0U != running), eDAC_Status_::DAC_STATUS_BUSY );
+
+	/* Timer period has 16 bit */
+	ticks = (clock_l + (rate >> 1)) / rate;
+	DRIVER_ASSERT( ((0U == ticks) || (0x10000UL < ticks)), eDAC_Status_::DAC_STATUS_INVALID_ARGUMENT );
+
+	p_ring = p_samples;
+	half_count = static_cast<unsigned short>( count >> 1 );
+	half = 0U;
+	rate_actual = clock_l / ticks;
+	running = 1U;
+
+	/* Arm channel on first half, it waits for DAC request */
+	XMC_DMA_ClearRequestLine( DAC_DMA, DAC_DMA_LINE );
+	XMC_DMA_CH_SetSourceAddress( DAC_DMA, DAC_DMA_CHANNEL, (unsigned long) p_samples );
+	XMC_DMA_CH_SetBlockSize( DAC_DMA, DAC_DMA_CHANNEL, half_count );
+	XMC_DMA_CH_Enable( DAC_DMA, DAC_DMA_CHANNEL );
+
+	/* Each trigger takes one sample from FIFO and requests next one */
+	(void) XMC_DAC_CH_StartDataMode( XMC_DAC0, DAC_STREAM_CHANNEL, DAC_TIMER_TRIGGER, 0U );
+
+	/* Timer is stopped, period is taken over at once */
+	XMC_CCU4_SLICE_SetTimerPeriodMatch( DAC_TIMER_SLICE, static_cast<unsigned short>( ticks - 1U ) );
+	XMC_CCU4_EnableShadowTransfer( DAC_TIMER_MODULE,
+			( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_SLICE_0 << (4U * DAC_TIMER_SLICE_NUM) )
+			);
+	XMC_CCU4_SLICE_StartTimer( DAC_TIMER_SLICE );
+
+	/* Return status */
+	return eDAC_Status_::DAC_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	stream_stop
+ *
+ * @brief		Stop playing samples
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void DAC__::stream_stop( void )
+{
+	/* Local Variables */
+	const unsigned long primask_l = __get_PRIMASK();
+
+	/* DMA interrupt must not re-arm channel in between */
+	__disable_irq();
+	if( (init_state > 0) && (0U != running) )
+	{
+		finish();
+	}
+	else{	/* Not required */	}
+	__set_PRIMASK( primask_l );
+}
+
+
+/******* Private Member function for DAC__ class *******/
+
+/**
+ * @function	timer_init
+ *
+ * @brief		Configure pacing timer slice
+ *
+ * \par<b>Description:</b><br>
+ * 				Edge aligned up counter, period match raises service
+ * 				request line routed to DAC trigger input
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void DAC__::timer_init( void )
+{
+	/* Local Variables */
+	XMC_CCU4_SLICE_COMPARE_CONFIG_t slice_cfg = {};
+
+	/* Enable module and prescaler, does not disturb other slices */
+	XMC_CCU4_Init( DAC_TIMER_MODULE, XMC_CCU4_SLICE_MCMS_ACTION_TRANSFER_PR_CR );
+
+	slice_cfg.timer_mode = (unsigned long) XMC_CCU4_SLICE_TIMER_COUNT_MODE_EA;
+	slice_cfg.monoshot = (unsigned long) XMC_CCU4_SLICE_TIMER_REPEAT_MODE_REPEAT;
+	slice_cfg.prescaler_initval = (unsigned long) DAC_TIMER_PRESCALER;
+	XMC_CCU4_SLICE_CompareInit( DAC_TIMER_SLICE, &slice_cfg );
+
+	/* Period match -> service request -> DAC trigger */
+	XMC_CCU4_SLICE_SetInterruptNode( DAC_TIMER_SLICE, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH, DAC_TIMER_SR );
+	XMC_CCU4_SLICE_EnableEvent( DAC_TIMER_SLICE, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH );
+
+	XMC_CCU4_EnableClock( DAC_TIMER_MODULE, DAC_TIMER_SLICE_NUM );
+}
+
+
+/**
+ * @function	finish
+ *
+ * @brief		Stop timer and channel, mark stream idle
+ *
+ * <i>Imp Note:</i>
+ * 				Called with interrupts masked or from DMA interrupt.
+ * 				Without triggers DAC holds last sample
+ *
+ */
+void DAC__::finish( void )
+{
+	XMC_CCU4_SLICE_StopClearTimer( DAC_TIMER_SLICE );
+	XMC_DMA_CH_Disable( DAC_DMA, DAC_DMA_CHANNEL );
+	/* Drop request of DAC that raced with stop */
+	XMC_DMA_ClearRequestLine( DAC_DMA, DAC_DMA_LINE );
+	running = 0U;
+}
+
+
+/******* ISR entries for DAC__ class *******/
+
+/**
+ * @function	dma_event
+ *
+ * @brief		Handler function for stream DMA channel events
+ *
+ * @param[in]	event	-	channel event from DMA module interrupt
+ *
+ * \par<b>Description:</b><br>
+ * 				Half done re-arms channel on other half before callback,
+ * 				samples in DAC FIFO bridge the re-arm
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void DAC__::dma_event( XMC_DMA_CH_EVENT_t event )
+{
+	/* Local Variables */
+	const unsigned char played_l = half;
+	const unsigned char next_l = static_cast<unsigned char>( 1U - played_l );
+
+	/* Stopped in between by user */
+	if( 0U == running ){ return; }
+	else{	/* Not required */	}
+
+	if( XMC_DMA_CH_EVENT_TRANSFER_COMPLETE == event )
+	{
+		XMC_DMA_CH_SetSourceAddress( DAC_DMA, DAC_DMA_CHANNEL,
+									(unsigned long) &( p_ring[next_l * half_count] ) );
+		XMC_DMA_CH_SetBlockSize( DAC_DMA, DAC_DMA_CHANNEL, half_count );
+		XMC_DMA_CH_Enable( DAC_DMA, DAC_DMA_CHANNEL );
+		half = next_l;
+		counters.halves = counters.halves + 1U;
+
+#if( 1 == DAC_CALLBACK_HANDLER_USED )
+		dac_callback_handler( eDAC_Event_::DAC_EVENT_HALF, static_cast<unsigned short>( played_l * half_count ) );
+#endif
+	}
+	else
+	{
+		finish();
+		counters.errors = counters.errors + 1U;
+
+#if( 1 == DAC_CALLBACK_HANDLER_USED )
+		dac_callback_handler( eDAC_Event_::DAC_EVENT_ERROR, 0U );
+#endif
+	}
+}
+
+#endif	/* DAC_USED */
+
+/********************************** End of File *******************************/
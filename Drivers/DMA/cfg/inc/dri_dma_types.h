@@ -0,0 +1,77 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DMA data types Header
+* Filename:		dri_dma_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_dma_types.h
+ *  @brief:	This file contains data types definitions for GPDMA modules
+ */
+#ifndef DRI_DMA_TYPES_H_
+#define DRI_DMA_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_dma.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_dma_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of DMA module
+ * */
+enum class eDMA_Status_/*	:	unsigned char	*/
+{
+	DMA_STATUS_SUCCESS = 0,
+	DMA_STATUS_FAILED,
+	DMA_STATUS_BUSY,
+	DMA_STATUS_INVALID_ARGUMENT
+};
+
+
+#endif /* DRI_DMA_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,102 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DMA Configuration Header
+* Filename:		dri_dma_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_dma_conf.h
+ *  @brief:	This file contains static configurations for GPDMA modules
+ *  		shared by peripheral drivers
+ */
+#ifndef DRI_DMA_CONF_H_
+#define DRI_DMA_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* GPDMA modules used in system */
+#define DMA_0_USED
+#define DMA_1_USED
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+#define DMA_MAX_MODULES			2
+#define DMA_0_MAX_CHANNELS		8
+#define DMA_1_MAX_CHANNELS		4
+
+/* One NVIC node per module, shared by all channels of module */
+#define DMA_0_IRQ_PRIORITY		16
+#define DMA_1_IRQ_PRIORITY		16
+
+/* TODO: <i>Imp Note:</>
+ * 			Channel allocation of drivers, a channel is claimed at run time
+ * 			and a second claim of same channel fails.
+ * 			Only GPDMA0 CH0 and CH1 support multi block (linked list)
+ * 			transfers, remaining channels are single block only.
+ *
+ * 			GPDMA0 CH0	-	ADC sample blocks, DLR line 5 (VADC G0SR0)
+ * 			GPDMA0 CH1	-	DSD sample blocks, DLR line 0 (DSD SRM0)
+ * 			GPDMA0 CH2	-	SPI channel 3 receive, DLR line 2 (USIC1 SR1)
+ * 			GPDMA0 CH3	-	SPI channel 3 transmit, DLR line 1 (USIC1 SR0)
+ * 			GPDMA0 CH4	-	GPIO waveform engine, DLR line 4 (CCU43 SR0)
+ * 			GPDMA0 CH5	-	CRC engine, memory to FCE, no DLR line
+ * 			GPDMA0 CH6	-	Input capture, DLR line 3 (CCU42 SR1)
+ * 			GPDMA0 CH7	-	free
+ *
+ * 			GPDMA1 CH0	-	free
+ * 			GPDMA1 CH1	-	free
+ * 			GPDMA1 CH2	-	DAC streaming, DLR line 10 (DAC SR0)
+ * 			GPDMA1 CH3	-	free
+ */
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Defining functions for DMA ISR handlers */
+#ifdef DMA_0_USED
+#define DMA_0_HANDLER			IRQ_Hdlr_105	/* GPDMA0_0 */
+#endif
+
+#ifdef DMA_1_USED
+#define DMA_1_HANDLER			IRQ_Hdlr_110	/* GPDMA1_0 */
+#endif
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_DMA_CONF_H_ */
+
+/********************************** End of File ******************************/
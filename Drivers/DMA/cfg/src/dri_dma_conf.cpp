@@ -0,0 +1,102 @@
+/*****************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DMA Configuration Source
+* Filename:		dri_dma_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_dma_conf.cpp
+ *  @brief:	This source file contains ISR handlers of GPDMA modules
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_dma.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/******* ISR Handlers for DMA__ modules *******/
+
+extern "C"
+{
+
+#ifdef DMA_0_HANDLER
+/**
+ * @function	DMA_0_HANDLER
+ *
+ * @brief		GPDMA0 handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void DMA_0_HANDLER( void )
+{
+	/* Call ISR entry function */
+	DMA__::isr_entry( XMC_DMA0 );
+}
+#endif	/* DMA_0_HANDLER */
+
+
+#ifdef DMA_1_HANDLER
+/**
+ * @function	DMA_1_HANDLER
+ *
+ * @brief		GPDMA1 handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void DMA_1_HANDLER( void )
+{
+	/* Call ISR entry function */
+	DMA__::isr_entry( XMC_DMA1 );
+}
+#endif	/* DMA_1_HANDLER */
+
+
+}	/* extern "C"{ */
+
+/*********************************** End of File ******************************/
@@ -0,0 +1,229 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DMA API Header
+* Filename:		dri_dma.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_dma.h
+ *  @brief:	This file contains API function declarations for sharing
+ *  		GPDMA modules and channels between peripheral drivers
+ */
+#ifndef DRI_DMA_H_
+#define DRI_DMA_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_dma_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for GPDMA module and channel ownership
+ *
+ ******************************************************************************/
+class DMA__
+{
+/* public members */
+public:
+	/* Constructors */
+	DMA__() = delete;
+	DMA__( DMA__& ) = delete;
+
+	/**
+	 * @function	channel_open
+	 *
+	 * @brief		Claim and configure a DMA channel
+	 *
+	 * @param[in]	p_dma	-	XMC_DMA0 or XMC_DMA1
+	 * 				channel	-	channel of module
+	 * 				config	-	channel configuration
+	 * 				events	-	XMC_DMA_CH_EVENT_t mask routed to handler
+	 * 				handler	-	channel event handler, may be nullptr
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eDMA_Status_
+	 *          	DMA_STATUS_SUCCESS:				Operation successful.<BR>
+	 *          	DMA_STATUS_FAILED:				Channel configuration failed.<BR>
+	 *          	DMA_STATUS_BUSY:				Channel owned by other driver.<BR>
+	 *          	DMA_STATUS_INVALID_ARGUMENT:	Wrong module or channel.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Module and its NVIC node are enabled with first claimed
+	 * 				channel. Channel is left disabled, owner starts it with
+	 * 				XMC_DMA_CH_Enable()
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Handler runs in DMA interrupt of module, all channels of
+	 * 				a module share one priority
+	 *
+	 */
+	static eDMA_Status_ channel_open( XMC_DMA_t * const p_dma,
+										const unsigned char channel,
+										const XMC_DMA_CH_CONFIG_t& config,
+										const unsigned long events,
+										XMC_DMA_CH_EVENT_HANDLER_t handler );
+
+	/**
+	 * @function	channel_close
+	 *
+	 * @brief		Stop and release a DMA channel
+	 *
+	 * @param[in]	p_dma	-	XMC_DMA0 or XMC_DMA1
+	 * 				channel	-	channel of module
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eDMA_Status_
+	 *          	DMA_STATUS_SUCCESS:				Operation successful.<BR>
+	 *          	DMA_STATUS_INVALID_ARGUMENT:	Wrong module or channel.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Module is switched off with last released channel
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eDMA_Status_ channel_close( XMC_DMA_t * const p_dma,
+										const unsigned char channel );
+
+	/**
+	 * @function	set_address_mode
+	 *
+	 * @brief		Change address count modes of a disabled channel
+	 *
+	 * @param[in]	p_dma		-	XMC_DMA0 or XMC_DMA1
+	 * 				channel		-	channel of module
+	 * 				src_mode	-	source address count mode
+	 * 				dst_mode	-	destination address count mode
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Lets a driver switch between buffer and fixed dummy
+	 * 				location per transfer without full channel setup
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static inline void set_address_mode( XMC_DMA_t * const p_dma, const unsigned char channel,
+										const XMC_DMA_CH_ADDRESS_COUNT_MODE_t src_mode,
+										const XMC_DMA_CH_ADDRESS_COUNT_MODE_t dst_mode )
+	{
+		p_dma->CH[channel].CTLL = ( p_dma->CH[channel].CTLL &
+									~( GPDMA0_CH_CTLL_SINC_Msk | GPDMA0_CH_CTLL_DINC_Msk ) ) |
+									( (unsigned long) src_mode << GPDMA0_CH_CTLL_SINC_Pos ) |
+									( (unsigned long) dst_mode << GPDMA0_CH_CTLL_DINC_Pos );
+	}
+
+	/**
+	 * @function	set_transfer_width
+	 *
+	 * @brief		Change source and destination width of a disabled channel
+	 *
+	 * @param[in]	p_dma	-	XMC_DMA0 or XMC_DMA1
+	 * 				channel	-	channel of module
+	 * 				width	-	transfer width of both sides
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Lets a driver move units of different size per transfer
+	 * 				without full channel setup
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static inline void set_transfer_width( XMC_DMA_t * const p_dma, const unsigned char channel,
+											const XMC_DMA_CH_TRANSFER_WIDTH_t width )
+	{
+		p_dma->CH[channel].CTLL = ( p_dma->CH[channel].CTLL &
+									~( GPDMA0_CH_CTLL_SRC_TR_WIDTH_Msk | GPDMA0_CH_CTLL_DST_TR_WIDTH_Msk ) ) |
+									( (unsigned long) width << GPDMA0_CH_CTLL_SRC_TR_WIDTH_Pos ) |
+									( (unsigned long) width << GPDMA0_CH_CTLL_DST_TR_WIDTH_Pos );
+	}
+
+	/******* Setters and Getters *******/
+	/* Bit n set - channel n of module is claimed */
+	static unsigned char get_claimed( XMC_DMA_t * const p_dma );
+
+	/******* ISR entries *******/
+	/* Dispatch pending channel events of module */
+	static void isr_entry( XMC_DMA_t * const p_dma );
+
+/* private members */
+private:
+	/** Data Members **/
+	static unsigned char claimed[DMA_MAX_MODULES];
+
+	/******* Private Member Functions *******/
+
+	/* Module index, DMA_MAX_MODULES for unknown module */
+	static inline unsigned char get_index( const XMC_DMA_t * const p_dma )
+	{
+		unsigned char index = DMA_MAX_MODULES;
+
+		if( XMC_DMA0 == p_dma ){ index = 0U; }
+#if defined(GPDMA1)
+		else if( XMC_DMA1 == p_dma ){ index = 1U; }
+#endif
+		else{	/* Not required */	}
+
+		return index;
+	}
+
+	/* Number of channels of module */
+	static inline unsigned char get_channels( const unsigned char index )
+	{
+		return ( (0U == index) ? DMA_0_MAX_CHANNELS : DMA_1_MAX_CHANNELS );
+	}
+
+	static IRQn_Type get_irq( const unsigned char index );
+	static void module_open( XMC_DMA_t * const p_dma, const unsigned char index );
+};
+
+
+#endif /* DRI_DMA_H_ */
+
+/********************************** End of File *******************************/
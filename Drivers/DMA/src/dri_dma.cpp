@@ -0,0 +1,274 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DMA API Source
+* Filename:		dri_dma.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_dma.cpp
+ *  @brief:	This source file contains API function definitions for
+ *  		sharing GPDMA modules and channels.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_dma.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Declare static data member
+ *
+ * Note: Tell linker to take variable from this source file
+ * */
+unsigned char DMA__::claimed[DMA_MAX_MODULES] = { 0U };
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/******* Public Member function for DMA__ class *******/
+
+/**
+ * @function	channel_open
+ *
+ * @brief		Claim and configure a DMA channel
+ *
+ * <i>Imp Note:</i>
+ * 				Claiming is done with interrupts masked, drivers may be
+ * 				opened from different contexts
+ *
+ */
+eDMA_Status_ DMA__::channel_open( XMC_DMA_t * const p_dma,
+									const unsigned char channel,
+									const XMC_DMA_CH_CONFIG_t& config,
+									const unsigned long events,
+									XMC_DMA_CH_EVENT_HANDLER_t handler )
+{
+	/* Local Variables */
+	eDMA_Status_ ret_status = eDMA_Status_::DMA_STATUS_SUCCESS;
+	const unsigned char index = get_index( p_dma );
+	const unsigned char mask = static_cast<unsigned char>( 0x1U << channel );
+	unsigned long primask_l;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( (DMA_MAX_MODULES <= index), eDMA_Status_::DMA_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (get_channels( index ) <= channel), eDMA_Status_::DMA_STATUS_INVALID_ARGUMENT );
+
+	primask_l = __get_PRIMASK();
+	__disable_irq();
+
+	if( 0U != (claimed[index] & mask) )
+	{
+		ret_status = eDMA_Status_::DMA_STATUS_BUSY;
+	}
+	else
+	{
+		/* First channel of module powers it up */
+		if( 0U == claimed[index] )
+		{
+			module_open( p_dma, index );
+		}
+		else{	/* Not required */	}
+
+		claimed[index] |= mask;
+	}
+
+	__set_PRIMASK( primask_l );
+
+	if( eDMA_Status_::DMA_STATUS_SUCCESS == ret_status )
+	{
+		/* Channel must be disabled for configuration */
+		XMC_DMA_CH_Disable( p_dma, channel );
+
+		if( XMC_DMA_CH_STATUS_OK != XMC_DMA_CH_Init( p_dma, channel, &config ) )
+		{
+			(void) channel_close( p_dma, channel );
+			ret_status = eDMA_Status_::DMA_STATUS_FAILED;
+		}
+		else
+		{
+			XMC_DMA_CH_ClearEventStatus( p_dma, channel, 0x1FUL );
+			XMC_DMA_CH_SetEventHandler( p_dma, channel, handler );
+			if( 0U != events )
+			{
+				XMC_DMA_CH_EnableEvent( p_dma, channel, events );
+			}
+			else{	/* Not required */	}
+		}
+	}
+	else{	/* Not required */	}
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/**
+ * @function	channel_close
+ *
+ * @brief		Stop and release a DMA channel
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eDMA_Status_ DMA__::channel_close( XMC_DMA_t * const p_dma, const unsigned char channel )
+{
+	/* Local Variables */
+	const unsigned char index = get_index( p_dma );
+	const unsigned char mask = static_cast<unsigned char>( 0x1U << channel );
+	unsigned long primask_l;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( (DMA_MAX_MODULES <= index), eDMA_Status_::DMA_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (get_channels( index ) <= channel), eDMA_Status_::DMA_STATUS_INVALID_ARGUMENT );
+
+	primask_l = __get_PRIMASK();
+	__disable_irq();
+
+	if( 0U != (claimed[index] & mask) )
+	{
+		XMC_DMA_CH_Disable( p_dma, channel );
+		XMC_DMA_CH_DisableEvent( p_dma, channel, 0x1FUL );
+		XMC_DMA_CH_ClearEventStatus( p_dma, channel, 0x1FUL );
+		XMC_DMA_CH_SetEventHandler( p_dma, channel, nullptr );
+
+		claimed[index] &= static_cast<unsigned char>( ~mask );
+
+		/* Last channel of module powers it down */
+		if( 0U == claimed[index] )
+		{
+			NVIC_DisableIRQ( get_irq( index ) );
+			XMC_DMA_Disable( p_dma );
+		}
+		else{	/* Not required */	}
+	}
+	else{	/* Not required */	}
+
+	__set_PRIMASK( primask_l );
+
+	/* Return status */
+	return eDMA_Status_::DMA_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	get_claimed
+ *
+ * @brief		Claimed channels of module
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned char DMA__::get_claimed( XMC_DMA_t * const p_dma )
+{
+	/* Local Variables */
+	const unsigned char index = get_index( p_dma );
+
+	return ( (DMA_MAX_MODULES > index) ? claimed[index] : 0U );
+}
+
+
+/******* Private Member function for DMA__ class *******/
+
+/**
+ * @function	get_irq
+ *
+ * @brief		NVIC node of module
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+IRQn_Type DMA__::get_irq( const unsigned char index )
+{
+#if defined(GPDMA1)
+	return ( (0U == index) ? GPDMA0_0_IRQn : GPDMA1_0_IRQn );
+#else
+	(void) index;
+	return GPDMA0_0_IRQn;
+#endif
+}
+
+
+/**
+ * @function	module_open
+ *
+ * @brief		Enable module and its NVIC node
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void DMA__::module_open( XMC_DMA_t * const p_dma, const unsigned char index )
+{
+	/* Local Variables */
+	const IRQn_Type irq_l = get_irq( index );
+
+	XMC_DMA_Init( p_dma );
+
+	/* Set priority and enable NVIC node */
+	NVIC_ClearPendingIRQ( irq_l );
+	NVIC_SetPriority( irq_l, NVIC_EncodePriority(NVIC_GetPriorityGrouping(),
+						( (0U == index) ? DMA_0_IRQ_PRIORITY : DMA_1_IRQ_PRIORITY ), 0U)
+					);
+	NVIC_EnableIRQ( irq_l );
+}
+
+
+/******* ISR entries for DMA__ class *******/
+
+/**
+ * @function	isr_entry
+ *
+ * @brief		Handler function for DMA module interrupt
+ *
+ * \par<b>Description:</b><br>
+ * 				XMCLib dispatches one channel event per call, node stays
+ * 				pending while further channel events are set
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void DMA__::isr_entry( XMC_DMA_t * const p_dma )
+{
+	XMC_DMA_IRQHandler( p_dma );
+}
+
+/********************************** End of File *******************************/
@@ -0,0 +1,116 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DSD data types Header
+* Filename:		dri_dsd_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_dsd_types.h
+ *  @brief:	This file contains data types definitions for delta-sigma
+ *  		demodulator with DMA sample blocks
+ */
+#ifndef DRI_DSD_TYPES_H_
+#define DRI_DSD_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_dsd.h>
+#include <xmc_gpio.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_dsd_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Decimated samples per block */
+#define DSD_FIR_BLOCK_SIZE			( DSD_BLOCK_SIZE / DSD_FIR_DECIMATION )
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of DSD
+ * */
+enum class eDSD_Status_/*	:	unsigned char	*/
+{
+	DSD_STATUS_SUCCESS = 0,
+	DSD_STATUS_FAILED,
+	DSD_STATUS_BUSY,
+	DSD_STATUS_INVALID_ARGUMENT
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eDSD_Init_/*	:	unsigned char	*/
+{
+	DSD_INIT_CLOSE = 0,
+	DSD_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for events of callback
+ * */
+enum class eDSD_Event_/*	:	unsigned char	*/
+{
+	DSD_EVENT_BLOCK = 0,			/**< Sample block filled */
+	DSD_EVENT_ERROR					/**< DMA bus error, sampling stopped */
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for DSD
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	Structure for statistics
+ */
+typedef struct tStDSD_Counters_
+{
+	unsigned long blocks = 0U;				/**< Blocks handed to callback */
+	unsigned long errors = 0U;				/**< DMA errors */
+} tStDSD_Counters;
+
+
+#endif /* DRI_DSD_TYPES_H_ */
+
+/********************************** End of File *******************************/
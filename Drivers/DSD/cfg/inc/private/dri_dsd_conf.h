@@ -0,0 +1,117 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DSD Configuration Header
+* Filename:		dri_dsd_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_dsd_conf.h
+ *  @brief:	This file contains static configurations for delta-sigma
+ *  		demodulator with DMA sample blocks
+ */
+#ifndef DRI_DSD_CONF_H_
+#define DRI_DSD_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* DSD used in system, 0 - not used */
+#define DSD_USED					1
+
+/* Callback function used in system */
+#define DSD_CALLBACK_HANDLER_USED	1
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Channel 0, modulator bit stream on DIN0A, input pins need no setup after reset */
+#define DSD_CHANNEL					DSD_CH0
+#define DSD_CHANNEL_ID				XMC_DSD_CH_ID_0
+#define DSD_DATA_SOURCE				XMC_DSD_CH_DATA_SOURCE_A_DIRECT
+
+/* Modulator clock fMOD = fDSD / 12, 10 MHz driven out on MCLK0 (P1.9) */
+#define DSD_CLOCK_DIVIDER			XMC_DSD_CH_CLK_DIV_12
+#define DSD_STROBE					XMC_DSD_CH_STROBE_DIRECT_CLOCK_RISE
+#define DSD_MCLK_PORT				XMC_GPIO_PORT1
+#define DSD_MCLK_PIN				9U
+#define DSD_MCLK_MODE				XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT3
+
+/* CIC3 main filter, 10 MHz / 64 gives 156.25 kS/s of 16 bit results */
+#define DSD_FILTER_TYPE				XMC_DSD_CH_FILTER_TYPE_CIC3
+#define DSD_DECIMATION				64U
+
+/*
+ * Integrator sums DSD_INTEGRATOR_VALUES filter results into one, 0 - not
+ * used. Sum has to fit 16 bit, e.g. CIC3 with decimation 16 and 4 values.
+ */
+#define DSD_INTEGRATOR_VALUES		0U
+
+/* Results per sample block */
+#define DSD_BLOCK_SIZE				256U
+
+/* DMA channel with linked list support and request line of SRM0,
+ * see xmc_dma_map.h */
+#define DSD_DMA						XMC_DMA0
+#define DSD_DMA_CHANNEL				1U
+#define DSD_DMA_REQUEST				DMA0_PERIPHERAL_REQUEST_DSD_SRM0_0
+
+/*
+ * Second stage FIR decimator in software, coefficients are described in
+ * dri_dsd_conf.cpp. Taps and decimation are even so that sample pairs stay
+ * word aligned for dual 16 bit MAC.
+ */
+#define DSD_FIR_TAPS				32U
+#define DSD_FIR_DECIMATION			4U
+
+
+/* Check FIR layout */
+#if ( (0 != (DSD_FIR_TAPS & 1U)) || (0 != (DSD_FIR_DECIMATION & 1U)) )
+	#error	"DSD FIR taps and decimation must be even"
+#endif
+
+/* Check block size */
+#if ( 0 != (DSD_BLOCK_SIZE % DSD_FIR_DECIMATION) )
+	#error	"DSD block size must be a multiple of FIR decimation"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_DSD_CONF_H_ */
+
+/********************************** End of File ******************************/
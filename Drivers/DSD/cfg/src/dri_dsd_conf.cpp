@@ -0,0 +1,78 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DSD Configuration Source
+* Filename:		dri_dsd_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_dsd_conf.cpp
+ *  @brief:	This source file contains FIR coefficients of DSD decimator
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_dsd.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check DSD usage in system */
+#if( 1 == DSD_USED )
+
+/*
+ * @brief	Low pass for decimation by 4, Hamming windowed sinc with cut off
+ * 			at 0.1 of input rate, unity gain at DC
+ */
+const short g_dsd_fir_coeff[DSD_FIR_TAPS] =
+{
+		-17,	20,		73,		135,	163,	91,		-129,	-466,
+		-782,	-850,	-435,	588,	2141,	3926,	5501,	6424,
+		6424,	5501,	3926,	2141,	588,	-435,	-850,	-782,
+		-466,	-129,	91,		163,	135,	73,		20,		-17
+};
+
+#endif	/* DSD_USED */
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/********************************** End of File *******************************/
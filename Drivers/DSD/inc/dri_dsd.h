@@ -0,0 +1,210 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DSD API Header
+* Filename:		dri_dsd.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_dsd.h
+ *  @brief:	This file contains API function declarations for delta-sigma
+ *  		demodulator with DMA sample blocks
+ */
+#ifndef DRI_DSD_H_
+#define DRI_DSD_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_dsd_types.h>
+#include <dri_dma.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+#if( 1 == DSD_USED )
+/* Q15 FIR coefficients, first one applies to oldest sample */
+extern const short g_dsd_fir_coeff[DSD_FIR_TAPS];
+
+#if( 1 == DSD_CALLBACK_HANDLER_USED )
+/* Callback handler for user, called in DMA interrupt */
+extern void dsd_callback_handler( const eDSD_Event_ event, const short * p_block );
+#endif
+#endif
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for delta-sigma demodulator with DMA sample blocks
+ *
+ * 			Modulator clock is generated by DSD, bit stream is demodulated
+ * 			by hardware CIC filter and optional integrator. Results are
+ * 			moved by a linked list DMA channel into two sample blocks in
+ * 			turn, a software FIR decimator lowers rate of a block further.
+ *
+ ******************************************************************************/
+
+/* Check DSD usage in system */
+#if( 1 == DSD_USED )
+
+class DSD__
+{
+/* public members */
+public:
+	/* Constructors */
+	DSD__() = delete;
+	DSD__( DSD__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for DSD
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eDSD_Init_	-	DSD_INIT_OPEN
+	 * 										DSD_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eDSD_Status_
+	 *          	DSD_STATUS_SUCCESS:		Operation successful.<BR>
+	 *          	DSD_STATUS_FAILED:		Operation failed.<BR>
+	 *          	DSD_STATUS_BUSY:		DMA channel owned by other driver.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function sets up modulator clock, filter chain and
+	 * 				DMA channel. Sampling starts with start()
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eDSD_Status_ init( const eDSD_Init_& init = eDSD_Init_::DSD_INIT_OPEN );
+
+	/**
+	 * @function	start
+	 *
+	 * @brief		Start continuous sampling into first block
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eDSD_Status_
+	 *          	DSD_STATUS_SUCCESS:		Sampling started.<BR>
+	 *          	DSD_STATUS_FAILED:		Not initialized.<BR>
+	 *          	DSD_STATUS_BUSY:		Already running.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				FIR history is cleared as well
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eDSD_Status_ start( void );
+
+	/**
+	 * @function	stop
+	 *
+	 * @brief		Stop sampling
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Partly filled block is dropped
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static void stop( void );
+
+	/**
+	 * @function	decimate
+	 *
+	 * @brief		FIR filter and decimate a block of results
+	 *
+	 * @param[in]	p_in	-	results, e.g. block of callback
+	 * 				count	-	number of results, multiple of DSD_FIR_DECIMATION
+	 * 							up to DSD_BLOCK_SIZE
+	 *
+	 * @param[out]	p_out	-	count / DSD_FIR_DECIMATION filtered samples
+	 *
+	 * @return  	number of samples written, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				History of last DSD_FIR_TAPS results is kept between
+	 * 				calls, blocks have to be passed in order
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from one context only
+	 *
+	 */
+	static unsigned short decimate( const short * const p_in, const unsigned short count,
+									short * const p_out );
+
+	/******* Setters and Getters *******/
+	static inline bool is_running( void ){ return ( 0U != running ); }
+	/* Statistics */
+	static const tStDSD_Counters& get_counters( void ) { return counters; }
+
+/* private members */
+private:
+	/** Data Members **/
+	static short blocks[2][DSD_BLOCK_SIZE];
+	static short fir_line[DSD_FIR_TAPS + DSD_BLOCK_SIZE];
+	static XMC_DMA_LLI_t lli[2];
+	static tStDSD_Counters counters;
+	static volatile unsigned char block_index;
+	static volatile unsigned char running;
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static void channel_init( void );
+	static void finish( void );
+	static void dma_event( XMC_DMA_CH_EVENT_t event );
+};
+
+#endif	/* DSD_USED */
+
+
+#endif /* DRI_DSD_H_ */
+
+/********************************** End of File *******************************/
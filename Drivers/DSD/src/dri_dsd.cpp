@@ -0,0 +1,445 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DSD API Source
+* Filename:		dri_dsd.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_dsd.cpp
+ *  @brief:	This source file contains API function definitions for
+ *  		delta-sigma demodulator with DMA sample blocks.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <string.h>
+#include <dri_dsd.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* DLR line of DMA request */
+#define DSD_DMA_LINE		( DSD_DMA_REQUEST & 0x0FU )
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check DSD usage in system */
+#if( 1 == DSD_USED )
+
+/* Declare static data member
+ *
+ * Note: Tell linker to take variable from this source file
+ * */
+short DSD__::blocks[2][DSD_BLOCK_SIZE];
+short DSD__::fir_line[DSD_FIR_TAPS + DSD_BLOCK_SIZE];
+XMC_DMA_LLI_t DSD__::lli[2];
+tStDSD_Counters DSD__::counters;
+volatile unsigned char DSD__::block_index = 0;
+volatile unsigned char DSD__::running = 0;
+unsigned char DSD__::init_state = 0;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/******* Public Member function for DSD__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for DSD
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eDSD_Status_ DSD__::init( const eDSD_Init_& init )
+{
+	/* Local Variables */
+	eDSD_Status_ ret_status = eDSD_Status_::DSD_STATUS_FAILED;
+	XMC_DMA_CH_CONFIG_t dma_cfg = {};
+	eDMA_Status_ dma_status_l;
+	unsigned char index = 0;
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open DSD */
+		case eDSD_Init_::DSD_INIT_OPEN:
+			/* Check for initialization */
+			if( init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			/* Two blocks chained in a ring, each one raises block event */
+			for( index = 0; index < 2U; ++index )
+			{
+				lli[index] = {};
+				lli[index].src_addr = (unsigned long) &( DSD_CHANNEL->RESM );
+				lli[index].dst_addr = (unsigned long) &( blocks[index][0] );
+				lli[index].llp = &lli[1U - index];
+				lli[index].enable_interrupt = 1U;
+				lli[index].dst_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_16;
+				lli[index].src_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_16;
+				lli[index].dst_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+				lli[index].src_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+				lli[index].dst_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+				lli[index].src_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+				lli[index].transfer_flow = (unsigned long) XMC_DMA_CH_TRANSFER_FLOW_P2M_DMA;
+				lli[index].enable_dst_linked_list = 1U;
+				lli[index].enable_src_linked_list = 1U;
+				lli[index].block_size = DSD_BLOCK_SIZE;
+			}
+
+			/* Main filter result to memory, one 16 bit result per request */
+			dma_cfg.enable_interrupt = 1U;
+			dma_cfg.dst_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_16;
+			dma_cfg.src_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_16;
+			dma_cfg.dst_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+			dma_cfg.src_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+			dma_cfg.dst_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+			dma_cfg.src_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+			dma_cfg.transfer_flow = (unsigned long) XMC_DMA_CH_TRANSFER_FLOW_P2M_DMA;
+			dma_cfg.src_addr = lli[0].src_addr;
+			dma_cfg.dst_addr = lli[0].dst_addr;
+			dma_cfg.linked_list_pointer = &lli[0];
+			dma_cfg.block_size = DSD_BLOCK_SIZE;
+			dma_cfg.transfer_type = XMC_DMA_CH_TRANSFER_TYPE_MULTI_BLOCK_SRCADR_LINKED_DSTADR_LINKED;
+			dma_cfg.priority = XMC_DMA_CH_PRIORITY_7;
+			dma_cfg.src_handshaking = XMC_DMA_CH_SRC_HANDSHAKING_HARDWARE;
+			dma_cfg.dst_handshaking = XMC_DMA_CH_DST_HANDSHAKING_SOFTWARE;
+			dma_cfg.src_peripheral_request = DSD_DMA_REQUEST;
+
+			dma_status_l = DMA__::channel_open( DSD_DMA, DSD_DMA_CHANNEL, dma_cfg,
+										( (unsigned long) XMC_DMA_CH_EVENT_BLOCK_TRANSFER_COMPLETE |
+										  (unsigned long) XMC_DMA_CH_EVENT_ERROR ),
+										dma_event );
+
+			/* Leave demodulator untouched without DMA channel */
+			if( eDMA_Status_::DMA_STATUS_BUSY == dma_status_l )
+			{
+				ret_status = eDSD_Status_::DSD_STATUS_BUSY;
+				break;
+			}
+			else if( eDMA_Status_::DMA_STATUS_SUCCESS != dma_status_l ){ break; }
+			else{	/* Not required */	}
+
+			/* Modulator clock and filter chain */
+			channel_init();
+
+			counters = {};
+
+			/* Set initialize state */
+			init_state = 1;
+			/* Update return status */
+			ret_status = eDSD_Status_::DSD_STATUS_SUCCESS;
+			break;
+
+		/* Close DSD */
+		case eDSD_Init_::DSD_INIT_CLOSE:
+			stop();
+
+			if( init_state > 0 )
+			{
+				XMC_DMA_DisableRequestLine( DSD_DMA, DSD_DMA_LINE );
+				(void) DMA__::channel_close( DSD_DMA, DSD_DMA_CHANNEL );
+				XMC_DSD_Disable( DSD );
+			}
+			else{	/* Not required */	}
+
+			/* Reset control state */
+			init_state = 0;
+			/* Update return status */
+			ret_status = eDSD_Status_::DSD_STATUS_SUCCESS;
+			break;
+
+		/* Default parameters, invalid argument */
+		default:
+			ret_status = eDSD_Status_::DSD_STATUS_INVALID_ARGUMENT;
+			break;
+	}
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/**
+ * @function	start
+ *
+ * @brief		Start continuous sampling into first block
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eDSD_Status_ DSD__::start( void )
+{
+	/* Check DSD state */
+	DRIVER_ASSERT( (0 == init_state), eDSD_Status_::DSD_STATUS_FAILED );
+	DRIVER_ASSERT( (0U != running), eDSD_Status_::DSD_STATUS_BUSY );
+
+	block_index = 0U;
+	memset( fir_line, 0, sizeof(fir_line) );
+
+	/* Arm channel on first block, it waits for first filter result */
+	XMC_DMA_CH_SetLinkedListPointer( DSD_DMA, DSD_DMA_CHANNEL, &lli[0] );
+	XMC_DMA_ClearRequestLine( DSD_DMA, DSD_DMA_LINE );
+	XMC_DMA_CH_Enable( DSD_DMA, DSD_DMA_CHANNEL );
+
+	running = 1U;
+
+	/* Filter restarts from zero, first results settle within three decimation periods */
+	XMC_DSD_Start( DSD, (unsigned long) DSD_CHANNEL_ID );
+
+	/* Return status */
+	return eDSD_Status_::DSD_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	stop
+ *
+ * @brief		Stop sampling
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void DSD__::stop( void )
+{
+	/* Local Variables */
+	const unsigned long primask_l = __get_PRIMASK();
+
+	/* DMA interrupt must not see half stopped channel */
+	__disable_irq();
+	if( (init_state > 0) && (0U != running) )
+	{
+		finish();
+	}
+	else{	/* Not required */	}
+	__set_PRIMASK( primask_l );
+}
+
+
+/**
+ * @function	decimate
+ *
+ * @brief		FIR filter and decimate a block of results
+ *
+ * \par<b>Description:</b><br>
+ * 				New results are appended behind history so that every
+ * 				output is one straight dot product, pairs of samples and
+ * 				coefficients are accumulated by one dual 16 bit MAC
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSD__::decimate( const short * const p_in, const unsigned short count,
+								short * const p_out )
+{
+	/* Local Variables */
+	const short * p_x = nullptr;
+#if defined(__ARM_FEATURE_DSP) && ( 1 == __ARM_FEATURE_DSP )
+	unsigned long x = 0;
+	unsigned long h = 0;
+#endif
+	long acc = 0;
+	unsigned short out = 0;
+	unsigned char tap = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_in) || (nullptr == p_out)), 0U );
+	DRIVER_ASSERT( ((0U == count) || (DSD_BLOCK_SIZE < count)), 0U );
+	DRIVER_ASSERT( (0U != (count % DSD_FIR_DECIMATION)), 0U );
+
+	memcpy( &fir_line[DSD_FIR_TAPS], p_in, count * sizeof(short) );
+
+	for( out = 0; out < (count / DSD_FIR_DECIMATION); ++out )
+	{
+		/* Window ends on last result of decimation group */
+		p_x = &fir_line[(out + 1U) * DSD_FIR_DECIMATION];
+		acc = 0;
+
+		for( tap = 0; tap < DSD_FIR_TAPS; tap = tap + 2U )
+		{
+#if defined(__ARM_FEATURE_DSP) && ( 1 == __ARM_FEATURE_DSP )
+			memcpy( &x, &p_x[tap], 4U );
+			memcpy( &h, &g_dsd_fir_coeff[tap], 4U );
+			/* Sum is signed 32 bit, also where long is wider */
+			acc = (long) (int32_t) __SMLAD( x, h, (unsigned long) acc );
+#else
+			/* Same pair wise sum without DSP extension */
+			acc = acc + ( (long) p_x[tap] * g_dsd_fir_coeff[tap] ) +
+						( (long) p_x[tap + 1U] * g_dsd_fir_coeff[tap + 1U] );
+#endif
+		}
+
+		/* Q30 sum back to Q15 */
+		p_out[out] = static_cast<short>( __SSAT( (acc >> 15), 16 ) );
+	}
+
+	/* Last results become history of next block */
+	memmove( &fir_line[0], &fir_line[count], DSD_FIR_TAPS * sizeof(short) );
+
+	/* Return number of samples */
+	return out;
+}
+
+
+/******* Private Member function for DSD__ class *******/
+
+/**
+ * @function	channel_init
+ *
+ * @brief		Configure modulator clock, main filter and integrator
+ *
+ * \par<b>Description:</b><br>
+ * 				Every main filter result raises service request routed to
+ * 				DMA line router
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void DSD__::channel_init( void )
+{
+	/* Local Variables */
+	XMC_DSD_CH_FILTER_CONFIG_t filter_cfg = {};
+#if( DSD_INTEGRATOR_VALUES > 0U )
+	XMC_DSD_CH_INTEGRATOR_CONFIG_t integrator_cfg = {};
+#endif
+	const XMC_GPIO_CONFIG_t mclk_cfg =
+	{
+			DSD_MCLK_MODE,
+			XMC_GPIO_OUTPUT_LEVEL_LOW,
+			XMC_GPIO_OUTPUT_STRENGTH_STRONG_SHARP_EDGE
+	};
+
+	XMC_DSD_Init( DSD );
+
+	filter_cfg.clock_divider = (unsigned long) DSD_CLOCK_DIVIDER;
+	filter_cfg.data_source = (unsigned long) DSD_DATA_SOURCE;
+	filter_cfg.clock_source = (unsigned long) XMC_DSD_CH_CLOCK_SOURCE_INTERN;
+	filter_cfg.strobe = (unsigned long) DSD_STROBE;
+	filter_cfg.filter_type = (unsigned long) DSD_FILTER_TYPE;
+	filter_cfg.result_event = (unsigned long) XMC_DSD_CH_RESULT_EVENT_ENABLE;
+	filter_cfg.decimation_factor = DSD_DECIMATION;
+	filter_cfg.filter_start_value = DSD_DECIMATION;
+	XMC_DSD_CH_MainFilter_Init( DSD_CHANNEL, &filter_cfg );
+
+#if( DSD_INTEGRATOR_VALUES > 0U )
+	/* Free running, each window of values gives one result */
+	integrator_cfg.start_condition = (unsigned long) XMC_DSD_CH_INTEGRATOR_START_ALLWAYS_ON;
+	integrator_cfg.stop_condition = (unsigned long) XMC_DSD_CH_INTEGRATOR_STOP_ENDLESS_OR_INVERSE_TRIGGER;
+	integrator_cfg.integration_loop = 1U;
+	integrator_cfg.discarded_values = 0U;
+	integrator_cfg.counted_values = DSD_INTEGRATOR_VALUES;
+	XMC_DSD_CH_Integrator_Init( DSD_CHANNEL, &integrator_cfg );
+#endif
+
+	/* Modulator clock out, bit stream input is left at reset state */
+	XMC_GPIO_Init( DSD_MCLK_PORT, DSD_MCLK_PIN, &mclk_cfg );
+}
+
+
+/**
+ * @function	finish
+ *
+ * @brief		Stop channel and DMA, mark DSD idle
+ *
+ * <i>Imp Note:</i>
+ * 				Called with interrupts masked or from DMA interrupt
+ *
+ */
+void DSD__::finish( void )
+{
+	XMC_DSD_Stop( DSD, (unsigned long) DSD_CHANNEL_ID );
+	XMC_DMA_CH_Disable( DSD_DMA, DSD_DMA_CHANNEL );
+	/* Drop request of result that raced with stop */
+	XMC_DMA_ClearRequestLine( DSD_DMA, DSD_DMA_LINE );
+	running = 0U;
+}
+
+
+/******* ISR entries for DSD__ class *******/
+
+/**
+ * @function	dma_event
+ *
+ * @brief		Handler function for DSD DMA channel events
+ *
+ * @param[in]	event	-	channel event from DMA module interrupt
+ *
+ * \par<b>Description:</b><br>
+ * 				Channel already fills other block while user gets the
+ * 				completed one, it has to be consumed within one block time
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void DSD__::dma_event( XMC_DMA_CH_EVENT_t event )
+{
+	/* Local Variables */
+	const short * p_block = nullptr;
+
+	/* Stopped in between by user */
+	if( 0U == running ){ return; }
+	else{	/* Not required */	}
+
+	if( XMC_DMA_CH_EVENT_BLOCK_TRANSFER_COMPLETE == event )
+	{
+		p_block = &( blocks[block_index][0] );
+		block_index = static_cast<unsigned char>( 1U - block_index );
+		counters.blocks = counters.blocks + 1U;
+
+#if( 1 == DSD_CALLBACK_HANDLER_USED )
+		dsd_callback_handler( eDSD_Event_::DSD_EVENT_BLOCK, p_block );
+#endif
+	}
+	else
+	{
+		finish();
+		counters.errors = counters.errors + 1U;
+
+#if( 1 == DSD_CALLBACK_HANDLER_USED )
+		dsd_callback_handler( eDSD_Event_::DSD_EVENT_ERROR, p_block );
+#endif
+	}
+
+	(void) p_block;
+}
+
+#endif	/* DSD_USED */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,147 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ETH data types Header
+* Filename:		dri_eth_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_eth_types.h
+ *  @brief:	This file contains data types definitions for Ethernet MAC
+ */
+#ifndef DRI_ETH_TYPES_H_
+#define DRI_ETH_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_eth_mac.h>
+#include <xmc_eth_phy.h>
+#include <xmc_scu.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_eth_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Flags of received frame */
+#define ETH_FRAME_IPV4				0x01U	/**< IPv4 frame */
+#define ETH_FRAME_CHECKSUM_OK		0x02U	/**< IP header and TCP/UDP/ICMP checksum verified by MAC */
+#define ETH_FRAME_TIMESTAMP			0x04U	/**< Receive time of frame is valid */
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of ETH
+ * */
+enum class eETH_Status_/*	:	unsigned char	*/
+{
+	ETH_STATUS_SUCCESS = 0,
+	ETH_STATUS_FAILED,
+	ETH_STATUS_BUSY,
+	ETH_STATUS_INVALID_ARGUMENT
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eETH_Init_/*	:	unsigned char	*/
+{
+	ETH_INIT_CLOSE = 0,
+	ETH_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for Events
+ * */
+enum class eETH_Event_	:	unsigned char
+{
+	ETH_EVENT_RX = 0,				/**< Frames queued, called from ISR */
+	ETH_EVENT_TX,					/**< Transmit descriptors free again, called from ISR */
+	ETH_EVENT_LINK_UP,				/**< Link established, called from tick() */
+	ETH_EVENT_LINK_DOWN				/**< Link lost, called from tick() */
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for Ethernet MAC
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	Structure for system time of MAC
+ */
+typedef struct tStETH_Time_
+{
+	unsigned long seconds = 0U;				/**< Seconds */
+	unsigned long nanoseconds = 0U;			/**< Nanoseconds, below 10^9 */
+} tStETH_Time;
+
+/*
+ * @brief	Structure for received frame
+ *
+ * <i>Imp Note:</i>
+ * 			Buffer belongs to receiver until it is given back by release()
+ */
+typedef struct tStETH_Frame_
+{
+	unsigned char * p_data = nullptr;		/**< Frame from destination address, without FCS */
+	unsigned short length = 0U;				/**< Frame length */
+	unsigned char flags = 0U;				/**< ETH_FRAME_* flags */
+	tStETH_Time time;						/**< Receive time, with ETH_FRAME_TIMESTAMP */
+} tStETH_Frame;
+
+/*
+ * @brief	Structure for statistics
+ */
+typedef struct tStETH_Counters_
+{
+	unsigned long rx_frames = 0U;			/**< Frames queued to stack */
+	unsigned long rx_dropped = 0U;			/**< Good frames without spare buffer or queue space */
+	unsigned long rx_errors = 0U;			/**< Frames with error summary or split over buffers */
+	unsigned long rx_stopped = 0U;			/**< Receive buffer unavailable events */
+	unsigned long tx_frames = 0U;			/**< Frames handed to DMA */
+	unsigned long tx_errors = 0U;			/**< Frames with error summary */
+} tStETH_Counters;
+
+
+#endif /* DRI_ETH_TYPES_H_ */
+
+/********************************** End of File *******************************/
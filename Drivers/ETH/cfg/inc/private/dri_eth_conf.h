@@ -0,0 +1,91 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ETH Configuration Header
+* Filename:		dri_eth_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_eth_conf.h
+ *  @brief:	This file contains static configurations for Ethernet MAC
+ */
+#ifndef DRI_ETH_CONF_H_
+#define DRI_ETH_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Ethernet MAC used in system, 0 - not used */
+#define ETH_USED					1
+
+/* Callback function used in system */
+#define ETH_CALLBACK_HANDLER_USED	1
+
+/* IEEE 1588 system time and frame timestamps, 0 - not used */
+#define ETH_PTP_USED				1
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/*
+ * Descriptor rings, every descriptor owns one buffer of XMC_ETH_MAC_BUF_SIZE.
+ * Spare buffers replace receive buffers handed to the stack, so at most
+ * ETH_RX_SPARE_BUFFERS frames can be held by the stack at one time.
+ */
+#define ETH_RX_DESCRIPTORS			8U
+#define ETH_TX_DESCRIPTORS			4U
+
+/* Power of 2, size of received frame queue and free buffer ring */
+#define ETH_RX_SPARE_BUFFERS		4U
+
+/* Receive interrupt delayed after a frame by up to this time, 0 - every frame */
+#define ETH_RX_COALESCE_US			100U
+
+/* Transmit interrupt requested every n frames, 1 - every frame */
+#define ETH_TX_COALESCE				4U
+
+/*
+ * PHY on XMC4500 Relax Kit is KSZ8031RNL at address 0, RMII on P2 and P15.
+ * Only xmc_eth_phy_ksz8031rnl.c out of the PHY sources has to be built.
+ */
+#define ETH_PHY_ADDRESS				0U
+
+/* Locally administered MAC address, byte 0 goes first on wire */
+#define ETH_MAC_ADDRESS				{ 0x02U, 0x03U, 0x19U, 0x45U, 0x00U, 0x01U }
+
+/* Limit of system time rate correction in ppb */
+#define ETH_PTP_MAX_PPB				500000L
+
+/* Link state is read from PHY every n calls of tick() */
+#define ETH_LINK_POLL_TICKS			500U
+
+/* Descriptors and buffers in DSRAM2, next to ETH DMA on bus matrix */
+#define ETH_MEMORY					__attribute__((section("DSRAM2_BSS"), aligned(8)))
+
+/* Interrupt Number and Priority */
+#define ETH_IRQ_NUM					108U
+#define ETH_PRIORITY				50U
+
+/* ISR handler */
+#define ETH_HANDLER					IRQ_Hdlr_108
+
+
+#endif /* DRI_ETH_CONF_H_ */
+
+/********************************** End of File *******************************/
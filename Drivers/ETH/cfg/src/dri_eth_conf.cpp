@@ -0,0 +1,96 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ETH Configuration Source
+* Filename:		dri_eth_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_eth_conf.cpp
+ *  @brief:	This source file contains MAC address and ISR handler of
+ *  		Ethernet MAC
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_eth.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check Ethernet usage in system */
+#if( 1 == ETH_USED )
+
+/*
+ * @brief	MAC address of device
+ */
+const unsigned char ETH__::address[6] = ETH_MAC_ADDRESS;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/******* ISR Handler for ETH__ *******/
+
+extern "C"
+{
+
+#ifdef ETH_HANDLER
+/**
+ * @function	ETH_HANDLER
+ *
+ * @brief		Ethernet MAC ISR handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void ETH_HANDLER( void )
+{
+	/* Call ISR entry function */
+	ETH__::isr_entry();
+}
+#endif	/* ETH_HANDLER */
+
+
+}	/* extern "C"{ */
+
+#endif	/* ETH_USED */
+
+
+/*********************************** End of File ******************************/
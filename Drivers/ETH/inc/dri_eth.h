@@ -0,0 +1,367 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ETH API Header
+* Filename:		dri_eth.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_eth.h
+ *  @brief:	This file contains API function declarations for Ethernet MAC
+ *  		with DMA descriptor rings
+ */
+#ifndef DRI_ETH_H_
+#define DRI_ETH_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_eth_types.h>
+#include <dri_ring.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+#if( 1 == ETH_USED )
+#if( 1 == ETH_CALLBACK_HANDLER_USED )
+/* Callback handler for user */
+extern void eth_callback_handler( const eETH_Event_ event );
+#endif
+#endif
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for Ethernet MAC
+ *
+ * 			Receive buffers are handed to the stack by reference and replaced
+ * 			in their descriptor by a spare buffer, frames are never copied.
+ * 			Transmit buffers are filled in place in the descriptor ring.
+ *
+ ******************************************************************************/
+
+/* Check Ethernet usage in system */
+#if( 1 == ETH_USED )
+
+class ETH__
+{
+/* public members */
+public:
+	/* Constructors */
+	ETH__() = delete;
+	ETH__( ETH__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for Ethernet MAC
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eETH_Init_	-	ETH_INIT_OPEN
+	 * 										ETH_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eETH_Status_
+	 *          	ETH_STATUS_SUCCESS:		Operation successful.<BR>
+	 *          	ETH_STATUS_FAILED:		PHY not responding or already open.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function sets up RMII, descriptor rings, checksum offload
+	 * 				and PHY autonegotiation. Transmission and reception start
+	 * 				with link up in tick()
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eETH_Status_ init( const eETH_Init_& init = eETH_Init_::ETH_INIT_OPEN );
+
+	/**
+	 * @function	receive
+	 *
+	 * @brief		Take next received frame
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	frame	-	received frame
+	 *
+	 * @return  	true if a frame was taken
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Frame buffer has to be given back by release()
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from one context only
+	 *
+	 */
+	static bool receive( tStETH_Frame& frame );
+
+	/**
+	 * @function	release
+	 *
+	 * @brief		Give receive buffer back to driver
+	 *
+	 * @param[in]	p_data	-	buffer of frame taken by receive()
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from one context only, the same as receive()
+	 *
+	 */
+	static void release( unsigned char * p_data );
+
+	/**
+	 * @function	claim
+	 *
+	 * @brief		Get next transmit buffer to fill in place
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	buffer of XMC_ETH_MAC_BUF_SIZE or nullptr if ring is full
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Buffer is sent by commit(), calling claim() again without
+	 * 				commit() returns the same buffer
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from one context only
+	 *
+	 */
+	static unsigned char * claim( void );
+
+	/**
+	 * @function	commit
+	 *
+	 * @brief		Send buffer returned by claim()
+	 *
+	 * @param[in]	length		-	frame length without FCS
+	 * @param[in]	timestamp	-	take transmit time, read by get_tx_time()
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eETH_Status_
+	 *          	ETH_STATUS_SUCCESS:				Frame handed to DMA.<BR>
+	 *          	ETH_STATUS_FAILED:				Not initialized or no link.<BR>
+	 *          	ETH_STATUS_BUSY:				Ring is full.<BR>
+	 *          	ETH_STATUS_INVALID_ARGUMENT:	Wrong length.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				MAC inserts IPv4 header and TCP/UDP/ICMP checksums, checksum
+	 * 				fields have to be 0 in frame
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from the same context as claim()
+	 *
+	 */
+	static eETH_Status_ commit( const unsigned short length, const bool timestamp = false );
+
+	/**
+	 * @function	transmit
+	 *
+	 * @brief		Copy frame into ring and send it
+	 *
+	 * @param[in]	p_data	-	frame from destination address
+	 * @param[in]	length	-	frame length without FCS
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eETH_Status_, same as commit()
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from the same context as claim()
+	 *
+	 */
+	static eETH_Status_ transmit( const unsigned char * p_data, const unsigned short length );
+
+	/**
+	 * @function	tick
+	 *
+	 * @brief		Link supervision, to be called from SysTick
+	 *
+	 * @param[in]	ticks	-	ticks passed since previous call
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				PHY is read every ETH_LINK_POLL_TICKS ticks and MAC follows
+	 * 				speed and duplex of link
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Reading PHY waits some 30 us per register on MDIO
+	 *
+	 */
+	static void tick( const unsigned long ticks );
+
+#if( 1 == ETH_PTP_USED )
+	/**
+	 * @function	get_tx_time
+	 *
+	 * @brief		Read transmit time of last frame committed with timestamp
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	time	-	system time of start of frame on wire
+	 *
+	 * @return  	true if time is valid, false while frame is pending
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				A time is returned once
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from the same context as claim()
+	 *
+	 */
+	static bool get_tx_time( tStETH_Time& time );
+
+	/**
+	 * @function	get_time
+	 *
+	 * @brief		Read system time of MAC
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	time	-	system time, 20 ns resolution
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Can be called from any context
+	 *
+	 */
+	static void get_time( tStETH_Time& time );
+
+	/**
+	 * @function	step_time
+	 *
+	 * @brief		Add offset to system time
+	 *
+	 * @param[in]	offset	-	nanoseconds, may be negative
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static void step_time( const long long offset );
+
+	/**
+	 * @function	adjust_rate
+	 *
+	 * @brief		Set rate of system time against nominal
+	 *
+	 * @param[in]	ppb	-	parts per billion, limited to ETH_PTP_MAX_PPB
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Addend of fine update is scaled from its nominal value
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static void adjust_rate( const long ppb );
+#endif	/* ETH_PTP_USED */
+
+	/******* Setters and Getters *******/
+	/* Link state */
+	static bool is_link_up( void ) { return ( 0U != link_up ); }
+	/* MAC address, 6 bytes */
+	static const unsigned char * get_address( void ) { return address; }
+	/* Statistics */
+	static const tStETH_Counters& get_counters( void ) { return counters; }
+
+	/* ISR entry function */
+	static void isr_entry( void );
+
+/* private members */
+private:
+	/** Data Members **/
+	static XMC_ETH_MAC_t mac;
+	static XMC_ETH_MAC_DMA_DESC_t rx_desc[ETH_RX_DESCRIPTORS];
+	static XMC_ETH_MAC_DMA_DESC_t tx_desc[ETH_TX_DESCRIPTORS];
+	static unsigned char rx_buffers[ETH_RX_DESCRIPTORS + ETH_RX_SPARE_BUFFERS][XMC_ETH_MAC_BUF_SIZE];
+	static unsigned char tx_buffers[ETH_TX_DESCRIPTORS][XMC_ETH_MAC_BUF_SIZE];
+	static Ring__<tStETH_Frame, ETH_RX_SPARE_BUFFERS> rx_queue;
+	static Ring__<unsigned char *, ETH_RX_SPARE_BUFFERS> rx_free;
+	static tStETH_Counters counters;
+	static const unsigned char address[6];
+	static unsigned char rx_index;
+	static unsigned char tx_index;
+	static unsigned char tx_coalesce;
+	static unsigned short link_ticks;
+#if( 1 == ETH_PTP_USED )
+	static tStETH_Time tx_time;
+	static unsigned long addend;
+	static unsigned char tx_time_index;
+	static unsigned char tx_time_state;
+#endif
+	static volatile unsigned char link_up;
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static void rx_run( void );
+#if( 1 == ETH_PTP_USED )
+	static void tx_time_capture( void );
+#endif
+};
+
+#endif	/* ETH_USED */
+
+
+#endif /* DRI_ETH_H_ */
+
+/********************************** End of File *******************************/
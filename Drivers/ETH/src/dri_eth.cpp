@@ -0,0 +1,770 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ETH API Source
+* Filename:		dri_eth.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_eth.cpp
+ *  @brief:	This source file contains API function definitions for Ethernet
+ *  		MAC with DMA descriptor rings.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_eth.h>
+#include <string.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Descriptors and buffers have to fit into DSRAM2 */
+#if( ((ETH_RX_DESCRIPTORS + ETH_RX_SPARE_BUFFERS + ETH_TX_DESCRIPTORS) * (XMC_ETH_MAC_BUF_SIZE + 32U)) > 0x8000U )
+	#error	"ETH descriptors and buffers exceed DSRAM2"
+#endif
+
+#if( (ETH_RX_DESCRIPTORS > 255U) || (ETH_TX_DESCRIPTORS > 255U) || (0U == ETH_TX_COALESCE) )
+	#error	"ETH descriptor configuration invalid"
+#endif
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* RDES1, no receive interrupt for frame, RI is raised by watchdog RIWT */
+#define ETH_RDES1_DIC				0x80000000U
+
+/* RDES4 extended status, valid with RDES0 ESA */
+#define ETH_RDES4_PAYLOAD_TYPE		0x00000007U
+#define ETH_RDES4_IP_HEADER_ERROR	0x00000008U
+#define ETH_RDES4_IP_PAYLOAD_ERROR	0x00000010U
+#define ETH_RDES4_IP_BYPASSED		0x00000020U
+#define ETH_RDES4_IPV4				0x00000040U
+
+/* RIWT counts in units of 256 clocks, 8 bit */
+#define ETH_RIWT_UNIT				256U
+#define ETH_RIWT_MAX				255U
+
+/* Smallest frame accepted for transmission, header only */
+#define ETH_MIN_FRAME				14U
+
+/* Transmit timestamp states */
+#define ETH_TX_TIME_NONE			0U
+#define ETH_TX_TIME_PENDING			1U
+#define ETH_TX_TIME_READY			2U
+
+/* Nanoseconds of a second, digital rollover */
+#define ETH_NS_PER_SECOND			1000000000L
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Check Ethernet usage in system */
+#if( 1 == ETH_USED )
+
+/* Static members of ETH__ */
+XMC_ETH_MAC_t ETH__::mac;
+ETH_MEMORY XMC_ETH_MAC_DMA_DESC_t ETH__::rx_desc[ETH_RX_DESCRIPTORS];
+ETH_MEMORY XMC_ETH_MAC_DMA_DESC_t ETH__::tx_desc[ETH_TX_DESCRIPTORS];
+ETH_MEMORY unsigned char ETH__::rx_buffers[ETH_RX_DESCRIPTORS + ETH_RX_SPARE_BUFFERS][XMC_ETH_MAC_BUF_SIZE];
+ETH_MEMORY unsigned char ETH__::tx_buffers[ETH_TX_DESCRIPTORS][XMC_ETH_MAC_BUF_SIZE];
+Ring__<tStETH_Frame, ETH_RX_SPARE_BUFFERS> ETH__::rx_queue;
+Ring__<unsigned char *, ETH_RX_SPARE_BUFFERS> ETH__::rx_free;
+tStETH_Counters ETH__::counters;
+unsigned char ETH__::rx_index = 0U;
+unsigned char ETH__::tx_index = 0U;
+unsigned char ETH__::tx_coalesce = 0U;
+unsigned short ETH__::link_ticks = 0U;
+#if( 1 == ETH_PTP_USED )
+tStETH_Time ETH__::tx_time;
+unsigned long ETH__::addend = 0U;
+unsigned char ETH__::tx_time_index = 0U;
+unsigned char ETH__::tx_time_state = ETH_TX_TIME_NONE;
+#endif
+volatile unsigned char ETH__::link_up = 0U;
+unsigned char ETH__::init_state = 0U;
+
+
+/******* Public Member function for ETH__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for Ethernet MAC
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eETH_Status_ ETH__::init( const eETH_Init_& init )
+{
+	/* Local Variables */
+	eETH_Status_ ret_status = eETH_Status_::ETH_STATUS_FAILED;
+	XMC_ETH_MAC_PORT_CTRL_t port_control;
+	XMC_ETH_PHY_CONFIG_t phy_config;
+	unsigned long riwt = 0U;
+	unsigned char index_l = 0U;
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open Ethernet */
+		case eETH_Init_::ETH_INIT_OPEN:
+			/* Check for initialization */
+			if( init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			/* RMII pins of XMC4500 Relax Kit, pad modes set by pin table */
+			port_control.raw = 0U;
+			port_control.mode = XMC_ETH_MAC_PORT_CTRL_MODE_RMII;
+			port_control.rxd0 = XMC_ETH_MAC_PORT_CTRL_RXD0_P2_2;
+			port_control.rxd1 = XMC_ETH_MAC_PORT_CTRL_RXD1_P2_3;
+			port_control.rxer = XMC_ETH_MAC_PORT_CTRL_RXER_P2_4;
+			port_control.clk_rmii = XMC_ETH_MAC_PORT_CTRL_CLK_RMII_P15_8;
+			port_control.crs_dv = XMC_ETH_MAC_PORT_CTRL_CRS_DV_P15_9;
+			port_control.mdio = XMC_ETH_MAC_PORT_CTRL_MDIO_P2_0;
+			XMC_GPIO_SetHardwareControl( XMC_GPIO_PORT2, 0U, XMC_GPIO_HWCTRL_PERIPHERAL1 );
+
+			/* Receive ring takes first buffers, the rest are spares */
+			mac.regs = ETH0;
+			mac.address = 0U;
+			for( index_l = 6U; index_l > 0U; --index_l )
+			{
+				mac.address = ( mac.address << 8U ) | address[index_l - 1U];
+			}
+			mac.rx_desc = rx_desc;
+			mac.tx_desc = tx_desc;
+			mac.rx_buf = &rx_buffers[0][0];
+			mac.tx_buf = &tx_buffers[0][0];
+			mac.num_rx_buf = ETH_RX_DESCRIPTORS;
+			mac.num_tx_buf = ETH_TX_DESCRIPTORS;
+
+			XMC_ETH_MAC_SetPortControl( &mac, port_control );
+
+			/* Enables IPv4 checksum offload, store and forward, 8 word descriptors */
+			if( XMC_ETH_MAC_STATUS_OK != XMC_ETH_MAC_Init( &mac ) )
+			{
+				XMC_ETH_MAC_Disable( &mac );
+				break;
+			}
+			else{	/* Not required */	}
+
+			rx_queue.flush();
+			rx_free.flush();
+			for( index_l = 0U; index_l < ETH_RX_SPARE_BUFFERS; ++index_l )
+			{
+				(void) rx_free.push( rx_buffers[ETH_RX_DESCRIPTORS + index_l] );
+			}
+			counters = tStETH_Counters();
+			rx_index = 0U;
+			tx_index = 0U;
+			tx_coalesce = 0U;
+			link_ticks = 0U;
+			link_up = 0U;
+
+			/* Receive interrupt coalescing by watchdog */
+			#if( ETH_RX_COALESCE_US > 0U )
+			riwt = ( (XMC_SCU_CLOCK_GetEthernetClockFrequency() / 1000000U) * ETH_RX_COALESCE_US ) / ETH_RIWT_UNIT;
+			riwt = ( riwt > ETH_RIWT_MAX ) ? ETH_RIWT_MAX : ( ( 0U == riwt ) ? 1U : riwt );
+			for( index_l = 0U; index_l < ETH_RX_DESCRIPTORS; ++index_l )
+			{
+				rx_desc[index_l].length |= ETH_RDES1_DIC;
+			}
+			#endif
+			ETH0->RECEIVE_INTERRUPT_WATCHDOG_TIMER = riwt;
+
+			XMC_ETH_MAC_EnableReceptionBroadcastFrames( &mac );
+			XMC_ETH_MAC_EnableReceptionMulticastFrames( &mac );
+			XMC_ETH_MAC_DisableJumboFrame( &mac );
+
+			#if( 1 == ETH_PTP_USED )
+			/* System time with fine update, PTPv2 event messages over IPv4 are timestamped */
+			XMC_ETH_MAC_InitPTP( &mac, static_cast<unsigned long>(XMC_ETH_MAC_TIMESTAMP_CONFIG_FINE_UPDATE) |
+										static_cast<unsigned long>(XMC_ETH_MAC_TIMESTAMP_CONFIG_ENABLE_PTPV2) |
+										static_cast<unsigned long>(XMC_ETH_MAC_TIMESTAMP_CONFIG_ENABLE_PTP_OVER_IPV4) );
+			addend = ETH0->TIMESTAMP_ADDEND;
+			tx_time_state = ETH_TX_TIME_NONE;
+			#endif
+
+			/* PHY autonegotiation, link is taken up in tick() */
+			phy_config.interface = XMC_ETH_LINK_INTERFACE_RMII;
+			phy_config.speed = XMC_ETH_LINK_SPEED_100M;
+			phy_config.duplex = XMC_ETH_LINK_DUPLEX_FULL;
+			phy_config.enable_auto_negotiate = true;
+			phy_config.enable_loop_back = false;
+			if( XMC_ETH_PHY_STATUS_OK != XMC_ETH_PHY_Init( &mac, ETH_PHY_ADDRESS, &phy_config ) )
+			{
+				XMC_ETH_MAC_Disable( &mac );
+				break;
+			}
+			else{	/* Not required */	}
+
+			XMC_ETH_MAC_EnableEvent( &mac, static_cast<unsigned long>(XMC_ETH_MAC_EVENT_RECEIVE) |
+											static_cast<unsigned long>(XMC_ETH_MAC_EVENT_TRANSMIT) |
+											static_cast<unsigned long>(XMC_ETH_MAC_EVENT_RECEIVE_BUFFER_UNAVAILABLE) );
+
+			NVIC_ClearPendingIRQ( static_cast<IRQn_Type>(ETH_IRQ_NUM) );
+			NVIC_SetPriority( static_cast<IRQn_Type>(ETH_IRQ_NUM),
+								NVIC_EncodePriority(NVIC_GetPriorityGrouping(),
+								ETH_PRIORITY,
+								0U)
+							);
+			NVIC_EnableIRQ( static_cast<IRQn_Type>(ETH_IRQ_NUM) );
+
+			/* Update initialization state */
+			init_state = 1U;
+			/* Update return status */
+			ret_status = eETH_Status_::ETH_STATUS_SUCCESS;
+			break;
+
+		/* Close Ethernet */
+		case eETH_Init_::ETH_INIT_CLOSE:
+			NVIC_DisableIRQ( static_cast<IRQn_Type>(ETH_IRQ_NUM) );
+
+			if( init_state > 0 )
+			{
+				XMC_ETH_MAC_DisableTx( &mac );
+				XMC_ETH_MAC_DisableRx( &mac );
+				(void) XMC_ETH_PHY_PowerDown( &mac, ETH_PHY_ADDRESS );
+				XMC_ETH_MAC_Disable( &mac );
+			}
+			else{	/* Not required */	}
+
+			link_up = 0U;
+			/* Reset initialization state */
+			init_state = 0U;
+			/* Update return status */
+			ret_status = eETH_Status_::ETH_STATUS_SUCCESS;
+			break;
+
+		default:
+			break;
+	}
+
+	return ret_status;
+}
+
+
+/**
+ * @function	receive
+ *
+ * @brief		Take next received frame
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+bool ETH__::receive( tStETH_Frame& frame )
+{
+	return rx_queue.pop( frame );
+}
+
+
+/**
+ * @function	release
+ *
+ * @brief		Give receive buffer back to driver
+ *
+ * <i>Imp Note:</i>
+ * 				Free ring holds every spare buffer, push cannot fail
+ *
+ */
+void ETH__::release( unsigned char * p_data )
+{
+	if( nullptr != p_data )
+	{
+		(void) rx_free.push( p_data );
+	}
+	else{	/* Not required */	}
+}
+
+
+/**
+ * @function	claim
+ *
+ * @brief		Get next transmit buffer to fill in place
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned char * ETH__::claim( void )
+{
+	/* Check descriptor ownership */
+	if( 0U != ( tx_desc[tx_index].status & ETH_MAC_DMA_TDES0_OWN ) )
+	{
+		return nullptr;
+	}
+	else{	/* Not required */	}
+
+	return reinterpret_cast<unsigned char*>( tx_desc[tx_index].buffer1 );
+}
+
+
+/**
+ * @function	commit
+ *
+ * @brief		Send buffer returned by claim()
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eETH_Status_ ETH__::commit( const unsigned short length, const bool timestamp )
+{
+	/* Local Variables */
+	XMC_ETH_MAC_DMA_DESC_t * p_desc = &tx_desc[tx_index];
+	unsigned long control = ETH_MAC_DMA_TDES0_TCH | ETH_MAC_DMA_TDES0_FS |
+							ETH_MAC_DMA_TDES0_LS | ETH_MAC_DMA_TDES0_CIC;
+
+	/* Check initialization and link */
+	DRIVER_ASSERT( (0U == init_state) || (0U == link_up), eETH_Status_::ETH_STATUS_FAILED );
+	DRIVER_ASSERT( (length < ETH_MIN_FRAME) || (length > XMC_ETH_MAC_BUF_SIZE),
+					eETH_Status_::ETH_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( 0U != ( p_desc->status & ETH_MAC_DMA_TDES0_OWN ), eETH_Status_::ETH_STATUS_BUSY );
+
+	/* Status of previous frame in descriptor */
+	if( 0U != ( p_desc->status & ETH_MAC_DMA_TDES0_ES ) )
+	{
+		counters.tx_errors += 1U;
+	}
+	else{	/* Not required */	}
+
+	#if( 1 == ETH_PTP_USED )
+	/* Keep transmit time of descriptor before it is reused */
+	if( (ETH_TX_TIME_PENDING == tx_time_state) && (tx_time_index == tx_index) )
+	{
+		tx_time_capture();
+	}
+	else{	/* Not required */	}
+
+	if( true == timestamp )
+	{
+		control |= ETH_MAC_DMA_TDES0_TTSE;
+		tx_time_index = tx_index;
+		tx_time_state = ETH_TX_TIME_PENDING;
+	}
+	else{	/* Not required */	}
+	#else
+	(void) timestamp;
+	#endif
+
+	/* Transmit interrupt every ETH_TX_COALESCE frames and when ring runs full */
+	tx_coalesce = tx_coalesce + 1U;
+	if( (tx_coalesce >= ETH_TX_COALESCE) ||
+		(0U != ( tx_desc[( tx_index + 1U ) % ETH_TX_DESCRIPTORS].status & ETH_MAC_DMA_TDES0_OWN )) )
+	{
+		control |= ETH_MAC_DMA_TDES0_IC;
+		tx_coalesce = 0U;
+	}
+	else{	/* Not required */	}
+
+	p_desc->length = length;
+	__DMB();
+	p_desc->status = control | ETH_MAC_DMA_TDES0_OWN;
+
+	tx_index = static_cast<unsigned char>( ( tx_index + 1U ) % ETH_TX_DESCRIPTORS );
+	counters.tx_frames += 1U;
+
+	/* Resume transmit DMA if suspended */
+	if( 0U != ( ETH0->STATUS & ETH_STATUS_TU_Msk ) )
+	{
+		ETH0->STATUS = ETH_STATUS_TU_Msk;
+	}
+	else{	/* Not required */	}
+	ETH0->TRANSMIT_POLL_DEMAND = 0U;
+
+	return eETH_Status_::ETH_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	transmit
+ *
+ * @brief		Copy frame into ring and send it
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eETH_Status_ ETH__::transmit( const unsigned char * p_data, const unsigned short length )
+{
+	/* Local Variables */
+	unsigned char * p_buffer = nullptr;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( (nullptr == p_data) || (length < ETH_MIN_FRAME) || (length > XMC_ETH_MAC_BUF_SIZE),
+					eETH_Status_::ETH_STATUS_INVALID_ARGUMENT );
+
+	p_buffer = claim();
+	DRIVER_ASSERT( nullptr == p_buffer, eETH_Status_::ETH_STATUS_BUSY );
+
+	memcpy( p_buffer, p_data, length );
+
+	return commit( length );
+}
+
+
+/**
+ * @function	tick
+ *
+ * @brief		Link supervision, to be called from SysTick
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void ETH__::tick( const unsigned long ticks )
+{
+	/* Local Variables */
+	XMC_ETH_LINK_STATUS_t status;
+
+	/* Check initialization and poll interval */
+	if( 0U == init_state ){ return; }
+	else{	/* Not required */	}
+
+	if( ticks < (ETH_LINK_POLL_TICKS - link_ticks) )
+	{
+		link_ticks = static_cast<unsigned short>( link_ticks + ticks );
+		return;
+	}
+	else{	/* Not required */	}
+	link_ticks = 0U;
+
+	status = XMC_ETH_PHY_GetLinkStatus( &mac, ETH_PHY_ADDRESS );
+
+	if( (XMC_ETH_LINK_STATUS_UP == status) && (0U == link_up) )
+	{
+		/* MAC follows negotiated speed and duplex */
+		XMC_ETH_MAC_SetLink( &mac, XMC_ETH_PHY_GetLinkSpeed( &mac, ETH_PHY_ADDRESS ),
+							XMC_ETH_PHY_GetLinkDuplex( &mac, ETH_PHY_ADDRESS ) );
+		XMC_ETH_MAC_EnableTx( &mac );
+		XMC_ETH_MAC_EnableRx( &mac );
+		link_up = 1U;
+
+		#if( 1 == ETH_CALLBACK_HANDLER_USED )
+		eth_callback_handler( eETH_Event_::ETH_EVENT_LINK_UP );
+		#endif
+	}
+	else if( (XMC_ETH_LINK_STATUS_DOWN == status) && (0U != link_up) )
+	{
+		XMC_ETH_MAC_DisableTx( &mac );
+		XMC_ETH_MAC_DisableRx( &mac );
+		link_up = 0U;
+
+		#if( 1 == ETH_CALLBACK_HANDLER_USED )
+		eth_callback_handler( eETH_Event_::ETH_EVENT_LINK_DOWN );
+		#endif
+	}
+	else{	/* Not required */	}
+}
+
+
+#if( 1 == ETH_PTP_USED )
+/**
+ * @function	get_tx_time
+ *
+ * @brief		Read transmit time of last frame committed with timestamp
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+bool ETH__::get_tx_time( tStETH_Time& time )
+{
+	if( ETH_TX_TIME_PENDING == tx_time_state )
+	{
+		tx_time_capture();
+	}
+	else{	/* Not required */	}
+
+	if( ETH_TX_TIME_READY == tx_time_state )
+	{
+		time = tx_time;
+		tx_time_state = ETH_TX_TIME_NONE;
+		return true;
+	}
+	else{	/* Not required */	}
+
+	return false;
+}
+
+
+/**
+ * @function	get_time
+ *
+ * @brief		Read system time of MAC
+ *
+ * <i>Imp Note:</i>
+ * 				Seconds are read again to catch a rollover between both reads
+ *
+ */
+void ETH__::get_time( tStETH_Time& time )
+{
+	do
+	{
+		time.seconds = ETH0->SYSTEM_TIME_SECONDS;
+		time.nanoseconds = ETH0->SYSTEM_TIME_NANOSECONDS;
+	} while( time.seconds != ETH0->SYSTEM_TIME_SECONDS );
+}
+
+
+/**
+ * @function	step_time
+ *
+ * @brief		Add offset to system time
+ *
+ * <i>Imp Note:</i>
+ * 				In digital rollover mode nanoseconds to subtract are written
+ * 				as 10^9 - value together with ADDSUB
+ *
+ */
+void ETH__::step_time( const long long offset )
+{
+	/* Local Variables */
+	unsigned long long magnitude = static_cast<unsigned long long>( ( offset < 0 ) ? -offset : offset );
+	unsigned long seconds = static_cast<unsigned long>( magnitude / ETH_NS_PER_SECOND );
+	unsigned long nanoseconds = static_cast<unsigned long>( magnitude % ETH_NS_PER_SECOND );
+
+	if( offset < 0 )
+	{
+		nanoseconds = ( 0U == nanoseconds ) ? 0U : ( ETH_NS_PER_SECOND - nanoseconds );
+		nanoseconds |= ETH_SYSTEM_TIME_NANOSECONDS_UPDATE_ADDSUB_Msk;
+	}
+	else{	/* Not required */	}
+
+	/* Previous update has to be finished */
+	while( 0U != ( ETH0->TIMESTAMP_CONTROL & ETH_TIMESTAMP_CONTROL_TSUPDT_Msk ) ){}
+
+	ETH0->SYSTEM_TIME_SECONDS_UPDATE = seconds;
+	ETH0->SYSTEM_TIME_NANOSECONDS_UPDATE = nanoseconds;
+	ETH0->TIMESTAMP_CONTROL |= ETH_TIMESTAMP_CONTROL_TSUPDT_Msk;
+}
+
+
+/**
+ * @function	adjust_rate
+ *
+ * @brief		Set rate of system time against nominal
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void ETH__::adjust_rate( const long ppb )
+{
+	/* Local Variables */
+	long ppb_l = ppb;
+
+	if( ppb_l > ETH_PTP_MAX_PPB ){ ppb_l = ETH_PTP_MAX_PPB; }
+	else if( ppb_l < -ETH_PTP_MAX_PPB ){ ppb_l = -ETH_PTP_MAX_PPB; }
+	else{	/* Not required */	}
+
+	XMC_ETH_MAC_UpdateAddend( &mac, static_cast<unsigned long>(
+								static_cast<long long>(addend) +
+								( ( static_cast<long long>(addend) * ppb_l ) / ETH_NS_PER_SECOND ) ) );
+}
+#endif	/* ETH_PTP_USED */
+
+
+/**
+ * @function	isr_entry
+ *
+ * @brief		ISR entry function for Ethernet MAC
+ *
+ * <i>Imp Note:</i>
+ * 				Transmit interrupts only report free ring space to the user
+ *
+ */
+void ETH__::isr_entry( void )
+{
+	/* Local Variables */
+	unsigned long status = XMC_ETH_MAC_GetEventStatus( &mac );
+
+	XMC_ETH_MAC_ClearEventStatus( &mac, status );
+
+	/* Reception, coalesced by watchdog */
+	if( 0U != ( status & ( static_cast<unsigned long>(XMC_ETH_MAC_EVENT_RECEIVE) |
+							static_cast<unsigned long>(XMC_ETH_MAC_EVENT_RECEIVE_BUFFER_UNAVAILABLE) ) ) )
+	{
+		rx_run();
+
+		/* Descriptors are owned by DMA again, restart suspended reception */
+		if( 0U != ( status & static_cast<unsigned long>(XMC_ETH_MAC_EVENT_RECEIVE_BUFFER_UNAVAILABLE) ) )
+		{
+			counters.rx_stopped += 1U;
+			ETH0->RECEIVE_POLL_DEMAND = 0U;
+		}
+		else{	/* Not required */	}
+
+		#if( 1 == ETH_CALLBACK_HANDLER_USED )
+		if( rx_queue.get_count() > 0U )
+		{
+			eth_callback_handler( eETH_Event_::ETH_EVENT_RX );
+		}
+		else{	/* Not required */	}
+		#endif
+	}
+	else{	/* Not required */	}
+
+	#if( 1 == ETH_CALLBACK_HANDLER_USED )
+	if( 0U != ( status & static_cast<unsigned long>(XMC_ETH_MAC_EVENT_TRANSMIT) ) )
+	{
+		eth_callback_handler( eETH_Event_::ETH_EVENT_TX );
+	}
+	else{	/* Not required */	}
+	#endif
+}
+
+
+/******* Private Member function for ETH__ class *******/
+
+/**
+ * @function	rx_run
+ *
+ * @brief		Hand completed receive descriptors to the stack
+ *
+ * <i>Imp Note:</i>
+ * 				Buffer of a good frame is swapped with a spare one, without
+ * 				spare buffer or queue space the frame is dropped in place
+ *
+ */
+void ETH__::rx_run( void )
+{
+	/* Local Variables */
+	XMC_ETH_MAC_DMA_DESC_t * p_desc = nullptr;
+	tStETH_Frame * p_frame = nullptr;
+	unsigned char * p_spare = nullptr;
+	unsigned long status = 0U;
+	unsigned long extended = 0U;
+
+	p_desc = &rx_desc[rx_index];
+	while( 0U == ( p_desc->status & ETH_MAC_DMA_RDES0_OWN ) )
+	{
+		status = p_desc->status;
+
+		/* Whole frame in one buffer without error */
+		if( (0U == ( status & ETH_MAC_DMA_RDES0_ES )) &&
+			((ETH_MAC_DMA_RDES0_FS | ETH_MAC_DMA_RDES0_LS) ==
+					( status & (ETH_MAC_DMA_RDES0_FS | ETH_MAC_DMA_RDES0_LS) )) )
+		{
+			p_frame = rx_queue.claim();
+			if( (nullptr != p_frame) && rx_free.pop( p_spare ) )
+			{
+				p_frame->p_data = reinterpret_cast<unsigned char*>( p_desc->buffer1 );
+				p_frame->length = static_cast<unsigned short>( ( ( status & ETH_MAC_DMA_RDES0_FL ) >> 16U ) - 4U );
+				p_frame->flags = 0U;
+
+				/* Checksum offload result */
+				if( 0U != ( status & ETH_MAC_DMA_RDES0_ESA ) )
+				{
+					extended = p_desc->extended_status;
+					if( 0U != ( extended & ETH_RDES4_IPV4 ) )
+					{
+						p_frame->flags = ETH_FRAME_IPV4;
+						if( (0U == ( extended & ( ETH_RDES4_IP_HEADER_ERROR | ETH_RDES4_IP_PAYLOAD_ERROR |
+												ETH_RDES4_IP_BYPASSED ) )) &&
+							(0U != ( extended & ETH_RDES4_PAYLOAD_TYPE )) )
+						{
+							p_frame->flags |= ETH_FRAME_CHECKSUM_OK;
+						}
+						else{	/* Not required */	}
+					}
+					else{	/* Not required */	}
+				}
+				else{	/* Not required */	}
+
+				#if( 1 == ETH_PTP_USED )
+				/* Receive time of timestamped frames */
+				if( 0U != ( status & ETH_MAC_DMA_RDES0_TSA ) )
+				{
+					p_frame->time.seconds = p_desc->time_stamp_seconds;
+					p_frame->time.nanoseconds = p_desc->time_stamp_nanoseconds;
+					p_frame->flags |= ETH_FRAME_TIMESTAMP;
+				}
+				else{	/* Not required */	}
+				#endif
+
+				rx_queue.commit();
+				p_desc->buffer1 = reinterpret_cast<unsigned long>( p_spare );
+				counters.rx_frames += 1U;
+			}
+			else
+			{
+				counters.rx_dropped += 1U;
+			}
+		}
+		else
+		{
+			counters.rx_errors += 1U;
+		}
+
+		/* Give descriptor back to DMA */
+		__DMB();
+		p_desc->status = ETH_MAC_DMA_RDES0_OWN;
+
+		rx_index = static_cast<unsigned char>( ( rx_index + 1U ) % ETH_RX_DESCRIPTORS );
+		p_desc = &rx_desc[rx_index];
+	}
+}
+
+#if( 1 == ETH_PTP_USED )
+/**
+ * @function	tx_time_capture
+ *
+ * @brief		Take transmit time out of its descriptor
+ *
+ * <i>Imp Note:</i>
+ * 				Time stays pending while DMA owns descriptor
+ *
+ */
+void ETH__::tx_time_capture( void )
+{
+	/* Local Variables */
+	const XMC_ETH_MAC_DMA_DESC_t * p_desc = &tx_desc[tx_time_index];
+
+	if( 0U != ( p_desc->status & ETH_MAC_DMA_TDES0_OWN ) ){ return; }
+	else{	/* Not required */	}
+
+	if( 0U != ( p_desc->status & ETH_MAC_DMA_TDES0_TTSS ) )
+	{
+		tx_time.seconds = p_desc->time_stamp_seconds;
+		tx_time.nanoseconds = p_desc->time_stamp_nanoseconds;
+		tx_time_state = ETH_TX_TIME_READY;
+	}
+	else
+	{
+		tx_time_state = ETH_TX_TIME_NONE;
+	}
+}
+#endif	/* ETH_PTP_USED */
+
+#endif	/* ETH_USED */
+
+
+/********************************** End of File *******************************/
@@ -0,0 +1,135 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Debounce data types Header
+* Filename:		dri_gpio_debounce_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_gpio_debounce_types.h
+ *  @brief:	This file contains data types definitions for GPIO debounce
+ *  		engine and key matrix scanning
+ */
+#ifndef DRI_GPIO_DEBOUNCE_TYPES_H_
+#define DRI_GPIO_DEBOUNCE_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+/* Include private headers first */
+#include <private/dri_gpio_debounce_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of debounce engine
+ * */
+enum class eGPIO_Debounce_Status_/*	:	unsigned char	*/
+{
+	GPIO_DEBOUNCE_STATUS_SUCCESS = 0,
+	GPIO_DEBOUNCE_STATUS_FAILED,
+	GPIO_DEBOUNCE_STATUS_NO_EVENT,
+	GPIO_DEBOUNCE_STATUS_INVALID_ARGUMENT
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eGPIO_Debounce_Init_/*	:	unsigned char	*/
+{
+	GPIO_DEBOUNCE_INIT_CLOSE = 0,
+	GPIO_DEBOUNCE_INIT_OPEN
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for debounce engine
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	Structure for 2 bit vertical counter over 32 inputs
+ *
+ * <i>Imp Note:</i>
+ * 			Bit n of ct0/ct1 is counter of input n, input changes its state
+ * 			after 4 consecutive samples differing from current state
+ */
+typedef struct tStGPIO_VerticalCounter_
+{
+	unsigned long ct0 = 0U;					/**< Counter bit 0 of all inputs */
+	unsigned long ct1 = 0U;					/**< Counter bit 1 of all inputs */
+	unsigned long state = 0U;				/**< Debounced level of all inputs */
+	volatile unsigned long pressed = 0U;	/**< Latched press events */
+	volatile unsigned long released = 0U;	/**< Latched release events */
+} tStGPIO_VerticalCounter;
+
+/*
+ * @brief	Structure for debounce events handed to user
+ */
+typedef struct tStGPIO_DebounceEvents_
+{
+	unsigned long pressed;		/**< Bit n set - input n became active */
+	unsigned long released;		/**< Bit n set - input n became inactive */
+} tStGPIO_DebounceEvents;
+
+/*
+ * @brief	Structure for debounced port configuration
+ */
+typedef struct tStGPIO_DebouncePort_
+{
+	XMC_GPIO_PORT_t * p_port;		/**< Port sampled as a whole */
+	unsigned long mask;				/**< Pins of port taking part */
+	unsigned long active_low;		/**< Pins pressed at low level */
+	XMC_GPIO_MODE_t mode;			/**< Input mode applied to masked pins */
+} tStGPIO_DebouncePort;
+
+/*
+ * @brief	Structure for key matrix configuration
+ *
+ * <i>Imp Note:</i>
+ * 			Rows are driven low one at a time in open drain mode,
+ * 			columns are pulled up and read active low
+ */
+typedef struct tStGPIO_Matrix_
+{
+	XMC_GPIO_PORT_t * p_row_port;					/**< Port of row pins */
+	unsigned char row_pins[GPIO_MATRIX_MAX_ROWS];	/**< Row pin numbers */
+	XMC_GPIO_PORT_t * p_col_port;					/**< Port of column pins */
+	unsigned long col_mask;							/**< Column pins of port */
+} tStGPIO_Matrix;
+
+
+#endif /* DRI_GPIO_DEBOUNCE_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,137 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Event data types Header
+* Filename:		dri_gpio_event_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_gpio_event_types.h
+ *  @brief:	This file contains data types definitions for GPIO edge events
+ *  		routed through ERU
+ */
+#ifndef DRI_GPIO_EVENT_TYPES_H_
+#define DRI_GPIO_EVENT_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_eru.h>
+#include <xmc_ccu4.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_gpio_event_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of GPIO events
+ * */
+enum class eGPIO_Event_Status_/*	:	unsigned char	*/
+{
+	GPIO_EVENT_STATUS_SUCCESS = 0,
+	GPIO_EVENT_STATUS_FAILED,
+	GPIO_EVENT_STATUS_EMPTY,
+	GPIO_EVENT_STATUS_INVALID_ARGUMENT
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eGPIO_Event_Init_/*	:	unsigned char	*/
+{
+	GPIO_EVENT_INIT_CLOSE = 0,
+	GPIO_EVENT_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for edge of event
+ * */
+enum class eGPIO_Edge_	:	unsigned char
+{
+	GPIO_EDGE_NONE = 0,
+	GPIO_EDGE_RISING,
+	GPIO_EDGE_FALLING,
+	GPIO_EDGE_BOTH
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for GPIO event instance
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	Structure for event record stored in event ring
+ */
+typedef struct tStGPIO_EventRecord_
+{
+	unsigned char route;		/**< Index of route in event route table */
+	unsigned char pin;			/**< Pin number in the port */
+	eGPIO_Edge_ edge;			/**< Detected edge, never GPIO_EDGE_BOTH */
+	unsigned char RES;
+	unsigned long timestamp;	/**< Timer ticks at ISR entry */
+} tStGPIO_EventRecord;
+
+/*
+ * @brief	Structure for pin to ERU routing
+ *
+ * <i>Imp Note:</i>
+ * 			Input A/B values are taken from xmc4_eru_map.h,
+ * 			e.g. ERU0_ETL2_INPUTB_P1_4 with source XMC_ERU_ETL_SOURCE_B
+ */
+typedef struct tStGPIO_EventRoute_
+{
+	tStPinConfig pin_cfg;					/**< Pin which is routed */
+	XMC_ERU_t * p_eru;						/**< ERU module, XMC_ERU0 or XMC_ERU1 */
+	unsigned char etl;						/**< Event trigger logic channel */
+	unsigned char ogu;						/**< Output gating unit, decides NVIC node */
+	XMC_ERU_ETL_INPUT_A_t input_a;			/**< Input A selection */
+	XMC_ERU_ETL_INPUT_B_t input_b;			/**< Input B selection */
+	XMC_ERU_ETL_SOURCE_t source;			/**< Input path combination */
+	eGPIO_Edge_ edge;						/**< Edge(s) generating an event */
+} tStGPIO_EventRoute;
+
+
+#endif /* DRI_GPIO_EVENT_TYPES_H_ */
+
+/********************************** End of File *******************************/
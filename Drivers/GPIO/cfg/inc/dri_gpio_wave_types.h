@@ -0,0 +1,121 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Waveform data types Header
+* Filename:		dri_gpio_wave_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_gpio_wave_types.h
+ *  @brief:	This file contains data types definitions for DMA driven
+ *  		GPIO waveform engine
+ */
+#ifndef DRI_GPIO_WAVE_TYPES_H_
+#define DRI_GPIO_WAVE_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_ccu4.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_gpio_wave_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of waveform engine
+ * */
+enum class eGPIO_Wave_Status_/*	:	unsigned char	*/
+{
+	GPIO_WAVE_STATUS_SUCCESS = 0,
+	GPIO_WAVE_STATUS_FAILED,
+	GPIO_WAVE_STATUS_BUSY,
+	GPIO_WAVE_STATUS_INVALID_ARGUMENT
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eGPIO_Wave_Init_/*	:	unsigned char	*/
+{
+	GPIO_WAVE_INIT_CLOSE = 0,
+	GPIO_WAVE_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for waveform end events
+ * */
+enum class eGPIO_Wave_Event_/*	:	unsigned char	*/
+{
+	GPIO_WAVE_EVENT_DONE = 0,		/**< All loops emitted */
+	GPIO_WAVE_EVENT_ERROR			/**< DMA bus error, output stopped */
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for waveform engine
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	typedef for waveform end callback, called in DMA interrupt
+ */
+typedef void (*gpio_wave_callback_pointer) ( eGPIO_Wave_Event_ event, unsigned long loops );
+
+/*
+ * @brief	Structure for state of running waveform
+ */
+typedef struct tStGPIO_WaveControl_
+{
+	const unsigned long * p_words = nullptr;		/**< OMR words of one loop */
+	unsigned short count = 0U;						/**< Words per loop */
+	unsigned long repeat = 0U;						/**< Loops to emit, 0 - endless */
+	volatile unsigned long loops = 0U;				/**< Loops emitted */
+	volatile unsigned char busy = 0U;				/**< Waveform running */
+	gpio_wave_callback_pointer fp_callback = nullptr;	/**< End notification */
+} tStGPIO_WaveControl;
+
+
+#endif /* DRI_GPIO_WAVE_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,82 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Debounce Configuration Header
+* Filename:		dri_gpio_debounce_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_gpio_debounce_conf.h
+ *  @brief:	This file contains static configurations for GPIO debounce
+ *  		engine and key matrix scanning
+ */
+#ifndef DRI_GPIO_DEBOUNCE_CONF_H_
+#define DRI_GPIO_DEBOUNCE_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Key matrix scanning, 0 - not used, 1 - used */
+#define GPIO_MATRIX_USED			0
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Total ports debounced in system, ports are described in dri_gpio_debounce_conf.cpp */
+#define GPIO_DEBOUNCE_PORTS_USED	1
+
+/* Key matrix size, rows are driven and columns are sampled */
+#define GPIO_MATRIX_ROWS			2
+#define GPIO_MATRIX_MAX_ROWS		16
+
+/* Check ports availability */
+#if ( (0 == GPIO_DEBOUNCE_PORTS_USED) && (0 == GPIO_MATRIX_USED) )
+	#error	"Debounce engine used without ports and matrix"
+#endif
+
+/* Check matrix size */
+#if ( (1 == GPIO_MATRIX_USED) && \
+		((GPIO_MATRIX_ROWS < 1) || (GPIO_MATRIX_ROWS > GPIO_MATRIX_MAX_ROWS)) )
+	#error	"Matrix rows must be within a port"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_GPIO_DEBOUNCE_CONF_H_ */
+
+/********************************** End of File ******************************/
@@ -0,0 +1,124 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Event Configuration Header
+* Filename:		dri_gpio_event_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_gpio_event_conf.h
+ *  @brief:	This file contains static configurations for GPIO edge events
+ */
+#ifndef DRI_GPIO_EVENT_CONF_H_
+#define DRI_GPIO_EVENT_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+#define GPIO_EVENT_MAX_ROUTES		8	/* 4 OGU on ERU0 + 4 OGU on ERU1 */
+
+/* Total routes used in system, routes are described in dri_gpio_event_conf.cpp */
+#define GPIO_EVENT_ROUTES_USED		2
+
+/* Routes used in system, route n is served by its own ERU OGU node */
+#define GPIO_EVENT_ROUTE_0_USED
+#define GPIO_EVENT_ROUTE_1_USED
+
+/* Number of records in event ring, power of 2 */
+#define GPIO_EVENT_RING_SIZE		64
+
+/* All routes share one priority so that ISRs never preempt each other,
+ * which keeps event ring single producer */
+#define GPIO_EVENT_IRQ_PRIORITY		20
+
+/* Free running timestamp timer, two concatenated CCU4 slices give 32 bits.
+ * High slice has to be the next slice of low slice */
+#define GPIO_EVENT_TS_MODULE		CCU43
+#define GPIO_EVENT_TS_SLICE_LO		CCU43_CC40
+#define GPIO_EVENT_TS_SLICE_HI		CCU43_CC41
+#define GPIO_EVENT_TS_SLICE_LO_NUM	0U
+#define GPIO_EVENT_TS_SLICE_HI_NUM	1U
+#define GPIO_EVENT_TS_PRESCALER		XMC_CCU4_SLICE_PRESCALER_1	/* fCCU4 ticks */
+
+
+/* Check routes availability */
+#if (GPIO_EVENT_ROUTES_USED > GPIO_EVENT_MAX_ROUTES)
+	#error	"Cannot route more pins than available ERU output nodes"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Defining functions for GPIO event ISR handlers,
+ * must match ERU module and OGU of route in route table */
+#ifdef GPIO_EVENT_ROUTE_0_USED
+#define GPIO_EVENT_0_HANDLER	IRQ_Hdlr_1	/* ERU0 OGU0 */
+#endif
+
+#ifdef GPIO_EVENT_ROUTE_1_USED
+#define GPIO_EVENT_1_HANDLER	IRQ_Hdlr_2	/* ERU0 OGU1 */
+#endif
+
+#ifdef GPIO_EVENT_ROUTE_2_USED
+#define GPIO_EVENT_2_HANDLER	IRQ_Hdlr_3	/* ERU0 OGU2 */
+#endif
+
+#ifdef GPIO_EVENT_ROUTE_3_USED
+#define GPIO_EVENT_3_HANDLER	IRQ_Hdlr_4	/* ERU0 OGU3 */
+#endif
+
+#ifdef GPIO_EVENT_ROUTE_4_USED
+#define GPIO_EVENT_4_HANDLER	IRQ_Hdlr_5	/* ERU1 OGU0 */
+#endif
+
+#ifdef GPIO_EVENT_ROUTE_5_USED
+#define GPIO_EVENT_5_HANDLER	IRQ_Hdlr_6	/* ERU1 OGU1 */
+#endif
+
+#ifdef GPIO_EVENT_ROUTE_6_USED
+#define GPIO_EVENT_6_HANDLER	IRQ_Hdlr_7	/* ERU1 OGU2 */
+#endif
+
+#ifdef GPIO_EVENT_ROUTE_7_USED
+#define GPIO_EVENT_7_HANDLER	IRQ_Hdlr_8	/* ERU1 OGU3 */
+#endif
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_GPIO_EVENT_CONF_H_ */
+
+/********************************** End of File ******************************/
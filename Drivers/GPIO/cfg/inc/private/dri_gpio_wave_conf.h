@@ -0,0 +1,92 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Waveform Configuration Header
+* Filename:		dri_gpio_wave_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_gpio_wave_conf.h
+ *  @brief:	This file contains static configurations for DMA driven
+ *  		GPIO waveform engine
+ */
+#ifndef DRI_GPIO_WAVE_CONF_H_
+#define DRI_GPIO_WAVE_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Waveform engine, 0 - not used, 1 - used */
+#define GPIO_WAVE_USED				1
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Output port and pins driven by waveform, pins outside of mask are
+ * only touched when a word addresses them. Port 1 is shared with LEDs,
+ * buttons and peripheral pins */
+#define GPIO_WAVE_PORT				XMC_GPIO_PORT1
+#define GPIO_WAVE_PIN_MASK			0x05C0UL	/* P1.6 - P1.8 and P1.10 */
+#define GPIO_WAVE_PIN_MODE			XMC_GPIO_MODE_OUTPUT_PUSH_PULL
+
+/* Pacing timer, one DMA request per period match on service request line.
+ * CCU43 CC40 and CC41 are taken by GPIO event timestamp */
+#define GPIO_WAVE_TIMER_MODULE		CCU43
+#define GPIO_WAVE_TIMER_SLICE		CCU43_CC42
+#define GPIO_WAVE_TIMER_SLICE_NUM	2U
+#define GPIO_WAVE_TIMER_SR			XMC_CCU4_SLICE_SR_ID_0
+#define GPIO_WAVE_TIMER_PRESCALER	XMC_CCU4_SLICE_PRESCALER_1	/* fCCU4 ticks */
+
+/* DMA channel and request line, request has to match timer module and
+ * service request line, see xmc_dma_map.h */
+#define GPIO_WAVE_DMA				XMC_DMA0
+#define GPIO_WAVE_DMA_CHANNEL		4U
+#define GPIO_WAVE_DMA_REQUEST		DMA0_PERIPHERAL_REQUEST_CCU43_SR0_4
+
+/* Words per block, limited by DMA block size */
+#define GPIO_WAVE_MAX_WORDS			4095U
+
+/* Shortest step in timer ticks, a bus transaction and request handshake
+ * have to fit into one step or requests get lost */
+#define GPIO_WAVE_MIN_PERIOD		16U
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_GPIO_WAVE_CONF_H_ */
+
+/********************************** End of File ******************************/
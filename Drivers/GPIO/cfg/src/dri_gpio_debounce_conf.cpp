@@ -0,0 +1,91 @@
+/*****************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Debounce Configuration Source
+* Filename:		dri_gpio_debounce_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_gpio_debounce_conf.cpp
+ *  @brief:	This source file contains port and key matrix tables for
+ *  		GPIO debounce engine
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_gpio_debounce.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+#if( GPIO_DEBOUNCE_PORTS_USED > 0 )
+/*
+ * @brief	Ports debounced as a whole
+ */
+const tStGPIO_DebouncePort g_gpio_debounce_ports[GPIO_DEBOUNCE_PORTS_USED] =
+{
+		{/**< Relax Kit BUTTON1 P1.14 and BUTTON2 P1.15, pulled up on board */
+				XMC_GPIO_PORT1,
+				( (0x1UL << 14U) | (0x1UL << 15U) ),
+				( (0x1UL << 14U) | (0x1UL << 15U) ),
+				XMC_GPIO_MODE_INPUT_TRISTATE
+		}
+};
+#endif	/* GPIO_DEBOUNCE_PORTS_USED */
+
+
+#if( 1 == GPIO_MATRIX_USED )
+/*
+ * @brief	Key matrix, 2 rows on P4.0 - P4.1 and 4 columns on P14.12 - P14.15
+ */
+const tStGPIO_Matrix g_gpio_matrix =
+{
+		XMC_GPIO_PORT4,
+		{ 0, 1 },
+		XMC_GPIO_PORT14,
+		( (0x1UL << 12U) | (0x1UL << 13U) | (0x1UL << 14U) | (0x1UL << 15U) )
+};
+#endif	/* GPIO_MATRIX_USED */
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/*********************************** End of File ******************************/
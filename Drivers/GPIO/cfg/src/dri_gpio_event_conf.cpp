@@ -0,0 +1,257 @@
+/*****************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Event Configuration Source
+* Filename:		dri_gpio_event_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_gpio_event_conf.cpp
+ *  @brief:	This source file contains route table and ISR handlers for
+ *  		GPIO edge events
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_gpio_event.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check event routes usage in system */
+#if( GPIO_EVENT_ROUTES_USED > 0 )
+
+/*
+ * @brief	Route table for GPIO events
+ *
+ * <i>Imp Note:</i>
+ * 			Entry n is served by handler GPIO_EVENT_n_HANDLER, ERU module and
+ * 			OGU of entry have to match handler in dri_gpio_event_conf.h
+ */
+const tStGPIO_EventRoute g_gpio_event_routes[GPIO_EVENT_ROUTES_USED] =
+{
+		{/**< Route 0, P1.4 -> ERU0 ETL2 -> OGU0, both edges */
+				{
+						XMC_GPIO_PORT1,
+						{
+								XMC_GPIO_MODE_INPUT_PULL_UP,
+								XMC_GPIO_OUTPUT_LEVEL_HIGH,
+								XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+						},
+						4
+				},
+				XMC_ERU0,
+				2,
+				0,
+				XMC_ERU_ETL_INPUT_A0,
+				ERU0_ETL2_INPUTB_P1_4,
+				XMC_ERU_ETL_SOURCE_B,
+				eGPIO_Edge_::GPIO_EDGE_BOTH
+		},
+		{/**< Route 1, P0.2 -> ERU0 ETL3 -> OGU1, falling edge */
+				{
+						XMC_GPIO_PORT0,
+						{
+								XMC_GPIO_MODE_INPUT_PULL_UP,
+								XMC_GPIO_OUTPUT_LEVEL_HIGH,
+								XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+						},
+						2
+				},
+				XMC_ERU0,
+				3,
+				1,
+				XMC_ERU_ETL_INPUT_A0,
+				ERU0_ETL3_INPUTB_P0_2,
+				XMC_ERU_ETL_SOURCE_B,
+				eGPIO_Edge_::GPIO_EDGE_FALLING
+		}
+};
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/******* ISR Handlers for GPIO_Event__ routes *******/
+
+extern "C"
+{
+
+#ifdef GPIO_EVENT_0_HANDLER
+/**
+ * @function	GPIO_EVENT_0_HANDLER
+ *
+ * @brief		GPIO event route 0 handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void GPIO_EVENT_0_HANDLER( void )
+{
+	/* Call ISR entry function */
+	GPIO_Event__::isr_entry( 0 );
+}
+#endif	/* GPIO_EVENT_0_HANDLER */
+
+
+#ifdef GPIO_EVENT_1_HANDLER
+/**
+ * @function	GPIO_EVENT_1_HANDLER
+ *
+ * @brief		GPIO event route 1 handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void GPIO_EVENT_1_HANDLER( void )
+{
+	/* Call ISR entry function */
+	GPIO_Event__::isr_entry( 1 );
+}
+#endif	/* GPIO_EVENT_1_HANDLER */
+
+
+#ifdef GPIO_EVENT_2_HANDLER
+/**
+ * @function	GPIO_EVENT_2_HANDLER
+ *
+ * @brief		GPIO event route 2 handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void GPIO_EVENT_2_HANDLER( void )
+{
+	/* Call ISR entry function */
+	GPIO_Event__::isr_entry( 2 );
+}
+#endif	/* GPIO_EVENT_2_HANDLER */
+
+
+#ifdef GPIO_EVENT_3_HANDLER
+/**
+ * @function	GPIO_EVENT_3_HANDLER
+ *
+ * @brief		GPIO event route 3 handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void GPIO_EVENT_3_HANDLER( void )
+{
+	/* Call ISR entry function */
+	GPIO_Event__::isr_entry( 3 );
+}
+#endif	/* GPIO_EVENT_3_HANDLER */
+
+
+#ifdef GPIO_EVENT_4_HANDLER
+/**
+ * @function	GPIO_EVENT_4_HANDLER
+ *
+ * @brief		GPIO event route 4 handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void GPIO_EVENT_4_HANDLER( void )
+{
+	/* Call ISR entry function */
+	GPIO_Event__::isr_entry( 4 );
+}
+#endif	/* GPIO_EVENT_4_HANDLER */
+
+
+#ifdef GPIO_EVENT_5_HANDLER
+/**
+ * @function	GPIO_EVENT_5_HANDLER
+ *
+ * @brief		GPIO event route 5 handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void GPIO_EVENT_5_HANDLER( void )
+{
+	/* Call ISR entry function */
+	GPIO_Event__::isr_entry( 5 );
+}
+#endif	/* GPIO_EVENT_5_HANDLER */
+
+
+#ifdef GPIO_EVENT_6_HANDLER
+/**
+ * @function	GPIO_EVENT_6_HANDLER
+ *
+ * @brief		GPIO event route 6 handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void GPIO_EVENT_6_HANDLER( void )
+{
+	/* Call ISR entry function */
+	GPIO_Event__::isr_entry( 6 );
+}
+#endif	/* GPIO_EVENT_6_HANDLER */
+
+
+#ifdef GPIO_EVENT_7_HANDLER
+/**
+ * @function	GPIO_EVENT_7_HANDLER
+ *
+ * @brief		GPIO event route 7 handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void GPIO_EVENT_7_HANDLER( void )
+{
+	/* Call ISR entry function */
+	GPIO_Event__::isr_entry( 7 );
+}
+#endif	/* GPIO_EVENT_7_HANDLER */
+
+
+}	/* extern "C"{ */
+
+#endif	/* GPIO_EVENT_ROUTES_USED */
+
+/*********************************** End of File ******************************/
@@ -165,6 +165,54 @@ public:
 	static inline void set_hw_ctrl( XMC_GPIO_PORT_t *const p_port,
 						const unsigned char pin, const XMC_GPIO_HWCTRL_t hwctrl
 						);
+
+	/**
+	 * @function	get_port_input
+	 *
+	 * @brief		Read all pins of port at once
+	 *
+	 * @param[in]	port	-	gpio port information
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	port PIN register, bit n is level of pin n
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function samples whole port in a single access
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static inline unsigned long get_port_input( XMC_GPIO_PORT_t *const p_port )
+	{
+		return p_port->IN;
+	}
+
+	/**
+	 * @function	set_port_output
+	 *
+	 * @brief		Modify output of several pins at once
+	 *
+	 * @param[in]	port	-	gpio port information
+	 * @param[in]	omr		-	value for OMR register, bit n sets pin n
+	 * 							and bit (n + 16) resets pin n
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function sets/resets/toggles pins in a single
+	 * 				atomic write, pins not selected are not touched
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static inline void set_port_output( XMC_GPIO_PORT_t *const p_port,
+										const unsigned long omr )
+	{
+		p_port->OMR = omr;
+	}
 };
 
 
@@ -0,0 +1,228 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Debounce API Header
+* Filename:		dri_gpio_debounce.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_gpio_debounce.h
+ *  @brief:	This file contains API function declarations for debouncing
+ *  		whole GPIO ports and scanning key matrix
+ */
+#ifndef DRI_GPIO_DEBOUNCE_H_
+#define DRI_GPIO_DEBOUNCE_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_gpio.h>
+#include <dri_gpio_debounce_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Port and matrix tables, defined in dri_gpio_debounce_conf.cpp */
+#if( GPIO_DEBOUNCE_PORTS_USED > 0 )
+extern const tStGPIO_DebouncePort g_gpio_debounce_ports[GPIO_DEBOUNCE_PORTS_USED];
+#endif
+
+#if( 1 == GPIO_MATRIX_USED )
+extern const tStGPIO_Matrix g_gpio_matrix;
+#endif
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for GPIO debounce engine
+ *
+ ******************************************************************************/
+class GPIO_Debounce__
+{
+/* public members */
+public:
+	/* Constructors */
+	GPIO_Debounce__() = delete;
+	GPIO_Debounce__( GPIO_Debounce__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for debounce engine
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eGPIO_Debounce_Init_	-	GPIO_DEBOUNCE_INIT_OPEN
+	 * 													GPIO_DEBOUNCE_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eGPIO_Debounce_Status_
+	 *          	GPIO_DEBOUNCE_STATUS_SUCCESS:	Operation successful.<BR>
+	 *          	GPIO_DEBOUNCE_STATUS_FAILED:	Operation failed.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function configures pins of port and matrix tables
+	 * 				and takes current levels as debounced state, so no
+	 * 				events are generated for keys held during startup
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eGPIO_Debounce_Status_ init( const eGPIO_Debounce_Init_& init =
+										eGPIO_Debounce_Init_::GPIO_DEBOUNCE_INIT_OPEN );
+
+	/**
+	 * @function	tick
+	 *
+	 * @brief		Sample and debounce all ports, scan one matrix row
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function has to be called at a fixed rate, e.g. from
+	 * 				SysTick_Handler. One port read and a few logic operations
+	 * 				per port, independent of number of keys
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Debounce time is 4 ticks for ports and
+	 * 				4 * GPIO_MATRIX_ROWS ticks for matrix keys
+	 *
+	 */
+	static void tick( void );
+
+	/**
+	 * @function	get_events
+	 *
+	 * @brief		Read and clear latched events of a port
+	 *
+	 * @param[in]	port	-	index in port table
+	 *
+	 * @param[out]	events	-	press and release masks
+	 *
+	 * @return  	eGPIO_Debounce_Status_
+	 *          	GPIO_DEBOUNCE_STATUS_SUCCESS:			Events available.<BR>
+	 *          	GPIO_DEBOUNCE_STATUS_NO_EVENT:			Nothing happened.<BR>
+	 *          	GPIO_DEBOUNCE_STATUS_INVALID_ARGUMENT:	Wrong index.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Bit positions are pin numbers of the port
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eGPIO_Debounce_Status_ get_events( const unsigned char port,
+												tStGPIO_DebounceEvents& events );
+
+	/**
+	 * @function	get_key_events
+	 *
+	 * @brief		Read and clear latched events of a matrix row
+	 *
+	 * @param[in]	row		-	matrix row
+	 *
+	 * @param[out]	events	-	press and release masks
+	 *
+	 * @return  	eGPIO_Debounce_Status_
+	 *          	GPIO_DEBOUNCE_STATUS_SUCCESS:			Events available.<BR>
+	 *          	GPIO_DEBOUNCE_STATUS_NO_EVENT:			Nothing happened.<BR>
+	 *          	GPIO_DEBOUNCE_STATUS_INVALID_ARGUMENT:	Wrong row.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Bit positions are pin numbers of column port
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eGPIO_Debounce_Status_ get_key_events( const unsigned char row,
+													tStGPIO_DebounceEvents& events );
+
+	/******* Setters and Getters *******/
+	/* Debounced level of port pins, 1 - active */
+	static unsigned long get_state( const unsigned char port );
+	/* Debounced keys of matrix row, 1 - pressed */
+	static unsigned long get_key_state( const unsigned char row );
+	/* Input change being counted or matrix scanned, tick() is needed every tick */
+	static bool is_busy( void );
+
+/* private members */
+private:
+	/** Data Members **/
+	#if( GPIO_DEBOUNCE_PORTS_USED > 0 )
+	static tStGPIO_VerticalCounter port_counter[GPIO_DEBOUNCE_PORTS_USED];
+	#endif
+	#if( 1 == GPIO_MATRIX_USED )
+	static tStGPIO_VerticalCounter row_counter[GPIO_MATRIX_ROWS];
+	static unsigned char row_index;
+	#endif
+	static volatile unsigned char init_state;
+
+	/******* Private Member Functions *******/
+
+	/* Run vertical counter on one sample of inputs */
+	static inline void debounce( tStGPIO_VerticalCounter& counter,
+									const unsigned long sample,
+									const unsigned long active_low )
+	{
+		/* Inputs differing from debounced state */
+		const unsigned long delta = (sample ^ counter.state);
+		unsigned long toggle;
+
+		/* Count up where delta is set, clear where not */
+		counter.ct1 = (counter.ct1 ^ counter.ct0) & delta;
+		counter.ct0 = (~counter.ct0) & delta;
+		/* Counter rolled over to 0 with delta still set */
+		toggle = delta & ~(counter.ct0 | counter.ct1);
+		counter.state ^= toggle;
+
+		/* Latch edges in terms of active level */
+		counter.pressed |= toggle & (counter.state ^ active_low);
+		counter.released |= toggle & ~(counter.state ^ active_low);
+	}
+
+	static eGPIO_Debounce_Status_ fetch( tStGPIO_VerticalCounter& counter,
+											tStGPIO_DebounceEvents& events );
+};
+
+
+#endif /* DRI_GPIO_DEBOUNCE_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,190 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Event API Header
+* Filename:		dri_gpio_event.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_gpio_event.h
+ *  @brief:	This file contains API function declarations for GPIO edge
+ *  		events routed through ERU with hardware timestamps
+ */
+#ifndef DRI_GPIO_EVENT_H_
+#define DRI_GPIO_EVENT_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_gpio_event_types.h>
+#include <dri_ring.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Route table, defined in dri_gpio_event_conf.cpp */
+#if( GPIO_EVENT_ROUTES_USED > 0 )
+extern const tStGPIO_EventRoute g_gpio_event_routes[GPIO_EVENT_ROUTES_USED];
+#endif
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for GPIO edge events
+ *
+ ******************************************************************************/
+
+/* Check event routes usage in system */
+#if( GPIO_EVENT_ROUTES_USED > 0 )
+
+class GPIO_Event__
+{
+/* public members */
+public:
+	/* Constructors */
+	GPIO_Event__() = delete;
+	GPIO_Event__( GPIO_Event__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for GPIO events
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eGPIO_Event_Init_	-	GPIO_EVENT_INIT_OPEN
+	 * 												GPIO_EVENT_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eGPIO_Event_Status_
+	 *          	GPIO_EVENT_STATUS_SUCCESS:	Operation successful.<BR>
+	 *          	GPIO_EVENT_STATUS_FAILED:	Operation failed.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function starts the timestamp timer, configures
+	 * 				every route of route table on ERU and enables the NVIC nodes
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eGPIO_Event_Status_ init( const eGPIO_Event_Init_& init =
+										eGPIO_Event_Init_::GPIO_EVENT_INIT_OPEN );
+
+	/**
+	 * @function	read
+	 *
+	 * @brief		Get oldest event out of event ring
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	record	-	event record
+	 *
+	 * @return  	eGPIO_Event_Status_
+	 *          	GPIO_EVENT_STATUS_SUCCESS:	Record available.<BR>
+	 *          	GPIO_EVENT_STATUS_EMPTY:	No event pending.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function pops a record queued by route ISR
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Only one context may read events
+	 *
+	 */
+	static eGPIO_Event_Status_ read( tStGPIO_EventRecord& record )
+	{
+		return ( true == event_ring.pop( record ) ) ?
+				eGPIO_Event_Status_::GPIO_EVENT_STATUS_SUCCESS :
+				eGPIO_Event_Status_::GPIO_EVENT_STATUS_EMPTY;
+	}
+
+	/**
+	 * @function	get_timestamp
+	 *
+	 * @brief		Read 32 bit free running timestamp timer
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	timer ticks
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function reads the concatenated CCU4 slices, high
+	 * 				half is read twice so a carry between reads is not lost
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static inline unsigned long get_timestamp( void )
+	{
+		unsigned long high_l;
+		unsigned long low_l;
+
+		do
+		{
+			high_l = GPIO_EVENT_TS_SLICE_HI->TIMER;
+			low_l = GPIO_EVENT_TS_SLICE_LO->TIMER;
+		} while( high_l != GPIO_EVENT_TS_SLICE_HI->TIMER );
+
+		return ( (high_l << 16U) | (low_l & 0xFFFFU) );
+	}
+
+	/******* Setters and Getters *******/
+	static unsigned long get_pending( void ) { return event_ring.get_count(); }
+	static unsigned long get_dropped( void ) { return event_ring.get_dropped(); }
+
+	/* ISR entry function for GPIO_Event__ class */
+	static void isr_entry( const unsigned char route );
+
+/* private members */
+private:
+	/** Data Members **/
+	static Ring__<tStGPIO_EventRecord, GPIO_EVENT_RING_SIZE> event_ring;
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static void timestamp_init( void );
+	static void route_init( const unsigned char route );
+};
+
+#endif	/* GPIO_EVENT_ROUTES_USED */
+
+
+#endif /* DRI_GPIO_EVENT_H_ */
+
+/********************************** End of File *******************************/
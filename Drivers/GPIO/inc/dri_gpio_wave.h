@@ -0,0 +1,208 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Waveform API Header
+* Filename:		dri_gpio_wave.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_gpio_wave.h
+ *  @brief:	This file contains API function declarations for parallel
+ *  		GPIO patterns written to port OMR by DMA, paced by CCU4
+ */
+#ifndef DRI_GPIO_WAVE_H_
+#define DRI_GPIO_WAVE_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_gpio_wave_types.h>
+#include <dri_dma.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for DMA driven GPIO waveform engine
+ *
+ ******************************************************************************/
+
+/* Check waveform engine usage in system */
+#if( 1 == GPIO_WAVE_USED )
+
+class GPIO_Wave__
+{
+/* public members */
+public:
+	/* Constructors */
+	GPIO_Wave__() = delete;
+	GPIO_Wave__( GPIO_Wave__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for waveform engine
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eGPIO_Wave_Init_	-	GPIO_WAVE_INIT_OPEN
+	 * 												GPIO_WAVE_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eGPIO_Wave_Status_
+	 *          	GPIO_WAVE_STATUS_SUCCESS:	Operation successful.<BR>
+	 *          	GPIO_WAVE_STATUS_FAILED:	Operation failed.<BR>
+	 *          	GPIO_WAVE_STATUS_BUSY:		DMA channel owned by other driver.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function configures output pins, pacing timer and
+	 * 				claims DMA channel. Timer is left stopped
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eGPIO_Wave_Status_ init( const eGPIO_Wave_Init_& init =
+										eGPIO_Wave_Init_::GPIO_WAVE_INIT_OPEN );
+
+	/**
+	 * @function	play
+	 *
+	 * @brief		Start emitting a buffer of OMR words
+	 *
+	 * @param[in]	p_words		-	OMR words, word aligned, valid until done
+	 * 				count		-	words per loop, 1 - GPIO_WAVE_MAX_WORDS
+	 * 				period		-	timer ticks per word, >= GPIO_WAVE_MIN_PERIOD
+	 * 				repeat		-	loops to emit, 0 - endless
+	 * 				fp_callback	-	end notification, may be nullptr
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eGPIO_Wave_Status_
+	 *          	GPIO_WAVE_STATUS_SUCCESS:			Waveform started.<BR>
+	 *          	GPIO_WAVE_STATUS_FAILED:			Engine not initialized.<BR>
+	 *          	GPIO_WAVE_STATUS_BUSY:				Previous waveform running.<BR>
+	 *          	GPIO_WAVE_STATUS_INVALID_ARGUMENT:	Wrong buffer or timing.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Word n is written to port OMR at (n + 1) * period ticks
+	 * 				after start. Each word sets and resets any pins of port
+	 * 				in one bus write, see make_word()
+	 *
+	 * <i>Imp Note:</i>
+	 * 				DMA channel is single block, next loop is re-armed in DMA
+	 * 				interrupt. First step of a loop gets stretched if
+	 * 				interrupt latency exceeds one period
+	 *
+	 */
+	static eGPIO_Wave_Status_ play( const unsigned long * const p_words,
+									const unsigned short count,
+									const unsigned short period,
+									const unsigned long repeat = 1U,
+									gpio_wave_callback_pointer fp_callback = nullptr );
+
+	/**
+	 * @function	stop
+	 *
+	 * @brief		Stop running waveform
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Pins keep levels of last emitted word, no callback
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static void stop( void );
+
+	/**
+	 * @function	make_word
+	 *
+	 * @brief		Build OMR word driving pins to levels
+	 *
+	 * @param[in]	levels	-	bit n: level of pin n
+	 * 				pins	-	bit n: pin n is driven by word
+	 *
+	 * @return  	OMR word, PS bits in lower and PR bits in upper half
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Usable in constant expressions for pattern tables
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static constexpr unsigned long make_word( const unsigned long levels,
+												const unsigned long pins = GPIO_WAVE_PIN_MASK )
+	{
+		return ( ( (pins & ~levels & 0xFFFFUL) << 16U ) | (pins & levels & 0xFFFFUL) );
+	}
+
+	/* OMR word toggling pins, PS and PR both set */
+	static constexpr unsigned long make_toggle( const unsigned long pins )
+	{
+		return ( ( (pins & 0xFFFFUL) << 16U ) | (pins & 0xFFFFUL) );
+	}
+
+	/******* Setters and Getters *******/
+	static inline bool is_busy( void ){ return ( 0U != control.busy ); }
+	static inline unsigned long get_loops( void ){ return control.loops; }
+
+/* private members */
+private:
+	/** Data Members **/
+	static tStGPIO_WaveControl control;
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static void timer_init( void );
+	static void dma_event( XMC_DMA_CH_EVENT_t event );
+	static void finish( void );
+};
+
+#endif	/* GPIO_WAVE_USED */
+
+
+#endif /* DRI_GPIO_WAVE_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,412 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Debounce API Source
+* Filename:		dri_gpio_debounce.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_gpio_debounce.cpp
+ *  @brief:	This source file contains API function definitions for
+ *  		GPIO debounce engine and key matrix scanning.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_gpio_debounce.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* OMR values to drive a pin high or low */
+#define GPIO_OMR_SET( pin )			( 0x1UL << (pin) )
+#define GPIO_OMR_RESET( pin )		( 0x10000UL << (pin) )
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Declare static data member
+ *
+ * Note: Tell linker to take variable from this source file
+ * */
+#if( GPIO_DEBOUNCE_PORTS_USED > 0 )
+tStGPIO_VerticalCounter GPIO_Debounce__::port_counter[GPIO_DEBOUNCE_PORTS_USED];
+#endif
+#if( 1 == GPIO_MATRIX_USED )
+tStGPIO_VerticalCounter GPIO_Debounce__::row_counter[GPIO_MATRIX_ROWS];
+unsigned char GPIO_Debounce__::row_index = 0;
+#endif
+volatile unsigned char GPIO_Debounce__::init_state = 0;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/******* Public Member function for GPIO_Debounce__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for debounce engine
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eGPIO_Debounce_Status_ GPIO_Debounce__::init( const eGPIO_Debounce_Init_& init )
+{
+	/* Local Variables */
+	eGPIO_Debounce_Status_ ret_status = eGPIO_Debounce_Status_::GPIO_DEBOUNCE_STATUS_FAILED;
+	unsigned char index = 0;
+	unsigned char pin = 0;
+	XMC_GPIO_CONFIG_t pin_cfg = { XMC_GPIO_MODE_INPUT_TRISTATE,
+									XMC_GPIO_OUTPUT_LEVEL_HIGH,
+									XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE };
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open debounce engine */
+		case eGPIO_Debounce_Init_::GPIO_DEBOUNCE_INIT_OPEN:
+			/* Check for initialization */
+			if( init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			#if( GPIO_DEBOUNCE_PORTS_USED > 0 )
+			for( index = 0; index < GPIO_DEBOUNCE_PORTS_USED; ++index )
+			{
+				/* Configure masked pins of port */
+				pin_cfg.mode = g_gpio_debounce_ports[index].mode;
+				for( pin = 0; pin < 16U; ++pin )
+				{
+					if( 0U != (g_gpio_debounce_ports[index].mask & (0x1UL << pin)) )
+					{
+						XMC_GPIO_Init( g_gpio_debounce_ports[index].p_port, pin, &pin_cfg );
+					}
+				}
+
+				/* Start from current levels */
+				port_counter[index].ct0 = 0U;
+				port_counter[index].ct1 = 0U;
+				port_counter[index].state = GPIO__::get_port_input( g_gpio_debounce_ports[index].p_port ) &
+											g_gpio_debounce_ports[index].mask;
+				port_counter[index].pressed = 0U;
+				port_counter[index].released = 0U;
+			}
+			#endif	/* GPIO_DEBOUNCE_PORTS_USED */
+
+			#if( 1 == GPIO_MATRIX_USED )
+			/* Columns pulled up */
+			pin_cfg.mode = XMC_GPIO_MODE_INPUT_PULL_UP;
+			for( pin = 0; pin < 16U; ++pin )
+			{
+				if( 0U != (g_gpio_matrix.col_mask & (0x1UL << pin)) )
+				{
+					XMC_GPIO_Init( g_gpio_matrix.p_col_port, pin, &pin_cfg );
+				}
+			}
+
+			/* Rows released, open drain high is high impedance */
+			pin_cfg.mode = XMC_GPIO_MODE_OUTPUT_OPEN_DRAIN;
+			pin_cfg.output_level = XMC_GPIO_OUTPUT_LEVEL_HIGH;
+			for( index = 0; index < GPIO_MATRIX_ROWS; ++index )
+			{
+				XMC_GPIO_Init( g_gpio_matrix.p_row_port, g_gpio_matrix.row_pins[index], &pin_cfg );
+				/* All keys released at start, columns idle high */
+				row_counter[index].ct0 = 0U;
+				row_counter[index].ct1 = 0U;
+				row_counter[index].state = g_gpio_matrix.col_mask;
+				row_counter[index].pressed = 0U;
+				row_counter[index].released = 0U;
+			}
+
+			/* Drive first row, sampled on next tick */
+			row_index = 0;
+			GPIO__::set_port_output( g_gpio_matrix.p_row_port,
+										GPIO_OMR_RESET( g_gpio_matrix.row_pins[0] ) );
+			#endif	/* GPIO_MATRIX_USED */
+
+			/* Set initialize state */
+			init_state = 1;
+			/* Update return status */
+			ret_status = eGPIO_Debounce_Status_::GPIO_DEBOUNCE_STATUS_SUCCESS;
+			break;
+
+		/* Close debounce engine */
+		case eGPIO_Debounce_Init_::GPIO_DEBOUNCE_INIT_CLOSE:
+			/* Stop sampling first */
+			init_state = 0;
+
+			#if( 1 == GPIO_MATRIX_USED )
+			/* Release driven row */
+			GPIO__::set_port_output( g_gpio_matrix.p_row_port,
+										GPIO_OMR_SET( g_gpio_matrix.row_pins[row_index] ) );
+			#endif	/* GPIO_MATRIX_USED */
+
+			/* Update return status */
+			ret_status = eGPIO_Debounce_Status_::GPIO_DEBOUNCE_STATUS_SUCCESS;
+			break;
+
+		/* Default parameters, invalid argument */
+		default:
+			ret_status = eGPIO_Debounce_Status_::GPIO_DEBOUNCE_STATUS_INVALID_ARGUMENT;
+			break;
+	}
+
+	/* Suppress warnings for unused configurations */
+	(void) index;
+	(void) pin;
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/**
+ * @function	tick
+ *
+ * @brief		Periodic sampling of ports and matrix
+ *
+ * <i>Imp Note:</i>
+ * 				Matrix row driven on previous tick is sampled first, so row
+ * 				has a full tick to settle before its columns are read
+ *
+ */
+void GPIO_Debounce__::tick( void )
+{
+	/* Local Variables */
+	unsigned char index = 0;
+
+	/* Check for initialization */
+	if( 0U == init_state ){ return; }
+	else{	/* Good to go */	}
+
+	#if( GPIO_DEBOUNCE_PORTS_USED > 0 )
+	for( index = 0; index < GPIO_DEBOUNCE_PORTS_USED; ++index )
+	{
+		debounce( port_counter[index],
+					GPIO__::get_port_input( g_gpio_debounce_ports[index].p_port ) &
+					g_gpio_debounce_ports[index].mask,
+					g_gpio_debounce_ports[index].active_low
+					);
+	}
+	#endif	/* GPIO_DEBOUNCE_PORTS_USED */
+
+	#if( 1 == GPIO_MATRIX_USED )
+	/* Columns of driven row */
+	debounce( row_counter[row_index],
+				GPIO__::get_port_input( g_gpio_matrix.p_col_port ) & g_gpio_matrix.col_mask,
+				g_gpio_matrix.col_mask
+				);
+
+	/* Release current row and drive next one */
+	index = ( (row_index + 1U) < GPIO_MATRIX_ROWS ) ? (row_index + 1U) : 0U;
+	GPIO__::set_port_output( g_gpio_matrix.p_row_port,
+								GPIO_OMR_SET( g_gpio_matrix.row_pins[row_index] ) |
+								GPIO_OMR_RESET( g_gpio_matrix.row_pins[index] )
+								);
+	row_index = index;
+	#endif	/* GPIO_MATRIX_USED */
+
+	/* Suppress warnings for unused configurations */
+	(void) index;
+}
+
+
+/**
+ * @function	get_events
+ *
+ * @brief		Read and clear latched events of a port
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eGPIO_Debounce_Status_ GPIO_Debounce__::get_events( const unsigned char port,
+													tStGPIO_DebounceEvents& events )
+{
+	#if( GPIO_DEBOUNCE_PORTS_USED > 0 )
+	/* Input argument validity */
+	DRIVER_ASSERT( port >= GPIO_DEBOUNCE_PORTS_USED,
+					eGPIO_Debounce_Status_::GPIO_DEBOUNCE_STATUS_INVALID_ARGUMENT );
+
+	return fetch( port_counter[port], events );
+	#else
+	(void) port;
+	(void) events;
+	return eGPIO_Debounce_Status_::GPIO_DEBOUNCE_STATUS_INVALID_ARGUMENT;
+	#endif
+}
+
+
+/**
+ * @function	get_key_events
+ *
+ * @brief		Read and clear latched events of a matrix row
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eGPIO_Debounce_Status_ GPIO_Debounce__::get_key_events( const unsigned char row,
+														tStGPIO_DebounceEvents& events )
+{
+	#if( 1 == GPIO_MATRIX_USED )
+	/* Input argument validity */
+	DRIVER_ASSERT( row >= GPIO_MATRIX_ROWS,
+					eGPIO_Debounce_Status_::GPIO_DEBOUNCE_STATUS_INVALID_ARGUMENT );
+
+	return fetch( row_counter[row], events );
+	#else
+	(void) row;
+	(void) events;
+	return eGPIO_Debounce_Status_::GPIO_DEBOUNCE_STATUS_INVALID_ARGUMENT;
+	#endif
+}
+
+
+/**
+ * @function	get_state
+ *
+ * @brief		Debounced level of port pins
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned long GPIO_Debounce__::get_state( const unsigned char port )
+{
+	#if( GPIO_DEBOUNCE_PORTS_USED > 0 )
+	/* Input argument validity */
+	DRIVER_ASSERT( port >= GPIO_DEBOUNCE_PORTS_USED, 0U );
+
+	return ( (port_counter[port].state ^ g_gpio_debounce_ports[port].active_low) &
+				g_gpio_debounce_ports[port].mask );
+	#else
+	(void) port;
+	return 0U;
+	#endif
+}
+
+
+/**
+ * @function	get_key_state
+ *
+ * @brief		Debounced keys of matrix row
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned long GPIO_Debounce__::get_key_state( const unsigned char row )
+{
+	#if( 1 == GPIO_MATRIX_USED )
+	/* Input argument validity */
+	DRIVER_ASSERT( row >= GPIO_MATRIX_ROWS, 0U );
+
+	return ( (~row_counter[row].state) & g_gpio_matrix.col_mask );
+	#else
+	(void) row;
+	return 0U;
+	#endif
+}
+
+
+/**
+ * @function	is_busy
+ *
+ * @brief		Check for work that needs every tick
+ *
+ * <i>Imp Note:</i>
+ * 				A counter off zero is counting a changed input. Matrix
+ * 				rows are scanned one per tick, so matrix is always busy
+ *
+ */
+bool GPIO_Debounce__::is_busy( void )
+{
+	/* Local Variables */
+	bool busy_l = false;
+	unsigned char index = 0;
+
+	if( 0U == init_state ){ return false; }
+	else{	/* Not required */	}
+
+	#if( GPIO_DEBOUNCE_PORTS_USED > 0 )
+	for( index = 0; index < GPIO_DEBOUNCE_PORTS_USED; ++index )
+	{
+		if( 0U != (port_counter[index].ct0 | port_counter[index].ct1) ){ busy_l = true; }
+		else{	/* Not required */	}
+	}
+	#endif	/* GPIO_DEBOUNCE_PORTS_USED */
+
+	#if( 1 == GPIO_MATRIX_USED )
+	busy_l = true;
+	#endif	/* GPIO_MATRIX_USED */
+
+	/* Suppress warnings for unused configurations */
+	(void) index;
+
+	return busy_l;
+}
+
+
+/******* Private Member function for GPIO_Debounce__ class *******/
+
+/**
+ * @function	fetch
+ *
+ * @brief		Read and clear latched events of a counter
+ *
+ * <i>Imp Note:</i>
+ * 				Interrupts are masked only for the copy and clear,
+ * 				so a tick cannot slip in between
+ *
+ */
+eGPIO_Debounce_Status_ GPIO_Debounce__::fetch( tStGPIO_VerticalCounter& counter,
+												tStGPIO_DebounceEvents& events )
+{
+	/* Local Variables */
+	const unsigned long primask_l = __get_PRIMASK();
+
+	__disable_irq();
+	events.pressed = counter.pressed;
+	events.released = counter.released;
+	counter.pressed = 0U;
+	counter.released = 0U;
+	__set_PRIMASK( primask_l );
+
+	return ( 0U != (events.pressed | events.released) ) ?
+			eGPIO_Debounce_Status_::GPIO_DEBOUNCE_STATUS_SUCCESS :
+			eGPIO_Debounce_Status_::GPIO_DEBOUNCE_STATUS_NO_EVENT;
+}
+
+
+/********************************** End of File *******************************/
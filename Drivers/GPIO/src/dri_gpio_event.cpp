@@ -0,0 +1,294 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Event API Source
+* Filename:		dri_gpio_event.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_gpio_event.cpp
+ *  @brief:	This source file contains API function definitions for
+ *  		GPIO edge events on ERU with CCU4 timestamps.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_gpio_event.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check event routes usage in system */
+#if( GPIO_EVENT_ROUTES_USED > 0 )
+
+/* Declare static data member
+ *
+ * Note: Tell linker to take variable from this source file
+ * */
+Ring__<tStGPIO_EventRecord, GPIO_EVENT_RING_SIZE> GPIO_Event__::event_ring;
+unsigned char GPIO_Event__::init_state = 0;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/******* Public Member function for GPIO_Event__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for GPIO events
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eGPIO_Event_Status_ GPIO_Event__::init( const eGPIO_Event_Init_& init )
+{
+	/* Local Variables */
+	eGPIO_Event_Status_ ret_status = eGPIO_Event_Status_::GPIO_EVENT_STATUS_FAILED;
+	unsigned char route = 0;
+	IRQn_Type irq_l;
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open event routes */
+		case eGPIO_Event_Init_::GPIO_EVENT_INIT_OPEN:
+			/* Check for initialization */
+			if( init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			/* Timer first, so very first event already gets valid time */
+			timestamp_init();
+
+			for( route = 0; route < GPIO_EVENT_ROUTES_USED; ++route )
+			{
+				route_init( route );
+			}
+
+			/* Set initialize state */
+			init_state = 1;
+			/* Update return status */
+			ret_status = eGPIO_Event_Status_::GPIO_EVENT_STATUS_SUCCESS;
+			break;
+
+		/* Close event routes */
+		case eGPIO_Event_Init_::GPIO_EVENT_INIT_CLOSE:
+			for( route = 0; route < GPIO_EVENT_ROUTES_USED; ++route )
+			{
+				irq_l = static_cast<IRQn_Type>( ( ( XMC_ERU0 == g_gpio_event_routes[route].p_eru ) ?
+								ERU0_0_IRQn : ERU1_0_IRQn ) + g_gpio_event_routes[route].ogu );
+				NVIC_DisableIRQ( irq_l );
+				XMC_ERU_ETL_SetEdgeDetection( g_gpio_event_routes[route].p_eru,
+												g_gpio_event_routes[route].etl,
+												XMC_ERU_ETL_EDGE_DETECTION_DISABLED
+												);
+			}
+
+			/* Stop timestamp timer */
+			XMC_CCU4_SLICE_StopClearTimer( GPIO_EVENT_TS_SLICE_LO );
+			XMC_CCU4_SLICE_StopClearTimer( GPIO_EVENT_TS_SLICE_HI );
+
+			/* Drop events of closed session */
+			event_ring.flush();
+
+			/* Reset control state */
+			init_state = 0;
+			/* Update return status */
+			ret_status = eGPIO_Event_Status_::GPIO_EVENT_STATUS_SUCCESS;
+			break;
+
+		/* Default parameters, invalid argument */
+		default:
+			ret_status = eGPIO_Event_Status_::GPIO_EVENT_STATUS_INVALID_ARGUMENT;
+			break;
+	}
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/******* Private Member function for GPIO_Event__ class *******/
+
+/**
+ * @function	timestamp_init
+ *
+ * @brief		Start free running 32 bit timestamp timer
+ *
+ * \par<b>Description:</b><br>
+ * 				Low slice counts module clock with full period, high slice
+ * 				is concatenated and counts low slice period matches
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void GPIO_Event__::timestamp_init( void )
+{
+	/* Local Variables */
+	XMC_CCU4_SLICE_COMPARE_CONFIG_t slice_cfg = {};
+
+	/* Enable module and prescaler, does not disturb other slices */
+	XMC_CCU4_Init( GPIO_EVENT_TS_MODULE, XMC_CCU4_SLICE_MCMS_ACTION_TRANSFER_PR_CR );
+
+	/* Low slice */
+	slice_cfg.timer_mode = (unsigned long) XMC_CCU4_SLICE_TIMER_COUNT_MODE_EA;
+	slice_cfg.monoshot = (unsigned long) XMC_CCU4_SLICE_TIMER_REPEAT_MODE_REPEAT;
+	slice_cfg.prescaler_initval = (unsigned long) GPIO_EVENT_TS_PRESCALER;
+	XMC_CCU4_SLICE_CompareInit( GPIO_EVENT_TS_SLICE_LO, &slice_cfg );
+
+	/* High slice, counts on period match of low slice */
+	slice_cfg.timer_concatenation = 1U;
+	XMC_CCU4_SLICE_CompareInit( GPIO_EVENT_TS_SLICE_HI, &slice_cfg );
+
+	/* Full 16 bit period for both halves */
+	XMC_CCU4_SLICE_SetTimerPeriodMatch( GPIO_EVENT_TS_SLICE_LO, 0xFFFFU );
+	XMC_CCU4_SLICE_SetTimerPeriodMatch( GPIO_EVENT_TS_SLICE_HI, 0xFFFFU );
+	XMC_CCU4_EnableShadowTransfer( GPIO_EVENT_TS_MODULE,
+			( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_SLICE_0 << (4U * GPIO_EVENT_TS_SLICE_LO_NUM) ) |
+			( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_SLICE_0 << (4U * GPIO_EVENT_TS_SLICE_HI_NUM) )
+			);
+
+	/* Enable slice clocks and run */
+	XMC_CCU4_EnableClock( GPIO_EVENT_TS_MODULE, GPIO_EVENT_TS_SLICE_LO_NUM );
+	XMC_CCU4_EnableClock( GPIO_EVENT_TS_MODULE, GPIO_EVENT_TS_SLICE_HI_NUM );
+	XMC_CCU4_SLICE_StartTimer( GPIO_EVENT_TS_SLICE_HI );
+	XMC_CCU4_SLICE_StartTimer( GPIO_EVENT_TS_SLICE_LO );
+}
+
+
+/**
+ * @function	route_init
+ *
+ * @brief		Route one pin through ERU to its NVIC node
+ *
+ * @param[in]	route	-	index in route table
+ *
+ * \par<b>Description:</b><br>
+ * 				Pin -> ETL (edge detection, trigger pulse) -> OGU
+ * 				(service request on trigger) -> NVIC
+ *
+ * <i>Imp Note:</i>
+ * 				eGPIO_Edge_ values match XMC_ERU_ETL_EDGE_DETECTION_t
+ *
+ */
+void GPIO_Event__::route_init( const unsigned char route )
+{
+	/* Local Variables */
+	const tStGPIO_EventRoute& route_l = g_gpio_event_routes[route];
+	XMC_ERU_ETL_CONFIG_t etl_cfg = {};
+	XMC_ERU_OGU_CONFIG_t ogu_cfg = {};
+	IRQn_Type irq_l = static_cast<IRQn_Type>( ( ( XMC_ERU0 == route_l.p_eru ) ?
+								ERU0_0_IRQn : ERU1_0_IRQn ) + route_l.ogu );
+
+	/* Pin as input */
+	XMC_GPIO_Init( route_l.pin_cfg.p_port, route_l.pin_cfg.pin, &route_l.pin_cfg.config );
+
+	/* Event trigger logic */
+	etl_cfg.input_a = (unsigned long) route_l.input_a;
+	etl_cfg.input_b = (unsigned long) route_l.input_b;
+	etl_cfg.source = (unsigned long) route_l.source;
+	etl_cfg.edge_detection = (unsigned long) route_l.edge;
+	etl_cfg.enable_output_trigger = 1U;
+	etl_cfg.output_trigger_channel = route_l.ogu;
+	etl_cfg.status_flag_mode = (unsigned long) XMC_ERU_ETL_STATUS_FLAG_MODE_HWCTRL;
+	XMC_ERU_ETL_Init( route_l.p_eru, route_l.etl, &etl_cfg );
+
+	/* Output gating, service request on every trigger pulse */
+	ogu_cfg.service_request = (unsigned long) XMC_ERU_OGU_SERVICE_REQUEST_ON_TRIGGER;
+	XMC_ERU_OGU_Init( route_l.p_eru, route_l.ogu, &ogu_cfg );
+
+	/* Set priority and enable NVIC node */
+	NVIC_ClearPendingIRQ( irq_l );
+	NVIC_SetPriority( irq_l, NVIC_EncodePriority(NVIC_GetPriorityGrouping(),
+						GPIO_EVENT_IRQ_PRIORITY, 0U)
+					);
+	NVIC_EnableIRQ( irq_l );
+}
+
+
+/******* ISR entries for GPIO_Event__ class *******/
+
+/**
+ * @function	isr_entry
+ *
+ * @brief		Handler function for route interrupt
+ *
+ * @param[in]	route	-	index in route table
+ *
+ * \par<b>Description:</b><br>
+ * 				Timestamp is taken first to keep latency jitter out of it,
+ * 				record is then built in place in event ring
+ *
+ * <i>Imp Note:</i>
+ * 				For both edges the pin level is sampled to find the edge,
+ * 				pulses shorter than ISR latency are reported with same edge
+ *
+ */
+void GPIO_Event__::isr_entry( const unsigned char route )
+{
+	/* Local Variables */
+	const unsigned long timestamp_l = get_timestamp();
+	const tStGPIO_EventRoute& route_l = g_gpio_event_routes[route];
+	tStGPIO_EventRecord * p_record = event_ring.claim();
+
+	/* Check free space, lost events are counted by ring */
+	if( nullptr != p_record )
+	{
+		p_record->route = route;
+		p_record->pin = route_l.pin_cfg.pin;
+		p_record->timestamp = timestamp_l;
+
+		if( eGPIO_Edge_::GPIO_EDGE_BOTH == route_l.edge )
+		{
+			p_record->edge = ( 0U != XMC_GPIO_GetInput( route_l.pin_cfg.p_port, route_l.pin_cfg.pin ) ) ?
+								eGPIO_Edge_::GPIO_EDGE_RISING : eGPIO_Edge_::GPIO_EDGE_FALLING;
+		}
+		else
+		{
+			p_record->edge = route_l.edge;
+		}
+
+		event_ring.commit();
+	}
+}
+
+#endif	/* GPIO_EVENT_ROUTES_USED */
+
+/********************************** End of File *******************************/
@@ -56,7 +56,7 @@
 /*
  * @brief Array size used for Pin configuration
  */
-static constexpr auto sg_pins_array_size (8);
+static constexpr auto sg_pins_array_size (27);
 
 /*
  * @brief Structure array used for Pin configuration
@@ -117,7 +117,7 @@ static const tStPinConfig sg_gpio_pins[::sg_pins_array_size] =
 				},
 				5
 		},
-		{/**< Port information for UART RX2 Pin 0 on port 0, UART Channel 3 */
+		{/**< Port information for SPI MISO Pin 0 on port 0, SPI Channel 3 */
 				XMC_GPIO_PORT0,
 				{
 						XMC_GPIO_MODE_INPUT_TRISTATE,
@@ -126,7 +126,7 @@ static const tStPinConfig sg_gpio_pins[::sg_pins_array_size] =
 				},
 				0
 		},
-		{/**< Port information for UART TX2 Pin 1 on port 0, UART Channel 3 */
+		{/**< Port information for SPI MOSI Pin 1 on port 0, SPI Channel 3 */
 				XMC_GPIO_PORT0,
 				{
 						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT2,
@@ -134,6 +134,177 @@ static const tStPinConfig sg_gpio_pins[::sg_pins_array_size] =
 						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
 				},
 				1
+		},
+		{/**< Port information for SPI SCLK Pin 10 on port 0, SPI Channel 3 */
+				XMC_GPIO_PORT0,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT2,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				10
+		},
+		{/**< Port information for SPI CS0 Pin 12 on port 0, SPI Channel 3 device 0 */
+				XMC_GPIO_PORT0,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL,
+						XMC_GPIO_OUTPUT_LEVEL_HIGH,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				12
+		},
+		{/**< Port information for SPI CS1 Pin 8 on port 0, SPI Channel 3 device 1 */
+				XMC_GPIO_PORT0,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL,
+						XMC_GPIO_OUTPUT_LEVEL_HIGH,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				8
+		},
+		{/**< Port information for I2C SCL Pin 6 on port 3, I2C Channel 5 */
+				XMC_GPIO_PORT3,
+				{
+						XMC_GPIO_MODE_OUTPUT_OPEN_DRAIN_ALT1,
+						XMC_GPIO_OUTPUT_LEVEL_HIGH,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				6
+		},
+		{/**< Port information for I2C SDA Pin 5 on port 3, I2C Channel 5 */
+				XMC_GPIO_PORT3,
+				{
+						XMC_GPIO_MODE_OUTPUT_OPEN_DRAIN_ALT1,
+						XMC_GPIO_OUTPUT_LEVEL_HIGH,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				5
+		},
+		{/**< Port information for CAN TXD Pin 2 on port 3, CAN Node 0 */
+				XMC_GPIO_PORT3,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT2,
+						XMC_GPIO_OUTPUT_LEVEL_HIGH,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				2
+		},
+		{/**< Port information for CAN RXD Pin 5 on port 1, CAN Node 0 */
+				XMC_GPIO_PORT1,
+				{
+						XMC_GPIO_MODE_INPUT_TRISTATE,
+						XMC_GPIO_OUTPUT_LEVEL_HIGH,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				5
+		},
+		{/**< Port information for CAN TXD Pin 12 on port 1, CAN Node 1 */
+				XMC_GPIO_PORT1,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT2,
+						XMC_GPIO_OUTPUT_LEVEL_HIGH,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				12
+		},
+		{/**< Port information for CAN RXD Pin 13 on port 1, CAN Node 1 */
+				XMC_GPIO_PORT1,
+				{
+						XMC_GPIO_MODE_INPUT_TRISTATE,
+						XMC_GPIO_OUTPUT_LEVEL_HIGH,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				13
+		},
+		{/**< Port information for ETH MDIO Pin 0 on port 2, direction switched by MAC */
+				XMC_GPIO_PORT2,
+				{
+						XMC_GPIO_MODE_INPUT_TRISTATE,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_MEDIUM_EDGE
+				},
+				0
+		},
+		{/**< Port information for ETH RXD0 Pin 2 on port 2 */
+				XMC_GPIO_PORT2,
+				{
+						XMC_GPIO_MODE_INPUT_TRISTATE,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_MEDIUM_EDGE
+				},
+				2
+		},
+		{/**< Port information for ETH RXD1 Pin 3 on port 2 */
+				XMC_GPIO_PORT2,
+				{
+						XMC_GPIO_MODE_INPUT_TRISTATE,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_MEDIUM_EDGE
+				},
+				3
+		},
+		{/**< Port information for ETH RXER Pin 4 on port 2 */
+				XMC_GPIO_PORT2,
+				{
+						XMC_GPIO_MODE_INPUT_TRISTATE,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_MEDIUM_EDGE
+				},
+				4
+		},
+		{/**< Port information for ETH TX_EN Pin 5 on port 2 */
+				XMC_GPIO_PORT2,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT1,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_MEDIUM_EDGE
+				},
+				5
+		},
+		{/**< Port information for ETH MDC Pin 7 on port 2 */
+				XMC_GPIO_PORT2,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT1,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_MEDIUM_EDGE
+				},
+				7
+		},
+		{/**< Port information for ETH TXD0 Pin 8 on port 2 */
+				XMC_GPIO_PORT2,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT1,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_MEDIUM_EDGE
+				},
+				8
+		},
+		{/**< Port information for ETH TXD1 Pin 9 on port 2 */
+				XMC_GPIO_PORT2,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT1,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_MEDIUM_EDGE
+				},
+				9
+		},
+		{/**< Port information for ETH REF_CLK Pin 8 on port 15 */
+				XMC_GPIO_PORT15,
+				{
+						XMC_GPIO_MODE_INPUT_TRISTATE,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_MEDIUM_EDGE
+				},
+				8
+		},
+		{/**< Port information for ETH CRS_DV Pin 9 on port 15 */
+				XMC_GPIO_PORT15,
+				{
+						XMC_GPIO_MODE_INPUT_TRISTATE,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_MEDIUM_EDGE
+				},
+				9
 		}
 };
 
@@ -0,0 +1,370 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Waveform API Source
+* Filename:		dri_gpio_wave.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_gpio_wave.cpp
+ *  @brief:	This source file contains API function definitions for
+ *  		DMA driven GPIO waveform engine.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_gpio_wave.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* DLR line of DMA request */
+#define GPIO_WAVE_DMA_LINE		( GPIO_WAVE_DMA_REQUEST & 0x0FU )
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check waveform engine usage in system */
+#if( 1 == GPIO_WAVE_USED )
+
+/* Declare static data member
+ *
+ * Note: Tell linker to take variable from this source file
+ * */
+tStGPIO_WaveControl GPIO_Wave__::control;
+unsigned char GPIO_Wave__::init_state = 0;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/******* Public Member function for GPIO_Wave__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for waveform engine
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eGPIO_Wave_Status_ GPIO_Wave__::init( const eGPIO_Wave_Init_& init )
+{
+	/* Local Variables */
+	eGPIO_Wave_Status_ ret_status = eGPIO_Wave_Status_::GPIO_WAVE_STATUS_FAILED;
+	XMC_DMA_CH_CONFIG_t dma_cfg = {};
+	eDMA_Status_ dma_status_l;
+	const XMC_GPIO_CONFIG_t pin_cfg =
+	{
+			GPIO_WAVE_PIN_MODE,
+			XMC_GPIO_OUTPUT_LEVEL_LOW,
+			XMC_GPIO_OUTPUT_STRENGTH_STRONG_SHARP_EDGE
+	};
+	unsigned char pin = 0;
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open waveform engine */
+		case eGPIO_Wave_Init_::GPIO_WAVE_INIT_OPEN:
+			/* Check for initialization */
+			if( init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			/* Memory to port OMR, one 32 bit word per timer request */
+			dma_cfg.enable_interrupt = 1U;
+			dma_cfg.dst_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_32;
+			dma_cfg.src_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_32;
+			dma_cfg.dst_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+			dma_cfg.src_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+			dma_cfg.dst_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+			dma_cfg.src_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+			dma_cfg.transfer_flow = (unsigned long) XMC_DMA_CH_TRANSFER_FLOW_M2P_DMA;
+			dma_cfg.dst_addr = (unsigned long) &(GPIO_WAVE_PORT->OMR);
+			dma_cfg.block_size = 1U;
+			dma_cfg.transfer_type = XMC_DMA_CH_TRANSFER_TYPE_SINGLE_BLOCK;
+			dma_cfg.priority = XMC_DMA_CH_PRIORITY_7;
+			dma_cfg.src_handshaking = XMC_DMA_CH_SRC_HANDSHAKING_SOFTWARE;
+			dma_cfg.dst_handshaking = XMC_DMA_CH_DST_HANDSHAKING_HARDWARE;
+			dma_cfg.dst_peripheral_request = GPIO_WAVE_DMA_REQUEST;
+
+			dma_status_l = DMA__::channel_open( GPIO_WAVE_DMA, GPIO_WAVE_DMA_CHANNEL, dma_cfg,
+										( (unsigned long) XMC_DMA_CH_EVENT_TRANSFER_COMPLETE |
+										  (unsigned long) XMC_DMA_CH_EVENT_ERROR ),
+										dma_event );
+
+			/* Leave pins and timer untouched without DMA channel */
+			if( eDMA_Status_::DMA_STATUS_BUSY == dma_status_l )
+			{
+				ret_status = eGPIO_Wave_Status_::GPIO_WAVE_STATUS_BUSY;
+				break;
+			}
+			else if( eDMA_Status_::DMA_STATUS_SUCCESS != dma_status_l ){ break; }
+			else{	/* Not required */	}
+
+			/* Output pins */
+			for( pin = 0; pin < 16U; ++pin )
+			{
+				if( 0U != ( GPIO_WAVE_PIN_MASK & (0x1UL << pin) ) )
+				{
+					XMC_GPIO_Init( GPIO_WAVE_PORT, pin, &pin_cfg );
+				}
+				else{	/* Not required */	}
+			}
+
+			/* Pacing timer */
+			timer_init();
+
+			/* Set initialize state */
+			init_state = 1;
+			/* Update return status */
+			ret_status = eGPIO_Wave_Status_::GPIO_WAVE_STATUS_SUCCESS;
+			break;
+
+		/* Close waveform engine */
+		case eGPIO_Wave_Init_::GPIO_WAVE_INIT_CLOSE:
+			stop();
+
+			XMC_CCU4_SLICE_DisableEvent( GPIO_WAVE_TIMER_SLICE, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH );
+			XMC_CCU4_DisableClock( GPIO_WAVE_TIMER_MODULE, GPIO_WAVE_TIMER_SLICE_NUM );
+
+			if( init_state > 0 )
+			{
+				XMC_DMA_DisableRequestLine( GPIO_WAVE_DMA, GPIO_WAVE_DMA_LINE );
+				(void) DMA__::channel_close( GPIO_WAVE_DMA, GPIO_WAVE_DMA_CHANNEL );
+			}
+			else{	/* Not required */	}
+
+			/* Reset control state */
+			init_state = 0;
+			/* Update return status */
+			ret_status = eGPIO_Wave_Status_::GPIO_WAVE_STATUS_SUCCESS;
+			break;
+
+		/* Default parameters, invalid argument */
+		default:
+			ret_status = eGPIO_Wave_Status_::GPIO_WAVE_STATUS_INVALID_ARGUMENT;
+			break;
+	}
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/**
+ * @function	play
+ *
+ * @brief		Start emitting a buffer of OMR words
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eGPIO_Wave_Status_ GPIO_Wave__::play( const unsigned long * const p_words,
+										const unsigned short count,
+										const unsigned short period,
+										const unsigned long repeat,
+										gpio_wave_callback_pointer fp_callback )
+{
+	/* Check engine state and input arguments */
+	DRIVER_ASSERT( (0 == init_state), eGPIO_Wave_Status_::GPIO_WAVE_STATUS_FAILED );
+	DRIVER_ASSERT( (nullptr == p_words), eGPIO_Wave_Status_::GPIO_WAVE_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (0U != ((unsigned long) p_words & 0x3UL)), eGPIO_Wave_Status_::GPIO_WAVE_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( ((0U == count) || (GPIO_WAVE_MAX_WORDS < count)),
+					eGPIO_Wave_Status_::GPIO_WAVE_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (GPIO_WAVE_MIN_PERIOD > period), eGPIO_Wave_Status_::GPIO_WAVE_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (0U != control.busy), eGPIO_Wave_Status_::GPIO_WAVE_STATUS_BUSY );
+
+	control.p_words = p_words;
+	control.count = count;
+	control.repeat = repeat;
+	control.loops = 0U;
+	control.fp_callback = fp_callback;
+	control.busy = 1U;
+
+	/* Arm channel, it waits for first period match */
+	XMC_DMA_ClearRequestLine( GPIO_WAVE_DMA, GPIO_WAVE_DMA_LINE );
+	XMC_DMA_CH_SetSourceAddress( GPIO_WAVE_DMA, GPIO_WAVE_DMA_CHANNEL, (unsigned long) p_words );
+	XMC_DMA_CH_SetBlockSize( GPIO_WAVE_DMA, GPIO_WAVE_DMA_CHANNEL, count );
+	XMC_DMA_CH_Enable( GPIO_WAVE_DMA, GPIO_WAVE_DMA_CHANNEL );
+
+	/* Timer is stopped, period is taken over at once */
+	XMC_CCU4_SLICE_SetTimerPeriodMatch( GPIO_WAVE_TIMER_SLICE, static_cast<unsigned short>( period - 1U ) );
+	XMC_CCU4_EnableShadowTransfer( GPIO_WAVE_TIMER_MODULE,
+			( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_SLICE_0 << (4U * GPIO_WAVE_TIMER_SLICE_NUM) )
+			);
+	XMC_CCU4_SLICE_StartTimer( GPIO_WAVE_TIMER_SLICE );
+
+	/* Return status */
+	return eGPIO_Wave_Status_::GPIO_WAVE_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	stop
+ *
+ * @brief		Stop running waveform
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void GPIO_Wave__::stop( void )
+{
+	/* Local Variables */
+	const unsigned long primask_l = __get_PRIMASK();
+
+	/* DMA interrupt must not re-arm channel in between */
+	__disable_irq();
+	if( init_state > 0 )
+	{
+		finish();
+	}
+	else{	/* Not required */	}
+	__set_PRIMASK( primask_l );
+}
+
+
+/******* Private Member function for GPIO_Wave__ class *******/
+
+/**
+ * @function	timer_init
+ *
+ * @brief		Configure pacing timer slice
+ *
+ * \par<b>Description:</b><br>
+ * 				Edge aligned up counter, period match raises service
+ * 				request line routed to DMA line router
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void GPIO_Wave__::timer_init( void )
+{
+	/* Local Variables */
+	XMC_CCU4_SLICE_COMPARE_CONFIG_t slice_cfg = {};
+
+	/* Enable module and prescaler, does not disturb other slices */
+	XMC_CCU4_Init( GPIO_WAVE_TIMER_MODULE, XMC_CCU4_SLICE_MCMS_ACTION_TRANSFER_PR_CR );
+
+	slice_cfg.timer_mode = (unsigned long) XMC_CCU4_SLICE_TIMER_COUNT_MODE_EA;
+	slice_cfg.monoshot = (unsigned long) XMC_CCU4_SLICE_TIMER_REPEAT_MODE_REPEAT;
+	slice_cfg.prescaler_initval = (unsigned long) GPIO_WAVE_TIMER_PRESCALER;
+	XMC_CCU4_SLICE_CompareInit( GPIO_WAVE_TIMER_SLICE, &slice_cfg );
+
+	/* Period match -> service request -> DMA */
+	XMC_CCU4_SLICE_SetInterruptNode( GPIO_WAVE_TIMER_SLICE, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH,
+									GPIO_WAVE_TIMER_SR );
+	XMC_CCU4_SLICE_EnableEvent( GPIO_WAVE_TIMER_SLICE, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH );
+
+	XMC_CCU4_EnableClock( GPIO_WAVE_TIMER_MODULE, GPIO_WAVE_TIMER_SLICE_NUM );
+}
+
+
+/**
+ * @function	finish
+ *
+ * @brief		Stop timer and channel, mark engine idle
+ *
+ * <i>Imp Note:</i>
+ * 				Called with interrupts masked or from DMA interrupt
+ *
+ */
+void GPIO_Wave__::finish( void )
+{
+	XMC_CCU4_SLICE_StopClearTimer( GPIO_WAVE_TIMER_SLICE );
+	XMC_DMA_CH_Disable( GPIO_WAVE_DMA, GPIO_WAVE_DMA_CHANNEL );
+	/* Drop request of period match that raced with stop */
+	XMC_DMA_ClearRequestLine( GPIO_WAVE_DMA, GPIO_WAVE_DMA_LINE );
+	control.busy = 0U;
+}
+
+
+/******* ISR entries for GPIO_Wave__ class *******/
+
+/**
+ * @function	dma_event
+ *
+ * @brief		Handler function for waveform DMA channel events
+ *
+ * @param[in]	event	-	channel event from DMA module interrupt
+ *
+ * \par<b>Description:</b><br>
+ * 				Block done re-arms channel with same buffer until repeat
+ * 				count is reached, timer keeps running meanwhile
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void GPIO_Wave__::dma_event( XMC_DMA_CH_EVENT_t event )
+{
+	/* Local Variables */
+	eGPIO_Wave_Event_ event_l = eGPIO_Wave_Event_::GPIO_WAVE_EVENT_DONE;
+
+	/* Stopped in between by user */
+	if( 0U == control.busy ){ return; }
+	else{	/* Not required */	}
+
+	if( XMC_DMA_CH_EVENT_TRANSFER_COMPLETE == event )
+	{
+		control.loops = control.loops + 1U;
+
+		if( (0U == control.repeat) || (control.loops < control.repeat) )
+		{
+			XMC_DMA_CH_SetSourceAddress( GPIO_WAVE_DMA, GPIO_WAVE_DMA_CHANNEL,
+										(unsigned long) control.p_words );
+			XMC_DMA_CH_SetBlockSize( GPIO_WAVE_DMA, GPIO_WAVE_DMA_CHANNEL, control.count );
+			XMC_DMA_CH_Enable( GPIO_WAVE_DMA, GPIO_WAVE_DMA_CHANNEL );
+			return;
+		}
+		else{	/* Not required */	}
+	}
+	else
+	{
+		event_l = eGPIO_Wave_Event_::GPIO_WAVE_EVENT_ERROR;
+	}
+
+	finish();
+
+	if( nullptr != control.fp_callback )
+	{
+		control.fp_callback( event_l, control.loops );
+	}
+	else{	/* Not required */	}
+}
+
+#endif	/* GPIO_WAVE_USED */
+
+/********************************** End of File *******************************/
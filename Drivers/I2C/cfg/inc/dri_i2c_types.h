@@ -0,0 +1,231 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		I2C data types Header
+* Filename:		dri_i2c_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_i2c_types.h
+ *  @brief:	This file contains data types definitions for I2C master channel
+ */
+#ifndef DRI_I2C_TYPES_H_
+#define DRI_I2C_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_i2c.h>
+#include <xmc_gpio.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_i2c_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of I2C
+ * */
+enum class eI2C_Status_/*	:	unsigned char	*/
+{
+	I2C_STATUS_SUCCESS = 0,
+	I2C_STATUS_FAILED,
+	I2C_STATUS_BUSY,
+	I2C_STATUS_INVALID_ARGUMENT,
+	I2C_STATUS_QUEUE_FULL
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eI2C_Init_/*	:	unsigned char	*/
+{
+	I2C_INIT_CLOSE = 0,
+	I2C_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for transaction state
+ * */
+enum class eI2C_Transfer_	:	unsigned char
+{
+	I2C_TRANSFER_IDLE = 0,			/**< Never submitted */
+	I2C_TRANSFER_QUEUED,			/**< Waiting in channel queue */
+	I2C_TRANSFER_ACTIVE,			/**< On the bus */
+	I2C_TRANSFER_DONE,				/**< Completed */
+	I2C_TRANSFER_NACK,				/**< Address or data not acknowledged */
+	I2C_TRANSFER_ARBITRATION_LOST,	/**< Other master won the bus */
+	I2C_TRANSFER_ERROR,				/**< Protocol error */
+	I2C_TRANSFER_TIMEOUT,			/**< Bus stuck, recovery done */
+	I2C_TRANSFER_ABORTED			/**< Removed by abort */
+};
+
+/*
+ * @brief	Enum for phase of active transaction
+ * */
+enum class eI2C_Phase_	:	unsigned char
+{
+	I2C_PHASE_IDLE = 0,
+	I2C_PHASE_ADDRESS_WRITE,		/**< Start and address with write bit sent */
+	I2C_PHASE_WRITE,				/**< Write bytes */
+	I2C_PHASE_ADDRESS_READ,			/**< (Repeated) start and address with read bit sent */
+	I2C_PHASE_READ,					/**< Read bytes */
+	I2C_PHASE_STOP					/**< Stop sent, waiting for stop on bus */
+};
+
+/*
+ * @brief	Enum for I2C Channel Information
+ * */
+enum class eI2C_Channel_	:	unsigned char
+{
+	I2C_CHANNEL_0 = 0,
+	I2C_CHANNEL_1,
+	I2C_CHANNEL_2,
+	I2C_CHANNEL_3,
+	I2C_CHANNEL_4,
+	I2C_CHANNEL_5
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for I2C instance
+ *
+ *****************************************************************************/
+
+struct tStI2C_Transaction_;
+
+/*
+ * @brief	typedef for transaction callback, called in interrupt context
+ * */
+typedef void (*i2c_callback_pointer) ( struct tStI2C_Transaction_& transaction );
+
+/*
+ * @brief	Structure for one queued transaction
+ *
+ * \par<b>Description:</b><br>
+ * 			Write part is sent first, read part follows after repeated start.
+ * 			Either part may be empty, both empty is an address probe
+ *
+ * <i>Imp Note:</i>
+ * 			Transaction is not copied, it has to stay valid until its state
+ * 			leaves I2C_TRANSFER_QUEUED and I2C_TRANSFER_ACTIVE
+ */
+typedef struct tStI2C_Transaction_
+{
+	unsigned char address = 0U;					/**< 7 bit slave address */
+	const unsigned char * p_write = nullptr;	/**< Bytes to write */
+	unsigned short write_length = 0U;
+	unsigned char * p_read = nullptr;			/**< Buffer for read bytes */
+	unsigned short read_length = 0U;
+	unsigned short timeout = 0U;				/**< Ticks, 0 - I2C_DEFAULT_TIMEOUT */
+	i2c_callback_pointer fp_callback = nullptr;	/**< Completion notification */
+	void * p_arg = nullptr;						/**< User context for callback */
+	volatile eI2C_Transfer_ state = eI2C_Transfer_::I2C_TRANSFER_IDLE;
+} tStI2C_Transaction;
+
+/*
+ * @brief	Structure for I2C control
+ */
+typedef struct tStI2C_Control_
+{
+	tStI2C_Transaction * p_active = nullptr;	/**< Transaction on the bus */
+	unsigned short index = 0U;					/**< Bytes done in current phase */
+	unsigned short ticks = 0U;					/**< Ticks since transaction start */
+	eI2C_Phase_ phase = eI2C_Phase_::I2C_PHASE_IDLE;
+	eI2C_Transfer_ result = eI2C_Transfer_::I2C_TRANSFER_DONE;	/**< State reported at stop */
+	unsigned long recovery_delay = 0U;			/**< Half SCL period in delay loops */
+	unsigned long recoveries = 0U;				/**< Bus recoveries done */
+	volatile unsigned char recovery = 0U;		/**< Bus recovery pending or running */
+	unsigned char init_state = 0U;
+} tStI2C_Control;
+
+/*
+ * @brief Structure used for Channel Context
+ */
+typedef struct tStI2C_Context_
+{
+	/**< channel information for current context */
+	XMC_USIC_CH_t * p_channel;
+} tStI2C_Context;
+
+/*
+ * @brief Structure for I2C bus pins, needed for bus recovery
+ */
+typedef struct tStI2C_Pins_
+{
+	XMC_GPIO_PORT_t * p_scl_port = nullptr;
+	unsigned char scl_pin = 0U;
+	XMC_GPIO_MODE_t scl_mode = XMC_GPIO_MODE_OUTPUT_OPEN_DRAIN_ALT2;	/**< Mode of SCL in I2C operation */
+	XMC_GPIO_PORT_t * p_sda_port = nullptr;
+	unsigned char sda_pin = 0U;
+	XMC_GPIO_MODE_t sda_mode = XMC_GPIO_MODE_OUTPUT_OPEN_DRAIN_ALT2;	/**< Mode of SDA in I2C operation */
+} tStI2C_Pins;
+
+/*
+ * @brief Structure for I2C channel configuration
+ */
+typedef struct tStI2C_Configuration_
+{
+	/**< channel configuration, own address is unused in master mode */
+	XMC_I2C_CH_CONFIG_t channel_cfg = { 100000U, 0U };
+	/**< DX0 input source of SDA and DX1 input source of SCL */
+	unsigned char sda_source = 0U;
+	unsigned char scl_source = 0U;
+	/**< Bus pins */
+	tStI2C_Pins pins;
+} tStI2C_Configuration;
+
+/*
+ * @brief Structure for I2C channel interrupt configuration
+ */
+typedef struct tStI2C_InterruptConfiguration_
+{
+	/**< Interrupt configuration for protocol and receive events */
+	tStInterruptConfig irq;
+	/**< Service request of channel events */
+	unsigned long sr;
+} tStI2C_InterruptConfiguration;
+
+
+#endif /* DRI_I2C_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,100 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		I2C Configuration Header
+* Filename:		dri_i2c_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_i2c_conf.h
+ *  @brief:	This file contains static configurations for I2C master channel
+ *  		on USIC
+ */
+#ifndef DRI_I2C_CONF_H_
+#define DRI_I2C_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+#define I2C_MAX_CHANNELS		6
+
+/* Total I2C Channels used in system */
+#define I2C_CHANNELS_USED		1
+
+/* I2C Channels used in system, channel n is USIC(n / 2) CH(n % 2) */
+//#define I2C_CHANNEL_0_USED
+//#define I2C_CHANNEL_1_USED
+//#define I2C_CHANNEL_2_USED
+//#define I2C_CHANNEL_3_USED
+//#define I2C_CHANNEL_4_USED
+#define I2C_CHANNEL_5_USED
+
+/* Pending transactions per channel, power of 2 */
+#define I2C_QUEUE_SIZE			8
+
+/* Transaction timeout in ticks of tick(), used when transaction gives 0 */
+#define I2C_DEFAULT_TIMEOUT		10U
+
+/* SCL pulses sent by bus recovery, one byte and acknowledge */
+#define I2C_RECOVERY_CLOCKS		9U
+
+
+/* Check channels availability */
+#if (I2C_CHANNELS_USED > I2C_MAX_CHANNELS)
+	#error	"Cannot instantiate more than available channels"
+#endif
+
+/* Check queue size */
+#if ( 0 != (I2C_QUEUE_SIZE & (I2C_QUEUE_SIZE - 1)) )
+	#error	"I2C queue size must be power of 2"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Defining functions for I2C ISR handlers and service requests,
+ * protocol and receive events share one service request */
+#ifdef I2C_CHANNEL_5_USED
+#define I2C_5_HANDLER			IRQ_Hdlr_99		/* USIC2 SR3 */
+#define I2C_5_SR				3
+#endif
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_I2C_CONF_H_ */
+
+/********************************** End of File ******************************/
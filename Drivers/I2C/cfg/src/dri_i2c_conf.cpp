@@ -0,0 +1,153 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		I2C Configuration Source
+* Filename:		dri_i2c_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_i2c_conf.cpp
+ *  @brief:	This source file contains configuration function definitions for
+ *  		I2C master on USIC channel
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_i2c.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check I2C Usage in system */
+#if( I2C_CHANNELS_USED > 0 )
+
+/*
+ * @brief	Objects for I2C Class
+ */
+static I2C__ sg_i2c_obj_ch5 (eI2C_Channel_::I2C_CHANNEL_5 );
+
+I2C__ * g_p_i2c_obj[I2C_CHANNELS_USED] =
+{ &sg_i2c_obj_ch5 };
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/**
+ * @function	initialize_i2c_objects
+ *
+ * @brief		Initialize I2C Objects with specific properties
+ *
+ * <i>Imp Note:</i>
+ * 				Do not call this function more than once!
+ */
+void I2C__::initialize_i2c_objects( void )
+{
+	/* Local Variables */
+	tStI2C_Configuration config;
+	tStI2C_InterruptConfiguration irq_config = {
+			.irq = { .irq_num = 99, .irq_priority = 57 },
+			.sr = 0
+	};
+
+	#ifdef I2C_CHANNEL_5_USED
+	/* Sensor bus at 400 kHz, SDA on P3.5 (DX0A) and SCL on P3.6 (DX1B),
+	 * P2 is taken by Ethernet RMII */
+	config.channel_cfg.baudrate = 400000U;
+	config.sda_source = USIC2_C1_DX0_P3_5;
+	config.scl_source = USIC2_C1_DX1_P3_6;
+	config.pins.p_scl_port = XMC_GPIO_PORT3;
+	config.pins.scl_pin = 6U;
+	config.pins.scl_mode = XMC_GPIO_MODE_OUTPUT_OPEN_DRAIN_ALT1;
+	config.pins.p_sda_port = XMC_GPIO_PORT3;
+	config.pins.sda_pin = 5U;
+	config.pins.sda_mode = XMC_GPIO_MODE_OUTPUT_OPEN_DRAIN_ALT1;
+
+	irq_config.sr = I2C_5_SR;
+
+	/* Initialize I2C__ Object channel 5 parameters */
+	g_p_i2c_obj[0]->set( irq_config, config );
+
+	__asm("NOP");
+	#endif	/* I2C_CHANNEL_5_USED */
+}
+
+
+/******* ISR Handlers for I2C__ channels *******/
+
+extern "C"
+{
+
+#ifdef I2C_5_HANDLER
+/**
+ * @function	I2C_5_HANDLER
+ *
+ * @brief		I2C5 channel event handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void I2C_5_HANDLER( void )
+{
+	/* Call ISR entry function */
+	I2C__::isr_entry( &sg_i2c_obj_ch5 );
+}
+#endif	/* I2C_5_HANDLER */
+
+
+}	/* extern "C"{ */
+
+
+/**
+ * @function		initialize_i2c_objects_c
+ *
+ * @brief			I2C objects initialization function
+ *
+ * <i>Imp Note:</i> To be called before main entry
+ *
+ */
+extern "C" void initialize_i2c_objects_c( void )
+		{
+			I2C__::initialize_i2c_objects();
+		}
+
+#endif	/* I2C_CHANNELS_USED */
+
+
+/*********************************** End of File ******************************/
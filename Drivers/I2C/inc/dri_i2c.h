@@ -0,0 +1,288 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		I2C API Header
+* Filename:		dri_i2c.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_i2c.h
+ *  @brief:	This file contains API function declarations for I2C master
+ *  		channel with queued interrupt driven transactions
+ */
+#ifndef DRI_I2C_H_
+#define DRI_I2C_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_i2c_types.h>
+#include <dri_ring.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for I2C master Instance
+ *
+ ******************************************************************************/
+
+/* Check I2C Usage in system */
+#if( I2C_CHANNELS_USED > 0 )
+
+class I2C__
+{
+/* public members */
+public:
+	/** Constructors and Destructors */
+	I2C__() = delete;
+
+	explicit I2C__( const eI2C_Channel_& channel_l ) : channel(channel_l)
+	{
+		/* Assign context */
+		context.p_channel = ( eI2C_Channel_::I2C_CHANNEL_0 == this->channel ) ? XMC_USIC0_CH0 :
+							( eI2C_Channel_::I2C_CHANNEL_1 == this->channel ) ? XMC_USIC0_CH1 :
+							( eI2C_Channel_::I2C_CHANNEL_2 == this->channel ) ? XMC_USIC1_CH0 :
+							( eI2C_Channel_::I2C_CHANNEL_3 == this->channel ) ? XMC_USIC1_CH1 :
+							( eI2C_Channel_::I2C_CHANNEL_4 == this->channel ) ? XMC_USIC2_CH0 :
+							XMC_USIC2_CH1;
+	}
+
+	/* Destructor for class, not required but still present */
+	~I2C__()
+	{
+		/* Close I2C channel */
+		init( eI2C_Init_::I2C_INIT_CLOSE );
+	}
+
+	/******* API Member functions *******/
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for I2C channel
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eI2C_Init_	-	I2C_INIT_OPEN
+	 * 											I2C_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eI2C_Status_
+	 *          	I2C_STATUS_SUCCESS:		Operation successful.<BR>
+	 *          	I2C_STATUS_FAILED:		Operation failed.<BR>
+	 *          	I2C_STATUS_BUSY:		Channel could not be stopped.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function will initialize I2C channel as master. Bus is
+	 * 				recovered first if a slave holds SDA low
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	eI2C_Status_ init( const eI2C_Init_& init = eI2C_Init_::I2C_INIT_OPEN );
+
+	/**
+	 * @function	submit
+	 *
+	 * @brief		Queue a transaction
+	 *
+	 * @param[in]	transaction	-	transaction description, kept by reference
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eI2C_Status_
+	 *          	I2C_STATUS_SUCCESS:				Transaction queued or started.<BR>
+	 *          	I2C_STATUS_FAILED:				Channel not initialized.<BR>
+	 *          	I2C_STATUS_BUSY:				Transaction already pending.<BR>
+	 *          	I2C_STATUS_INVALID_ARGUMENT:	Wrong address or buffers.<BR>
+	 *          	I2C_STATUS_QUEUE_FULL:			No free queue entry.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Transactions run in submission order. Write part and read
+	 * 				part are joined by repeated start. Completion is reported
+	 * 				by state of transaction and optional callback
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Can be called from thread context and from callbacks
+	 *
+	 */
+	eI2C_Status_ submit( tStI2C_Transaction& transaction );
+
+	/**
+	 * @function	abort
+	 *
+	 * @brief		Abort active and queued transactions
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eI2C_Status_
+	 *          	I2C_STATUS_SUCCESS:	Operation successful.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Transactions are marked I2C_TRANSFER_ABORTED without
+	 * 				callback. Bus is recovered if a transaction was active
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from thread context. Recovery runs with
+	 * 				interrupts enabled for up to I2C_RECOVERY_CLOCKS SCL
+	 * 				periods
+	 *
+	 */
+	eI2C_Status_ abort( void );
+
+	/**
+	 * @function	tick
+	 *
+	 * @brief		Timeout supervision of active transaction
+	 *
+	 * @param[in]	ticks	-	ticks passed since previous call
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Slaves may stretch SCL, master waits for them in hardware.
+	 * 				A transaction running longer than its timeout stops the
+	 * 				channel and leaves bus recovery to run()
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Call periodically, e.g. from SysTick handler
+	 *
+	 */
+	void tick( const unsigned long ticks );
+
+	/**
+	 * @function	run
+	 *
+	 * @brief		Bus recovery after timeout
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Frees the bus of a timed out transaction, which then ends
+	 * 				with I2C_TRANSFER_TIMEOUT, and starts the next one. Does
+	 * 				nothing without pending recovery
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from main loop. Recovery runs with interrupts
+	 * 				enabled for up to I2C_RECOVERY_CLOCKS SCL periods
+	 *
+	 */
+	void run( void );
+
+	/******* Setters and Getters *******/
+	/**
+	 * @function	set
+	 *
+	 * @brief		setter function for I2C__ class
+	 *
+	 * @param[in]	irq_config_l	-	interrupt configurations for I2C object
+	 * @param[in]	channel_cfg_l	-	I2C channel configurations
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function will set the configuration parameters
+	 * 				for I2C__ class object
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	void set( const tStI2C_InterruptConfiguration& irq_config_l,
+				const tStI2C_Configuration& channel_cfg_l )
+	{
+		/* Set parameters */
+		irq_config = irq_config_l;
+		config = channel_cfg_l;
+	}
+
+	/* Transaction on the bus or waiting */
+	bool is_busy( void ) const { return ( (nullptr != control.p_active) || (queue.get_count() > 0U) ); }
+	/* Bus recoveries since init */
+	unsigned long get_recoveries( void ) const { return control.recoveries; }
+
+	/* ISR entry function */
+	static void isr_entry( I2C__* p_object )
+	{
+		p_object->isr_handler();
+	}
+
+	/* Object initializer for I2C class */
+	static void initialize_i2c_objects( void );
+
+/* private members */
+private:
+	/** Data Members **/
+	eI2C_Channel_ channel;
+	tStI2C_Configuration config;
+	tStI2C_Context context;
+	tStI2C_InterruptConfiguration irq_config;
+	tStI2C_Control control;
+	Ring__<tStI2C_Transaction *, I2C_QUEUE_SIZE> queue;
+
+	/******* Private Member Functions *******/
+	void channel_open( void );
+	void start_next( void );
+	void request_read( void );
+	void finish( const eI2C_Transfer_ state );
+	void recover( void );
+	void isr_handler( void );
+
+/* protected members, if any */
+protected:
+
+};
+
+#endif	/* I2C_CHANNELS_USED */
+
+
+#endif /* DRI_I2C_H_ */
+
+/********************************** End of File *******************************/
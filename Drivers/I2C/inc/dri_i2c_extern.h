@@ -0,0 +1,70 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		I2C Extern Header
+* Filename:		dri_i2c_extern.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_i2c_extern.h
+ *  @brief:	This file contains extern variable for I2C and I2C API header
+ */
+#ifndef DRI_I2C_EXTERN_H_
+#define DRI_I2C_EXTERN_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_i2c.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+#if( I2C_CHANNELS_USED > 0 )
+
+/*
+ * @brief	Objects for I2C Class
+ */
+extern I2C__ * g_p_i2c_obj[I2C_CHANNELS_USED];
+
+#endif
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+
+#endif /* DRI_I2C_EXTERN_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,700 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		I2C API Source
+* Filename:		dri_i2c.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_i2c.cpp
+ *  @brief:	This source file contains API function definitions for
+ *  		I2C master channel with queued interrupt driven transactions.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_i2c.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Channel events served by state machine */
+#define I2C_EVENTS		( (unsigned long) XMC_I2C_CH_EVENT_ACK | \
+						  (unsigned long) XMC_I2C_CH_EVENT_NACK | \
+						  (unsigned long) XMC_I2C_CH_EVENT_ARBITRATION_LOST | \
+						  (unsigned long) XMC_I2C_CH_EVENT_ERROR | \
+						  (unsigned long) XMC_I2C_CH_EVENT_STOP_CONDITION_RECEIVED | \
+						  (unsigned long) XMC_I2C_CH_EVENT_STANDARD_RECEIVE | \
+						  (unsigned long) XMC_I2C_CH_EVENT_ALTERNATIVE_RECEIVE )
+
+/* Status flags of served events */
+#define I2C_FLAGS		( (unsigned long) XMC_I2C_CH_STATUS_FLAG_ACK_RECEIVED | \
+						  (unsigned long) XMC_I2C_CH_STATUS_FLAG_NACK_RECEIVED | \
+						  (unsigned long) XMC_I2C_CH_STATUS_FLAG_ARBITRATION_LOST | \
+						  (unsigned long) XMC_I2C_CH_STATUS_FLAG_ERROR | \
+						  (unsigned long) XMC_I2C_CH_STATUS_FLAG_STOP_CONDITION_RECEIVED | \
+						  (unsigned long) XMC_I2C_CH_STATUS_FLAG_RECEIVE_INDICATION | \
+						  (unsigned long) XMC_I2C_CH_STATUS_FLAG_ALTERNATIVE_RECEIVE_INDICATION )
+
+/* 7 bit address in USIC format */
+#define I2C_ADDRESS( address )		( (unsigned short) ((address) << 1U) )
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Check I2C Usage in system */
+#if( I2C_CHANNELS_USED > 0 )
+
+/**
+ * @function	i2c_delay
+ *
+ * @brief		Busy wait used by bus recovery
+ *
+ * @param[in]	loops	-	delay loops
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+static void i2c_delay( unsigned long loops )
+{
+	while( loops > 0U )
+	{
+		__asm("NOP");
+		--loops;
+	}
+}
+
+
+/******* Public Member function for I2C__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for I2C channel
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eI2C_Status_ I2C__::init( const eI2C_Init_& init )
+{
+	/* Local Variables */
+	eI2C_Status_ ret_status = eI2C_Status_::I2C_STATUS_FAILED;
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open I2C Channel */
+		case eI2C_Init_::I2C_INIT_OPEN:
+			/* Check for initialization */
+			if( control.init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			/* Delay loops of half SCL period, loop takes about 4 cycles */
+			control.recovery_delay = SystemCoreClock / (config.channel_cfg.baudrate << 3U);
+			control.recoveries = 0U;
+
+			/* Free the bus if a slave was reset in the middle of a byte */
+			if( (nullptr != config.pins.p_sda_port) &&
+				(0U == XMC_GPIO_GetInput( config.pins.p_sda_port, config.pins.sda_pin )) )
+			{
+				recover();
+			}
+			else{	/* Not required */	}
+
+			channel_open();
+
+			/* Set priority and enable NVIC node for channel events */
+			NVIC_ClearPendingIRQ( static_cast<IRQn_Type>(irq_config.irq.irq_num) );
+			NVIC_SetPriority( static_cast<IRQn_Type>(irq_config.irq.irq_num),
+								NVIC_EncodePriority(NVIC_GetPriorityGrouping(),
+								irq_config.irq.irq_priority,
+								0U)
+							);
+			NVIC_EnableIRQ( static_cast<IRQn_Type>(irq_config.irq.irq_num) );
+
+			/* Update initialization state */
+			control.init_state = 1U;
+			/* Update return status */
+			ret_status = eI2C_Status_::I2C_STATUS_SUCCESS;
+			break;
+
+		/* Close I2C Channel */
+		case eI2C_Init_::I2C_INIT_CLOSE:
+			if( 0U == control.init_state )
+			{
+				ret_status = eI2C_Status_::I2C_STATUS_SUCCESS;
+				break;
+			}
+			else{	/* Not required */	}
+
+			(void) abort();
+
+			if( XMC_I2C_CH_STATUS_BUSY == XMC_I2C_CH_Stop( context.p_channel ) )
+			{
+				/* Update return status */
+				ret_status = eI2C_Status_::I2C_STATUS_BUSY;
+				break;
+			}
+			else{	/* Not required */	}
+
+			XMC_I2C_CH_DisableEvent( context.p_channel, I2C_EVENTS );
+			NVIC_DisableIRQ( static_cast<IRQn_Type>(irq_config.irq.irq_num) );
+
+			/* Reset initialization state */
+			control.init_state = 0U;
+			/* Update return status */
+			ret_status = eI2C_Status_::I2C_STATUS_SUCCESS;
+			break;
+
+		/* Default parameters, invalid argument */
+		default:
+			/* Update return status */
+			ret_status = eI2C_Status_::I2C_STATUS_INVALID_ARGUMENT;
+			break;
+	}
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/**
+ * @function	submit
+ *
+ * @brief		Queue a transaction
+ *
+ * <i>Imp Note:</i>
+ * 				Queue push and start are done with interrupts masked, so
+ * 				channel interrupt and callbacks may submit as well
+ *
+ */
+eI2C_Status_ I2C__::submit( tStI2C_Transaction& transaction )
+{
+	/* Input argument validity */
+	DRIVER_ASSERT( 0U == control.init_state, eI2C_Status_::I2C_STATUS_FAILED );
+	DRIVER_ASSERT( transaction.address > 0x7FU, eI2C_Status_::I2C_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( ( (transaction.write_length > 0U) && (nullptr == transaction.p_write) ),
+					eI2C_Status_::I2C_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( ( (transaction.read_length > 0U) && (nullptr == transaction.p_read) ),
+					eI2C_Status_::I2C_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( ( (eI2C_Transfer_::I2C_TRANSFER_QUEUED == transaction.state) ||
+					(eI2C_Transfer_::I2C_TRANSFER_ACTIVE == transaction.state) ),
+					eI2C_Status_::I2C_STATUS_BUSY );
+
+	/* Local Variables */
+	eI2C_Status_ ret_status = eI2C_Status_::I2C_STATUS_SUCCESS;
+	const unsigned long primask_l = __get_PRIMASK();
+
+	__disable_irq();
+
+	transaction.state = eI2C_Transfer_::I2C_TRANSFER_QUEUED;
+	if( false == queue.push( &transaction ) )
+	{
+		transaction.state = eI2C_Transfer_::I2C_TRANSFER_IDLE;
+		ret_status = eI2C_Status_::I2C_STATUS_QUEUE_FULL;
+	}
+	else
+	{
+		/* Bus idle, start right away */
+		start_next();
+	}
+
+	__set_PRIMASK( primask_l );
+
+	return ret_status;
+}
+
+
+/**
+ * @function	abort
+ *
+ * @brief		Abort active and queued transactions
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eI2C_Status_ I2C__::abort( void )
+{
+	/* Local Variables */
+	tStI2C_Transaction * p_transaction = nullptr;
+	bool recover_l = false;
+	unsigned long primask_l = __get_PRIMASK();
+
+	__disable_irq();
+
+	if( nullptr != control.p_active )
+	{
+		control.p_active->state = eI2C_Transfer_::I2C_TRANSFER_ABORTED;
+		control.p_active = nullptr;
+		control.phase = eI2C_Phase_::I2C_PHASE_IDLE;
+
+		/* Slave may be left in the middle of a byte, recovery holds
+		 * back transactions submitted meanwhile */
+		XMC_I2C_CH_DisableEvent( context.p_channel, I2C_EVENTS );
+		control.recovery = 1U;
+		recover_l = true;
+	}
+	else{	/* Not required */	}
+
+	while( true == queue.pop( p_transaction ) )
+	{
+		p_transaction->state = eI2C_Transfer_::I2C_TRANSFER_ABORTED;
+	}
+
+	__set_PRIMASK( primask_l );
+
+	if( true == recover_l )
+	{
+		recover();
+		channel_open();
+
+		primask_l = __get_PRIMASK();
+		__disable_irq();
+		control.recovery = 0U;
+		start_next();
+		__set_PRIMASK( primask_l );
+	}
+	else{	/* Not required */	}
+
+	return eI2C_Status_::I2C_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	tick
+ *
+ * @brief		Timeout supervision of active transaction
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void I2C__::tick( const unsigned long ticks )
+{
+	/* Local Variables */
+	unsigned short timeout = 0U;
+	const unsigned long primask_l = __get_PRIMASK();
+
+	__disable_irq();
+
+	if( (nullptr != control.p_active) && (0U == control.recovery) )
+	{
+		timeout = ( 0U == control.p_active->timeout ) ?
+					static_cast<unsigned short>(I2C_DEFAULT_TIMEOUT) : control.p_active->timeout;
+
+		/* Saturate, timeout fits 16 bit */
+		control.ticks = ( ticks < (0xFFFFUL - control.ticks) ) ?
+						static_cast<unsigned short>( control.ticks + ticks ) : 0xFFFFU;
+		if( control.ticks > timeout )
+		{
+			/* Slave holds SCL or SDA, stop channel and let run() free the
+			 * bus, transaction stays active until then */
+			XMC_I2C_CH_DisableEvent( context.p_channel, I2C_EVENTS );
+			control.recovery = 1U;
+		}
+		else{	/* Not required */	}
+	}
+	else{	/* Not required */	}
+
+	__set_PRIMASK( primask_l );
+}
+
+
+/**
+ * @function	run
+ *
+ * @brief		Bus recovery after timeout
+ *
+ * <i>Imp Note:</i>
+ * 				Channel events are disabled and the timed out transaction
+ * 				stays active, so nothing else uses the bus meanwhile
+ *
+ */
+void I2C__::run( void )
+{
+	/* Local Variables */
+	unsigned long primask_l = 0U;
+
+	if( (0U == control.recovery) || (nullptr == control.p_active) ){ return; }
+	else{	/* Not required */	}
+
+	recover();
+	channel_open();
+
+	primask_l = __get_PRIMASK();
+	__disable_irq();
+
+	control.recovery = 0U;
+	finish( eI2C_Transfer_::I2C_TRANSFER_TIMEOUT );
+
+	__set_PRIMASK( primask_l );
+}
+
+
+/******* Private Member function for I2C__ class *******/
+
+/**
+ * @function	channel_open
+ *
+ * @brief		Configure and start USIC channel in I2C mode
+ *
+ * \par<b>Description:</b><br>
+ * 				Used by init and after bus recovery, channel is fully
+ * 				reconfigured which also drops pending transmit data
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void I2C__::channel_open( void )
+{
+	XMC_USIC_CH_SetMode( context.p_channel, XMC_USIC_CH_OPERATING_MODE_IDLE );
+	XMC_I2C_CH_Init( context.p_channel, &(config.channel_cfg) );
+	XMC_I2C_CH_SetInputSource( context.p_channel, XMC_I2C_CH_INPUT_SDA, config.sda_source );
+	XMC_I2C_CH_SetInputSource( context.p_channel, XMC_I2C_CH_INPUT_SCL, config.scl_source );
+
+	/* All events on one service request, state machine needs their order */
+	XMC_I2C_CH_SelectInterruptNodePointer( context.p_channel,
+					XMC_I2C_CH_INTERRUPT_NODE_POINTER_PROTOCOL, irq_config.sr );
+	XMC_I2C_CH_SelectInterruptNodePointer( context.p_channel,
+					XMC_I2C_CH_INTERRUPT_NODE_POINTER_RECEIVE, irq_config.sr );
+	XMC_I2C_CH_SelectInterruptNodePointer( context.p_channel,
+					XMC_I2C_CH_INTERRUPT_NODE_POINTER_ALTERNATE_RECEIVE, irq_config.sr );
+	XMC_I2C_CH_EnableEvent( context.p_channel, I2C_EVENTS );
+
+	XMC_I2C_CH_Start( context.p_channel );
+}
+
+
+/**
+ * @function	start_next
+ *
+ * @brief		Put next queued transaction on the bus
+ *
+ * \par<b>Description:</b><br>
+ * 				Does nothing while a transaction is active or bus is
+ * 				being recovered
+ *
+ * <i>Imp Note:</i>
+ * 				Called with interrupts masked or from channel interrupt
+ *
+ */
+void I2C__::start_next( void )
+{
+	/* Local Variables */
+	tStI2C_Transaction * p_transaction = nullptr;
+
+	if( (nullptr != control.p_active) || (0U != control.recovery) ||
+		(false == queue.pop( p_transaction )) )
+	{
+		return;
+	}
+	else{	/* Not required */	}
+
+	control.p_active = p_transaction;
+	control.index = 0U;
+	control.ticks = 0U;
+	control.result = eI2C_Transfer_::I2C_TRANSFER_DONE;
+	p_transaction->state = eI2C_Transfer_::I2C_TRANSFER_ACTIVE;
+
+	/* Read only transaction goes to read address directly */
+	if( (0U == p_transaction->write_length) && (p_transaction->read_length > 0U) )
+	{
+		control.phase = eI2C_Phase_::I2C_PHASE_ADDRESS_READ;
+		XMC_I2C_CH_MasterStart( context.p_channel, I2C_ADDRESS( p_transaction->address ),
+								XMC_I2C_CH_CMD_READ );
+	}
+	else
+	{
+		control.phase = eI2C_Phase_::I2C_PHASE_ADDRESS_WRITE;
+		XMC_I2C_CH_MasterStart( context.p_channel, I2C_ADDRESS( p_transaction->address ),
+								XMC_I2C_CH_CMD_WRITE );
+	}
+}
+
+
+/**
+ * @function	request_read
+ *
+ * @brief		Clock in next byte of read phase
+ *
+ * \par<b>Description:</b><br>
+ * 				Last byte is answered with NACK, which tells slave to
+ * 				release SDA before stop
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void I2C__::request_read( void )
+{
+	if( (control.index + 1U) < control.p_active->read_length )
+	{
+		XMC_I2C_CH_MasterReceiveAck( context.p_channel );
+	}
+	else
+	{
+		XMC_I2C_CH_MasterReceiveNack( context.p_channel );
+	}
+}
+
+
+/**
+ * @function	finish
+ *
+ * @brief		Complete active transaction and start next one
+ *
+ * @param[in]	state	-	final state of transaction
+ *
+ * \par<b>Description:</b><br>
+ * 				Active pointer is cleared before callback, so callback can
+ * 				submit follow up transactions
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void I2C__::finish( const eI2C_Transfer_ state )
+{
+	/* Local Variables */
+	tStI2C_Transaction * const p_transaction = control.p_active;
+
+	if( nullptr == p_transaction ){ return; }
+	else{	/* Not required */	}
+
+	control.p_active = nullptr;
+	control.phase = eI2C_Phase_::I2C_PHASE_IDLE;
+	p_transaction->state = state;
+
+	if( nullptr != p_transaction->fp_callback )
+	{
+		p_transaction->fp_callback( *p_transaction );
+	}
+	else{	/* Not required */	}
+
+	start_next();
+}
+
+
+/**
+ * @function	recover
+ *
+ * @brief		Free a bus held by a slave
+ *
+ * \par<b>Description:</b><br>
+ * 				Pins are taken from USIC as open drain GPIO. SCL is pulsed
+ * 				until slave releases SDA, at most I2C_RECOVERY_CLOCKS times,
+ * 				then a stop condition is generated by hand. Each SCL high
+ * 				phase waits for a stretching slave, bounded by one period
+ *
+ * <i>Imp Note:</i>
+ * 				Channel has to be reopened afterwards
+ *
+ */
+void I2C__::recover( void )
+{
+	/* Local Variables */
+	const tStI2C_Pins& pins = config.pins;
+	unsigned char clocks = 0U;
+	unsigned long stretch = 0U;
+
+	if( (nullptr == pins.p_scl_port) || (nullptr == pins.p_sda_port) ){ return; }
+	else{	/* Not required */	}
+
+	XMC_GPIO_SetOutputHigh( pins.p_scl_port, pins.scl_pin );
+	XMC_GPIO_SetOutputHigh( pins.p_sda_port, pins.sda_pin );
+	XMC_GPIO_SetMode( pins.p_scl_port, pins.scl_pin, XMC_GPIO_MODE_OUTPUT_OPEN_DRAIN );
+	XMC_GPIO_SetMode( pins.p_sda_port, pins.sda_pin, XMC_GPIO_MODE_OUTPUT_OPEN_DRAIN );
+	i2c_delay( control.recovery_delay );
+
+	for( clocks = 0U; clocks < I2C_RECOVERY_CLOCKS; ++clocks )
+	{
+		if( 0U != XMC_GPIO_GetInput( pins.p_sda_port, pins.sda_pin ) ){ break; }
+		else{	/* Not required */	}
+
+		XMC_GPIO_SetOutputLow( pins.p_scl_port, pins.scl_pin );
+		i2c_delay( control.recovery_delay );
+		XMC_GPIO_SetOutputHigh( pins.p_scl_port, pins.scl_pin );
+
+		/* Clock stretching */
+		for( stretch = (control.recovery_delay << 1U);
+			(0U == XMC_GPIO_GetInput( pins.p_scl_port, pins.scl_pin )) && (stretch > 0U);
+			--stretch )
+		{
+			/* Wait for slave */
+		}
+		i2c_delay( control.recovery_delay );
+	}
+
+	/* Stop condition, SDA rises while SCL is high */
+	XMC_GPIO_SetOutputLow( pins.p_scl_port, pins.scl_pin );
+	i2c_delay( control.recovery_delay );
+	XMC_GPIO_SetOutputLow( pins.p_sda_port, pins.sda_pin );
+	i2c_delay( control.recovery_delay );
+	XMC_GPIO_SetOutputHigh( pins.p_scl_port, pins.scl_pin );
+	i2c_delay( control.recovery_delay );
+	XMC_GPIO_SetOutputHigh( pins.p_sda_port, pins.sda_pin );
+	i2c_delay( control.recovery_delay );
+
+	/* Give pins back to USIC */
+	XMC_GPIO_SetMode( pins.p_scl_port, pins.scl_pin, pins.scl_mode );
+	XMC_GPIO_SetMode( pins.p_sda_port, pins.sda_pin, pins.sda_mode );
+
+	++(control.recoveries);
+}
+
+
+/**
+ * @function	isr_handler
+ *
+ * @brief		Transaction state machine
+ *
+ * \par<b>Description:</b><br>
+ * 				ACK moves write and address phases forward, received bytes
+ * 				move read phase forward. Every ending issues stop and the
+ * 				transaction completes when stop is seen on the bus
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void I2C__::isr_handler( void )
+{
+	/* Local Variables */
+	const unsigned long status = XMC_I2C_CH_GetStatusFlag( context.p_channel ) & I2C_FLAGS;
+	tStI2C_Transaction * const p_transaction = control.p_active;
+	unsigned char data_l = 0U;
+
+	XMC_I2C_CH_ClearStatusFlag( context.p_channel, status );
+
+	if( nullptr == p_transaction )
+	{
+		/* Stale events after abort or timeout */
+		return;
+	}
+	else{	/* Not required */	}
+
+	/* Lost bus, other master drives it and sends stop */
+	if( 0U != (status & (unsigned long) XMC_I2C_CH_STATUS_FLAG_ARBITRATION_LOST) )
+	{
+		finish( eI2C_Transfer_::I2C_TRANSFER_ARBITRATION_LOST );
+		return;
+	}
+	else{	/* Not required */	}
+
+	/* Wrong TDF sequence, restart channel */
+	if( 0U != (status & (unsigned long) XMC_I2C_CH_STATUS_FLAG_ERROR) )
+	{
+		channel_open();
+		finish( eI2C_Transfer_::I2C_TRANSFER_ERROR );
+		return;
+	}
+	else{	/* Not required */	}
+
+	if( 0U != (status & (unsigned long) XMC_I2C_CH_STATUS_FLAG_NACK_RECEIVED) )
+	{
+		control.result = eI2C_Transfer_::I2C_TRANSFER_NACK;
+		control.phase = eI2C_Phase_::I2C_PHASE_STOP;
+		XMC_I2C_CH_MasterStop( context.p_channel );
+	}
+	else if( 0U != (status & (unsigned long) XMC_I2C_CH_STATUS_FLAG_ACK_RECEIVED) )
+	{
+		switch( control.phase )
+		{
+			case eI2C_Phase_::I2C_PHASE_ADDRESS_WRITE:
+			case eI2C_Phase_::I2C_PHASE_WRITE:
+				if( control.index < p_transaction->write_length )
+				{
+					control.phase = eI2C_Phase_::I2C_PHASE_WRITE;
+					XMC_I2C_CH_MasterTransmit( context.p_channel, p_transaction->p_write[control.index] );
+					++(control.index);
+				}
+				else if( p_transaction->read_length > 0U )
+				{
+					control.phase = eI2C_Phase_::I2C_PHASE_ADDRESS_READ;
+					control.index = 0U;
+					XMC_I2C_CH_MasterRepeatedStart( context.p_channel,
+													I2C_ADDRESS( p_transaction->address ),
+													XMC_I2C_CH_CMD_READ );
+				}
+				else
+				{
+					control.phase = eI2C_Phase_::I2C_PHASE_STOP;
+					XMC_I2C_CH_MasterStop( context.p_channel );
+				}
+				break;
+
+			case eI2C_Phase_::I2C_PHASE_ADDRESS_READ:
+				control.phase = eI2C_Phase_::I2C_PHASE_READ;
+				request_read();
+				break;
+
+			default:
+				break;
+		}
+	}
+	else{	/* Not required */	}
+
+	if( (eI2C_Phase_::I2C_PHASE_READ == control.phase) &&
+		(0U != (status & ( (unsigned long) XMC_I2C_CH_STATUS_FLAG_RECEIVE_INDICATION |
+						   (unsigned long) XMC_I2C_CH_STATUS_FLAG_ALTERNATIVE_RECEIVE_INDICATION ))) )
+	{
+		data_l = XMC_I2C_CH_GetReceivedData( context.p_channel );
+		p_transaction->p_read[control.index] = data_l;
+		++(control.index);
+
+		if( control.index < p_transaction->read_length )
+		{
+			request_read();
+		}
+		else
+		{
+			control.phase = eI2C_Phase_::I2C_PHASE_STOP;
+			XMC_I2C_CH_MasterStop( context.p_channel );
+		}
+	}
+	else{	/* Not required */	}
+
+	/* Bus released */
+	if( (eI2C_Phase_::I2C_PHASE_STOP == control.phase) &&
+		(0U != (status & (unsigned long) XMC_I2C_CH_STATUS_FLAG_STOP_CONDITION_RECEIVED)) )
+	{
+		finish( control.result );
+	}
+	else{	/* Not required */	}
+}
+
+#endif	/* I2C_CHANNELS_USED */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,115 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		POSIF data types Header
+* Filename:		dri_posif_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_posif_types.h
+ *  @brief:	This file contains data types definitions for POSIF quadrature
+ *  		encoder with hardware position and velocity capture
+ */
+#ifndef DRI_POSIF_TYPES_H_
+#define DRI_POSIF_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_posif.h>
+#include <xmc_ccu4.h>
+#include <xmc_gpio.h>
+#include <xmc_scu.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_posif_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of POSIF
+ * */
+enum class ePOSIF_Status_/*	:	unsigned char	*/
+{
+	POSIF_STATUS_SUCCESS = 0,
+	POSIF_STATUS_FAILED
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class ePOSIF_Init_/*	:	unsigned char	*/
+{
+	POSIF_INIT_CLOSE = 0,
+	POSIF_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for direction of rotation
+ * */
+enum class ePOSIF_Direction_/*	:	unsigned char	*/
+{
+	POSIF_DIRECTION_CCW = 0,		/**< Phase B leads, position decrements */
+	POSIF_DIRECTION_CW				/**< Phase A leads, position increments */
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for POSIF
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	Structure for encoder state at one sample
+ */
+typedef struct tStPOSIF_Snapshot_
+{
+	long position = 0;				/**< Counts since init, four per line */
+	long velocity = 0;				/**< Counts per second, positive clockwise */
+	unsigned short edge_period = 0U;	/**< Ticks between last two edges, 0 - stalled */
+	ePOSIF_Direction_ direction = ePOSIF_Direction_::POSIF_DIRECTION_CW;
+} tStPOSIF_Snapshot;
+
+
+#endif /* DRI_POSIF_TYPES_H_ */
+
+/********************************** End of File *******************************/
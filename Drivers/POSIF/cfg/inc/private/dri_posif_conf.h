@@ -0,0 +1,103 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		POSIF Configuration Header
+* Filename:		dri_posif_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_posif_conf.h
+ *  @brief:	This file contains static configurations for POSIF quadrature
+ *  		encoder with hardware position and velocity capture
+ */
+#ifndef DRI_POSIF_CONF_H_
+#define DRI_POSIF_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* POSIF used in system, 0 - not used */
+#define POSIF_USED					1
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/*
+ * Phase A on POSIF0.IN0A (P1.3) and phase B on POSIF0.IN1A (P1.2). Index
+ * input IN2 is P1.1 (LED) or P14.5 (ADC) on this board, so no index.
+ */
+#define POSIF_MODULE				POSIF0
+#define POSIF_PORT					XMC_GPIO_PORT1
+#define POSIF_PIN_A					3U
+#define POSIF_PIN_B					2U
+#define POSIF_INPUT_A				XMC_POSIF_INPUT_PORT_A
+#define POSIF_INPUT_B				XMC_POSIF_INPUT_PORT_A
+#define POSIF_FILTER				XMC_POSIF_FILTER_4_CLOCK_CYCLE
+
+/*
+ * CCU40 slices fed by POSIF0 outputs, see xmc4_ccu4_map.h
+ * 	Slice 0 counts quadrature clock (IN0E = OUT0) with direction (IN0F = OUT1)
+ * 	Slice 1 runs free as time base of position method
+ * 	Slice 2 captures time between edges on period clock (IN2F = OUT2)
+ */
+#define POSIF_CCU					CCU40
+#define POSIF_COUNT_SLICE			CCU40_CC40
+#define POSIF_COUNT_SLICE_NUM		0U
+#define POSIF_COUNT_INPUT			XMC_CCU4_SLICE_INPUT_E
+#define POSIF_DIRECTION_INPUT		XMC_CCU4_SLICE_INPUT_F
+#define POSIF_STAMP_SLICE			CCU40_CC41
+#define POSIF_STAMP_SLICE_NUM		1U
+#define POSIF_EDGE_SLICE			CCU40_CC42
+#define POSIF_EDGE_SLICE_NUM		2U
+#define POSIF_EDGE_INPUT			XMC_CCU4_SLICE_INPUT_F
+
+/* Time base of slice 1 and 2, fCCU4 / 64 gives 1.875 MHz and 35 ms range,
+ * sample() has to be called more often than that */
+#define POSIF_PRESCALER				XMC_CCU4_SLICE_PRESCALER_64
+
+/*
+ * Velocity is counts over time between samples when at least this many
+ * counts passed, time between last edges otherwise
+ */
+#define POSIF_VELOCITY_MIN_COUNTS	8L
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_POSIF_CONF_H_ */
+
+/********************************** End of File ******************************/
@@ -0,0 +1,179 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		POSIF API Header
+* Filename:		dri_posif.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_posif.h
+ *  @brief:	This file contains API function declarations for POSIF
+ *  		quadrature encoder with hardware position and velocity capture
+ */
+#ifndef DRI_POSIF_H_
+#define DRI_POSIF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_posif_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for POSIF quadrature encoder
+ *
+ * 			POSIF decodes phases into clock and direction, a CCU4 slice
+ * 			counts them and another one captures time between edges. No
+ * 			interrupt is raised per edge at any rate.
+ *
+ * 			sample() extends 16 bit hardware count to position, derives
+ * 			velocity and publishes a snapshot. Snapshots are double
+ * 			buffered with a sequence count, readers of any priority get a
+ * 			consistent copy without locking.
+ *
+ ******************************************************************************/
+
+/* Check POSIF usage in system */
+#if( 1 == POSIF_USED )
+
+class POSIF__
+{
+/* public members */
+public:
+	/* Constructors */
+	POSIF__() = delete;
+	POSIF__( POSIF__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for POSIF
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							ePOSIF_Init_	-	POSIF_INIT_OPEN
+	 * 											POSIF_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	ePOSIF_Status_
+	 *          	POSIF_STATUS_SUCCESS:	Operation successful.<BR>
+	 *          	POSIF_STATUS_FAILED:	POSIF rejected configuration.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Position starts at 0
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static ePOSIF_Status_ init( const ePOSIF_Init_& init = ePOSIF_Init_::POSIF_INIT_OPEN );
+
+	/**
+	 * @function	sample
+	 *
+	 * @brief		Read hardware and publish new snapshot
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Position method is used for velocity at speed and time
+	 * 				between edges at low speed, see POSIF_VELOCITY_MIN_COUNTS
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from one context only, periodically and
+	 * 				well within 32768 counts and 35 ms, e.g. by a
+	 * 				CONTROL__ loop
+	 *
+	 */
+	static __RAM_FUNC void sample( void );
+
+	/**
+	 * @function	get_snapshot
+	 *
+	 * @brief		Copy last published snapshot
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	snapshot	-	position, velocity and direction
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Copy is retried only if sample() published twice
+	 * 				meanwhile
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Callable from any context
+	 *
+	 */
+	static void get_snapshot( tStPOSIF_Snapshot& snapshot );
+
+	/******* Setters and Getters *******/
+	/* Raw 16 bit hardware count, wraps */
+	static inline unsigned short get_count( void ){ return XMC_CCU4_SLICE_GetTimerValue( POSIF_COUNT_SLICE ); }
+
+/* private members */
+private:
+	/** Data Members **/
+	static tStPOSIF_Snapshot snapshots[2];
+	static volatile unsigned long sequence;
+	static unsigned long clock;
+	static unsigned short last_count;
+	static unsigned short last_stamp;
+	static unsigned short edge_period;
+	static unsigned char edge_discard;
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static void slice_init( void );
+	static __RAM_FUNC unsigned short edge_ticks( void );
+};
+
+#endif	/* POSIF_USED */
+
+
+#endif /* DRI_POSIF_H_ */
+
+/********************************** End of File *******************************/
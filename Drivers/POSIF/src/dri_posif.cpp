@@ -0,0 +1,386 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		POSIF API Source
+* Filename:		dri_posif.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_posif.cpp
+ *  @brief:	This source file contains API function definitions for POSIF
+ *  		quadrature encoder with hardware position and velocity capture.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_posif.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Latest capture of capture trigger 0 */
+#define POSIF_CAPTURE_REGISTER		1U
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Check POSIF usage in system */
+#if( 1 == POSIF_USED )
+
+/* Declare static data member */
+tStPOSIF_Snapshot POSIF__::snapshots[2];
+volatile unsigned long POSIF__::sequence;
+unsigned long POSIF__::clock;
+unsigned short POSIF__::last_count;
+unsigned short POSIF__::last_stamp;
+unsigned short POSIF__::edge_period;
+unsigned char POSIF__::edge_discard;
+unsigned char POSIF__::init_state;
+
+
+/******* Public Member function for POSIF__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for POSIF
+ *
+ * \par<b>Description:</b><br>
+ * 				Slices run before POSIF starts, so no edge is lost
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+ePOSIF_Status_ POSIF__::init( const ePOSIF_Init_& init )
+{
+	/* Local Variables */
+	const XMC_GPIO_CONFIG_t pin_cfg =
+	{
+			XMC_GPIO_MODE_INPUT_PULL_UP,
+			XMC_GPIO_OUTPUT_LEVEL_HIGH,
+			XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+	};
+	XMC_POSIF_CONFIG_t posif_cfg = {};
+	XMC_POSIF_QD_CONFIG_t qd_cfg = {};
+
+	switch( init )
+	{
+		case ePOSIF_Init_::POSIF_INIT_OPEN:
+		{
+			if( 0U == init_state )
+			{
+				XMC_GPIO_Init( POSIF_PORT, POSIF_PIN_A, &pin_cfg );
+				XMC_GPIO_Init( POSIF_PORT, POSIF_PIN_B, &pin_cfg );
+
+				clock = XMC_SCU_CLOCK_GetCcuClockFrequency() >> (unsigned long) POSIF_PRESCALER;
+
+				XMC_CCU4_Init( POSIF_CCU, XMC_CCU4_SLICE_MCMS_ACTION_TRANSFER_PR_CR );
+				slice_init();
+
+				posif_cfg.mode = (unsigned long) XMC_POSIF_MODE_QD;
+				posif_cfg.input0 = (unsigned long) POSIF_INPUT_A;
+				posif_cfg.input1 = (unsigned long) POSIF_INPUT_B;
+				posif_cfg.filter = (unsigned long) POSIF_FILTER;
+				XMC_POSIF_Init( POSIF_MODULE, &posif_cfg );
+
+				qd_cfg.mode = XMC_POSIF_QD_MODE_QUADRATURE;
+				qd_cfg.index = (unsigned long) XMC_POSIF_QD_INDEX_GENERATION_NEVER;
+				DRIVER_ASSERT( (XMC_POSIF_STATUS_OK != XMC_POSIF_QD_Init( POSIF_MODULE, &qd_cfg )),
+								ePOSIF_Status_::POSIF_STATUS_FAILED );
+
+				snapshots[0] = tStPOSIF_Snapshot();
+				snapshots[1] = tStPOSIF_Snapshot();
+				sequence = 0U;
+				edge_period = 0U;
+				edge_discard = 1U;
+				last_count = get_count();
+				last_stamp = XMC_CCU4_SLICE_GetTimerValue( POSIF_STAMP_SLICE );
+
+				XMC_POSIF_Start( POSIF_MODULE );
+
+				init_state = 1U;
+			}
+			else{	/* Not required */	}
+		}
+		break;
+
+		default:
+		case ePOSIF_Init_::POSIF_INIT_CLOSE:
+		{
+			XMC_POSIF_Stop( POSIF_MODULE );
+			XMC_CCU4_SLICE_StopClearTimer( POSIF_COUNT_SLICE );
+			XMC_CCU4_SLICE_StopClearTimer( POSIF_STAMP_SLICE );
+			XMC_CCU4_SLICE_StopClearTimer( POSIF_EDGE_SLICE );
+
+			init_state = 0U;
+		}
+		break;
+	}
+
+	return ePOSIF_Status_::POSIF_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	sample
+ *
+ * @brief		Read hardware and publish new snapshot
+ *
+ * \par<b>Description:</b><br>
+ * 				New snapshot is built in buffer not published, then
+ * 				sequence count publishes it
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void POSIF__::sample( void )
+{
+	/* Local Variables */
+	unsigned long sequence_l = 0;
+	unsigned short count_l = 0;
+	unsigned short stamp_l = 0;
+	unsigned short elapsed_l = 0;
+	unsigned short period_l = 0;
+	long delta_l = 0;
+	long velocity_l = 0;
+
+	if( 0U != init_state )
+	{
+		sequence_l = sequence;
+		const tStPOSIF_Snapshot& last = snapshots[sequence_l & 1U];
+		tStPOSIF_Snapshot& next = snapshots[(sequence_l + 1U) & 1U];
+
+		count_l = get_count();
+		stamp_l = XMC_CCU4_SLICE_GetTimerValue( POSIF_STAMP_SLICE );
+		period_l = edge_ticks();
+		delta_l = static_cast<short>( count_l - last_count );
+		elapsed_l = static_cast<unsigned short>( stamp_l - last_stamp );
+		last_count = count_l;
+		last_stamp = stamp_l;
+
+		next.direction = ( XMC_POSIF_QD_DIR_CLOCKWISE == XMC_POSIF_QD_GetDirection( POSIF_MODULE ) ) ?
+							ePOSIF_Direction_::POSIF_DIRECTION_CW : ePOSIF_Direction_::POSIF_DIRECTION_CCW;
+
+		/* Counts over time at speed, quantization of one count is small there */
+		if( ((POSIF_VELOCITY_MIN_COUNTS <= delta_l) || (-POSIF_VELOCITY_MIN_COUNTS >= delta_l)) &&
+			(0U != elapsed_l) )
+		{
+			velocity_l = static_cast<long>( (static_cast<long long>( delta_l ) * clock) / elapsed_l );
+		}
+		/* Time between edges at low speed */
+		else if( 0U != period_l )
+		{
+			velocity_l = static_cast<long>( clock / period_l );
+			velocity_l = ( ePOSIF_Direction_::POSIF_DIRECTION_CW == next.direction ) ? velocity_l : -velocity_l;
+		}
+		else{	/* Not required */	}
+
+		next.position = last.position + delta_l;
+		next.velocity = velocity_l;
+		next.edge_period = period_l;
+
+		/* Snapshot must be complete before it is published */
+		__DMB();
+		sequence = sequence_l + 1U;
+	}
+	else{	/* Not required */	}
+}
+
+
+/**
+ * @function	get_snapshot
+ *
+ * @brief		Copy last published snapshot
+ *
+ * \par<b>Description:</b><br>
+ * 				sample() writes only the buffer not published, so copy is
+ * 				torn only if sample() ran twice during it. A reader that
+ * 				preempts sample() never waits.
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void POSIF__::get_snapshot( tStPOSIF_Snapshot& snapshot )
+{
+	/* Local Variables */
+	unsigned long sequence_l = 0;
+
+	do
+	{
+		sequence_l = sequence;
+		__DMB();
+		snapshot = snapshots[sequence_l & 1U];
+		__DMB();
+	}
+	while( 2U <= (sequence - sequence_l) );
+}
+
+
+/******* Private Member function for POSIF__ class *******/
+
+/**
+ * @function	slice_init
+ *
+ * @brief		Configure count, time base and edge capture slices
+ *
+ * \par<b>Description:</b><br>
+ * 				All slices wrap at 16 bit, differences are taken modulo
+ * 				2^16
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void POSIF__::slice_init( void )
+{
+	/* Local Variables */
+	XMC_CCU4_SLICE_COMPARE_CONFIG_t slice_cfg = {};
+	XMC_CCU4_SLICE_CAPTURE_CONFIG_t capture_cfg = {};
+	XMC_CCU4_SLICE_EVENT_CONFIG_t event_cfg = {};
+
+	/* Quadrature clock counts, direction counts down while low (CCW) */
+	slice_cfg.timer_mode = (unsigned long) XMC_CCU4_SLICE_TIMER_COUNT_MODE_EA;
+	slice_cfg.monoshot = (unsigned long) XMC_CCU4_SLICE_TIMER_REPEAT_MODE_REPEAT;
+	slice_cfg.prescaler_initval = (unsigned long) XMC_CCU4_SLICE_PRESCALER_1;
+	XMC_CCU4_SLICE_CompareInit( POSIF_COUNT_SLICE, &slice_cfg );
+
+	event_cfg.mapped_input = POSIF_COUNT_INPUT;
+	event_cfg.edge = XMC_CCU4_SLICE_EVENT_EDGE_SENSITIVITY_RISING_EDGE;
+	event_cfg.level = XMC_CCU4_SLICE_EVENT_LEVEL_SENSITIVITY_ACTIVE_HIGH;
+	event_cfg.duration = XMC_CCU4_SLICE_EVENT_FILTER_DISABLED;
+	XMC_CCU4_SLICE_ConfigureEvent( POSIF_COUNT_SLICE, XMC_CCU4_SLICE_EVENT_0, &event_cfg );
+	XMC_CCU4_SLICE_CountConfig( POSIF_COUNT_SLICE, XMC_CCU4_SLICE_EVENT_0 );
+
+	event_cfg.mapped_input = POSIF_DIRECTION_INPUT;
+	event_cfg.edge = XMC_CCU4_SLICE_EVENT_EDGE_SENSITIVITY_NONE;
+	event_cfg.level = XMC_CCU4_SLICE_EVENT_LEVEL_SENSITIVITY_ACTIVE_LOW;
+	XMC_CCU4_SLICE_ConfigureEvent( POSIF_COUNT_SLICE, XMC_CCU4_SLICE_EVENT_1, &event_cfg );
+	XMC_CCU4_SLICE_DirectionConfig( POSIF_COUNT_SLICE, XMC_CCU4_SLICE_EVENT_1 );
+
+	/* Free running time base */
+	slice_cfg.prescaler_initval = (unsigned long) POSIF_PRESCALER;
+	XMC_CCU4_SLICE_CompareInit( POSIF_STAMP_SLICE, &slice_cfg );
+
+	/* Period clock captures and clears timer, so capture is time between edges */
+	capture_cfg.timer_clear_mode = (unsigned long) XMC_CCU4_SLICE_TIMER_CLEAR_MODE_ALWAYS;
+	capture_cfg.ignore_full_flag = 1U;
+	capture_cfg.prescaler_initval = (unsigned long) POSIF_PRESCALER;
+	XMC_CCU4_SLICE_CaptureInit( POSIF_EDGE_SLICE, &capture_cfg );
+
+	event_cfg.mapped_input = POSIF_EDGE_INPUT;
+	event_cfg.edge = XMC_CCU4_SLICE_EVENT_EDGE_SENSITIVITY_RISING_EDGE;
+	event_cfg.level = XMC_CCU4_SLICE_EVENT_LEVEL_SENSITIVITY_ACTIVE_HIGH;
+	XMC_CCU4_SLICE_ConfigureEvent( POSIF_EDGE_SLICE, XMC_CCU4_SLICE_EVENT_0, &event_cfg );
+	XMC_CCU4_SLICE_Capture0Config( POSIF_EDGE_SLICE, XMC_CCU4_SLICE_EVENT_0 );
+
+	XMC_CCU4_SLICE_SetTimerPeriodMatch( POSIF_COUNT_SLICE, 0xFFFFU );
+	XMC_CCU4_SLICE_SetTimerPeriodMatch( POSIF_STAMP_SLICE, 0xFFFFU );
+	XMC_CCU4_SLICE_SetTimerPeriodMatch( POSIF_EDGE_SLICE, 0xFFFFU );
+	XMC_CCU4_EnableShadowTransfer( POSIF_CCU,
+			( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_SLICE_0 << (4U * POSIF_COUNT_SLICE_NUM) ) |
+			( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_SLICE_0 << (4U * POSIF_STAMP_SLICE_NUM) ) |
+			( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_PRESCALER_SLICE_0 << (4U * POSIF_STAMP_SLICE_NUM) ) |
+			( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_SLICE_0 << (4U * POSIF_EDGE_SLICE_NUM) ) |
+			( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_PRESCALER_SLICE_0 << (4U * POSIF_EDGE_SLICE_NUM) ) );
+
+	XMC_CCU4_EnableMultipleClocks( POSIF_CCU, static_cast<unsigned char>(
+			(1U << POSIF_COUNT_SLICE_NUM) | (1U << POSIF_STAMP_SLICE_NUM) | (1U << POSIF_EDGE_SLICE_NUM) ) );
+
+	XMC_CCU4_SLICE_ClearEvent( POSIF_EDGE_SLICE, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH );
+	XMC_CCU4_SLICE_StartTimer( POSIF_COUNT_SLICE );
+	XMC_CCU4_SLICE_StartTimer( POSIF_STAMP_SLICE );
+	XMC_CCU4_SLICE_StartTimer( POSIF_EDGE_SLICE );
+}
+
+
+/**
+ * @function	edge_ticks
+ *
+ * @brief		Time between last two edges
+ *
+ * \par<b>Description:</b><br>
+ * 				Period match of edge timer means no edge for its whole
+ * 				range, i.e. stalled. First capture after stall, or after
+ * 				init, measures from wrap or start and is dropped, whether
+ * 				it is read together with the stall or by a later call.
+ * 				While time since last edge exceeds last period, it is
+ * 				the better estimate.
+ *
+ * <i>Imp Note:</i>
+ * 				Period match flag is polled, it raises no interrupt
+ *
+ */
+unsigned short POSIF__::edge_ticks( void )
+{
+	/* Local Variables */
+	const unsigned long capture_l = XMC_CCU4_SLICE_GetCaptureRegisterValue( POSIF_EDGE_SLICE, POSIF_CAPTURE_REGISTER );
+	const bool stalled_l = XMC_CCU4_SLICE_GetEvent( POSIF_EDGE_SLICE, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH );
+	const unsigned short timer_l = XMC_CCU4_SLICE_GetTimerValue( POSIF_EDGE_SLICE );
+
+	if( true == stalled_l )
+	{
+		XMC_CCU4_SLICE_ClearEvent( POSIF_EDGE_SLICE, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH );
+		edge_period = 0U;
+		/* Capture read with the stall is dropped here, else drop the next one */
+		edge_discard = ( 0U == (capture_l & CCU4_CC4_CV_FFL_Msk) ) ? 1U : 0U;
+	}
+	else if( 0U != (capture_l & CCU4_CC4_CV_FFL_Msk) )
+	{
+		if( 0U != edge_discard )
+		{
+			edge_discard = 0U;
+		}
+		else
+		{
+			edge_period = static_cast<unsigned short>( capture_l & CCU4_CC4_CV_CAPTV_Msk );
+		}
+	}
+	else{	/* Not required */	}
+
+	return ( (0U != edge_period) && (timer_l > edge_period) ) ? timer_l : edge_period;
+}
+
+#endif	/* POSIF_USED */
+
+/********************************** End of File *******************************/
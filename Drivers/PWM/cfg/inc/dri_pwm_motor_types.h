@@ -0,0 +1,101 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Motor PWM data types Header
+* Filename:		dri_pwm_motor_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_pwm_motor_types.h
+ *  @brief:	This file contains data types definitions for CCU8 three phase
+ *  		complementary PWM with dead time and trap
+ */
+#ifndef DRI_PWM_MOTOR_TYPES_H_
+#define DRI_PWM_MOTOR_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_ccu8.h>
+#include <xmc_gpio.h>
+#include <xmc_scu.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_pwm_motor_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+/* Duty scale is shared with PWM__ */
+#include <dri_pwm_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of motor PWM
+ * */
+enum class ePWM_Motor_Status_/*	:	unsigned char	*/
+{
+	PWM_MOTOR_STATUS_SUCCESS = 0,
+	PWM_MOTOR_STATUS_FAILED,
+	PWM_MOTOR_STATUS_BUSY,
+	PWM_MOTOR_STATUS_INVALID_ARGUMENT
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class ePWM_Motor_Init_/*	:	unsigned char	*/
+{
+	PWM_MOTOR_INIT_CLOSE = 0,
+	PWM_MOTOR_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for events of callback
+ * */
+enum class ePWM_Motor_Event_/*	:	unsigned char	*/
+{
+	PWM_MOTOR_EVENT_PERIOD = 0,		/**< Period match, center of high side pulse */
+	PWM_MOTOR_EVENT_TRAP			/**< Trap input asserted, outputs already passive */
+};
+
+
+#endif /* DRI_PWM_MOTOR_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,91 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		PWM data types Header
+* Filename:		dri_pwm_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_pwm_types.h
+ *  @brief:	This file contains data types definitions for CCU4 PWM with
+ *  		batched shadow transfer
+ */
+#ifndef DRI_PWM_TYPES_H_
+#define DRI_PWM_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_ccu4.h>
+#include <xmc_gpio.h>
+#include <xmc_scu.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_pwm_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Duty cycle of 100 %, duty is unsigned Q15 */
+#define PWM_DUTY_FULL				32768U
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of PWM
+ * */
+enum class ePWM_Status_/*	:	unsigned char	*/
+{
+	PWM_STATUS_SUCCESS = 0,
+	PWM_STATUS_FAILED,
+	PWM_STATUS_INVALID_ARGUMENT
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class ePWM_Init_/*	:	unsigned char	*/
+{
+	PWM_INIT_CLOSE = 0,
+	PWM_INIT_OPEN
+};
+
+
+#endif /* DRI_PWM_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,96 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		PWM Configuration Header
+* Filename:		dri_pwm_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_pwm_conf.h
+ *  @brief:	This file contains static configurations for CCU4 PWM with
+ *  		batched shadow transfer
+ */
+#ifndef DRI_PWM_CONF_H_
+#define DRI_PWM_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* PWM used in system, 0 - not used */
+#define PWM_USED					1
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/*
+ * Channel n runs on slice PWM_SLICE_n, number PWM_SLICE_NUMBER_n of module,
+ * all channels share one period and start together. CCU40 is kept for
+ * POSIF, CCU41 runs control loops and CCU43 serves GPIO event and
+ * waveform. CC41 is left out, its only output CCU42.OUT1 is P3.5 which
+ * is SDA of I2C, it serves input capture, see dri_capture_conf.h.
+ */
+#define PWM_MODULE					CCU42
+#define PWM_CHANNELS				3U
+#define PWM_SLICE_0					CCU42_CC40
+#define PWM_SLICE_NUMBER_0			0U
+#define PWM_SLICE_1					CCU42_CC42
+#define PWM_SLICE_NUMBER_1			2U
+#define PWM_SLICE_2					CCU42_CC43
+#define PWM_SLICE_NUMBER_2			3U
+
+/* Slice clock fCCU4 / 2^n and PWM frequency, edge aligned */
+#define PWM_PRESCALER				XMC_CCU4_SLICE_PRESCALER_1
+#define PWM_FREQUENCY				20000UL
+
+/* All slices start on rising edge of SCU global start of module, INyI */
+#define PWM_START_INPUT				XMC_CCU4_SLICE_INPUT_I
+#define PWM_START_TRIGGER			XMC_SCU_CCU_TRIGGER_CCU42
+
+/* Output pins of channels are described in dri_pwm_conf.cpp */
+
+
+/* Check channels availability, one slice of module is not bonded out */
+#if ( (0U == PWM_CHANNELS) || (3U < PWM_CHANNELS) )
+	#error	"PWM has 1 to 3 channels"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_PWM_CONF_H_ */
+
+/********************************** End of File ******************************/
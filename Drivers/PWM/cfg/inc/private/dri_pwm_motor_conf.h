@@ -0,0 +1,128 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Motor PWM Configuration Header
+* Filename:		dri_pwm_motor_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_pwm_motor_conf.h
+ *  @brief:	This file contains static configurations for CCU8 three phase
+ *  		complementary PWM with dead time and trap
+ */
+#ifndef DRI_PWM_MOTOR_CONF_H_
+#define DRI_PWM_MOTOR_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Motor PWM used in system, 0 - not used */
+#define PWM_MOTOR_USED					1
+
+/* Callback function used in system */
+#define PWM_MOTOR_CALLBACK_HANDLER_USED	1
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Slice, slice number and compare channel of phases. Outputs of slice 0
+ * and 1 channel 1 clash with UART and SPI on port 0, so phase U and V use
+ * channel 1 of slice 2 and 3 and phase W channel 2 of slice 1. Slice 0
+ * stays free */
+#define PWM_MOTOR_MODULE				CCU80
+#define PWM_MOTOR_PHASES				3U
+#define PWM_MOTOR_SLICE_U				CCU80_CC82
+#define PWM_MOTOR_SLICE_NUMBER_U		2U
+#define PWM_MOTOR_CHANNEL_U				1U
+#define PWM_MOTOR_SLICE_V				CCU80_CC83
+#define PWM_MOTOR_SLICE_NUMBER_V		3U
+#define PWM_MOTOR_CHANNEL_V				1U
+#define PWM_MOTOR_SLICE_W				CCU80_CC81
+#define PWM_MOTOR_SLICE_NUMBER_W		1U
+#define PWM_MOTOR_CHANNEL_W				2U
+
+/* Slice clock fCCU8 / 2^n and PWM frequency, center aligned so timer
+ * counts up and down once per PWM period */
+#define PWM_MOTOR_PRESCALER				XMC_CCU8_SLICE_PRESCALER_1
+#define PWM_MOTOR_FREQUENCY				20000UL
+
+/* Dead time inserted on both edges of high and low side, counted in fCCU8
+ * ticks and limited to 255 of them */
+#define PWM_MOTOR_DEAD_TIME_NS			500UL
+
+/* All slices start on rising edge of SCU global start of module, INyH */
+#define PWM_MOTOR_START_INPUT			XMC_CCU8_SLICE_INPUT_H
+#define PWM_MOTOR_START_TRIGGER			XMC_SCU_CCU_TRIGGER_CCU80
+
+/* Trap input CCU80.INyA on P0.7, shared by all slices, low active.
+ * Trap state is left only by trap_clear() at a period boundary */
+#define PWM_MOTOR_TRAP_INPUT			XMC_CCU8_SLICE_INPUT_A
+#define PWM_MOTOR_TRAP_PORT				XMC_GPIO_PORT0
+#define PWM_MOTOR_TRAP_PIN				7U
+#define PWM_MOTOR_TRAP_FILTER			XMC_CCU8_SLICE_EVENT_FILTER_3_CYCLES
+
+/* Period match of phase U is served on SR0 and trap on SR1, SR2 and SR3
+ * are left for ADC triggers, see ADC__::route_ccu8() */
+#define PWM_MOTOR_PERIOD_IRQ			CCU80_0_IRQn
+#define PWM_MOTOR_TRAP_IRQ				CCU80_1_IRQn
+#define PWM_MOTOR_PERIOD_HANDLER		IRQ_Hdlr_60	/* CCU80 SR0 */
+#define PWM_MOTOR_TRAP_HANDLER			IRQ_Hdlr_61	/* CCU80 SR1 */
+
+/* Period hook runs control loop, only trap may preempt it */
+#define PWM_MOTOR_PERIOD_IRQ_PRIORITY	2U
+#define PWM_MOTOR_TRAP_IRQ_PRIORITY		1U
+
+/* Output pins of phases are described in dri_pwm_motor_conf.cpp */
+
+
+/* Check phases */
+#if ( 3U != PWM_MOTOR_PHASES )
+	#error	"Motor PWM drives three phases"
+#endif
+
+/* Check compare channels */
+#if ( (PWM_MOTOR_CHANNEL_U - 1U) > 1U ) || ( (PWM_MOTOR_CHANNEL_V - 1U) > 1U ) || \
+	( (PWM_MOTOR_CHANNEL_W - 1U) > 1U )
+	#error	"Motor PWM compare channel is 1 or 2"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_PWM_MOTOR_CONF_H_ */
+
+/********************************** End of File ******************************/
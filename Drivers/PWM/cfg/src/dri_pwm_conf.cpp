@@ -0,0 +1,105 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		PWM Configuration Source
+* Filename:		dri_pwm_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_pwm_conf.cpp
+ *  @brief:	This source file contains output pins of PWM channels
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_pwm.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check PWM usage in system */
+#if( 1 == PWM_USED )
+
+/*
+ * @brief	Output pins of PWM channels
+ *
+ * <i>Imp Note:</i>
+ * 			CCU42 outputs of LQFP100 are on port 3 only, OUT0 on P3.0 and
+ * 			P3.6, OUT1 on P3.5, OUT2 on P3.4 and OUT3 on P3.3. P3.5 and
+ * 			P3.6 are taken by I2C, so slice 1 is not used, see
+ * 			dri_pwm_conf.h.
+ */
+const tStPinConfig g_pwm_pins[PWM_CHANNELS] =
+{
+		{/**< Channel 0, CCU42.OUT0 on P3.0 */
+				XMC_GPIO_PORT3,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT3,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				0
+		},
+		{/**< Channel 1, CCU42.OUT2 on P3.4 */
+				XMC_GPIO_PORT3,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT3,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				4
+		},
+		{/**< Channel 2, CCU42.OUT3 on P3.3 */
+				XMC_GPIO_PORT3,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT3,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				3
+		}
+};
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#endif	/* PWM_USED */
+
+/********************************** End of File *******************************/
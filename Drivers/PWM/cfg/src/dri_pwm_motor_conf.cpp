@@ -0,0 +1,173 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Motor PWM Configuration Source
+* Filename:		dri_pwm_motor_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_pwm_motor_conf.cpp
+ *  @brief:	This source file contains output pins and ISR handlers of
+ *  		motor PWM
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_pwm_motor.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check motor PWM usage in system */
+#if( 1 == PWM_MOTOR_USED )
+
+/*
+ * @brief	Output pins of phases, high side then low side
+ *
+ * <i>Imp Note:</i>
+ * 			High sides are ST and low sides inverted ST of compare
+ * 			channel of phase, see dri_pwm_motor_conf.h.
+ */
+const tStPinConfig g_pwm_motor_pins[2U * PWM_MOTOR_PHASES] =
+{
+		{/**< Phase U high side, CCU80.OUT20 on P0.3 */
+				XMC_GPIO_PORT0,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT3,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				3
+		},
+		{/**< Phase U low side, CCU80.OUT21 on P2.14 */
+				XMC_GPIO_PORT2,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT3,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				14
+		},
+		{/**< Phase V high side, CCU80.OUT30 on P0.6 */
+				XMC_GPIO_PORT0,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT3,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				6
+		},
+		{/**< Phase V low side, CCU80.OUT31 on P0.11 */
+				XMC_GPIO_PORT0,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT3,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				11
+		},
+		{/**< Phase W high side, CCU80.OUT12 on P0.9 */
+				XMC_GPIO_PORT0,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT3,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				9
+		},
+		{/**< Phase W low side, CCU80.OUT13 on P2.6 */
+				XMC_GPIO_PORT2,
+				{
+						XMC_GPIO_MODE_OUTPUT_PUSH_PULL_ALT3,
+						XMC_GPIO_OUTPUT_LEVEL_LOW,
+						XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+				},
+				6
+		}
+};
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/******* ISR Handlers for PWM_Motor__ *******/
+
+extern "C"
+{
+
+#ifdef PWM_MOTOR_PERIOD_HANDLER
+/**
+ * @function	PWM_MOTOR_PERIOD_HANDLER
+ *
+ * @brief		Motor PWM period match handler
+ *
+ * <i>Imp Note:</i>
+ * 				Placed in RAM with period path
+ *
+ */
+__RAM_FUNC void PWM_MOTOR_PERIOD_HANDLER( void )
+{
+	/* Call ISR entry function */
+	PWM_Motor__::isr_period();
+}
+#endif	/* PWM_MOTOR_PERIOD_HANDLER */
+
+
+#ifdef PWM_MOTOR_TRAP_HANDLER
+/**
+ * @function	PWM_MOTOR_TRAP_HANDLER
+ *
+ * @brief		Motor PWM trap handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void PWM_MOTOR_TRAP_HANDLER( void )
+{
+	/* Call ISR entry function */
+	PWM_Motor__::isr_trap();
+}
+#endif	/* PWM_MOTOR_TRAP_HANDLER */
+
+
+}	/* extern "C"{ */
+
+#endif	/* PWM_MOTOR_USED */
+
+/********************************** End of File *******************************/
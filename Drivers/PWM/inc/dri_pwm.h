@@ -0,0 +1,185 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		PWM API Header
+* Filename:		dri_pwm.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_pwm.h
+ *  @brief:	This file contains API function declarations for CCU4 PWM with
+ *  		batched shadow transfer
+ */
+#ifndef DRI_PWM_H_
+#define DRI_PWM_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_pwm_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+#if( 1 == PWM_USED )
+/* Output pin of channel n, p_port nullptr for slice without pin */
+extern const tStPinConfig g_pwm_pins[PWM_CHANNELS];
+#endif
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for CCU4 PWM with batched shadow transfer
+ *
+ * 			All channel slices run one period and are started by one
+ * 			write, so their period boundaries coincide. New compare values
+ * 			go to shadow registers and one shadow transfer request moves
+ * 			all of them at next period boundary, no channel ever outputs a
+ * 			mix of old and new period.
+ *
+ ******************************************************************************/
+
+/* Check PWM usage in system */
+#if( 1 == PWM_USED )
+
+class PWM__
+{
+/* public members */
+public:
+	/* Constructors */
+	PWM__() = delete;
+	PWM__( PWM__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for PWM
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							ePWM_Init_	-	PWM_INIT_OPEN
+	 * 										PWM_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	ePWM_Status_
+	 *          	PWM_STATUS_SUCCESS:		Operation successful.<BR>
+	 *          	PWM_STATUS_FAILED:		PWM_FREQUENCY out of timer range.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Channels start with 0 % duty
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static ePWM_Status_ init( const ePWM_Init_& init = ePWM_Init_::PWM_INIT_OPEN );
+
+	/**
+	 * @function	set_duties
+	 *
+	 * @brief		Update duty cycles of several channels at once
+	 *
+	 * @param[in]	p_duty	-	duty of channel 0 to count - 1, unsigned Q15,
+	 * 							PWM_DUTY_FULL is 100 %
+	 * 				count	-	number of channels
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	ePWM_Status_
+	 *          	PWM_STATUS_SUCCESS:				Values take effect at next period.<BR>
+	 *          	PWM_STATUS_FAILED:				Not initialized.<BR>
+	 *          	PWM_STATUS_INVALID_ARGUMENT:	Wrong count.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				One multiply and one shadow register write per channel,
+	 * 				one transfer request for all
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Duty above PWM_DUTY_FULL is clamped. Call early in period,
+	 * 				a request that races with period boundary of some slice
+	 * 				applies one period later to all.
+	 *
+	 */
+	static ePWM_Status_ set_duties( const unsigned short * const p_duty, const unsigned char count );
+
+	/**
+	 * @function	set_duty
+	 *
+	 * @brief		Update duty cycle of one channel
+	 *
+	 * @param[in]	channel	-	channel number
+	 * 				duty	-	unsigned Q15, PWM_DUTY_FULL is 100 %
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	ePWM_Status_
+	 *          	PWM_STATUS_SUCCESS:				Value takes effect at next period.<BR>
+	 *          	PWM_STATUS_FAILED:				Not initialized.<BR>
+	 *          	PWM_STATUS_INVALID_ARGUMENT:	Wrong channel.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static ePWM_Status_ set_duty( const unsigned char channel, const unsigned short duty );
+
+	/******* Setters and Getters *******/
+	/* Period in slice ticks */
+	static inline unsigned long get_period( void ){ return period; }
+
+/* private members */
+private:
+	/** Data Members **/
+	static unsigned long period;
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static void slice_init( const unsigned char channel );
+	static inline unsigned short to_compare( unsigned short duty )
+	{
+		duty = ( duty > PWM_DUTY_FULL ) ? static_cast<unsigned short>( PWM_DUTY_FULL ) : duty;
+		return static_cast<unsigned short>( period - ((period * duty) >> 15) );
+	}
+};
+
+#endif	/* PWM_USED */
+
+
+#endif /* DRI_PWM_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,208 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Motor PWM API Header
+* Filename:		dri_pwm_motor.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_pwm_motor.h
+ *  @brief:	This file contains API function declarations for CCU8 three
+ *  		phase complementary PWM with dead time and trap
+ */
+#ifndef DRI_PWM_MOTOR_H_
+#define DRI_PWM_MOTOR_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_pwm_motor_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+#if( 1 == PWM_MOTOR_USED )
+/* High side (OUTy0) and low side (OUTy1) pin of phase U, V and W in turn */
+extern const tStPinConfig g_pwm_motor_pins[2U * PWM_MOTOR_PHASES];
+
+#if( 1 == PWM_MOTOR_CALLBACK_HANDLER_USED )
+/* Callback handler for user, called in period and trap interrupt */
+extern void pwm_motor_callback_handler( const ePWM_Motor_Event_ event );
+#endif
+#endif
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for CCU8 three phase complementary PWM
+ *
+ * 			One slice per phase drives high side with ST and low side with
+ * 			inverted ST, dead time generator of slice delays the rising
+ * 			edge of both. Timers count up and down, started together by
+ * 			SCU global start.
+ *
+ * 			Trap input forces all six outputs to passive level in
+ * 			hardware, interrupt only reports it. Period match of phase U
+ * 			calls user once per PWM period to run control loop.
+ *
+ ******************************************************************************/
+
+/* Check motor PWM usage in system */
+#if( 1 == PWM_MOTOR_USED )
+
+class PWM_Motor__
+{
+/* public members */
+public:
+	/* Constructors */
+	PWM_Motor__() = delete;
+	PWM_Motor__( PWM_Motor__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for motor PWM
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							ePWM_Motor_Init_	-	PWM_MOTOR_INIT_OPEN
+	 * 												PWM_MOTOR_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	ePWM_Motor_Status_
+	 *          	PWM_MOTOR_STATUS_SUCCESS:	Operation successful.<BR>
+	 *          	PWM_MOTOR_STATUS_FAILED:	Frequency or dead time out of range.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Phases start with 0 % duty, i.e. high sides off and low
+	 * 				sides on
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Trap asserted during init keeps outputs passive until
+	 * 				trap_clear()
+	 *
+	 */
+	static ePWM_Motor_Status_ init( const ePWM_Motor_Init_& init = ePWM_Motor_Init_::PWM_MOTOR_INIT_OPEN );
+
+	/**
+	 * @function	set_duties
+	 *
+	 * @brief		Update duty cycles of all three phases
+	 *
+	 * @param[in]	p_duty	-	duty of phase U, V and W, unsigned Q15,
+	 * 							PWM_DUTY_FULL is 100 %
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	ePWM_Motor_Status_
+	 *          	PWM_MOTOR_STATUS_SUCCESS:			Values take effect at next period.<BR>
+	 *          	PWM_MOTOR_STATUS_FAILED:			Not initialized.<BR>
+	 *          	PWM_MOTOR_STATUS_INVALID_ARGUMENT:	Null pointer.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Three compare shadow writes and one transfer request, so
+	 * 				phases never mix old and new values
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Placed in RAM, meant to be called from period callback.
+	 * 				Duty above PWM_DUTY_FULL is clamped.
+	 *
+	 */
+	static __RAM_FUNC ePWM_Motor_Status_ set_duties( const unsigned short * const p_duty );
+
+	/**
+	 * @function	trap_clear
+	 *
+	 * @brief		Leave trap state
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	ePWM_Motor_Status_
+	 *          	PWM_MOTOR_STATUS_SUCCESS:	Outputs resume at next period.<BR>
+	 *          	PWM_MOTOR_STATUS_FAILED:	Not initialized.<BR>
+	 *          	PWM_MOTOR_STATUS_BUSY:		Trap input still active.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Trap flags of all phases are cleared together, hardware
+	 * 				resumes outputs synchronous to PWM period
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Set safe duties before clearing
+	 *
+	 */
+	static ePWM_Motor_Status_ trap_clear( void );
+
+	/******* Setters and Getters *******/
+	/* Trap flag of phase U, all phases share trap input */
+	static inline bool is_trapped( void )
+	{
+		return XMC_CCU8_SLICE_GetEvent( PWM_MOTOR_SLICE_U, XMC_CCU8_SLICE_IRQ_ID_TRAP );
+	}
+	/* Half period in slice ticks, PWM period is twice of it */
+	static inline unsigned long get_period( void ){ return period; }
+	/* Dead time in fCCU8 ticks */
+	static inline unsigned char get_dead_time( void ){ return dead_time; }
+
+	/******* ISR entries *******/
+	static __RAM_FUNC void isr_period( void );
+	static void isr_trap( void );
+
+/* private members */
+private:
+	/** Data Members **/
+	static unsigned long period;
+	static unsigned char dead_time;
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static void slice_init( const unsigned char phase );
+	static inline unsigned short to_compare( unsigned short duty )
+	{
+		duty = ( duty > PWM_DUTY_FULL ) ? static_cast<unsigned short>( PWM_DUTY_FULL ) : duty;
+		return static_cast<unsigned short>( period - ((period * duty) >> 15) );
+	}
+};
+
+#endif	/* PWM_MOTOR_USED */
+
+
+#endif /* DRI_PWM_MOTOR_H_ */
+
+/********************************** End of File *******************************/
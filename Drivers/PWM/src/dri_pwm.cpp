@@ -0,0 +1,277 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		PWM API Source
+* Filename:		dri_pwm.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_pwm.cpp
+ *  @brief:	This source file contains API function definitions for CCU4
+ *  		PWM with batched shadow transfer.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_pwm.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Shadow transfer request bits of period, compare and prescaler of slice */
+#define PWM_TRANSFER_BITS( slice )	\
+	( ( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_SLICE_0 | \
+		(unsigned long) XMC_CCU4_SHADOW_TRANSFER_PRESCALER_SLICE_0 ) << (4U * (slice)) )
+
+/* Shadow transfer request bit of period and compare of slice */
+#define PWM_TRANSFER_BIT( slice )	\
+	( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_SLICE_0 << (4U * (slice)) )
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check PWM usage in system */
+#if( 1 == PWM_USED )
+
+/* Slice of channel n and its number in module */
+static XMC_CCU4_SLICE_t * const sg_pwm_slices[3] =
+{
+		PWM_SLICE_0,
+		PWM_SLICE_1,
+		PWM_SLICE_2
+};
+static const unsigned char sg_pwm_slice_numbers[3] =
+{
+		PWM_SLICE_NUMBER_0,
+		PWM_SLICE_NUMBER_1,
+		PWM_SLICE_NUMBER_2
+};
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Declare static data member */
+unsigned long PWM__::period;
+unsigned char PWM__::init_state;
+
+
+/******* Public Member function for PWM__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for PWM
+ *
+ * \par<b>Description:</b><br>
+ * 				Slices are armed to start on SCU global start, one pulse
+ * 				of it clears and starts all timers in same clock
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+ePWM_Status_ PWM__::init( const ePWM_Init_& init )
+{
+	/* Local Variables */
+	unsigned long period_l = 0;
+	unsigned long transfer_l = 0;
+	unsigned char clocks_l = 0;
+	unsigned char channel = 0;
+
+	switch( init )
+	{
+		case ePWM_Init_::PWM_INIT_OPEN:
+		{
+			if( 0U == init_state )
+			{
+				/* Compare value of 0 % duty is period itself and has to fit 16 bit */
+				period_l = ( XMC_SCU_CLOCK_GetCcuClockFrequency() >> (unsigned long) PWM_PRESCALER ) / PWM_FREQUENCY;
+				DRIVER_ASSERT( ((2U > period_l) || (0xFFFFUL < period_l)), ePWM_Status_::PWM_STATUS_FAILED );
+				period = period_l;
+
+				/* Enable module and prescaler, does not disturb other slices */
+				XMC_CCU4_Init( PWM_MODULE, XMC_CCU4_SLICE_MCMS_ACTION_TRANSFER_PR_CR );
+
+				for( channel = 0; channel < PWM_CHANNELS; ++channel )
+				{
+					slice_init( channel );
+					transfer_l |= PWM_TRANSFER_BITS( sg_pwm_slice_numbers[channel] );
+					clocks_l = static_cast<unsigned char>( clocks_l | (1U << sg_pwm_slice_numbers[channel]) );
+				}
+
+				/* Load period and 0 % compare before start */
+				XMC_CCU4_EnableShadowTransfer( PWM_MODULE, transfer_l );
+				XMC_CCU4_EnableMultipleClocks( PWM_MODULE, clocks_l );
+
+				XMC_SCU_SetCcuTriggerHigh( PWM_START_TRIGGER );
+				XMC_SCU_SetCcuTriggerLow( PWM_START_TRIGGER );
+
+				init_state = 1U;
+			}
+			else{	/* Not required */	}
+		}
+		break;
+
+		default:
+		case ePWM_Init_::PWM_INIT_CLOSE:
+		{
+			for( channel = 0; channel < PWM_CHANNELS; ++channel )
+			{
+				/* Output falls back to passive level */
+				XMC_CCU4_SLICE_StopClearTimer( sg_pwm_slices[channel] );
+				XMC_CCU4_DisableClock( PWM_MODULE, sg_pwm_slice_numbers[channel] );
+			}
+
+			init_state = 0U;
+		}
+		break;
+	}
+
+	return ePWM_Status_::PWM_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	set_duties
+ *
+ * @brief		Update duty cycles of several channels at once
+ *
+ * \par<b>Description:</b><br>
+ * 				Compare shadow registers are written first, single write
+ * 				of transfer request then commits all of them
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+ePWM_Status_ PWM__::set_duties( const unsigned short * const p_duty, const unsigned char count )
+{
+	/* Local Variables */
+	unsigned long transfer_l = 0;
+	unsigned char channel = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_duty) || (0U == count) || (PWM_CHANNELS < count)),
+					ePWM_Status_::PWM_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (0U == init_state), ePWM_Status_::PWM_STATUS_FAILED );
+
+	for( channel = 0; channel < count; ++channel )
+	{
+		XMC_CCU4_SLICE_SetTimerCompareMatch( sg_pwm_slices[channel], to_compare( p_duty[channel] ) );
+		transfer_l |= PWM_TRANSFER_BIT( sg_pwm_slice_numbers[channel] );
+	}
+
+	XMC_CCU4_EnableShadowTransfer( PWM_MODULE, transfer_l );
+
+	return ePWM_Status_::PWM_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	set_duty
+ *
+ * @brief		Update duty cycle of one channel
+ *
+ * \par<b>Description:</b><br>
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+ePWM_Status_ PWM__::set_duty( const unsigned char channel, const unsigned short duty )
+{
+	/* Check input arguments */
+	DRIVER_ASSERT( (PWM_CHANNELS <= channel), ePWM_Status_::PWM_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (0U == init_state), ePWM_Status_::PWM_STATUS_FAILED );
+
+	XMC_CCU4_SLICE_SetTimerCompareMatch( sg_pwm_slices[channel], to_compare( duty ) );
+	XMC_CCU4_EnableShadowTransfer( PWM_MODULE, PWM_TRANSFER_BIT( sg_pwm_slice_numbers[channel] ) );
+
+	return ePWM_Status_::PWM_STATUS_SUCCESS;
+}
+
+
+/******* Private Member function for PWM__ class *******/
+
+/**
+ * @function	slice_init
+ *
+ * @brief		Configure slice and output pin of a channel
+ *
+ * \par<b>Description:</b><br>
+ * 				Edge aligned up counter, output is high from compare match
+ * 				to period match
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void PWM__::slice_init( const unsigned char channel )
+{
+	/* Local Variables */
+	XMC_CCU4_SLICE_COMPARE_CONFIG_t slice_cfg = {};
+	XMC_CCU4_SLICE_EVENT_CONFIG_t start_cfg = {};
+	XMC_CCU4_SLICE_t * const p_slice = sg_pwm_slices[channel];
+
+	slice_cfg.timer_mode = (unsigned long) XMC_CCU4_SLICE_TIMER_COUNT_MODE_EA;
+	slice_cfg.monoshot = (unsigned long) XMC_CCU4_SLICE_TIMER_REPEAT_MODE_REPEAT;
+	slice_cfg.prescaler_initval = (unsigned long) PWM_PRESCALER;
+	slice_cfg.passive_level = (unsigned long) XMC_CCU4_SLICE_OUTPUT_PASSIVE_LEVEL_LOW;
+	XMC_CCU4_SLICE_CompareInit( p_slice, &slice_cfg );
+
+	XMC_CCU4_SLICE_SetTimerPeriodMatch( p_slice, static_cast<unsigned short>( period - 1U ) );
+	XMC_CCU4_SLICE_SetTimerCompareMatch( p_slice, static_cast<unsigned short>( period ) );
+
+	/* Start by SCU global start */
+	start_cfg.mapped_input = PWM_START_INPUT;
+	start_cfg.edge = XMC_CCU4_SLICE_EVENT_EDGE_SENSITIVITY_RISING_EDGE;
+	start_cfg.level = XMC_CCU4_SLICE_EVENT_LEVEL_SENSITIVITY_ACTIVE_HIGH;
+	start_cfg.duration = XMC_CCU4_SLICE_EVENT_FILTER_DISABLED;
+	XMC_CCU4_SLICE_ConfigureEvent( p_slice, XMC_CCU4_SLICE_EVENT_0, &start_cfg );
+	XMC_CCU4_SLICE_StartConfig( p_slice, XMC_CCU4_SLICE_EVENT_0, XMC_CCU4_SLICE_START_MODE_TIMER_START_CLEAR );
+
+	if( nullptr != g_pwm_pins[channel].p_port )
+	{
+		XMC_GPIO_Init( g_pwm_pins[channel].p_port, g_pwm_pins[channel].pin, &g_pwm_pins[channel].config );
+	}
+	else{	/* Not required */	}
+}
+
+#endif	/* PWM_USED */
+
+/********************************** End of File *******************************/
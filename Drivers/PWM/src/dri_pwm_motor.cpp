@@ -0,0 +1,433 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Motor PWM API Source
+* Filename:		dri_pwm_motor.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_pwm_motor.cpp
+ *  @brief:	This source file contains API function definitions for CCU8
+ *  		three phase complementary PWM with dead time and trap.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_pwm_motor.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Dead time counter is 8 bit */
+#define PWM_MOTOR_DEAD_TIME_MAX		255UL
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Shadow transfer request bit of period and compare of slice */
+#define PWM_MOTOR_TRANSFER_BIT( slice_number )	\
+	( (unsigned long) XMC_CCU8_SHADOW_TRANSFER_SLICE_0 << (4U * (slice_number)) )
+
+/* Shadow transfer of all phases */
+#define PWM_MOTOR_TRANSFER_ALL	\
+	( PWM_MOTOR_TRANSFER_BIT( PWM_MOTOR_SLICE_NUMBER_U ) | PWM_MOTOR_TRANSFER_BIT( PWM_MOTOR_SLICE_NUMBER_V ) | \
+	  PWM_MOTOR_TRANSFER_BIT( PWM_MOTOR_SLICE_NUMBER_W ) )
+
+/* Clock enable bits of all phases */
+#define PWM_MOTOR_CLOCK_ALL	\
+	( (1U << PWM_MOTOR_SLICE_NUMBER_U) | (1U << PWM_MOTOR_SLICE_NUMBER_V) | (1U << PWM_MOTOR_SLICE_NUMBER_W) )
+
+/* Compare of channel of a phase, channel is constant so only one write stays */
+#define PWM_MOTOR_SET_COMPARE( slice, channel, compare )	\
+	( (1U == (channel)) ? XMC_CCU8_SLICE_SetTimerCompareMatchChannel1( (slice), (compare) ) \
+						: XMC_CCU8_SLICE_SetTimerCompareMatchChannel2( (slice), (compare) ) )
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check motor PWM usage in system */
+#if( 1 == PWM_MOTOR_USED )
+
+/* Slice of phase U, V and W */
+static XMC_CCU8_SLICE_t * const sg_pwm_motor_slices[PWM_MOTOR_PHASES] =
+{
+		PWM_MOTOR_SLICE_U,
+		PWM_MOTOR_SLICE_V,
+		PWM_MOTOR_SLICE_W
+};
+
+/* Slice number of phase U, V and W */
+static const unsigned char sg_pwm_motor_slice_numbers[PWM_MOTOR_PHASES] =
+{
+		PWM_MOTOR_SLICE_NUMBER_U,
+		PWM_MOTOR_SLICE_NUMBER_V,
+		PWM_MOTOR_SLICE_NUMBER_W
+};
+
+/* Compare channel of phase U, V and W */
+static const unsigned char sg_pwm_motor_channels[PWM_MOTOR_PHASES] =
+{
+		PWM_MOTOR_CHANNEL_U,
+		PWM_MOTOR_CHANNEL_V,
+		PWM_MOTOR_CHANNEL_W
+};
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Declare static data member */
+unsigned long PWM_Motor__::period;
+unsigned char PWM_Motor__::dead_time;
+unsigned char PWM_Motor__::init_state;
+
+
+/******* Public Member function for PWM_Motor__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for motor PWM
+ *
+ * \par<b>Description:</b><br>
+ * 				Slices are armed to start on SCU global start, pins are
+ * 				switched to CCU8 only after outputs hold passive level
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+ePWM_Motor_Status_ PWM_Motor__::init( const ePWM_Motor_Init_& init )
+{
+	/* Local Variables */
+	const XMC_GPIO_CONFIG_t trap_cfg =
+	{
+			XMC_GPIO_MODE_INPUT_PULL_UP,
+			XMC_GPIO_OUTPUT_LEVEL_HIGH,
+			XMC_GPIO_OUTPUT_STRENGTH_STRONG_SOFT_EDGE
+	};
+	unsigned long clock_l = 0;
+	unsigned long period_l = 0;
+	unsigned long dead_time_l = 0;
+	unsigned char phase = 0;
+	unsigned char pin = 0;
+
+	switch( init )
+	{
+		case ePWM_Motor_Init_::PWM_MOTOR_INIT_OPEN:
+		{
+			if( 0U == init_state )
+			{
+				clock_l = XMC_SCU_CLOCK_GetCcuClockFrequency();
+
+				/* Timer counts period ticks up and the same down */
+				period_l = ( (clock_l >> (unsigned long) PWM_MOTOR_PRESCALER) / PWM_MOTOR_FREQUENCY ) >> 1U;
+				DRIVER_ASSERT( ((2U > period_l) || (0xFFFFUL < period_l)), ePWM_Motor_Status_::PWM_MOTOR_STATUS_FAILED );
+
+				/* Dead time counter runs on fCCU8 */
+				dead_time_l = ( (clock_l / 1000UL) * PWM_MOTOR_DEAD_TIME_NS ) / 1000000UL;
+				DRIVER_ASSERT( ((0U == dead_time_l) || (PWM_MOTOR_DEAD_TIME_MAX < dead_time_l)),
+								ePWM_Motor_Status_::PWM_MOTOR_STATUS_FAILED );
+
+				period = period_l;
+				dead_time = static_cast<unsigned char>( dead_time_l );
+
+				/* Enable module and prescaler, does not disturb slice 0 */
+				XMC_CCU8_Init( PWM_MOTOR_MODULE, XMC_CCU8_SLICE_MCMS_ACTION_TRANSFER_PR_CR );
+				XMC_GPIO_Init( PWM_MOTOR_TRAP_PORT, PWM_MOTOR_TRAP_PIN, &trap_cfg );
+
+				for( phase = 0; phase < PWM_MOTOR_PHASES; ++phase )
+				{
+					slice_init( phase );
+				}
+
+				/* Load period and 0 % compare before start */
+				XMC_CCU8_EnableShadowTransfer( PWM_MOTOR_MODULE, PWM_MOTOR_TRANSFER_ALL );
+
+				/* Period hook on phase U only, all phases share period boundary */
+				XMC_CCU8_SLICE_SetInterruptNode( PWM_MOTOR_SLICE_U, XMC_CCU8_SLICE_IRQ_ID_PERIOD_MATCH,
+												XMC_CCU8_SLICE_SR_ID_0 );
+				XMC_CCU8_SLICE_SetInterruptNode( PWM_MOTOR_SLICE_U, XMC_CCU8_SLICE_IRQ_ID_EVENT2,
+												XMC_CCU8_SLICE_SR_ID_1 );
+				XMC_CCU8_SLICE_ClearEvent( PWM_MOTOR_SLICE_U, XMC_CCU8_SLICE_IRQ_ID_PERIOD_MATCH );
+				XMC_CCU8_SLICE_ClearEvent( PWM_MOTOR_SLICE_U, XMC_CCU8_SLICE_IRQ_ID_EVENT2 );
+				XMC_CCU8_SLICE_EnableEvent( PWM_MOTOR_SLICE_U, XMC_CCU8_SLICE_IRQ_ID_PERIOD_MATCH );
+				XMC_CCU8_SLICE_EnableEvent( PWM_MOTOR_SLICE_U, XMC_CCU8_SLICE_IRQ_ID_EVENT2 );
+
+				NVIC_ClearPendingIRQ( PWM_MOTOR_PERIOD_IRQ );
+				NVIC_SetPriority( PWM_MOTOR_PERIOD_IRQ, NVIC_EncodePriority(NVIC_GetPriorityGrouping(),
+									PWM_MOTOR_PERIOD_IRQ_PRIORITY, 0U)
+								);
+				NVIC_EnableIRQ( PWM_MOTOR_PERIOD_IRQ );
+
+				NVIC_ClearPendingIRQ( PWM_MOTOR_TRAP_IRQ );
+				NVIC_SetPriority( PWM_MOTOR_TRAP_IRQ, NVIC_EncodePriority(NVIC_GetPriorityGrouping(),
+									PWM_MOTOR_TRAP_IRQ_PRIORITY, 0U)
+								);
+				NVIC_EnableIRQ( PWM_MOTOR_TRAP_IRQ );
+
+				XMC_CCU8_EnableMultipleClocks( PWM_MOTOR_MODULE, static_cast<unsigned char>( PWM_MOTOR_CLOCK_ALL ) );
+
+				/* Outputs are at passive level now, hand pins over */
+				for( pin = 0; pin < (2U * PWM_MOTOR_PHASES); ++pin )
+				{
+					XMC_GPIO_Init( g_pwm_motor_pins[pin].p_port, g_pwm_motor_pins[pin].pin,
+									&g_pwm_motor_pins[pin].config );
+				}
+
+				XMC_SCU_SetCcuTriggerHigh( PWM_MOTOR_START_TRIGGER );
+				XMC_SCU_SetCcuTriggerLow( PWM_MOTOR_START_TRIGGER );
+
+				init_state = 1U;
+			}
+			else{	/* Not required */	}
+		}
+		break;
+
+		default:
+		case ePWM_Motor_Init_::PWM_MOTOR_INIT_CLOSE:
+		{
+			NVIC_DisableIRQ( PWM_MOTOR_PERIOD_IRQ );
+			NVIC_DisableIRQ( PWM_MOTOR_TRAP_IRQ );
+
+			for( phase = 0; phase < PWM_MOTOR_PHASES; ++phase )
+			{
+				/* Outputs fall back to passive level */
+				XMC_CCU8_SLICE_StopClearTimer( sg_pwm_motor_slices[phase] );
+				XMC_CCU8_DisableClock( PWM_MOTOR_MODULE, sg_pwm_motor_slice_numbers[phase] );
+			}
+
+			init_state = 0U;
+		}
+		break;
+	}
+
+	return ePWM_Motor_Status_::PWM_MOTOR_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	set_duties
+ *
+ * @brief		Update duty cycles of all three phases
+ *
+ * \par<b>Description:</b><br>
+ * 				Center aligned compare value covers high side pulse around
+ * 				period match, dead time is cut from it by hardware
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+ePWM_Motor_Status_ PWM_Motor__::set_duties( const unsigned short * const p_duty )
+{
+	/* Check input arguments */
+	DRIVER_ASSERT( (nullptr == p_duty), ePWM_Motor_Status_::PWM_MOTOR_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (0U == init_state), ePWM_Motor_Status_::PWM_MOTOR_STATUS_FAILED );
+
+	PWM_MOTOR_SET_COMPARE( PWM_MOTOR_SLICE_U, PWM_MOTOR_CHANNEL_U, to_compare( p_duty[0] ) );
+	PWM_MOTOR_SET_COMPARE( PWM_MOTOR_SLICE_V, PWM_MOTOR_CHANNEL_V, to_compare( p_duty[1] ) );
+	PWM_MOTOR_SET_COMPARE( PWM_MOTOR_SLICE_W, PWM_MOTOR_CHANNEL_W, to_compare( p_duty[2] ) );
+
+	XMC_CCU8_EnableShadowTransfer( PWM_MOTOR_MODULE, PWM_MOTOR_TRANSFER_ALL );
+
+	return ePWM_Motor_Status_::PWM_MOTOR_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	trap_clear
+ *
+ * @brief		Leave trap state
+ *
+ * \par<b>Description:</b><br>
+ * 				Software exit mode keeps trap state until trap flag is
+ * 				cleared with input inactive
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+ePWM_Motor_Status_ PWM_Motor__::trap_clear( void )
+{
+	/* Local Variables */
+	unsigned char phase = 0;
+
+	DRIVER_ASSERT( (0U == init_state), ePWM_Motor_Status_::PWM_MOTOR_STATUS_FAILED );
+
+	/* Input low is trap */
+	DRIVER_ASSERT( (0U == XMC_GPIO_GetInput( PWM_MOTOR_TRAP_PORT, PWM_MOTOR_TRAP_PIN )),
+					ePWM_Motor_Status_::PWM_MOTOR_STATUS_BUSY );
+
+	for( phase = 0; phase < PWM_MOTOR_PHASES; ++phase )
+	{
+		XMC_CCU8_SLICE_ClearEvent( sg_pwm_motor_slices[phase], XMC_CCU8_SLICE_IRQ_ID_TRAP );
+	}
+
+	return ePWM_Motor_Status_::PWM_MOTOR_STATUS_SUCCESS;
+}
+
+
+/******* Private Member function for PWM_Motor__ class *******/
+
+/**
+ * @function	slice_init
+ *
+ * @brief		Configure slice of a phase
+ *
+ * \par<b>Description:</b><br>
+ * 				OUTy0 is ST and OUTy1 inverted ST of compare channel 1,
+ * 				OUTy2 and OUTy3 the same of channel 2. Outputs of channel
+ * 				of phase get dead time on rising edge and passive LOW, so
+ * 				trap switches off high and low side
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void PWM_Motor__::slice_init( const unsigned char phase )
+{
+	/* Local Variables */
+	XMC_CCU8_SLICE_COMPARE_CONFIG_t slice_cfg = {};
+	XMC_CCU8_SLICE_DEAD_TIME_CONFIG_t dead_time_cfg = {};
+	XMC_CCU8_SLICE_EVENT_CONFIG_t event_cfg = {};
+	XMC_CCU8_SLICE_t * const p_slice = sg_pwm_motor_slices[phase];
+	unsigned long outputs = 0;
+
+	slice_cfg.timer_mode = (unsigned long) XMC_CCU8_SLICE_TIMER_COUNT_MODE_CA;
+	slice_cfg.monoshot = (unsigned long) XMC_CCU8_SLICE_TIMER_REPEAT_MODE_REPEAT;
+	slice_cfg.prescaler_initval = (unsigned long) PWM_MOTOR_PRESCALER;
+	slice_cfg.passive_level_out0 = (unsigned long) XMC_CCU8_SLICE_OUTPUT_PASSIVE_LEVEL_LOW;
+	slice_cfg.passive_level_out1 = (unsigned long) XMC_CCU8_SLICE_OUTPUT_PASSIVE_LEVEL_LOW;
+	slice_cfg.passive_level_out2 = (unsigned long) XMC_CCU8_SLICE_OUTPUT_PASSIVE_LEVEL_LOW;
+	slice_cfg.passive_level_out3 = (unsigned long) XMC_CCU8_SLICE_OUTPUT_PASSIVE_LEVEL_LOW;
+	slice_cfg.invert_out1 = 1U;
+	slice_cfg.invert_out3 = 1U;
+	XMC_CCU8_SLICE_CompareInit( p_slice, &slice_cfg );
+
+	XMC_CCU8_SLICE_SetTimerPeriodMatch( p_slice, static_cast<unsigned short>( period - 1U ) );
+
+	dead_time_cfg.div = (unsigned long) XMC_CCU8_SLICE_DTC_DIV_1;
+	if( 1U == sg_pwm_motor_channels[phase] )
+	{
+		XMC_CCU8_SLICE_SetTimerCompareMatchChannel1( p_slice, static_cast<unsigned short>( period ) );
+
+		dead_time_cfg.enable_dead_time_channel1 = 1U;
+		dead_time_cfg.channel1_st_path = 1U;
+		dead_time_cfg.channel1_inv_st_path = 1U;
+		dead_time_cfg.channel1_st_rising_edge_counter = dead_time;
+		dead_time_cfg.channel1_st_falling_edge_counter = dead_time;
+		outputs = ( (unsigned long) XMC_CCU8_SLICE_OUTPUT_0 | (unsigned long) XMC_CCU8_SLICE_OUTPUT_1 );
+	}
+	else
+	{
+		XMC_CCU8_SLICE_SetTimerCompareMatchChannel2( p_slice, static_cast<unsigned short>( period ) );
+
+		dead_time_cfg.enable_dead_time_channel2 = 1U;
+		dead_time_cfg.channel2_st_path = 1U;
+		dead_time_cfg.channel2_inv_st_path = 1U;
+		dead_time_cfg.channel2_st_rising_edge_counter = dead_time;
+		dead_time_cfg.channel2_st_falling_edge_counter = dead_time;
+		outputs = ( (unsigned long) XMC_CCU8_SLICE_OUTPUT_2 | (unsigned long) XMC_CCU8_SLICE_OUTPUT_3 );
+	}
+	XMC_CCU8_SLICE_DeadTimeInit( p_slice, &dead_time_cfg );
+
+	/* Start by SCU global start */
+	event_cfg.mapped_input = PWM_MOTOR_START_INPUT;
+	event_cfg.edge = XMC_CCU8_SLICE_EVENT_EDGE_SENSITIVITY_RISING_EDGE;
+	event_cfg.level = XMC_CCU8_SLICE_EVENT_LEVEL_SENSITIVITY_ACTIVE_HIGH;
+	event_cfg.duration = XMC_CCU8_SLICE_EVENT_FILTER_DISABLED;
+	XMC_CCU8_SLICE_ConfigureEvent( p_slice, XMC_CCU8_SLICE_EVENT_0, &event_cfg );
+	XMC_CCU8_SLICE_StartConfig( p_slice, XMC_CCU8_SLICE_EVENT_0, XMC_CCU8_SLICE_START_MODE_TIMER_START_CLEAR );
+
+	/* Trap on low level, falling edge raises event 2 interrupt */
+	event_cfg.mapped_input = PWM_MOTOR_TRAP_INPUT;
+	event_cfg.edge = XMC_CCU8_SLICE_EVENT_EDGE_SENSITIVITY_FALLING_EDGE;
+	event_cfg.level = XMC_CCU8_SLICE_EVENT_LEVEL_SENSITIVITY_ACTIVE_LOW;
+	event_cfg.duration = PWM_MOTOR_TRAP_FILTER;
+	XMC_CCU8_SLICE_ConfigureEvent( p_slice, XMC_CCU8_SLICE_EVENT_2, &event_cfg );
+	XMC_CCU8_SLICE_TrapConfig( p_slice, XMC_CCU8_SLICE_TRAP_EXIT_MODE_SW, true );
+	XMC_CCU8_SLICE_EnableTrap( p_slice, outputs );
+}
+
+
+/******* ISR entries for PWM_Motor__ class *******/
+
+/**
+ * @function	isr_period
+ *
+ * @brief		Period match of phase U
+ *
+ * \par<b>Description:</b><br>
+ * 				Flag is cleared before callback, so a callback that
+ * 				overruns the period is entered again at once
+ *
+ * <i>Imp Note:</i>
+ * 				Placed in RAM with handler
+ *
+ */
+void PWM_Motor__::isr_period( void )
+{
+	XMC_CCU8_SLICE_ClearEvent( PWM_MOTOR_SLICE_U, XMC_CCU8_SLICE_IRQ_ID_PERIOD_MATCH );
+
+#if( 1 == PWM_MOTOR_CALLBACK_HANDLER_USED )
+	pwm_motor_callback_handler( ePWM_Motor_Event_::PWM_MOTOR_EVENT_PERIOD );
+#endif
+}
+
+
+/**
+ * @function	isr_trap
+ *
+ * @brief		Trap input asserted
+ *
+ * \par<b>Description:</b><br>
+ * 				Outputs are passive already, trap flag stays set until
+ * 				trap_clear()
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void PWM_Motor__::isr_trap( void )
+{
+	XMC_CCU8_SLICE_ClearEvent( PWM_MOTOR_SLICE_U, XMC_CCU8_SLICE_IRQ_ID_EVENT2 );
+
+#if( 1 == PWM_MOTOR_CALLBACK_HANDLER_USED )
+	pwm_motor_callback_handler( ePWM_Motor_Event_::PWM_MOTOR_EVENT_TRAP );
+#endif
+}
+
+#endif	/* PWM_MOTOR_USED */
+
+/********************************** End of File *******************************/
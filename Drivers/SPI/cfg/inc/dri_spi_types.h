@@ -0,0 +1,266 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		SPI data types Header
+* Filename:		dri_spi_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_spi_types.h
+ *  @brief:	This file contains data types definitions for SPI master channel
+ */
+#ifndef DRI_SPI_TYPES_H_
+#define DRI_SPI_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_spi.h>
+#include <xmc_scu.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/dri_spi_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+#include <dri_dma_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* No chip select held */
+#define SPI_NO_DEVICE			0xFFU
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of SPI
+ * */
+enum class eSPI_Status_/*	:	unsigned char	*/
+{
+	SPI_STATUS_SUCCESS = 0,
+	SPI_STATUS_FAILED,
+	SPI_STATUS_BUSY,
+	SPI_STATUS_INVALID_ARGUMENT,
+	SPI_STATUS_QUEUE_FULL
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eSPI_Init_/*	:	unsigned char	*/
+{
+	SPI_INIT_CLOSE = 0,
+	SPI_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for clock polarity and phase, CPOL is bit 1 and CPHA is bit 0
+ * */
+enum class eSPI_Mode_	:	unsigned char
+{
+	SPI_MODE_0 = 0,		/**< Idle low, sample on rising edge */
+	SPI_MODE_1,			/**< Idle low, sample on falling edge */
+	SPI_MODE_2,			/**< Idle high, sample on falling edge */
+	SPI_MODE_3			/**< Idle high, sample on rising edge */
+};
+
+/*
+ * @brief	Enum for transaction state
+ * */
+enum class eSPI_Transfer_	:	unsigned char
+{
+	SPI_TRANSFER_IDLE = 0,		/**< Never submitted */
+	SPI_TRANSFER_QUEUED,		/**< Waiting in channel queue */
+	SPI_TRANSFER_ACTIVE,		/**< On the bus */
+	SPI_TRANSFER_DONE,			/**< Completed */
+	SPI_TRANSFER_ABORTED,		/**< Removed by abort */
+	SPI_TRANSFER_ERROR			/**< DMA bus error */
+};
+
+/*
+ * @brief	Enum for transfer engine selected at init
+ * */
+enum class eSPI_Engine_	:	unsigned char
+{
+	SPI_ENGINE_NONE = 0,
+	SPI_ENGINE_DMA,
+	SPI_ENGINE_FIFO
+};
+
+/*
+ * @brief	Enum for SPI Channel Information
+ * */
+enum class eSPI_Channel_	:	unsigned char
+{
+	SPI_CHANNEL_0 = 0,
+	SPI_CHANNEL_1,
+	SPI_CHANNEL_2,
+	SPI_CHANNEL_3,
+	SPI_CHANNEL_4,
+	SPI_CHANNEL_5
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for SPI instance
+ *
+ *****************************************************************************/
+
+struct tStSPI_Transaction_;
+
+/*
+ * @brief	typedef for transaction callback, called in interrupt context
+ * */
+typedef void (*spi_callback_pointer) ( struct tStSPI_Transaction_& transaction );
+
+/*
+ * @brief	Structure for one queued transfer
+ *
+ * <i>Imp Note:</i>
+ * 			Transaction is not copied, it has to stay valid until its state
+ * 			leaves SPI_TRANSFER_QUEUED and SPI_TRANSFER_ACTIVE
+ */
+typedef struct tStSPI_Transaction_
+{
+	const unsigned char * p_tx = nullptr;		/**< Data to send, nullptr - dummy bytes */
+	unsigned char * p_rx = nullptr;				/**< Received data, nullptr - discarded */
+	unsigned short length = 0U;					/**< Bytes in both directions */
+	unsigned char device = 0U;					/**< Chip select, index in device table */
+	unsigned char keep_cs = 0U;					/**< 1 - leave chip select active after transfer */
+	unsigned long baudrate = 1000000U;			/**< Shift clock of this transfer */
+	eSPI_Mode_ mode = eSPI_Mode_::SPI_MODE_0;	/**< Clock polarity and phase of this transfer */
+	spi_callback_pointer fp_callback = nullptr;	/**< Completion notification */
+	void * p_arg = nullptr;						/**< User context for callback */
+	volatile eSPI_Transfer_ state = eSPI_Transfer_::SPI_TRANSFER_IDLE;
+} tStSPI_Transaction;
+
+/*
+ * @brief	Structure for chip select of a device
+ */
+typedef struct tStSPI_Device_
+{
+	XMC_GPIO_PORT_t * p_port;		/**< Port of chip select pin */
+	unsigned char pin;				/**< Chip select pin */
+	unsigned char active_high;		/**< 0 - select at low level */
+} tStSPI_Device;
+
+/*
+ * @brief	Structure for SPI control
+ */
+typedef struct tStSPI_Control_
+{
+	tStSPI_Transaction * p_active = nullptr;	/**< Transaction on the bus */
+	unsigned short tx_index = 0U;				/**< Bytes handed to USIC */
+	unsigned short rx_index = 0U;				/**< Bytes received */
+	unsigned long baudrate = 0U;				/**< Current shift clock */
+	eSPI_Mode_ mode = eSPI_Mode_::SPI_MODE_0;	/**< Current clock polarity and phase */
+	unsigned char cs_held = SPI_NO_DEVICE;		/**< Device left selected by keep_cs */
+	eSPI_Engine_ engine = eSPI_Engine_::SPI_ENGINE_NONE;	/**< Transfer engine */
+} tStSPI_Control;
+
+/*
+ * @brief Structure used for Channel Context
+ */
+typedef struct tStSPI_Context_
+{
+	/**< channel information for current context */
+	XMC_USIC_CH_t * p_channel;
+} tStSPI_Context;
+
+/*
+ * @brief Structure for SPI channel fifo configuration
+ */
+typedef struct tStSPI_FIFO_Configuration_
+{
+	/* fifo position in USIC buffer and size for tx and rx */
+	unsigned long tx_fifo_pointer = 0U;
+	XMC_USIC_CH_FIFO_SIZE_t tx_fifo_size = XMC_USIC_CH_FIFO_SIZE_16WORDS;
+	unsigned long rx_fifo_pointer = 16U;
+	XMC_USIC_CH_FIFO_SIZE_t rx_fifo_size = XMC_USIC_CH_FIFO_SIZE_16WORDS;
+} tStSPI_FIFO_Configuration;
+
+/*
+ * @brief Structure for SPI channel DMA configuration
+ */
+typedef struct tStSPI_DMA_Configuration_
+{
+	XMC_DMA_t * p_dma = nullptr;					/**< Module, nullptr - FIFO only */
+	unsigned char tx_channel = 0U;					/**< Channel writing TBUF */
+	unsigned char rx_channel = 1U;					/**< Channel reading RBUF */
+	unsigned char tx_request = 0U;					/**< Request of tx service request, see xmc_dma_map.h */
+	unsigned char rx_request = 0U;					/**< Request of rx service request, see xmc_dma_map.h */
+	XMC_DMA_CH_EVENT_HANDLER_t fp_handler = nullptr;	/**< Channel event handler of object */
+} tStSPI_DMA_Configuration;
+
+/*
+ * @brief Structure for SPI channel configuration
+ */
+typedef struct tStSPI_Configuration_
+{
+	/**< channel configuration */
+	XMC_SPI_CH_CONFIG_t channel_cfg = { 1000000U, XMC_SPI_CH_BUS_MODE_MASTER,
+										XMC_SPI_CH_SLAVE_SEL_INV_TO_MSLS,
+										XMC_USIC_CH_PARITY_MODE_NONE };
+	/**< DX0 input source of MISO */
+	unsigned char input_source = 0U;
+	/** Channel FIFO configuration */
+	tStSPI_FIFO_Configuration fifo_cfg;
+	/** Channel DMA configuration */
+	tStSPI_DMA_Configuration dma_cfg;
+	/**< Chip select table of channel */
+	const tStSPI_Device * p_devices = nullptr;
+	unsigned char device_count = 0U;
+} tStSPI_Configuration;
+
+/*
+ * @brief Structure for SPI channel interrupt configuration
+ */
+typedef struct tStSPI_InterruptConfiguration_
+{
+	/**< Interrupt configuration for FIFO engine */
+	tStInterruptConfig fifo_irq;
+	/**< Service request of FIFO interrupt */
+	unsigned long fifo_sr;
+	/**< Service requests routed to DMA line router */
+	unsigned long dma_tx_sr;
+	unsigned long dma_rx_sr;
+} tStSPI_InterruptConfiguration;
+
+
+#endif /* DRI_SPI_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,110 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		SPI Configuration Header
+* Filename:		dri_spi_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_spi_conf.h
+ *  @brief:	This file contains static configurations for SPI master channel
+ *  		on USIC
+ */
+#ifndef DRI_SPI_CONF_H_
+#define DRI_SPI_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Transfers by GPDMA, 0 - FIFO interrupt only, 1 - DMA with FIFO fallback
+ * when DMA channels are not available */
+#define SPI_DMA_USED			1
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+#define SPI_MAX_CHANNELS		6
+
+/* Total SPI Channels used in system */
+#define SPI_CHANNELS_USED		1
+
+/* SPI Channels used in system, channel n is USIC(n / 2) CH(n % 2) */
+//#define SPI_CHANNEL_0_USED
+//#define SPI_CHANNEL_1_USED
+//#define SPI_CHANNEL_2_USED
+#define SPI_CHANNEL_3_USED
+//#define SPI_CHANNEL_4_USED
+//#define SPI_CHANNEL_5_USED
+
+/* Pending transactions per channel, power of 2 */
+#define SPI_QUEUE_SIZE			8
+
+/* Chip select devices per channel, devices are described in dri_spi_conf.cpp */
+#define SPI_MAX_DEVICES			4
+
+/* Bytes per FIFO refill, must not exceed receive FIFO size */
+#define SPI_FIFO_CHUNK			16U
+
+/* Bytes per DMA block, longer transactions are chained in DMA interrupt */
+#define SPI_DMA_MAX_BLOCK		4095U
+
+/* Byte shifted out for receive only transactions */
+#define SPI_DUMMY_BYTE			0xFFU
+
+
+/* Check channels availability */
+#if (SPI_CHANNELS_USED > SPI_MAX_CHANNELS)
+	#error	"Cannot instantiate more than available channels"
+#endif
+
+/* Check queue size */
+#if ( 0 != (SPI_QUEUE_SIZE & (SPI_QUEUE_SIZE - 1)) )
+	#error	"SPI queue size must be power of 2"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Defining functions for SPI FIFO ISR handlers and service requests,
+ * DMA requests use service requests 0 (transmit) and 1 (receive) */
+#ifdef SPI_CHANNEL_3_USED
+#define SPI_3_HANDLER			IRQ_Hdlr_94		/* USIC1 SR4 */
+#define SPI_3_SR				4
+#endif
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* DRI_SPI_CONF_H_ */
+
+/********************************** End of File ******************************/
@@ -0,0 +1,184 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		SPI Configuration Source
+* Filename:		dri_spi_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_spi_conf.cpp
+ *  @brief:	This source file contains configuration function definitions for
+ *  		SPI master on USIC channel
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_spi.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check SPI Usage in system */
+#if( SPI_CHANNELS_USED > 0 )
+
+/*
+ * @brief	Objects for SPI Class
+ */
+static SPI__ sg_spi_obj_ch3 (eSPI_Channel_::SPI_CHANNEL_3 );
+
+SPI__ * g_p_spi_obj[SPI_CHANNELS_USED] =
+{ &sg_spi_obj_ch3 };
+
+/*
+ * @brief	Chip selects of channel 3
+ */
+static const tStSPI_Device sg_spi_ch3_devices[] =
+{
+		{ XMC_GPIO_PORT0, 12U, 0U },	/**< Device 0, external ADC */
+		{ XMC_GPIO_PORT0, 8U, 0U }		/**< Device 1, serial flash */
+};
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#if( 1 == SPI_DMA_USED )
+/**
+ * @function	spi_3_dma_handler
+ *
+ * @brief		DMA channel events of SPI channel 3
+ *
+ * <i>Imp Note:</i>
+ * 				DMA handler has no context, one handler per object
+ */
+static void spi_3_dma_handler( XMC_DMA_CH_EVENT_t event )
+{
+	/* Call ISR entry function */
+	SPI__::dma_isr_entry( &sg_spi_obj_ch3, event );
+}
+#endif
+
+
+/**
+ * @function	initialize_spi_objects
+ *
+ * @brief		Initialize SPI Objects with specific properties
+ *
+ * <i>Imp Note:</i>
+ * 				Do not call this function more than once!
+ */
+void SPI__::initialize_spi_objects( void )
+{
+	/* Local Variables */
+	tStSPI_Configuration config;
+	tStSPI_InterruptConfiguration irq_config = {
+			.fifo_irq = { .irq_num = 94, .irq_priority = 56 },
+			.fifo_sr = 0,
+			.dma_tx_sr = 0,
+			.dma_rx_sr = 1
+	};
+
+	#ifdef SPI_CHANNEL_3_USED
+	/* MISO on P0.0 is DX0D */
+	config.input_source = 3U;
+	config.p_devices = sg_spi_ch3_devices;
+	config.device_count = sizeof(sg_spi_ch3_devices) / sizeof(sg_spi_ch3_devices[0]);
+
+	#if( 1 == SPI_DMA_USED )
+	/* USIC1 requests are served by GPDMA0 only, DLR line 5 is taken by ADC */
+	config.dma_cfg.p_dma = XMC_DMA0;
+	config.dma_cfg.tx_channel = 3U;
+	config.dma_cfg.rx_channel = 2U;
+	config.dma_cfg.tx_request = DMA0_PERIPHERAL_REQUEST_USIC1_SR0_1;
+	config.dma_cfg.rx_request = DMA0_PERIPHERAL_REQUEST_USIC1_SR1_2;
+	config.dma_cfg.fp_handler = spi_3_dma_handler;
+	#endif
+
+	irq_config.fifo_sr = SPI_3_SR;
+
+	/* Initialize SPI__ Object channel 3 parameters */
+	g_p_spi_obj[0]->set( irq_config, config );
+
+	__asm("NOP");
+	#endif	/* SPI_CHANNEL_3_USED */
+}
+
+
+/******* ISR Handlers for SPI__ channels *******/
+
+extern "C"
+{
+
+#ifdef SPI_3_HANDLER
+/**
+ * @function	SPI_3_HANDLER
+ *
+ * @brief		SPI3 FIFO handler
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void SPI_3_HANDLER( void )
+{
+	/* Call ISR entry function */
+	SPI__::isr_entry( &sg_spi_obj_ch3 );
+}
+#endif	/* SPI_3_HANDLER */
+
+
+}	/* extern "C"{ */
+
+
+/**
+ * @function		initialize_spi_objects_c
+ *
+ * @brief			SPI objects initialization function
+ *
+ * <i>Imp Note:</i> To be called before main entry
+ *
+ */
+extern "C" void initialize_spi_objects_c( void )
+		{
+			SPI__::initialize_spi_objects();
+		}
+
+#endif	/* SPI_CHANNELS_USED */
+
+
+/*********************************** End of File ******************************/
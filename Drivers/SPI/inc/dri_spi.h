@@ -0,0 +1,267 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		SPI API Header
+* Filename:		dri_spi.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_spi.h
+ *  @brief:	This file contains API function declarations for SPI master
+ *  		channel with queued DMA transfers
+ */
+#ifndef DRI_SPI_H_
+#define DRI_SPI_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_spi_types.h>
+#include <dri_dma.h>
+#include <dri_ring.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for SPI master Instance
+ *
+ ******************************************************************************/
+
+/* Check SPI Usage in system */
+#if( SPI_CHANNELS_USED > 0 )
+
+class SPI__
+{
+/* public members */
+public:
+	/** Constructors and Destructors */
+	SPI__() = delete;
+
+	explicit SPI__( const eSPI_Channel_& channel_l ) : channel(channel_l)
+	{
+		/* Assign context */
+		context.p_channel = ( eSPI_Channel_::SPI_CHANNEL_0 == this->channel ) ? XMC_USIC0_CH0 :
+							( eSPI_Channel_::SPI_CHANNEL_1 == this->channel ) ? XMC_USIC0_CH1 :
+							( eSPI_Channel_::SPI_CHANNEL_2 == this->channel ) ? XMC_USIC1_CH0 :
+							( eSPI_Channel_::SPI_CHANNEL_3 == this->channel ) ? XMC_USIC1_CH1 :
+							( eSPI_Channel_::SPI_CHANNEL_4 == this->channel ) ? XMC_USIC2_CH0 :
+							XMC_USIC2_CH1;
+	}
+
+	/* Destructor for class, not required but still present */
+	~SPI__()
+	{
+		/* Close SPI channel */
+		init( eSPI_Init_::SPI_INIT_CLOSE );
+	}
+
+	/******* API Member functions *******/
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for SPI channel
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eSPI_Init_	-	SPI_INIT_OPEN
+	 * 											SPI_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eSPI_Status_
+	 *          	SPI_STATUS_SUCCESS:		Operation successful.<BR>
+	 *          	SPI_STATUS_FAILED:		Operation failed.<BR>
+	 *          	SPI_STATUS_BUSY:		Channel could not be stopped.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function will initialize SPI channel as master.
+	 * 				DMA channels are claimed if configured, channel falls back
+	 * 				to FIFO interrupt engine if they are owned by other drivers
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Chip selects are driven by software, pins have to be
+	 * 				configured as GPIO outputs in pin table
+	 *
+	 */
+	eSPI_Status_ init( const eSPI_Init_& init = eSPI_Init_::SPI_INIT_OPEN );
+
+	/**
+	 * @function	submit
+	 *
+	 * @brief		Queue a transaction
+	 *
+	 * @param[in]	transaction	-	transfer description, kept by reference
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eSPI_Status_
+	 *          	SPI_STATUS_SUCCESS:				Transaction queued or started.<BR>
+	 *          	SPI_STATUS_FAILED:				Channel not initialized.<BR>
+	 *          	SPI_STATUS_BUSY:				Transaction already pending.<BR>
+	 *          	SPI_STATUS_INVALID_ARGUMENT:	Wrong length, device or clock.<BR>
+	 *          	SPI_STATUS_QUEUE_FULL:			No free queue entry.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Transactions run in submission order, each one with its own
+	 * 				shift clock, mode and chip select. Completion is reported by
+	 * 				state of transaction and optional callback
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Can be called from thread context and from callbacks
+	 *
+	 */
+	eSPI_Status_ submit( tStSPI_Transaction& transaction );
+
+	/**
+	 * @function	abort
+	 *
+	 * @brief		Abort active and queued transactions
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eSPI_Status_
+	 *          	SPI_STATUS_SUCCESS:	Operation successful.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Transactions are marked SPI_TRANSFER_ABORTED without
+	 * 				callback and all chip selects are released
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	eSPI_Status_ abort( void );
+
+	/******* Setters and Getters *******/
+	/**
+	 * @function	set
+	 *
+	 * @brief		setter function for SPI__ class
+	 *
+	 * @param[in]	irq_config_l	-	interrupt configurations for SPI object
+	 * @param[in]	channel_cfg_l	-	SPI channel configurations
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function will set the configuration parameters
+	 * 				for SPI__ class object
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	void set( const tStSPI_InterruptConfiguration& irq_config_l,
+				const tStSPI_Configuration& channel_cfg_l )
+	{
+		/* Set parameters */
+		irq_config = irq_config_l;
+		config = channel_cfg_l;
+	}
+
+	/* Transfer engine chosen by init */
+	eSPI_Engine_ get_engine( void ) const { return control.engine; }
+	/* Transaction on the bus or waiting */
+	bool is_busy( void ) const { return ( (nullptr != control.p_active) || (queue.get_count() > 0U) ); }
+
+	/* ISR entry function for FIFO engine */
+	static void isr_entry( SPI__* p_object )
+	{
+		p_object->fifo_isr_entry();
+	}
+
+	#if( 1 == SPI_DMA_USED )
+	/* ISR entry function for DMA engine */
+	static void dma_isr_entry( SPI__* p_object, const XMC_DMA_CH_EVENT_t event )
+	{
+		p_object->dma_event( event );
+	}
+	#endif
+
+	/* Object initializer for SPI class */
+	static void initialize_spi_objects( void );
+
+/* private members */
+private:
+	/** Data Members **/
+	eSPI_Channel_ channel;
+	tStSPI_Configuration config;
+	tStSPI_Context context;
+	tStSPI_InterruptConfiguration irq_config;
+	tStSPI_Control control;
+	Ring__<tStSPI_Transaction *, SPI_QUEUE_SIZE> queue;
+
+	/* Fixed source and sink of one direction transfers */
+	static const unsigned char dummy_tx;
+	static unsigned char dummy_rx;
+
+	/******* Private Member Functions *******/
+	void start_next( void );
+	void apply_settings( const tStSPI_Transaction& transaction );
+	void select( const unsigned char device, const bool active ) const;
+	void finish( const eSPI_Transfer_ state );
+
+	/* FIFO engine */
+	void fifo_open( void );
+	void fifo_chunk( void );
+	void fifo_isr_entry( void );
+
+	/* DMA engine */
+	#if( 1 == SPI_DMA_USED )
+	bool dma_open( void );
+	void dma_close( void );
+	void dma_chunk( void );
+	void dma_event( const XMC_DMA_CH_EVENT_t event );
+	#endif
+
+/* protected members, if any */
+protected:
+
+};
+
+#endif	/* SPI_CHANNELS_USED */
+
+
+#endif /* DRI_SPI_H_ */
+
+/********************************** End of File *******************************/
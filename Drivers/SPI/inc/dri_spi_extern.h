@@ -0,0 +1,70 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		SPI Extern Header
+* Filename:		dri_spi_extern.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_spi_extern.h
+ *  @brief:	This file contains extern variable for SPI and SPI API header
+ */
+#ifndef DRI_SPI_EXTERN_H_
+#define DRI_SPI_EXTERN_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_spi.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+#if( SPI_CHANNELS_USED > 0 )
+
+/*
+ * @brief	Objects for SPI Class
+ */
+extern SPI__ * g_p_spi_obj[SPI_CHANNELS_USED];
+
+#endif
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+
+#endif /* DRI_SPI_EXTERN_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,828 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		SPI API Source
+* Filename:		dri_spi.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	dri_spi.cpp
+ *  @brief:	This source file contains API function definitions for
+ *  		SPI master channel with queued DMA transfers.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_spi.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* DLR line of DMA request */
+#define SPI_DMA_LINE( request )		( (request) & 0x0FU )
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check SPI Usage in system */
+#if( SPI_CHANNELS_USED > 0 )
+
+/* Declare static data member
+ *
+ * Note: Tell linker to take variable from this source file
+ * */
+const unsigned char SPI__::dummy_tx = SPI_DUMMY_BYTE;
+unsigned char SPI__::dummy_rx = 0U;
+
+/* Shift clock passive level and delay for eSPI_Mode_ */
+static constexpr XMC_SPI_CH_BRG_SHIFT_CLOCK_PASSIVE_LEVEL_t sg_spi_clock_mode[4] =
+{
+	XMC_SPI_CH_BRG_SHIFT_CLOCK_PASSIVE_LEVEL_0_DELAY_ENABLED,
+	XMC_SPI_CH_BRG_SHIFT_CLOCK_PASSIVE_LEVEL_0_DELAY_DISABLED,
+	XMC_SPI_CH_BRG_SHIFT_CLOCK_PASSIVE_LEVEL_1_DELAY_ENABLED,
+	XMC_SPI_CH_BRG_SHIFT_CLOCK_PASSIVE_LEVEL_1_DELAY_DISABLED
+};
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/******* Public Member function for SPI__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for SPI channel
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eSPI_Status_ SPI__::init( const eSPI_Init_& init )
+{
+	/* Local Variables */
+	eSPI_Status_ ret_status = eSPI_Status_::SPI_STATUS_FAILED;
+	unsigned char device = 0U;
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open SPI Channel */
+		case eSPI_Init_::SPI_INIT_OPEN:
+			/* Check for initialization */
+			if( eSPI_Engine_::SPI_ENGINE_NONE != control.engine ){ break; }
+			else{	/* Not required */	}
+
+			/* Initialize channel as master, 8 bit words, MSB first,
+			 * endless frame as chip selects are driven by software */
+			XMC_SPI_CH_Init( context.p_channel, &(config.channel_cfg) );
+			XMC_SPI_CH_SetBitOrderMsbFirst( context.p_channel );
+			XMC_SPI_CH_SetWordLength( context.p_channel, 8U );
+			XMC_SPI_CH_SetFrameLength( context.p_channel, 64U );
+			XMC_SPI_CH_SetInputSource( context.p_channel, XMC_SPI_CH_INPUT_DIN0,
+										config.input_source );
+			XMC_SPI_CH_ConfigureShiftClockOutput( context.p_channel,
+										sg_spi_clock_mode[static_cast<unsigned char>(eSPI_Mode_::SPI_MODE_0)],
+										XMC_SPI_CH_BRG_SHIFT_CLOCK_OUTPUT_SCLK );
+			control.baudrate = config.channel_cfg.baudrate;
+			control.mode = eSPI_Mode_::SPI_MODE_0;
+			control.cs_held = SPI_NO_DEVICE;
+
+			/* Release all chip selects */
+			for( device = 0U; device < config.device_count; ++device )
+			{
+				select( device, false );
+			}
+
+			/* Select transfer engine */
+			#if( 1 == SPI_DMA_USED )
+			if( true == dma_open() )
+			{
+				control.engine = eSPI_Engine_::SPI_ENGINE_DMA;
+			}
+			else
+			#endif
+			{
+				fifo_open();
+				control.engine = eSPI_Engine_::SPI_ENGINE_FIFO;
+			}
+
+			/* Start SPI channel */
+			XMC_SPI_CH_Start( context.p_channel );
+
+			/* Update return status */
+			ret_status = eSPI_Status_::SPI_STATUS_SUCCESS;
+			break;
+
+		/* Close SPI Channel */
+		case eSPI_Init_::SPI_INIT_CLOSE:
+			if( eSPI_Engine_::SPI_ENGINE_NONE == control.engine )
+			{
+				ret_status = eSPI_Status_::SPI_STATUS_SUCCESS;
+				break;
+			}
+			else{	/* Not required */	}
+
+			(void) abort();
+
+			if( XMC_SPI_CH_STATUS_BUSY == XMC_SPI_CH_Stop( context.p_channel ) )
+			{
+				/* Update return status */
+				ret_status = eSPI_Status_::SPI_STATUS_BUSY;
+				break;
+			}
+			else{	/* Not required */	}
+
+			NVIC_DisableIRQ( static_cast<IRQn_Type>(irq_config.fifo_irq.irq_num) );
+			#if( 1 == SPI_DMA_USED )
+			if( eSPI_Engine_::SPI_ENGINE_DMA == control.engine )
+			{
+				dma_close();
+			}
+			else{	/* Not required */	}
+			#endif
+
+			/* Reset control state */
+			control.engine = eSPI_Engine_::SPI_ENGINE_NONE;
+			/* Update return status */
+			ret_status = eSPI_Status_::SPI_STATUS_SUCCESS;
+			break;
+
+		/* Default parameters, invalid argument */
+		default:
+			/* Update return status */
+			ret_status = eSPI_Status_::SPI_STATUS_INVALID_ARGUMENT;
+			break;
+	}
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/**
+ * @function	submit
+ *
+ * @brief		Queue a transaction
+ *
+ * <i>Imp Note:</i>
+ * 				Queue push and start are done with interrupts masked, so
+ * 				completion interrupt and callbacks may submit as well
+ *
+ */
+eSPI_Status_ SPI__::submit( tStSPI_Transaction& transaction )
+{
+	/* Input argument validity */
+	DRIVER_ASSERT( eSPI_Engine_::SPI_ENGINE_NONE == control.engine,
+					eSPI_Status_::SPI_STATUS_FAILED );
+	DRIVER_ASSERT( 0U == transaction.length,
+					eSPI_Status_::SPI_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( config.device_count <= transaction.device,
+					eSPI_Status_::SPI_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( ( (0U == transaction.baudrate) ||
+					(transaction.baudrate > (XMC_SCU_CLOCK_GetPeripheralClockFrequency() >> 1U)) ),
+					eSPI_Status_::SPI_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( ( (eSPI_Transfer_::SPI_TRANSFER_QUEUED == transaction.state) ||
+					(eSPI_Transfer_::SPI_TRANSFER_ACTIVE == transaction.state) ),
+					eSPI_Status_::SPI_STATUS_BUSY );
+
+	/* Local Variables */
+	eSPI_Status_ ret_status = eSPI_Status_::SPI_STATUS_SUCCESS;
+	const unsigned long primask_l = __get_PRIMASK();
+
+	__disable_irq();
+
+	transaction.state = eSPI_Transfer_::SPI_TRANSFER_QUEUED;
+	if( false == queue.push( &transaction ) )
+	{
+		transaction.state = eSPI_Transfer_::SPI_TRANSFER_IDLE;
+		ret_status = eSPI_Status_::SPI_STATUS_QUEUE_FULL;
+	}
+	else
+	{
+		/* Bus idle, start right away */
+		start_next();
+	}
+
+	__set_PRIMASK( primask_l );
+
+	return ret_status;
+}
+
+
+/**
+ * @function	abort
+ *
+ * @brief		Abort active and queued transactions
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eSPI_Status_ SPI__::abort( void )
+{
+	/* Local Variables */
+	tStSPI_Transaction * p_transaction = nullptr;
+	const unsigned long primask_l = __get_PRIMASK();
+
+	__disable_irq();
+
+	/* Stop engine */
+	#if( 1 == SPI_DMA_USED )
+	if( eSPI_Engine_::SPI_ENGINE_DMA == control.engine )
+	{
+		XMC_DMA_CH_Disable( config.dma_cfg.p_dma, config.dma_cfg.tx_channel );
+		XMC_DMA_CH_Disable( config.dma_cfg.p_dma, config.dma_cfg.rx_channel );
+	}
+	else
+	#endif
+	{
+		XMC_USIC_CH_RXFIFO_DisableEvent( context.p_channel, (unsigned long)
+						((unsigned long) XMC_USIC_CH_RXFIFO_EVENT_CONF_STANDARD |
+						(unsigned long) XMC_USIC_CH_RXFIFO_EVENT_CONF_ALTERNATE)
+						);
+		XMC_USIC_CH_TXFIFO_Flush( context.p_channel );
+		XMC_USIC_CH_RXFIFO_Flush( context.p_channel );
+	}
+
+	if( nullptr != control.p_active )
+	{
+		control.p_active->state = eSPI_Transfer_::SPI_TRANSFER_ABORTED;
+		select( control.p_active->device, false );
+		control.p_active = nullptr;
+	}
+	else{	/* Not required */	}
+
+	if( SPI_NO_DEVICE != control.cs_held )
+	{
+		select( control.cs_held, false );
+		control.cs_held = SPI_NO_DEVICE;
+	}
+	else{	/* Not required */	}
+
+	while( true == queue.pop( p_transaction ) )
+	{
+		p_transaction->state = eSPI_Transfer_::SPI_TRANSFER_ABORTED;
+	}
+
+	__set_PRIMASK( primask_l );
+
+	return eSPI_Status_::SPI_STATUS_SUCCESS;
+}
+
+
+/******* Private Member function for SPI__ class *******/
+
+/**
+ * @function	start_next
+ *
+ * @brief		Put next queued transaction on the bus
+ *
+ * \par<b>Description:</b><br>
+ * 				Does nothing while a transaction is active
+ *
+ * <i>Imp Note:</i>
+ * 				Called with interrupts masked or from engine interrupt
+ *
+ */
+void SPI__::start_next( void )
+{
+	/* Local Variables */
+	tStSPI_Transaction * p_transaction = nullptr;
+
+	if( (nullptr != control.p_active) || (false == queue.pop( p_transaction )) )
+	{
+		return;
+	}
+	else{	/* Not required */	}
+
+	control.p_active = p_transaction;
+	control.tx_index = 0U;
+	control.rx_index = 0U;
+	p_transaction->state = eSPI_Transfer_::SPI_TRANSFER_ACTIVE;
+
+	/* Device left selected by previous transfer */
+	if( (SPI_NO_DEVICE != control.cs_held) && (control.cs_held != p_transaction->device) )
+	{
+		select( control.cs_held, false );
+	}
+	else{	/* Not required */	}
+	control.cs_held = SPI_NO_DEVICE;
+
+	/* Clock has to be settled before device is selected */
+	apply_settings( *p_transaction );
+	select( p_transaction->device, true );
+
+	#if( 1 == SPI_DMA_USED )
+	if( eSPI_Engine_::SPI_ENGINE_DMA == control.engine )
+	{
+		dma_chunk();
+	}
+	else
+	#endif
+	{
+		XMC_USIC_CH_RXFIFO_EnableEvent( context.p_channel, (unsigned long)
+						((unsigned long) XMC_USIC_CH_RXFIFO_EVENT_CONF_STANDARD |
+						(unsigned long) XMC_USIC_CH_RXFIFO_EVENT_CONF_ALTERNATE)
+						);
+		fifo_chunk();
+	}
+}
+
+
+/**
+ * @function	apply_settings
+ *
+ * @brief		Switch shift clock and mode for a transaction
+ *
+ * @param[in]	transaction	-	transaction to be started
+ *
+ * <i>Imp Note:</i>
+ * 				Baud rate generator is only reprogrammed on change, bus is
+ * 				idle at this point
+ *
+ */
+void SPI__::apply_settings( const tStSPI_Transaction& transaction )
+{
+	if( transaction.baudrate != control.baudrate )
+	{
+		(void) XMC_SPI_CH_SetBaudrate( context.p_channel, transaction.baudrate );
+		control.baudrate = transaction.baudrate;
+	}
+	else{	/* Not required */	}
+
+	if( transaction.mode != control.mode )
+	{
+		XMC_SPI_CH_ConfigureShiftClockOutput( context.p_channel,
+								sg_spi_clock_mode[static_cast<unsigned char>(transaction.mode) & 0x3U],
+								XMC_SPI_CH_BRG_SHIFT_CLOCK_OUTPUT_SCLK );
+		control.mode = transaction.mode;
+	}
+	else{	/* Not required */	}
+}
+
+
+/**
+ * @function	select
+ *
+ * @brief		Drive chip select of a device
+ *
+ * @param[in]	device	-	index in device table
+ * 				active	-	true to select device
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void SPI__::select( const unsigned char device, const bool active ) const
+{
+	/* Local Variables */
+	const tStSPI_Device& device_l = config.p_devices[device];
+
+	if( active == (0U != device_l.active_high) )
+	{
+		XMC_GPIO_SetOutputHigh( device_l.p_port, device_l.pin );
+	}
+	else
+	{
+		XMC_GPIO_SetOutputLow( device_l.p_port, device_l.pin );
+	}
+}
+
+
+/**
+ * @function	finish
+ *
+ * @brief		Complete active transaction and start next one
+ *
+ * @param[in]	state	-	final state of transaction
+ *
+ * \par<b>Description:</b><br>
+ * 				Active pointer is cleared before callback, so callback can
+ * 				submit follow up transactions
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void SPI__::finish( const eSPI_Transfer_ state )
+{
+	/* Local Variables */
+	tStSPI_Transaction * const p_transaction = control.p_active;
+
+	if( nullptr == p_transaction ){ return; }
+	else{	/* Not required */	}
+
+	if( eSPI_Engine_::SPI_ENGINE_FIFO == control.engine )
+	{
+		XMC_USIC_CH_RXFIFO_DisableEvent( context.p_channel, (unsigned long)
+						((unsigned long) XMC_USIC_CH_RXFIFO_EVENT_CONF_STANDARD |
+						(unsigned long) XMC_USIC_CH_RXFIFO_EVENT_CONF_ALTERNATE)
+						);
+	}
+	else{	/* Not required */	}
+
+	/* Keep chip select only on success */
+	if( (0U != p_transaction->keep_cs) && (eSPI_Transfer_::SPI_TRANSFER_DONE == state) )
+	{
+		control.cs_held = p_transaction->device;
+	}
+	else
+	{
+		select( p_transaction->device, false );
+	}
+
+	control.p_active = nullptr;
+	p_transaction->state = state;
+
+	if( nullptr != p_transaction->fp_callback )
+	{
+		p_transaction->fp_callback( *p_transaction );
+	}
+	else{	/* Not required */	}
+
+	start_next();
+}
+
+
+/******* FIFO engine *******/
+
+/**
+ * @function	fifo_open
+ *
+ * @brief		Configure FIFOs and interrupt for FIFO engine
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void SPI__::fifo_open( void )
+{
+	XMC_USIC_CH_TXFIFO_Configure( context.p_channel, config.fifo_cfg.tx_fifo_pointer,
+									config.fifo_cfg.tx_fifo_size, 1U );
+	XMC_USIC_CH_RXFIFO_Configure( context.p_channel, config.fifo_cfg.rx_fifo_pointer,
+									config.fifo_cfg.rx_fifo_size, 0U );
+
+	/* Set service request for rx FIFO receive interrupt */
+	XMC_USIC_CH_RXFIFO_SetInterruptNodePointer( context.p_channel,
+					XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_STANDARD,
+					irq_config.fifo_sr
+					);
+	XMC_USIC_CH_RXFIFO_SetInterruptNodePointer( context.p_channel,
+					XMC_USIC_CH_RXFIFO_INTERRUPT_NODE_POINTER_ALTERNATE,
+					irq_config.fifo_sr
+					);
+
+	/* Set priority and enable NVIC node for receive interrupt */
+	NVIC_SetPriority( static_cast<IRQn_Type>(irq_config.fifo_irq.irq_num),
+						NVIC_EncodePriority(NVIC_GetPriorityGrouping(),
+						irq_config.fifo_irq.irq_priority,
+						0U)
+					);
+	NVIC_EnableIRQ( static_cast<IRQn_Type>(irq_config.fifo_irq.irq_num) );
+}
+
+
+/**
+ * @function	fifo_chunk
+ *
+ * @brief		Load next chunk of active transaction into transmit FIFO
+ *
+ * \par<b>Description:</b><br>
+ * 				Chunk never exceeds receive FIFO, receive trigger limit is
+ * 				set so that one interrupt drains whole chunk
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void SPI__::fifo_chunk( void )
+{
+	/* Local Variables */
+	const tStSPI_Transaction& transaction = *(control.p_active);
+	unsigned short count = transaction.length - control.tx_index;
+
+	count = ( count > SPI_FIFO_CHUNK ) ? static_cast<unsigned short>(SPI_FIFO_CHUNK) : count;
+
+	/* Limit first, chunk may complete while loading */
+	XMC_USIC_CH_RXFIFO_SetSizeTriggerLimit( context.p_channel,
+											config.fifo_cfg.rx_fifo_size,
+											(count - 1U)
+											);
+
+	while( count > 0U )
+	{
+		XMC_USIC_CH_TXFIFO_PutData( context.p_channel,
+				( nullptr != transaction.p_tx ) ? transaction.p_tx[control.tx_index] : dummy_tx );
+		++(control.tx_index);
+		--count;
+	}
+}
+
+
+/**
+ * @function	fifo_isr_entry
+ *
+ * @brief		Receive FIFO handler of FIFO engine
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void SPI__::fifo_isr_entry( void )
+{
+	/* Local Variables */
+	tStSPI_Transaction * const p_transaction = control.p_active;
+	unsigned char data_l = 0U;
+
+	if( nullptr == p_transaction ){ return; }
+	else{	/* Not required */	}
+
+	while( (0 == XMC_USIC_CH_RXFIFO_IsEmpty( context.p_channel )) &&
+			(control.rx_index < control.tx_index) )
+	{
+		data_l = static_cast<unsigned char>( XMC_USIC_CH_RXFIFO_GetData( context.p_channel ) );
+		if( nullptr != p_transaction->p_rx )
+		{
+			p_transaction->p_rx[control.rx_index] = data_l;
+		}
+		else{	/* Not required */	}
+		++(control.rx_index);
+	}
+
+	if( control.rx_index >= p_transaction->length )
+	{
+		finish( eSPI_Transfer_::SPI_TRANSFER_DONE );
+	}
+	else if( control.rx_index == control.tx_index )
+	{
+		fifo_chunk();
+	}
+	else{	/* Chunk not complete yet */	}
+}
+
+
+/******* DMA engine *******/
+
+#if( 1 == SPI_DMA_USED )
+/**
+ * @function	dma_open
+ *
+ * @brief		Claim and configure transmit and receive DMA channels
+ *
+ * @return		true if both channels are owned by this object
+ *
+ * \par<b>Description:</b><br>
+ * 				Transmit buffer event requests next byte for TBUF, receive
+ * 				events request RBUF read. FIFOs stay disabled
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+bool SPI__::dma_open( void )
+{
+	/* Local Variables */
+	XMC_DMA_CH_CONFIG_t tx_cfg = {};
+	XMC_DMA_CH_CONFIG_t rx_cfg = {};
+	const tStSPI_DMA_Configuration& dma_l = config.dma_cfg;
+
+	if( nullptr == dma_l.p_dma ){ return false; }
+	else{	/* Not required */	}
+
+	/* Memory to TBUF, byte wise */
+	tx_cfg.enable_interrupt = 1U;
+	tx_cfg.dst_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_8;
+	tx_cfg.src_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_8;
+	tx_cfg.dst_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+	tx_cfg.src_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+	tx_cfg.dst_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+	tx_cfg.src_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+	tx_cfg.transfer_flow = (unsigned long) XMC_DMA_CH_TRANSFER_FLOW_M2P_DMA;
+	tx_cfg.dst_addr = (unsigned long) &(context.p_channel->TBUF[0]);
+	tx_cfg.block_size = 1U;
+	tx_cfg.transfer_type = XMC_DMA_CH_TRANSFER_TYPE_SINGLE_BLOCK;
+	tx_cfg.priority = XMC_DMA_CH_PRIORITY_6;
+	tx_cfg.src_handshaking = XMC_DMA_CH_SRC_HANDSHAKING_SOFTWARE;
+	tx_cfg.dst_handshaking = XMC_DMA_CH_DST_HANDSHAKING_HARDWARE;
+	tx_cfg.dst_peripheral_request = dma_l.tx_request;
+
+	/* RBUF to memory, higher priority so that RBUF never overruns */
+	rx_cfg.enable_interrupt = 1U;
+	rx_cfg.dst_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_8;
+	rx_cfg.src_transfer_width = (unsigned long) XMC_DMA_CH_TRANSFER_WIDTH_8;
+	rx_cfg.dst_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT;
+	rx_cfg.src_address_count_mode = (unsigned long) XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE;
+	rx_cfg.dst_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+	rx_cfg.src_burst_length = (unsigned long) XMC_DMA_CH_BURST_LENGTH_1;
+	rx_cfg.transfer_flow = (unsigned long) XMC_DMA_CH_TRANSFER_FLOW_P2M_DMA;
+	rx_cfg.src_addr = (unsigned long) &(context.p_channel->RBUF);
+	rx_cfg.block_size = 1U;
+	rx_cfg.transfer_type = XMC_DMA_CH_TRANSFER_TYPE_SINGLE_BLOCK;
+	rx_cfg.priority = XMC_DMA_CH_PRIORITY_7;
+	rx_cfg.src_handshaking = XMC_DMA_CH_SRC_HANDSHAKING_HARDWARE;
+	rx_cfg.src_peripheral_request = dma_l.rx_request;
+	rx_cfg.dst_handshaking = XMC_DMA_CH_DST_HANDSHAKING_SOFTWARE;
+
+	if( eDMA_Status_::DMA_STATUS_SUCCESS != DMA__::channel_open( dma_l.p_dma, dma_l.tx_channel, tx_cfg,
+										(unsigned long) XMC_DMA_CH_EVENT_ERROR,
+										dma_l.fp_handler ) )
+	{
+		return false;
+	}
+	else{	/* Not required */	}
+
+	if( eDMA_Status_::DMA_STATUS_SUCCESS != DMA__::channel_open( dma_l.p_dma, dma_l.rx_channel, rx_cfg,
+										( (unsigned long) XMC_DMA_CH_EVENT_TRANSFER_COMPLETE |
+										  (unsigned long) XMC_DMA_CH_EVENT_ERROR ),
+										dma_l.fp_handler ) )
+	{
+		XMC_DMA_DisableRequestLine( dma_l.p_dma, SPI_DMA_LINE( dma_l.tx_request ) );
+		(void) DMA__::channel_close( dma_l.p_dma, dma_l.tx_channel );
+		return false;
+	}
+	else{	/* Not required */	}
+
+	/* Route USIC events to DMA service requests */
+	XMC_SPI_CH_SelectInterruptNodePointer( context.p_channel,
+						XMC_SPI_CH_INTERRUPT_NODE_POINTER_TRANSMIT_BUFFER,
+						irq_config.dma_tx_sr );
+	XMC_SPI_CH_SelectInterruptNodePointer( context.p_channel,
+						XMC_SPI_CH_INTERRUPT_NODE_POINTER_RECEIVE,
+						irq_config.dma_rx_sr );
+	XMC_SPI_CH_SelectInterruptNodePointer( context.p_channel,
+						XMC_SPI_CH_INTERRUPT_NODE_POINTER_ALTERNATE_RECEIVE,
+						irq_config.dma_rx_sr );
+	XMC_SPI_CH_EnableEvent( context.p_channel, (unsigned long)
+						((unsigned long) XMC_SPI_CH_EVENT_TRANSMIT_BUFFER |
+						(unsigned long) XMC_SPI_CH_EVENT_STANDARD_RECEIVE |
+						(unsigned long) XMC_SPI_CH_EVENT_ALTERNATIVE_RECEIVE)
+						);
+
+	return true;
+}
+
+
+/**
+ * @function	dma_close
+ *
+ * @brief		Release DMA channels
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void SPI__::dma_close( void )
+{
+	/* Local Variables */
+	const tStSPI_DMA_Configuration& dma_l = config.dma_cfg;
+
+	XMC_SPI_CH_DisableEvent( context.p_channel, (unsigned long)
+						((unsigned long) XMC_SPI_CH_EVENT_TRANSMIT_BUFFER |
+						(unsigned long) XMC_SPI_CH_EVENT_STANDARD_RECEIVE |
+						(unsigned long) XMC_SPI_CH_EVENT_ALTERNATIVE_RECEIVE)
+						);
+	XMC_DMA_DisableRequestLine( dma_l.p_dma, SPI_DMA_LINE( dma_l.tx_request ) );
+	XMC_DMA_DisableRequestLine( dma_l.p_dma, SPI_DMA_LINE( dma_l.rx_request ) );
+	(void) DMA__::channel_close( dma_l.p_dma, dma_l.tx_channel );
+	(void) DMA__::channel_close( dma_l.p_dma, dma_l.rx_channel );
+}
+
+
+/**
+ * @function	dma_chunk
+ *
+ * @brief		Arm both DMA channels for next block of active transaction
+ *
+ * \par<b>Description:</b><br>
+ * 				Receive channel is armed first. Transmit buffer event only
+ * 				fires on TBUF transfer, first request is triggered by software
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void SPI__::dma_chunk( void )
+{
+	/* Local Variables */
+	const tStSPI_Transaction& transaction = *(control.p_active);
+	const tStSPI_DMA_Configuration& dma_l = config.dma_cfg;
+	unsigned short count = transaction.length - control.rx_index;
+
+	count = ( count > SPI_DMA_MAX_BLOCK ) ? static_cast<unsigned short>(SPI_DMA_MAX_BLOCK) : count;
+	control.tx_index = control.rx_index + count;
+
+	/* Receive side */
+	if( nullptr != transaction.p_rx )
+	{
+		DMA__::set_address_mode( dma_l.p_dma, dma_l.rx_channel,
+								XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE,
+								XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT );
+		XMC_DMA_CH_SetDestinationAddress( dma_l.p_dma, dma_l.rx_channel,
+								(unsigned long) &(transaction.p_rx[control.rx_index]) );
+	}
+	else
+	{
+		DMA__::set_address_mode( dma_l.p_dma, dma_l.rx_channel,
+								XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE,
+								XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE );
+		XMC_DMA_CH_SetDestinationAddress( dma_l.p_dma, dma_l.rx_channel,
+								(unsigned long) &dummy_rx );
+	}
+	XMC_DMA_CH_SetBlockSize( dma_l.p_dma, dma_l.rx_channel, count );
+	XMC_DMA_CH_Enable( dma_l.p_dma, dma_l.rx_channel );
+
+	/* Transmit side */
+	if( nullptr != transaction.p_tx )
+	{
+		DMA__::set_address_mode( dma_l.p_dma, dma_l.tx_channel,
+								XMC_DMA_CH_ADDRESS_COUNT_MODE_INCREMENT,
+								XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE );
+		XMC_DMA_CH_SetSourceAddress( dma_l.p_dma, dma_l.tx_channel,
+								(unsigned long) &(transaction.p_tx[control.rx_index]) );
+	}
+	else
+	{
+		DMA__::set_address_mode( dma_l.p_dma, dma_l.tx_channel,
+								XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE,
+								XMC_DMA_CH_ADDRESS_COUNT_MODE_NO_CHANGE );
+		XMC_DMA_CH_SetSourceAddress( dma_l.p_dma, dma_l.tx_channel,
+								(unsigned long) &dummy_tx );
+	}
+	XMC_DMA_CH_SetBlockSize( dma_l.p_dma, dma_l.tx_channel, count );
+
+	/* Drop transmit buffer request left from end of previous block */
+	XMC_DMA_ClearRequestLine( dma_l.p_dma, SPI_DMA_LINE( dma_l.tx_request ) );
+	XMC_DMA_CH_Enable( dma_l.p_dma, dma_l.tx_channel );
+	XMC_SPI_CH_TriggerServiceRequest( context.p_channel, irq_config.dma_tx_sr );
+}
+
+
+/**
+ * @function	dma_event
+ *
+ * @brief		DMA channel event of this object
+ *
+ * @param[in]	event	-	channel event from DMA module interrupt
+ *
+ * \par<b>Description:</b><br>
+ * 				Only receive channel reports completion, all bytes have
+ * 				been clocked in at that point
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void SPI__::dma_event( const XMC_DMA_CH_EVENT_t event )
+{
+	if( nullptr == control.p_active ){ return; }
+	else{	/* Not required */	}
+
+	if( XMC_DMA_CH_EVENT_TRANSFER_COMPLETE == event )
+	{
+		control.rx_index = control.tx_index;
+
+		if( control.rx_index < control.p_active->length )
+		{
+			dma_chunk();
+		}
+		else
+		{
+			finish( eSPI_Transfer_::SPI_TRANSFER_DONE );
+		}
+	}
+	else
+	{
+		XMC_DMA_CH_Disable( config.dma_cfg.p_dma, config.dma_cfg.tx_channel );
+		XMC_DMA_CH_Disable( config.dma_cfg.p_dma, config.dma_cfg.rx_channel );
+		finish( eSPI_Transfer_::SPI_TRANSFER_ERROR );
+	}
+}
+#endif	/* SPI_DMA_USED */
+
+
+#endif	/* SPI_CHANNELS_USED */
+
+/********************************** End of File *******************************/
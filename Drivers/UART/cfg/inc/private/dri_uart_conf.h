@@ -46,7 +46,7 @@
  */
 
 /* Total UART Channels used in system */
-#define UART_CHANNELS_USED		3
+#define UART_CHANNELS_USED		2
 
 /* UART Channels used in system */
 #define UART_CHANNEL_0_USED
@@ -58,7 +58,8 @@
 #define UART_CHANNEL_2_USED
 //#define UART_CHANNEL_2_ERROR_USED
 
-#define UART_CHANNEL_3_USED
+/* USIC1 CH1 pins are taken by SPI channel 3 */
+//#define UART_CHANNEL_3_USED
 //#define UART_CHANNEL_3_ERROR_USED
 
 
@@ -108,8 +109,8 @@
 #endif
 
 #ifdef UART_CHANNEL_2_USED
-#define UART_2_TX_HANDLER  	IRQ_Hdlr_91
-#define UART_2_TX_SR		1
+#define UART_2_TX_HANDLER  	IRQ_Hdlr_93
+#define UART_2_TX_SR		3
 #endif
 
 #ifdef UART_CHANNEL_3_USED
@@ -132,7 +133,7 @@
 #endif
 
 #ifdef UART_CHANNEL_2_USED
-#define UART_2_RX_HANDLER  	IRQ_Hdlr_90
+#define UART_2_RX_HANDLER  	IRQ_Hdlr_92
 #endif
 
 #ifdef UART_CHANNEL_3_USED
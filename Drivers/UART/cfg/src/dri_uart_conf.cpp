@@ -64,10 +64,11 @@ static UART__ sg_uart_obj_ch0 (eUART_Channel_::UART_CHANNEL_0 );
 /* Not using because of pins unavailability, if need to use then add configurations */
 //static UART__ sg_uart_obj_ch1 (eUART_Channel_::UART_CHANNEL_1 );
 static UART__ sg_uart_obj_ch2 (eUART_Channel_::UART_CHANNEL_2 );
-static UART__ sg_uart_obj_ch3 (eUART_Channel_::UART_CHANNEL_3 );
+/* Not using because pins are taken by SPI channel 3 */
+//static UART__ sg_uart_obj_ch3 (eUART_Channel_::UART_CHANNEL_3 );
 
 UART__ * g_p_uart_obj[UART_CHANNELS_USED] =
-{ &sg_uart_obj_ch0, &sg_uart_obj_ch2, &sg_uart_obj_ch3 };
+{ &sg_uart_obj_ch0, &sg_uart_obj_ch2 };
 
 
 
@@ -142,9 +143,10 @@ void UART__::initialize_uart_objects( void )
 	#endif	/* UART_CHANNEL_1_USED */
 
 	#ifdef UART_CHANNEL_2_USED
-	/* Initialize UART__ Object channel 2 parameters */
-	irq_config.tx_irq.irq_num = 91;
-	irq_config.rx_irq.irq_num = 90;
+	/* Initialize UART__ Object channel 2 parameters, service requests
+	 * 0 and 1 of USIC1 are DMA requests of SPI channel 3 */
+	irq_config.tx_irq.irq_num = 93;
+	irq_config.rx_irq.irq_num = 92;
 	irq_config.tx_irq.irq_priority = 62;
 	irq_config.rx_irq.irq_priority = 61;
 	irq_config.tx_sr = UART_2_TX_SR;
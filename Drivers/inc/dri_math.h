@@ -0,0 +1,107 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Compile time math Header
+* Filename:		dri_math.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_math.h
+ *  @brief:	This file contains constexpr math helpers used to build
+ *  		lookup tables at compile time
+ */
+#ifndef DRI_MATH_H_
+#define DRI_MATH_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for compile time math helpers
+ *
+ * 			All members are constexpr, so tables built with them are
+ * 			placed in flash and no math library is linked.
+ *
+ ******************************************************************************/
+class Math__
+{
+/* public members */
+public:
+	/* Constructors */
+	Math__() = delete;
+	Math__( Math__& ) = delete;
+
+	/**
+	 * @function	sine_quadrant
+	 *
+	 * @brief		sin(x * pi / 2) on first quadrant
+	 *
+	 * @param[in]	x	-	fraction of quadrant, 0.0 to 1.0
+	 *
+	 * @return  	sine value, 0.0 to 1.0
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Taylor series, exact to double for the quadrant
+	 *
+	 */
+	static constexpr double sine_quadrant( const double x )
+	{
+		const double angle = 1.57079632679489661923 * x;
+		double term = angle;
+		double sum = angle;
+
+		for( unsigned long n = 1U; n < 12U; ++n )
+		{
+			term = -term * angle * angle / ( (2.0 * n) * ((2.0 * n) + 1.0) );
+			sum = sum + term;
+		}
+
+		return sum;
+	}
+};
+
+
+#endif /* DRI_MATH_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,215 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Ring buffer Header
+* Filename:		dri_ring.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	dri_ring.h
+ *  @brief:	This file contains lock-free single producer/single consumer
+ *  		ring buffer used by drivers to pass records out of ISRs
+ */
+#ifndef DRI_RING_H_
+#define DRI_RING_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for lock-free ring buffer
+ *
+ * 			One context (ISR) pushes and one context (thread/main loop) pops.
+ * 			Indices run freely and are masked on access, so full and empty
+ * 			states are distinguished without a spare slot.
+ *
+ ******************************************************************************/
+template <typename T, unsigned long SIZE>
+class Ring__
+{
+	static_assert( (SIZE >= 2U) && (0U == (SIZE & (SIZE - 1U))),
+					"Ring size must be power of 2" );
+
+/* public members */
+public:
+	/** Constructors */
+	Ring__() : head(0U), tail(0U), dropped(0U) {}
+	Ring__( Ring__& ) = delete;
+
+	/**
+	 * @function	push
+	 *
+	 * @brief		Put one element into ring, producer side only
+	 *
+	 * @param[in]	item	-	element to be copied into ring
+	 *
+	 * @return  	true if stored, false if ring is full
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Dropped elements are counted and can be read by get_dropped()
+	 *
+	 */
+	bool push( const T& item )
+	{
+		unsigned long head_l = head;
+
+		if( SIZE == (head_l - tail) )
+		{
+			++dropped;
+			return false;
+		}
+
+		buffer[head_l & (SIZE - 1U)] = item;
+		/* Element must be visible before index is published */
+		__DMB();
+		head = head_l + 1U;
+
+		return true;
+	}
+
+	/**
+	 * @function	claim
+	 *
+	 * @brief		Get free slot to fill in place, producer side only
+	 *
+	 * @return  	pointer to slot or nullptr if ring is full
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Slot is handed to consumer by commit()
+	 *
+	 */
+	T * claim( void )
+	{
+		unsigned long head_l = head;
+
+		if( SIZE == (head_l - tail) )
+		{
+			++dropped;
+			return nullptr;
+		}
+
+		return &buffer[head_l & (SIZE - 1U)];
+	}
+
+	/* Publish slot returned by claim() */
+	void commit( void )
+	{
+		__DMB();
+		head = head + 1U;
+	}
+
+	/**
+	 * @function	pop
+	 *
+	 * @brief		Get one element out of ring, consumer side only
+	 *
+	 * @param[out]	item	-	element copied out of ring
+	 *
+	 * @return  	true if element available, false if ring is empty
+	 *
+	 */
+	bool pop( T& item )
+	{
+		unsigned long tail_l = tail;
+
+		if( head == tail_l )
+		{
+			return false;
+		}
+
+		item = buffer[tail_l & (SIZE - 1U)];
+		/* Slot must be read before it is returned to producer */
+		__DMB();
+		tail = tail_l + 1U;
+
+		return true;
+	}
+
+	/**
+	 * @function	peek
+	 *
+	 * @brief		Get oldest element in place, consumer side only
+	 *
+	 * @return  	pointer to element or nullptr if ring is empty
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Element stays owned by consumer until release()
+	 *
+	 */
+	const T * peek( void ) const
+	{
+		unsigned long tail_l = tail;
+
+		return ( head == tail_l ) ? nullptr : &buffer[tail_l & (SIZE - 1U)];
+	}
+
+	/* Release element returned by peek() */
+	void release( void )
+	{
+		__DMB();
+		tail = tail + 1U;
+	}
+
+	/* Discard all elements, consumer side only */
+	void flush( void ) { tail = head; }
+
+	/******* Setters and Getters *******/
+	unsigned long get_count( void ) const { return (head - tail); }
+	unsigned long get_dropped( void ) const { return dropped; }
+	static constexpr unsigned long get_size( void ) { return SIZE; }
+
+/* private members */
+private:
+	/** Data Members **/
+	T buffer[SIZE];
+	volatile unsigned long head;		/**< Written by producer only */
+	volatile unsigned long tail;		/**< Written by consumer only */
+	volatile unsigned long dropped;		/**< Elements lost on full ring */
+};
+
+
+#endif /* DRI_RING_H_ */
+
+/********************************** End of File *******************************/
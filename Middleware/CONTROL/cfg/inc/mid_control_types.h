@@ -0,0 +1,144 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Control Loop data types Header
+* Filename:		mid_control_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_control_types.h
+ *  @brief:	This file contains data types definitions for timer driven
+ *  		control loops
+ */
+#ifndef MID_CONTROL_TYPES_H_
+#define MID_CONTROL_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_ccu4.h>
+#include <xmc_scu.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/mid_control_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of control loops
+ * */
+enum class eControl_Status_/*	:	unsigned char	*/
+{
+	CONTROL_STATUS_SUCCESS = 0,
+	CONTROL_STATUS_FAILED,
+	CONTROL_STATUS_BUSY,
+	CONTROL_STATUS_INVALID_ARGUMENT
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eControl_Init_/*	:	unsigned char	*/
+{
+	CONTROL_INIT_CLOSE = 0,
+	CONTROL_INIT_OPEN
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for control loops
+ *
+ *****************************************************************************/
+
+/* Loop body, called once per period in timer interrupt */
+typedef void (*control_loop_pointer) ( void * p_context );
+
+/*
+ * @brief	Structure for loop registration
+ */
+typedef struct tStControl_Loop_
+{
+	control_loop_pointer fp_loop = nullptr;	/**< Loop body, place in RAM by __RAM_FUNC */
+	void * p_context = nullptr;				/**< Passed to loop body */
+	unsigned long rate = 0U;				/**< Loop rate in Hz */
+	unsigned char priority = 0U;			/**< Interrupt priority, faster loops preempt */
+} tStControl_Loop;
+
+/*
+ * @brief	Structure for statistics of a loop, times in slice ticks
+ *
+ * 			Latency is timer count at ISR entry, i.e. time since period
+ * 			match. Its spread max - min is jitter of loop start.
+ */
+typedef struct tStControl_Stats_
+{
+	unsigned long runs = 0U;				/**< Loop body calls */
+	unsigned long overruns = 0U;			/**< Body still running at next period */
+	unsigned short period = 0U;				/**< Loop period */
+	unsigned short latency_min = 0xFFFFU;	/**< Shortest entry latency */
+	unsigned short latency_max = 0U;		/**< Longest entry latency */
+	unsigned short exec_last = 0U;			/**< Last body execution time */
+	unsigned short exec_max = 0U;			/**< Longest body execution time */
+} tStControl_Stats;
+
+/*
+ * @brief	Structure for fixed point PID controller
+ *
+ * 			out = (kp * e + sum(ki * e) + kd * (e - e_prev)) >> 16, clamped
+ * 			to limits. Integral stops while output is clamped in direction
+ * 			of error and is kept inside limits (anti-windup).
+ */
+typedef struct tStControl_Pid_
+{
+	long kp = 0;							/**< Proportional gain, Q16.16 */
+	long ki = 0;							/**< Integral gain per run, Q16.16 */
+	long kd = 0;							/**< Derivative gain per run, Q16.16 */
+	long out_min = -32768;					/**< Lower output limit */
+	long out_max = 32767;					/**< Upper output limit */
+	long long integral = 0;					/**< Integral term, Q16.16 */
+	long error = 0;							/**< Error of previous run */
+} tStControl_Pid;
+
+
+#endif /* MID_CONTROL_TYPES_H_ */
+
+/********************************** End of File *******************************/
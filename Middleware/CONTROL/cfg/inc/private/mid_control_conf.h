@@ -0,0 +1,110 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Control Loop Configuration Header
+* Filename:		mid_control_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_control_conf.h
+ *  @brief:	This file contains static configurations for timer driven
+ *  		control loops
+ */
+#ifndef MID_CONTROL_CONF_H_
+#define MID_CONTROL_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Control loops used in system, 0 - not used */
+#define CONTROL_USED				1
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Loop n runs in period match interrupt of slice n of this module */
+#define CONTROL_MODULE				CCU41
+#define CONTROL_MAX_LOOPS			4U
+#define CONTROL_SLICE_0				CCU41_CC40
+#define CONTROL_SLICE_1				CCU41_CC41
+#define CONTROL_SLICE_2				CCU41_CC42
+#define CONTROL_SLICE_3				CCU41_CC43
+
+/* Loops used in system, loop n is served by its own handler */
+#define CONTROL_LOOP_0_USED
+#define CONTROL_LOOP_1_USED
+
+/* Slice clock fCCU4 / 2^n, 16 bit period gives lowest rate of
+ * 120 MHz / 65536 = 1.8 kHz with prescaler 1 */
+#define CONTROL_PRESCALER			XMC_CCU4_SLICE_PRESCALER_1
+
+/* Shortest loop period in slice ticks, ISR entry, statistics and exit
+ * have to fit with margin for loop body */
+#define CONTROL_MIN_PERIOD			600U
+
+/* Service request n of module is interrupt CONTROL_IRQ_BASE + n */
+#define CONTROL_IRQ_BASE			CCU41_0_IRQn
+
+
+/* Check loops availability */
+#if ( 4U < CONTROL_MAX_LOOPS )
+	#error	"CCU4 module has 4 slices only"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Defining functions for control loop ISR handlers, must match module */
+#ifdef CONTROL_LOOP_0_USED
+#define CONTROL_LOOP_0_HANDLER		IRQ_Hdlr_48	/* CCU41 SR0 */
+#endif
+
+#ifdef CONTROL_LOOP_1_USED
+#define CONTROL_LOOP_1_HANDLER		IRQ_Hdlr_49	/* CCU41 SR1 */
+#endif
+
+#ifdef CONTROL_LOOP_2_USED
+#define CONTROL_LOOP_2_HANDLER		IRQ_Hdlr_50	/* CCU41 SR2 */
+#endif
+
+#ifdef CONTROL_LOOP_3_USED
+#define CONTROL_LOOP_3_HANDLER		IRQ_Hdlr_51	/* CCU41 SR3 */
+#endif
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* MID_CONTROL_CONF_H_ */
+
+/********************************** End of File ******************************/
@@ -0,0 +1,145 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Control Loop Configuration Source
+* Filename:		mid_control_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	mid_control_conf.cpp
+ *  @brief:	This source file contains ISR handlers for timer driven control
+ *  		loops
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_control.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Check control loops usage in system */
+#if( 1 == CONTROL_USED )
+
+/******* ISR Handlers for CONTROL__ loops *******/
+
+extern "C"
+{
+
+#ifdef CONTROL_LOOP_0_HANDLER
+/**
+ * @function	CONTROL_LOOP_0_HANDLER
+ *
+ * @brief		Control loop 0 handler
+ *
+ * <i>Imp Note:</i>
+ * 				Placed in RAM with loop path
+ *
+ */
+__RAM_FUNC void CONTROL_LOOP_0_HANDLER( void )
+{
+	/* Call ISR entry function */
+	CONTROL__::isr_entry( 0 );
+}
+#endif	/* CONTROL_LOOP_0_HANDLER */
+
+
+#ifdef CONTROL_LOOP_1_HANDLER
+/**
+ * @function	CONTROL_LOOP_1_HANDLER
+ *
+ * @brief		Control loop 1 handler
+ *
+ * <i>Imp Note:</i>
+ * 				Placed in RAM with loop path
+ *
+ */
+__RAM_FUNC void CONTROL_LOOP_1_HANDLER( void )
+{
+	/* Call ISR entry function */
+	CONTROL__::isr_entry( 1 );
+}
+#endif	/* CONTROL_LOOP_1_HANDLER */
+
+
+#ifdef CONTROL_LOOP_2_HANDLER
+/**
+ * @function	CONTROL_LOOP_2_HANDLER
+ *
+ * @brief		Control loop 2 handler
+ *
+ * <i>Imp Note:</i>
+ * 				Placed in RAM with loop path
+ *
+ */
+__RAM_FUNC void CONTROL_LOOP_2_HANDLER( void )
+{
+	/* Call ISR entry function */
+	CONTROL__::isr_entry( 2 );
+}
+#endif	/* CONTROL_LOOP_2_HANDLER */
+
+
+#ifdef CONTROL_LOOP_3_HANDLER
+/**
+ * @function	CONTROL_LOOP_3_HANDLER
+ *
+ * @brief		Control loop 3 handler
+ *
+ * <i>Imp Note:</i>
+ * 				Placed in RAM with loop path
+ *
+ */
+__RAM_FUNC void CONTROL_LOOP_3_HANDLER( void )
+{
+	/* Call ISR entry function */
+	CONTROL__::isr_entry( 3 );
+}
+#endif	/* CONTROL_LOOP_3_HANDLER */
+
+
+}	/* extern "C"{ */
+
+#endif	/* CONTROL_USED */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,238 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Control Loop API Header
+* Filename:		mid_control.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_control.h
+ *  @brief:	This file contains API function declarations for timer driven
+ *  		control loops
+ */
+#ifndef MID_CONTROL_H_
+#define MID_CONTROL_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_control_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for timer driven control loops
+ *
+ * 			Each loop owns one CCU4 slice, period match interrupt of the
+ * 			slice calls loop body. Interrupt path and PID step execute from
+ * 			RAM so that flash wait states do not add to loop time. Entry
+ * 			latency and execution time are taken from slice timer itself.
+ *
+ ******************************************************************************/
+
+/* Check control loops usage in system */
+#if( 1 == CONTROL_USED )
+
+class CONTROL__
+{
+/* public members */
+public:
+	/* Constructors */
+	CONTROL__() = delete;
+	CONTROL__( CONTROL__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for control loops
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eControl_Init_	-	CONTROL_INIT_OPEN
+	 * 											CONTROL_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eControl_Status_
+	 *          	CONTROL_STATUS_SUCCESS:		Operation successful.<BR>
+	 *          	CONTROL_STATUS_FAILED:		Operation failed.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Enables timer module, close stops all loops
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eControl_Status_ init( const eControl_Init_& init = eControl_Init_::CONTROL_INIT_OPEN );
+
+	/**
+	 * @function	loop_open
+	 *
+	 * @brief		Register and start a loop
+	 *
+	 * @param[in]	loop		-	loop number, slice of module
+	 * 				loop_cfg	-	body, context, rate and priority
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eControl_Status_
+	 *          	CONTROL_STATUS_SUCCESS:				Loop running.<BR>
+	 *          	CONTROL_STATUS_FAILED:				Not initialized.<BR>
+	 *          	CONTROL_STATUS_BUSY:				Loop already open.<BR>
+	 *          	CONTROL_STATUS_INVALID_ARGUMENT:	Rate out of timer range.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Period is rounded to whole slice ticks, see period in
+	 * 				statistics for exact rate
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Handler of loop has to be enabled in mid_control_conf.h
+	 *
+	 */
+	static eControl_Status_ loop_open( const unsigned char loop, const tStControl_Loop& loop_cfg );
+
+	/**
+	 * @function	loop_close
+	 *
+	 * @brief		Stop and release a loop
+	 *
+	 * @param[in]	loop	-	loop number
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eControl_Status_
+	 *          	CONTROL_STATUS_SUCCESS:				Loop stopped.<BR>
+	 *          	CONTROL_STATUS_INVALID_ARGUMENT:	Wrong loop.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eControl_Status_ loop_close( const unsigned char loop );
+
+	/**
+	 * @function	pid
+	 *
+	 * @brief		One step of fixed point PID controller
+	 *
+	 * @param[in]	pid		-	controller gains, limits and state
+	 * 				error	-	set point minus feedback
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	controller output within limits
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Constant execution time, no division
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from loop body
+	 *
+	 */
+	static __RAM_FUNC long pid( tStControl_Pid& pid, const long error );
+
+	/**
+	 * @function	pid_reset
+	 *
+	 * @brief		Clear integral and previous error of PID controller
+	 *
+	 * @param[in]	pid		-	controller
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static void pid_reset( tStControl_Pid& pid );
+
+	/**
+	 * @function	clear_stats
+	 *
+	 * @brief		Restart statistics of a loop
+	 *
+	 * @param[in]	loop	-	loop number
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static void clear_stats( const unsigned char loop );
+
+	/******* Setters and Getters *******/
+	static inline bool is_open( const unsigned char loop )
+	{
+		return ( (CONTROL_MAX_LOOPS > loop) && (nullptr != loops[loop].fp_loop) );
+	}
+	/* Statistics, copy is not atomic against running loop */
+	static const tStControl_Stats& get_stats( const unsigned char loop )
+	{
+		return stats[(CONTROL_MAX_LOOPS > loop) ? loop : 0U];
+	}
+
+	/* ISR entry function for CONTROL__ class */
+	static __RAM_FUNC void isr_entry( const unsigned char loop );
+
+/* private members */
+private:
+	/** Data Members **/
+	static tStControl_Loop loops[CONTROL_MAX_LOOPS];
+	static tStControl_Stats stats[CONTROL_MAX_LOOPS];
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static void slice_init( const unsigned char loop, const unsigned short period );
+};
+
+#endif	/* CONTROL_USED */
+
+
+#endif /* MID_CONTROL_H_ */
+
+/********************************** End of File *******************************/
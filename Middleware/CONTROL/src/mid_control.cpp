@@ -0,0 +1,395 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Control Loop API Source
+* Filename:		mid_control.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	mid_control.cpp
+ *  @brief:	This source file contains API function definitions for timer
+ *  		driven control loops.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_control.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check control loops usage in system */
+#if( 1 == CONTROL_USED )
+
+/* Slice of loop n */
+static XMC_CCU4_SLICE_t * const sg_control_slices[CONTROL_MAX_LOOPS] =
+{
+		CONTROL_SLICE_0,
+		CONTROL_SLICE_1,
+		CONTROL_SLICE_2,
+		CONTROL_SLICE_3
+};
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Declare static data member */
+tStControl_Loop CONTROL__::loops[CONTROL_MAX_LOOPS];
+tStControl_Stats CONTROL__::stats[CONTROL_MAX_LOOPS];
+unsigned char CONTROL__::init_state;
+
+
+/******* Public Member function for CONTROL__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for control loops
+ *
+ * \par<b>Description:</b><br>
+ * 				Module prescaler is started once, slices are set up by
+ * 				loop_open()
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eControl_Status_ CONTROL__::init( const eControl_Init_& init )
+{
+	/* Local Variables */
+	unsigned char loop = 0;
+
+	switch( init )
+	{
+		case eControl_Init_::CONTROL_INIT_OPEN:
+		{
+			if( 0U == init_state )
+			{
+				/* Enable module and prescaler, does not disturb other slices */
+				XMC_CCU4_Init( CONTROL_MODULE, XMC_CCU4_SLICE_MCMS_ACTION_TRANSFER_PR_CR );
+				init_state = 1U;
+			}
+			else{	/* Not required */	}
+		}
+		break;
+
+		default:
+		case eControl_Init_::CONTROL_INIT_CLOSE:
+		{
+			for( loop = 0; loop < CONTROL_MAX_LOOPS; ++loop )
+			{
+				(void) loop_close( loop );
+			}
+
+			init_state = 0U;
+		}
+		break;
+	}
+
+	return eControl_Status_::CONTROL_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	loop_open
+ *
+ * @brief		Register and start a loop
+ *
+ * \par<b>Description:</b><br>
+ * 				Period in slice ticks is fCCU4 / 2^prescaler / rate
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eControl_Status_ CONTROL__::loop_open( const unsigned char loop, const tStControl_Loop& loop_cfg )
+{
+	/* Local Variables */
+	unsigned long period_l = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((CONTROL_MAX_LOOPS <= loop) || (nullptr == loop_cfg.fp_loop) || (0U == loop_cfg.rate)),
+					eControl_Status_::CONTROL_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( (0U == init_state), eControl_Status_::CONTROL_STATUS_FAILED );
+	DRIVER_ASSERT( (nullptr != loops[loop].fp_loop), eControl_Status_::CONTROL_STATUS_BUSY );
+
+	period_l = ( XMC_SCU_CLOCK_GetCcuClockFrequency() >> (unsigned long) CONTROL_PRESCALER ) / loop_cfg.rate;
+	DRIVER_ASSERT( ((CONTROL_MIN_PERIOD > period_l) || (0x10000UL < period_l)),
+					eControl_Status_::CONTROL_STATUS_INVALID_ARGUMENT );
+
+	loops[loop] = loop_cfg;
+	stats[loop] = tStControl_Stats();
+	stats[loop].period = static_cast<unsigned short>( period_l - 1U );
+
+	slice_init( loop, static_cast<unsigned short>( period_l - 1U ) );
+
+	return eControl_Status_::CONTROL_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	loop_close
+ *
+ * @brief		Stop and release a loop
+ *
+ * \par<b>Description:</b><br>
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eControl_Status_ CONTROL__::loop_close( const unsigned char loop )
+{
+	/* Local Variables */
+	const IRQn_Type irq_l = static_cast<IRQn_Type>( CONTROL_IRQ_BASE + loop );
+
+	/* Check input arguments */
+	DRIVER_ASSERT( (CONTROL_MAX_LOOPS <= loop), eControl_Status_::CONTROL_STATUS_INVALID_ARGUMENT );
+
+	if( nullptr != loops[loop].fp_loop )
+	{
+		NVIC_DisableIRQ( irq_l );
+		XMC_CCU4_SLICE_StopClearTimer( sg_control_slices[loop] );
+		XMC_CCU4_SLICE_DisableEvent( sg_control_slices[loop], XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH );
+		XMC_CCU4_DisableClock( CONTROL_MODULE, loop );
+		NVIC_ClearPendingIRQ( irq_l );
+		loops[loop].fp_loop = nullptr;
+	}
+	else{	/* Not required */	}
+
+	return eControl_Status_::CONTROL_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	pid
+ *
+ * @brief		One step of fixed point PID controller
+ *
+ * \par<b>Description:</b><br>
+ * 				Terms are summed in 64 bit. When output clamps, integral
+ * 				update is dropped if error pushes further into the limit
+ * 				(conditional integration).
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+__RAM_FUNC long CONTROL__::pid( tStControl_Pid& pid, const long error )
+{
+	/* Local Variables */
+	const long long min_l = (long long) pid.out_min * 65536LL;
+	const long long max_l = (long long) pid.out_max * 65536LL;
+	long long integral_l = pid.integral + ( (long long) pid.ki * error );
+	long long sum_l = 0;
+
+	/* Integral alone never exceeds limits */
+	integral_l = ( integral_l > max_l ) ? max_l : ( (integral_l < min_l) ? min_l : integral_l );
+
+	sum_l = ( (long long) pid.kp * error ) + integral_l +
+			( (long long) pid.kd * ((long long) error - pid.error) );
+
+	if( sum_l > max_l )
+	{
+		sum_l = max_l;
+		integral_l = ( error > 0 ) ? pid.integral : integral_l;
+	}
+	else if( sum_l < min_l )
+	{
+		sum_l = min_l;
+		integral_l = ( error < 0 ) ? pid.integral : integral_l;
+	}
+	else{	/* Not required */	}
+
+	pid.integral = integral_l;
+	pid.error = error;
+
+	return static_cast<long>( sum_l >> 16 );
+}
+
+
+/**
+ * @function	pid_reset
+ *
+ * @brief		Clear integral and previous error of PID controller
+ *
+ * \par<b>Description:</b><br>
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void CONTROL__::pid_reset( tStControl_Pid& pid )
+{
+	pid.integral = 0;
+	pid.error = 0;
+}
+
+
+/**
+ * @function	clear_stats
+ *
+ * @brief		Restart statistics of a loop
+ *
+ * \par<b>Description:</b><br>
+ * 				Period is kept
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void CONTROL__::clear_stats( const unsigned char loop )
+{
+	/* Local Variables */
+	unsigned long primask_l = 0;
+	unsigned short period_l = 0;
+
+	if( CONTROL_MAX_LOOPS > loop )
+	{
+		primask_l = __get_PRIMASK();
+		__disable_irq();
+
+		period_l = stats[loop].period;
+		stats[loop] = tStControl_Stats();
+		stats[loop].period = period_l;
+
+		__set_PRIMASK( primask_l );
+	}
+	else{	/* Not required */	}
+}
+
+
+/******* Private Member function for CONTROL__ class *******/
+
+/**
+ * @function	slice_init
+ *
+ * @brief		Configure and start slice of a loop
+ *
+ * \par<b>Description:</b><br>
+ * 				Edge aligned up counter, period match of slice n raises
+ * 				service request n
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void CONTROL__::slice_init( const unsigned char loop, const unsigned short period )
+{
+	/* Local Variables */
+	XMC_CCU4_SLICE_COMPARE_CONFIG_t slice_cfg = {};
+	XMC_CCU4_SLICE_t * const p_slice = sg_control_slices[loop];
+	const IRQn_Type irq_l = static_cast<IRQn_Type>( CONTROL_IRQ_BASE + loop );
+
+	slice_cfg.timer_mode = (unsigned long) XMC_CCU4_SLICE_TIMER_COUNT_MODE_EA;
+	slice_cfg.monoshot = (unsigned long) XMC_CCU4_SLICE_TIMER_REPEAT_MODE_REPEAT;
+	slice_cfg.prescaler_initval = (unsigned long) CONTROL_PRESCALER;
+	XMC_CCU4_SLICE_CompareInit( p_slice, &slice_cfg );
+
+	XMC_CCU4_SLICE_SetTimerPeriodMatch( p_slice, period );
+	XMC_CCU4_EnableShadowTransfer( CONTROL_MODULE,
+			( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_SLICE_0 << (4U * loop) ) |
+			( (unsigned long) XMC_CCU4_SHADOW_TRANSFER_PRESCALER_SLICE_0 << (4U * loop) ) );
+
+	XMC_CCU4_SLICE_SetInterruptNode( p_slice, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH,
+									static_cast<XMC_CCU4_SLICE_SR_ID_t>( loop ) );
+	XMC_CCU4_SLICE_ClearEvent( p_slice, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH );
+	XMC_CCU4_SLICE_EnableEvent( p_slice, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH );
+
+	NVIC_ClearPendingIRQ( irq_l );
+	NVIC_SetPriority( irq_l, NVIC_EncodePriority(NVIC_GetPriorityGrouping(),
+						loops[loop].priority, 0U)
+					);
+	NVIC_EnableIRQ( irq_l );
+
+	XMC_CCU4_EnableClock( CONTROL_MODULE, loop );
+	XMC_CCU4_SLICE_StartTimer( p_slice );
+}
+
+
+/******* ISR entries for CONTROL__ class *******/
+
+/**
+ * @function	isr_entry
+ *
+ * @brief		Handler function for loop period match
+ *
+ * @param[in]	loop	-	loop number
+ *
+ * \par<b>Description:</b><br>
+ * 				Timer restarted from zero at period match, so count at entry
+ * 				is latency and count after body is latency plus execution.
+ * 				Period match flag set again after body means next period
+ * 				started before body ended.
+ *
+ * <i>Imp Note:</i>
+ * 				Execution time of an overrun is reported as full period
+ *
+ */
+__RAM_FUNC void CONTROL__::isr_entry( const unsigned char loop )
+{
+	/* Local Variables */
+	XMC_CCU4_SLICE_t * const p_slice = sg_control_slices[loop];
+	const unsigned short start_l = XMC_CCU4_SLICE_GetTimerValue( p_slice );
+	tStControl_Stats& stats_l = stats[loop];
+	unsigned short exec_l = 0;
+
+	XMC_CCU4_SLICE_ClearEvent( p_slice, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH );
+
+	loops[loop].fp_loop( loops[loop].p_context );
+
+	if( true == XMC_CCU4_SLICE_GetEvent( p_slice, XMC_CCU4_SLICE_IRQ_ID_PERIOD_MATCH ) )
+	{
+		exec_l = stats_l.period;
+		++stats_l.overruns;
+	}
+	else
+	{
+		exec_l = static_cast<unsigned short>( XMC_CCU4_SLICE_GetTimerValue( p_slice ) - start_l );
+	}
+
+	++stats_l.runs;
+	stats_l.exec_last = exec_l;
+	stats_l.exec_max = ( exec_l > stats_l.exec_max ) ? exec_l : stats_l.exec_max;
+	stats_l.latency_min = ( start_l < stats_l.latency_min ) ? start_l : stats_l.latency_min;
+	stats_l.latency_max = ( start_l > stats_l.latency_max ) ? start_l : stats_l.latency_max;
+}
+
+#endif	/* CONTROL_USED */
+
+/********************************** End of File *******************************/
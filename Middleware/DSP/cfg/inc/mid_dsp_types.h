@@ -0,0 +1,152 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DSP data types Header
+* Filename:		mid_dsp_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_dsp_types.h
+ *  @brief:	This file contains data types definitions for fixed point
+ *  		signal processing kernels
+ */
+#ifndef MID_DSP_TYPES_H_
+#define MID_DSP_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Include XMC Headers */
+#include <xmc_common.h>
+
+#ifdef __cplusplus
+}	/* extern "C" { */
+#endif
+
+/* Include private headers first */
+#include <private/mid_dsp_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for DSP
+ *
+ * 			Q15 samples are short, Q31 samples are long (32 bit on target).
+ * 			State buffers are owned by user and cleared by DSP__::reset().
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	Structure for Q15 FIR filter and decimator
+ */
+typedef struct tStDSP_FirQ15_
+{
+	const short * p_coeff = nullptr;		/**< Q15 coefficients, first one applies to oldest sample */
+	short * p_state = nullptr;				/**< taps + max_block samples */
+	unsigned short taps = 0U;				/**< Even number of taps, pad with zero */
+	unsigned short max_block = 0U;			/**< Largest count of samples per call */
+	unsigned char factor = 1U;				/**< Decimation factor of decimate_q15() */
+} tStDSP_FirQ15;
+
+/*
+ * @brief	Structure for Q31 FIR filter and decimator
+ */
+typedef struct tStDSP_FirQ31_
+{
+	const long * p_coeff = nullptr;			/**< Q31 coefficients, first one applies to oldest sample */
+	long * p_state = nullptr;				/**< taps + max_block samples */
+	unsigned short taps = 0U;				/**< Number of taps */
+	unsigned short max_block = 0U;			/**< Largest count of samples per call */
+	unsigned char factor = 1U;				/**< Decimation factor of decimate_q31() */
+} tStDSP_FirQ31;
+
+/*
+ * @brief	Structure for cascade of Q15 biquads, direct form I
+ *
+ * 			y = b0*x + b1*x1 + b2*x2 + a1*y1 + a2*y2, feedback coefficients
+ * 			are negated against usual transfer function. Coefficients are
+ * 			Q(15 - post_shift) so that |a1| up to 2 fits with post_shift 1.
+ */
+typedef struct tStDSP_BiquadQ15_
+{
+	const short * p_coeff = nullptr;		/**< {b0, 0, b1, b2, a1, a2} per stage */
+	short * p_state = nullptr;				/**< {x1, x2, y1, y2} per stage */
+	unsigned char stages = 0U;				/**< Number of stages */
+	unsigned char post_shift = 1U;			/**< Coefficient scaling */
+} tStDSP_BiquadQ15;
+
+/*
+ * @brief	Structure for cascade of Q31 biquads, direct form I
+ *
+ * 			Same equation as tStDSP_BiquadQ15, coefficients are
+ * 			Q(31 - post_shift).
+ */
+typedef struct tStDSP_BiquadQ31_
+{
+	const long * p_coeff = nullptr;			/**< {b0, b1, b2, a1, a2} per stage */
+	long * p_state = nullptr;				/**< {x1, x2, y1, y2} per stage */
+	unsigned char stages = 0U;				/**< Number of stages */
+	unsigned char post_shift = 1U;			/**< Coefficient scaling */
+} tStDSP_BiquadQ31;
+
+/*
+ * @brief	Structure for Q15 moving average over 2^shift samples
+ */
+typedef struct tStDSP_AverageQ15_
+{
+	short * p_window = nullptr;				/**< 2^shift last samples */
+	long sum = 0;							/**< Sum of window */
+	unsigned short index = 0U;				/**< Oldest sample of window */
+	unsigned char shift = 0U;				/**< Window length as power of 2 */
+} tStDSP_AverageQ15;
+
+/*
+ * @brief	Structure for Q31 moving average over 2^shift samples
+ */
+typedef struct tStDSP_AverageQ31_
+{
+	long * p_window = nullptr;				/**< 2^shift last samples */
+	long long sum = 0;						/**< Sum of window */
+	unsigned short index = 0U;				/**< Oldest sample of window */
+	unsigned char shift = 0U;				/**< Window length as power of 2 */
+} tStDSP_AverageQ31;
+
+
+#endif /* MID_DSP_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,98 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DSP Configuration Header
+* Filename:		mid_dsp_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_dsp_conf.h
+ *  @brief:	This file contains static configurations for fixed point
+ *  		signal processing kernels
+ */
+#ifndef MID_DSP_CONF_H_
+#define MID_DSP_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* DSP kernels used in system, 0 - not used */
+#define DSP_USED					1
+
+/*
+ * Dual 16 bit MAC and saturating instructions of Cortex-M4 DSP extension,
+ * 0 - portable C of same arithmetic, e.g. build on host
+ */
+#if defined(__ARM_FEATURE_DSP) && ( 1 == __ARM_FEATURE_DSP )
+	#define DSP_SIMD_USED			1
+#else
+	#define DSP_SIMD_USED			0
+#endif
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Largest moving average window is 2^DSP_AVERAGE_MAX_SHIFT samples */
+#define DSP_AVERAGE_MAX_SHIFT		10U
+
+/*
+ * Largest FFT, power of 2. Sine and bit reversal tables of this size are
+ * generated at compile time into flash, smaller FFTs step through them.
+ */
+#define DSP_FFT_MAX_POINTS			1024U
+
+/* Resolution of right aligned ADC results taken by DSP__::load_adc_q15() */
+#define DSP_ADC_BITS				12U
+
+
+/* Check FFT size, bit reversal table holds unsigned short indices */
+#if ( (16U > DSP_FFT_MAX_POINTS) || (4096U < DSP_FFT_MAX_POINTS) || \
+	  (0U != (DSP_FFT_MAX_POINTS & (DSP_FFT_MAX_POINTS - 1U))) )
+	#error	"DSP FFT size must be a power of 2 from 16 to 4096"
+#endif
+
+/* Check ADC resolution */
+#if ( (DSP_ADC_BITS < 8U) || (DSP_ADC_BITS > 16U) )
+	#error	"DSP ADC resolution must be 8 to 16 bit"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* MID_DSP_CONF_H_ */
+
+/********************************** End of File ******************************/
@@ -0,0 +1,530 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DSP API Header
+* Filename:		mid_dsp.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_dsp.h
+ *  @brief:	This file contains API function declarations for fixed point
+ *  		signal processing kernels
+ */
+#ifndef MID_DSP_H_
+#define MID_DSP_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_dsp_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for fixed point signal processing kernels
+ *
+ * 			FIR, decimator, biquad cascade, moving average, dot product and
+ * 			FFT on Q15 and Q31 blocks. Q15 kernels use dual 16 bit MAC when
+ * 			DSP_SIMD_USED, portable C path computes same sums in 64 bit so
+ * 			that both give bit exact results. Kernels keep no data of their
+ * 			own, state lives in structures of caller.
+ *
+ ******************************************************************************/
+
+/* Check DSP usage in system */
+#if( 1 == DSP_USED )
+
+class DSP__
+{
+/* public members */
+public:
+	/* Constructors */
+	DSP__() = delete;
+	DSP__( DSP__& ) = delete;
+
+	/**
+	 * @function	reset
+	 *
+	 * @brief		Clear history of a filter
+	 *
+	 * @param[in]	filter	-	filter structure
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				To be called once before first block and whenever
+	 * 				stream restarts
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static void reset( tStDSP_FirQ15& filter );
+	static void reset( tStDSP_FirQ31& filter );
+	static void reset( tStDSP_BiquadQ15& filter );
+	static void reset( tStDSP_BiquadQ31& filter );
+	static void reset( tStDSP_AverageQ15& filter );
+	static void reset( tStDSP_AverageQ31& filter );
+
+	/**
+	 * @function	dot_q15
+	 *
+	 * @brief		Dot product of two Q15 vectors
+	 *
+	 * @param[in]	p_a		-	first vector
+	 * 				p_b		-	second vector
+	 * 				count	-	number of elements
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	Q30 sum, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Sum is kept in 64 bit and cannot overflow
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static long long dot_q15( const short * const p_a, const short * const p_b,
+								const unsigned short count );
+
+	/**
+	 * @function	dot_q31
+	 *
+	 * @brief		Dot product of two Q31 vectors
+	 *
+	 * @param[in]	p_a		-	first vector
+	 * 				p_b		-	second vector
+	 * 				count	-	number of elements
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	Q62 sum, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Sum wraps in 64 bit for full scale vectors longer than 2
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Scale inputs down for long vectors
+	 *
+	 */
+	static long long dot_q31( const long * const p_a, const long * const p_b,
+								const unsigned short count );
+
+	/**
+	 * @function	fir_q15
+	 *
+	 * @brief		FIR filter a block of Q15 samples
+	 *
+	 * @param[in]	filter	-	filter structure
+	 * 				p_in	-	samples
+	 * 				count	-	number of samples up to max_block
+	 *
+	 * @param[out]	p_out	-	count filtered samples
+	 *
+	 * @return  	number of samples written, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				History is kept between calls, blocks have to be passed
+	 * 				in order. Output saturates to Q15.
+	 *
+	 * <i>Imp Note:</i>
+	 * 				p_out may be same as p_in
+	 *
+	 */
+	static unsigned short fir_q15( tStDSP_FirQ15& filter, const short * const p_in,
+									const unsigned short count, short * const p_out );
+
+	/**
+	 * @function	decimate_q15
+	 *
+	 * @brief		FIR filter and decimate a block of Q15 samples
+	 *
+	 * @param[in]	filter	-	filter structure
+	 * 				p_in	-	samples
+	 * 				count	-	number of samples, multiple of factor up to
+	 * 							max_block
+	 *
+	 * @param[out]	p_out	-	count / factor filtered samples
+	 *
+	 * @return  	number of samples written, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Only every factor-th output is computed, each one ends
+	 * 				on last sample of its group
+	 *
+	 * <i>Imp Note:</i>
+	 * 				p_out may be same as p_in
+	 *
+	 */
+	static unsigned short decimate_q15( tStDSP_FirQ15& filter, const short * const p_in,
+										const unsigned short count, short * const p_out );
+
+	/**
+	 * @function	fir_q31
+	 *
+	 * @brief		FIR filter a block of Q31 samples
+	 *
+	 * @param[in]	filter	-	filter structure
+	 * 				p_in	-	samples
+	 * 				count	-	number of samples up to max_block
+	 *
+	 * @param[out]	p_out	-	count filtered samples
+	 *
+	 * @return  	number of samples written, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Products are summed in 64 bit, output saturates to Q31
+	 *
+	 * <i>Imp Note:</i>
+	 * 				p_out may be same as p_in
+	 *
+	 */
+	static unsigned short fir_q31( tStDSP_FirQ31& filter, const long * const p_in,
+									const unsigned short count, long * const p_out );
+
+	/**
+	 * @function	decimate_q31
+	 *
+	 * @brief		FIR filter and decimate a block of Q31 samples
+	 *
+	 * @param[in]	filter	-	filter structure
+	 * 				p_in	-	samples
+	 * 				count	-	number of samples, multiple of factor up to
+	 * 							max_block
+	 *
+	 * @param[out]	p_out	-	count / factor filtered samples
+	 *
+	 * @return  	number of samples written, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 * 				p_out may be same as p_in
+	 *
+	 */
+	static unsigned short decimate_q31( tStDSP_FirQ31& filter, const long * const p_in,
+										const unsigned short count, long * const p_out );
+
+	/**
+	 * @function	biquad_q15
+	 *
+	 * @brief		Filter a block of Q15 samples by biquad cascade
+	 *
+	 * @param[in]	filter	-	filter structure
+	 * 				p_in	-	samples
+	 * 				count	-	number of samples
+	 *
+	 * @param[out]	p_out	-	count filtered samples
+	 *
+	 * @return  	number of samples written, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Each stage sums in 64 bit and saturates its output to Q15
+	 * 				before next stage
+	 *
+	 * <i>Imp Note:</i>
+	 * 				p_out may be same as p_in
+	 *
+	 */
+	static unsigned short biquad_q15( tStDSP_BiquadQ15& filter, const short * const p_in,
+										const unsigned short count, short * const p_out );
+
+	/**
+	 * @function	biquad_q31
+	 *
+	 * @brief		Filter a block of Q31 samples by biquad cascade
+	 *
+	 * @param[in]	filter	-	filter structure
+	 * 				p_in	-	samples
+	 * 				count	-	number of samples
+	 *
+	 * @param[out]	p_out	-	count filtered samples
+	 *
+	 * @return  	number of samples written, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Each stage sums in 64 bit and saturates its output to Q31
+	 * 				before next stage
+	 *
+	 * <i>Imp Note:</i>
+	 * 				p_out may be same as p_in
+	 *
+	 */
+	static unsigned short biquad_q31( tStDSP_BiquadQ31& filter, const long * const p_in,
+										const unsigned short count, long * const p_out );
+
+	/**
+	 * @function	average_q15
+	 *
+	 * @brief		Moving average of a block of Q15 samples
+	 *
+	 * @param[in]	filter	-	filter structure
+	 * 				p_in	-	samples
+	 * 				count	-	number of samples
+	 *
+	 * @param[out]	p_out	-	count averaged samples
+	 *
+	 * @return  	number of samples written, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Running sum is updated by entering and leaving sample,
+	 * 				cost does not depend on window length
+	 *
+	 * <i>Imp Note:</i>
+	 * 				p_out may be same as p_in
+	 *
+	 */
+	static unsigned short average_q15( tStDSP_AverageQ15& filter, const short * const p_in,
+										const unsigned short count, short * const p_out );
+
+	/**
+	 * @function	average_q31
+	 *
+	 * @brief		Moving average of a block of Q31 samples
+	 *
+	 * @param[in]	filter	-	filter structure
+	 * 				p_in	-	samples
+	 * 				count	-	number of samples
+	 *
+	 * @param[out]	p_out	-	count averaged samples
+	 *
+	 * @return  	number of samples written, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 * 				p_out may be same as p_in
+	 *
+	 */
+	static unsigned short average_q31( tStDSP_AverageQ31& filter, const long * const p_in,
+										const unsigned short count, long * const p_out );
+
+	/**
+	 * @function	fft_q15
+	 *
+	 * @brief		In place mixed radix-4/2 FFT of Q15 complex samples
+	 *
+	 * @param[in]	p_data	-	points complex samples {re, im}
+	 * 				points	-	power of 2 from 16 to DSP_FFT_MAX_POINTS
+	 *
+	 * @param[out]	p_data	-	spectrum in natural order, scaled by 1 / points
+	 *
+	 * @return  	points, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Decimation in frequency, every radix-4 stage halves twice
+	 * 				and the radix-2 stage of odd log2(points) once, so that
+	 * 				butterflies cannot overflow. Twiddles come from sine table
+	 * 				generated at compile time.
+	 *
+	 * <i>Imp Note:</i>
+	 * 				p_data has to be 4 byte aligned
+	 *
+	 */
+	static unsigned short fft_q15( short * const p_data, const unsigned short points );
+
+	/**
+	 * @function	fft_q31
+	 *
+	 * @brief		In place mixed radix-4/2 FFT of Q31 complex samples
+	 *
+	 * @param[in]	p_data	-	points complex samples {re, im}
+	 * 				points	-	power of 2 from 16 to DSP_FFT_MAX_POINTS
+	 *
+	 * @param[out]	p_data	-	spectrum in natural order, scaled by 1 / points
+	 *
+	 * @return  	points, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Same algorithm as fft_q15(), products are kept in 64 bit
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static unsigned short fft_q31( long * const p_data, const unsigned short points );
+
+	/**
+	 * @function	load_q15
+	 *
+	 * @brief		Load real Q15 samples as complex FFT input
+	 *
+	 * @param[in]	p_in	-	points real samples
+	 * 				points	-	power of 2 from 16 to DSP_FFT_MAX_POINTS
+	 * 				window	-	true to apply Hann window
+	 *
+	 * @param[out]	p_out	-	points complex samples {re, 0}
+	 *
+	 * @return  	points, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Window is taken from FFT sine table
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static unsigned short load_q15( const short * const p_in, const unsigned short points,
+									const bool window, short * const p_out );
+
+	/**
+	 * @function	load_adc_q15
+	 *
+	 * @brief		Load one channel of an ADC sample block as complex FFT input
+	 *
+	 * @param[in]	p_in	-	right aligned DSP_ADC_BITS results, e.g. block of
+	 * 							adc_callback_handler()
+	 * 				stride	-	channels interleaved in block, 1 for one channel
+	 * 				points	-	power of 2 from 16 to DSP_FFT_MAX_POINTS
+	 * 				window	-	true to apply Hann window
+	 *
+	 * @param[out]	p_out	-	points complex samples {re, 0}
+	 *
+	 * @return  	points, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Mid scale is removed and results are scaled to full Q15
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Block has to hold points * stride results
+	 *
+	 */
+	static unsigned short load_adc_q15( const unsigned short * const p_in, const unsigned char stride,
+										const unsigned short points, const bool window,
+										short * const p_out );
+
+	/**
+	 * @function	load_q31
+	 *
+	 * @brief		Load real Q31 samples as complex FFT input
+	 *
+	 * @param[in]	p_in	-	points real samples
+	 * 				points	-	power of 2 from 16 to DSP_FFT_MAX_POINTS
+	 * 				window	-	true to apply Hann window
+	 *
+	 * @param[out]	p_out	-	points complex samples {re, 0}
+	 *
+	 * @return  	points, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static unsigned short load_q31( const long * const p_in, const unsigned short points,
+									const bool window, long * const p_out );
+
+	/**
+	 * @function	magnitude_q15
+	 *
+	 * @brief		Magnitude of Q15 complex samples
+	 *
+	 * @param[in]	p_in	-	count complex samples {re, im}
+	 * 				count	-	number of samples, e.g. points / 2 of real input
+	 *
+	 * @param[out]	p_out	-	count magnitudes, saturated to Q15
+	 *
+	 * @return  	number of samples written, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static unsigned short magnitude_q15( const short * const p_in, const unsigned short count,
+											short * const p_out );
+
+	/**
+	 * @function	magnitude_q31
+	 *
+	 * @brief		Magnitude of Q31 complex samples
+	 *
+	 * @param[in]	p_in	-	count complex samples {re, im}
+	 * 				count	-	number of samples, e.g. points / 2 of real input
+	 *
+	 * @param[out]	p_out	-	count magnitudes, saturated to Q31
+	 *
+	 * @return  	number of samples written, 0 on wrong arguments
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static unsigned short magnitude_q31( const long * const p_in, const unsigned short count,
+											long * const p_out );
+
+/* private members */
+private:
+	/******* Private Member Functions *******/
+	static unsigned short filter_q15( tStDSP_FirQ15& filter, const short * const p_in,
+										const unsigned short count, short * const p_out,
+										const unsigned char factor );
+	static unsigned short filter_q31( tStDSP_FirQ31& filter, const long * const p_in,
+										const unsigned short count, long * const p_out,
+										const unsigned char factor );
+	static bool is_fft_size( const unsigned short points );
+	static unsigned long square_root( unsigned long long value );
+#if( 1 == DSP_SIMD_USED )
+	static unsigned long rotate_q15( const unsigned long sample, const unsigned long twiddle );
+#else
+	static void rotate_q15( short * const p_out, const long real, const long imag,
+							const short cosine, const short sine );
+#endif
+	static void rotate_q31( long * const p_out, const long long real, const long long imag,
+							const long cosine, const long sine );
+	static inline short saturate_q15( const long long value )
+	{
+		return ( (value > 32767) ? 32767 : ((value < -32768) ? -32768 : static_cast<short>(value)) );
+	}
+	static inline long saturate_q31( const long long value )
+	{
+		return ( (value > 2147483647LL) ? 2147483647L :
+				((value < -2147483648LL) ? (-2147483647L - 1L) : static_cast<long>(value)) );
+	}
+};
+
+#endif	/* DSP_USED */
+
+
+#endif /* MID_DSP_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,642 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DSP API Source
+* Filename:		mid_dsp.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	mid_dsp.cpp
+ *  @brief:	This source file contains API function definitions for fixed
+ *  		point signal processing kernels.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_dsp.h>
+#include <string.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Check DSP usage in system */
+#if( 1 == DSP_USED )
+
+/******* Public Member function for DSP__ class *******/
+
+/**
+ * @function	reset
+ *
+ * @brief		Clear history of a filter
+ *
+ * \par<b>Description:</b><br>
+ * 				Structures without state buffer are left untouched
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void DSP__::reset( tStDSP_FirQ15& filter )
+{
+	if( nullptr != filter.p_state )
+	{
+		memset( filter.p_state, 0, (filter.taps + filter.max_block) * sizeof(short) );
+	}
+	else{	/* Not required */	}
+}
+
+void DSP__::reset( tStDSP_FirQ31& filter )
+{
+	if( nullptr != filter.p_state )
+	{
+		memset( filter.p_state, 0, (filter.taps + filter.max_block) * sizeof(long) );
+	}
+	else{	/* Not required */	}
+}
+
+void DSP__::reset( tStDSP_BiquadQ15& filter )
+{
+	if( nullptr != filter.p_state )
+	{
+		memset( filter.p_state, 0, (4U * filter.stages) * sizeof(short) );
+	}
+	else{	/* Not required */	}
+}
+
+void DSP__::reset( tStDSP_BiquadQ31& filter )
+{
+	if( nullptr != filter.p_state )
+	{
+		memset( filter.p_state, 0, (4U * filter.stages) * sizeof(long) );
+	}
+	else{	/* Not required */	}
+}
+
+void DSP__::reset( tStDSP_AverageQ15& filter )
+{
+	if( (nullptr != filter.p_window) && (DSP_AVERAGE_MAX_SHIFT >= filter.shift) )
+	{
+		memset( filter.p_window, 0, (1UL << filter.shift) * sizeof(short) );
+		filter.sum = 0;
+		filter.index = 0U;
+	}
+	else{	/* Not required */	}
+}
+
+void DSP__::reset( tStDSP_AverageQ31& filter )
+{
+	if( (nullptr != filter.p_window) && (DSP_AVERAGE_MAX_SHIFT >= filter.shift) )
+	{
+		memset( filter.p_window, 0, (1UL << filter.shift) * sizeof(long) );
+		filter.sum = 0;
+		filter.index = 0U;
+	}
+	else{	/* Not required */	}
+}
+
+
+/**
+ * @function	dot_q15
+ *
+ * @brief		Dot product of two Q15 vectors
+ *
+ * \par<b>Description:</b><br>
+ * 				Pairs are accumulated by one dual 16 bit MAC into 64 bit
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+long long DSP__::dot_q15( const short * const p_a, const short * const p_b,
+							const unsigned short count )
+{
+	/* Local Variables */
+#if( 1 == DSP_SIMD_USED )
+	unsigned long a = 0;
+	unsigned long b = 0;
+#endif
+	long long acc = 0;
+	unsigned short index = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_a) || (nullptr == p_b)), 0 );
+
+	for( index = 0; (index + 1U) < count; index = index + 2U )
+	{
+#if( 1 == DSP_SIMD_USED )
+		memcpy( &a, &p_a[index], 4U );
+		memcpy( &b, &p_b[index], 4U );
+		acc = (long long) __SMLALD( a, b, (unsigned long long) acc );
+#else
+		acc = acc + ( (long long) p_a[index] * p_b[index] ) +
+					( (long long) p_a[index + 1U] * p_b[index + 1U] );
+#endif
+	}
+
+	/* Odd element */
+	if( index < count )
+	{
+		acc = acc + ( (long long) p_a[index] * p_b[index] );
+	}
+	else{	/* Not required */	}
+
+	return acc;
+}
+
+
+/**
+ * @function	dot_q31
+ *
+ * @brief		Dot product of two Q31 vectors
+ *
+ * \par<b>Description:</b><br>
+ * 				32 x 32 bit products are accumulated by long MAC
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+long long DSP__::dot_q31( const long * const p_a, const long * const p_b,
+							const unsigned short count )
+{
+	/* Local Variables */
+	long long acc = 0;
+	unsigned short index = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_a) || (nullptr == p_b)), 0 );
+
+	for( index = 0; index < count; ++index )
+	{
+		acc = acc + ( (long long) p_a[index] * p_b[index] );
+	}
+
+	return acc;
+}
+
+
+/**
+ * @function	fir_q15
+ *
+ * @brief		FIR filter a block of Q15 samples
+ *
+ * \par<b>Description:</b><br>
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::fir_q15( tStDSP_FirQ15& filter, const short * const p_in,
+								const unsigned short count, short * const p_out )
+{
+	return filter_q15( filter, p_in, count, p_out, 1U );
+}
+
+
+/**
+ * @function	decimate_q15
+ *
+ * @brief		FIR filter and decimate a block of Q15 samples
+ *
+ * \par<b>Description:</b><br>
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::decimate_q15( tStDSP_FirQ15& filter, const short * const p_in,
+									const unsigned short count, short * const p_out )
+{
+	return filter_q15( filter, p_in, count, p_out, filter.factor );
+}
+
+
+/**
+ * @function	fir_q31
+ *
+ * @brief		FIR filter a block of Q31 samples
+ *
+ * \par<b>Description:</b><br>
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::fir_q31( tStDSP_FirQ31& filter, const long * const p_in,
+								const unsigned short count, long * const p_out )
+{
+	return filter_q31( filter, p_in, count, p_out, 1U );
+}
+
+
+/**
+ * @function	decimate_q31
+ *
+ * @brief		FIR filter and decimate a block of Q31 samples
+ *
+ * \par<b>Description:</b><br>
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::decimate_q31( tStDSP_FirQ31& filter, const long * const p_in,
+									const unsigned short count, long * const p_out )
+{
+	return filter_q31( filter, p_in, count, p_out, filter.factor );
+}
+
+
+/**
+ * @function	biquad_q15
+ *
+ * @brief		Filter a block of Q15 samples by biquad cascade
+ *
+ * \par<b>Description:</b><br>
+ * 				State and coefficient pairs are laid out so that x1, x2
+ * 				and y1, y2 meet b1, b2 and a1, a2 in one dual MAC each.
+ * 				Stage state is kept in registers for whole block.
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::biquad_q15( tStDSP_BiquadQ15& filter, const short * const p_in,
+									const unsigned short count, short * const p_out )
+{
+	/* Local Variables */
+	const short * p_coeff = nullptr;
+	short * p_state = nullptr;
+	const short * p_x = p_in;
+#if( 1 == DSP_SIMD_USED )
+	unsigned long x12 = 0;
+	unsigned long y12 = 0;
+	unsigned long b12 = 0;
+	unsigned long a12 = 0;
+#endif
+	long long acc = 0;
+	short y = 0;
+	unsigned short index = 0;
+	unsigned char stage = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_in) || (nullptr == p_out)), 0U );
+	DRIVER_ASSERT( ((nullptr == filter.p_coeff) || (nullptr == filter.p_state)), 0U );
+	DRIVER_ASSERT( ((0U == filter.stages) || (15U <= filter.post_shift)), 0U );
+
+	for( stage = 0; stage < filter.stages; ++stage )
+	{
+		p_coeff = &filter.p_coeff[6U * stage];
+		p_state = &filter.p_state[4U * stage];
+
+#if( 1 == DSP_SIMD_USED )
+		memcpy( &x12, &p_state[0], 4U );
+		memcpy( &y12, &p_state[2], 4U );
+		memcpy( &b12, &p_coeff[2], 4U );
+		memcpy( &a12, &p_coeff[4], 4U );
+
+		for( index = 0; index < count; ++index )
+		{
+			acc = (long long) p_coeff[0] * p_x[index];
+			acc = (long long) __SMLALD( x12, b12, (unsigned long long) acc );
+			acc = (long long) __SMLALD( y12, a12, (unsigned long long) acc );
+			y = saturate_q15( acc >> (15U - filter.post_shift) );
+
+			/* Shift delay lines, newest sample into lower half word */
+			x12 = __PKHBT( p_x[index], x12, 16 );
+			y12 = __PKHBT( y, y12, 16 );
+			p_out[index] = y;
+		}
+
+		memcpy( &p_state[0], &x12, 4U );
+		memcpy( &p_state[2], &y12, 4U );
+#else
+		short x1 = p_state[0];
+		short x2 = p_state[1];
+		short y1 = p_state[2];
+		short y2 = p_state[3];
+
+		for( index = 0; index < count; ++index )
+		{
+			acc = ( (long long) p_coeff[0] * p_x[index] ) +
+					( (long long) x1 * p_coeff[2] ) + ( (long long) x2 * p_coeff[3] ) +
+					( (long long) y1 * p_coeff[4] ) + ( (long long) y2 * p_coeff[5] );
+			y = saturate_q15( acc >> (15U - filter.post_shift) );
+
+			x2 = x1;
+			x1 = p_x[index];
+			y2 = y1;
+			y1 = y;
+			p_out[index] = y;
+		}
+
+		p_state[0] = x1;
+		p_state[1] = x2;
+		p_state[2] = y1;
+		p_state[3] = y2;
+#endif
+
+		/* Next stage filters output of this one */
+		p_x = p_out;
+	}
+
+	return count;
+}
+
+
+/**
+ * @function	biquad_q31
+ *
+ * @brief		Filter a block of Q31 samples by biquad cascade
+ *
+ * \par<b>Description:</b><br>
+ * 				Stage state is kept in registers for whole block
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::biquad_q31( tStDSP_BiquadQ31& filter, const long * const p_in,
+									const unsigned short count, long * const p_out )
+{
+	/* Local Variables */
+	const long * p_coeff = nullptr;
+	long * p_state = nullptr;
+	const long * p_x = p_in;
+	long long acc = 0;
+	long x1 = 0;
+	long x2 = 0;
+	long y1 = 0;
+	long y2 = 0;
+	unsigned short index = 0;
+	unsigned char stage = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_in) || (nullptr == p_out)), 0U );
+	DRIVER_ASSERT( ((nullptr == filter.p_coeff) || (nullptr == filter.p_state)), 0U );
+	DRIVER_ASSERT( ((0U == filter.stages) || (31U <= filter.post_shift)), 0U );
+
+	for( stage = 0; stage < filter.stages; ++stage )
+	{
+		p_coeff = &filter.p_coeff[5U * stage];
+		p_state = &filter.p_state[4U * stage];
+		x1 = p_state[0];
+		x2 = p_state[1];
+		y1 = p_state[2];
+		y2 = p_state[3];
+
+		for( index = 0; index < count; ++index )
+		{
+			acc = ( (long long) p_coeff[0] * p_x[index] ) +
+					( (long long) p_coeff[1] * x1 ) + ( (long long) p_coeff[2] * x2 ) +
+					( (long long) p_coeff[3] * y1 ) + ( (long long) p_coeff[4] * y2 );
+
+			x2 = x1;
+			x1 = p_x[index];
+			y2 = y1;
+			y1 = saturate_q31( acc >> (31U - filter.post_shift) );
+			p_out[index] = y1;
+		}
+
+		p_state[0] = x1;
+		p_state[1] = x2;
+		p_state[2] = y1;
+		p_state[3] = y2;
+
+		/* Next stage filters output of this one */
+		p_x = p_out;
+	}
+
+	return count;
+}
+
+
+/**
+ * @function	average_q15
+ *
+ * @brief		Moving average of a block of Q15 samples
+ *
+ * \par<b>Description:</b><br>
+ * 				Mean is rounded towards minus infinity
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::average_q15( tStDSP_AverageQ15& filter, const short * const p_in,
+									const unsigned short count, short * const p_out )
+{
+	/* Local Variables */
+	const unsigned short mask = static_cast<unsigned short>( (1UL << filter.shift) - 1U );
+	unsigned short index = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_in) || (nullptr == p_out)), 0U );
+	DRIVER_ASSERT( ((nullptr == filter.p_window) || (DSP_AVERAGE_MAX_SHIFT < filter.shift)), 0U );
+
+	for( index = 0; index < count; ++index )
+	{
+		filter.sum = filter.sum + p_in[index] - filter.p_window[filter.index];
+		filter.p_window[filter.index] = p_in[index];
+		filter.index = (filter.index + 1U) & mask;
+		p_out[index] = static_cast<short>( filter.sum >> filter.shift );
+	}
+
+	return count;
+}
+
+
+/**
+ * @function	average_q31
+ *
+ * @brief		Moving average of a block of Q31 samples
+ *
+ * \par<b>Description:</b><br>
+ * 				Mean is rounded towards minus infinity
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::average_q31( tStDSP_AverageQ31& filter, const long * const p_in,
+									const unsigned short count, long * const p_out )
+{
+	/* Local Variables */
+	const unsigned short mask = static_cast<unsigned short>( (1UL << filter.shift) - 1U );
+	unsigned short index = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_in) || (nullptr == p_out)), 0U );
+	DRIVER_ASSERT( ((nullptr == filter.p_window) || (DSP_AVERAGE_MAX_SHIFT < filter.shift)), 0U );
+
+	for( index = 0; index < count; ++index )
+	{
+		filter.sum = filter.sum + p_in[index] - filter.p_window[filter.index];
+		filter.p_window[filter.index] = p_in[index];
+		filter.index = (filter.index + 1U) & mask;
+		p_out[index] = static_cast<long>( filter.sum >> filter.shift );
+	}
+
+	return count;
+}
+
+
+/******* Private Member function for DSP__ class *******/
+
+/**
+ * @function	filter_q15
+ *
+ * @brief		Common Q15 FIR and decimator
+ *
+ * \par<b>Description:</b><br>
+ * 				New samples are appended behind history so that every
+ * 				output is one straight dot product, pairs of samples and
+ * 				coefficients are accumulated by one dual 16 bit MAC
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::filter_q15( tStDSP_FirQ15& filter, const short * const p_in,
+									const unsigned short count, short * const p_out,
+									const unsigned char factor )
+{
+	/* Local Variables */
+	const short * p_x = nullptr;
+#if( 1 == DSP_SIMD_USED )
+	unsigned long x = 0;
+	unsigned long h = 0;
+#endif
+	long long acc = 0;
+	unsigned short out = 0;
+	unsigned short tap = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_in) || (nullptr == p_out)), 0U );
+	DRIVER_ASSERT( ((nullptr == filter.p_coeff) || (nullptr == filter.p_state)), 0U );
+	DRIVER_ASSERT( ((0U == filter.taps) || (0U != (filter.taps & 1U))), 0U );
+	DRIVER_ASSERT( ((0U == count) || (filter.max_block < count)), 0U );
+	DRIVER_ASSERT( ((0U == factor) || (0U != (count % factor))), 0U );
+
+	memcpy( &filter.p_state[filter.taps], p_in, count * sizeof(short) );
+
+	for( out = 0; out < (count / factor); ++out )
+	{
+		/* Window ends on last sample of decimation group */
+		p_x = &filter.p_state[(out + 1U) * factor];
+		acc = 0;
+
+		for( tap = 0; tap < filter.taps; tap = tap + 2U )
+		{
+#if( 1 == DSP_SIMD_USED )
+			memcpy( &x, &p_x[tap], 4U );
+			memcpy( &h, &filter.p_coeff[tap], 4U );
+			acc = (long long) __SMLALD( x, h, (unsigned long long) acc );
+#else
+			/* Same pair wise sum without DSP extension */
+			acc = acc + ( (long long) p_x[tap] * filter.p_coeff[tap] ) +
+						( (long long) p_x[tap + 1U] * filter.p_coeff[tap + 1U] );
+#endif
+		}
+
+		/* Q30 sum back to Q15 */
+		p_out[out] = saturate_q15( acc >> 15 );
+	}
+
+	/* Last samples become history of next block */
+	memmove( &filter.p_state[0], &filter.p_state[count], filter.taps * sizeof(short) );
+
+	/* Return number of samples */
+	return out;
+}
+
+
+/**
+ * @function	filter_q31
+ *
+ * @brief		Common Q31 FIR and decimator
+ *
+ * \par<b>Description:</b><br>
+ * 				Same layout as filter_q15(), 32 x 32 bit products are
+ * 				accumulated by long MAC
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::filter_q31( tStDSP_FirQ31& filter, const long * const p_in,
+									const unsigned short count, long * const p_out,
+									const unsigned char factor )
+{
+	/* Local Variables */
+	const long * p_x = nullptr;
+	long long acc = 0;
+	unsigned short out = 0;
+	unsigned short tap = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_in) || (nullptr == p_out)), 0U );
+	DRIVER_ASSERT( ((nullptr == filter.p_coeff) || (nullptr == filter.p_state)), 0U );
+	DRIVER_ASSERT( (0U == filter.taps), 0U );
+	DRIVER_ASSERT( ((0U == count) || (filter.max_block < count)), 0U );
+	DRIVER_ASSERT( ((0U == factor) || (0U != (count % factor))), 0U );
+
+	memcpy( &filter.p_state[filter.taps], p_in, count * sizeof(long) );
+
+	for( out = 0; out < (count / factor); ++out )
+	{
+		/* Window ends on last sample of decimation group */
+		p_x = &filter.p_state[(out + 1U) * factor];
+		acc = 0;
+
+		for( tap = 0; tap < filter.taps; ++tap )
+		{
+			acc = acc + ( (long long) p_x[tap] * filter.p_coeff[tap] );
+		}
+
+		/* Q62 sum back to Q31 */
+		p_out[out] = saturate_q31( acc >> 31 );
+	}
+
+	/* Last samples become history of next block */
+	memmove( &filter.p_state[0], &filter.p_state[count], filter.taps * sizeof(long) );
+
+	/* Return number of samples */
+	return out;
+}
+
+#endif	/* DSP_USED */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,788 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DSP FFT Source
+* Filename:		mid_dsp_fft.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	mid_dsp_fft.cpp
+ *  @brief:	This source file contains API function definitions for fixed
+ *  		point FFT, window and magnitude.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_dsp.h>
+#include <dri_math.h>
+#include <string.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Quarter period of sine table is cosine offset */
+#define DSP_FFT_QUARTER				( DSP_FFT_MAX_POINTS / 4U )
+#define DSP_FFT_MASK				( DSP_FFT_MAX_POINTS - 1U )
+
+/* Mid scale of unsigned ADC results */
+#define DSP_ADC_OFFSET				( 1L << (DSP_ADC_BITS - 1U) )
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/* Check DSP usage in system */
+#if( 1 == DSP_USED )
+
+/*
+ * @brief	Table of DSP_FFT_MAX_POINTS entries, literal type so that it can
+ * 			be filled by constexpr function
+ */
+template< typename T >
+struct tStDSP_Table
+{
+	T value[DSP_FFT_MAX_POINTS];
+};
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Compile time table generation
+*******************************************************************************/
+
+/* sin(2 * pi * index / DSP_FFT_MAX_POINTS), other quadrants by symmetry */
+static constexpr double sine_value( const unsigned long index )
+{
+	const unsigned long quadrant = index / DSP_FFT_QUARTER;
+	const unsigned long rest = index % DSP_FFT_QUARTER;
+	const double value = ( 0U == (quadrant & 1U) ) ?
+							Math__::sine_quadrant( static_cast<double>(rest) / DSP_FFT_QUARTER ) :
+							Math__::sine_quadrant( static_cast<double>(DSP_FFT_QUARTER - rest) / DSP_FFT_QUARTER );
+
+	return ( (quadrant < 2U) ? value : -value );
+}
+
+/* Round to nearest, half away from zero */
+static constexpr long long round_scaled( const double value, const double scale )
+{
+	return ( (value >= 0.0) ? static_cast<long long>( (value * scale) + 0.5 ) :
+							-static_cast<long long>( (-value * scale) + 0.5 ) );
+}
+
+static constexpr tStDSP_Table<short> make_sine_q15( void )
+{
+	tStDSP_Table<short> table{};
+
+	for( unsigned long index = 0U; index < DSP_FFT_MAX_POINTS; ++index )
+	{
+		table.value[index] = static_cast<short>( round_scaled( sine_value(index), 32767.0 ) );
+	}
+
+	return table;
+}
+
+static constexpr tStDSP_Table<long> make_sine_q31( void )
+{
+	tStDSP_Table<long> table{};
+
+	for( unsigned long index = 0U; index < DSP_FFT_MAX_POINTS; ++index )
+	{
+		table.value[index] = static_cast<long>( round_scaled( sine_value(index), 2147483647.0 ) );
+	}
+
+	return table;
+}
+
+/* Bit reversal of all log2(DSP_FFT_MAX_POINTS) bits */
+static constexpr tStDSP_Table<unsigned short> make_reverse( void )
+{
+	tStDSP_Table<unsigned short> table{};
+
+	for( unsigned long index = 0U; index < DSP_FFT_MAX_POINTS; ++index )
+	{
+		unsigned long value = index;
+		unsigned long reversed = 0U;
+
+		for( unsigned long span = 1U; span < DSP_FFT_MAX_POINTS; span = span << 1 )
+		{
+			reversed = (reversed << 1) | (value & 1U);
+			value = value >> 1;
+		}
+
+		table.value[index] = static_cast<unsigned short>( reversed );
+	}
+
+	return table;
+}
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Constant initialized, linker places them in .rodata (flash) */
+static constexpr tStDSP_Table<short> sg_sine_q15 = make_sine_q15();
+static constexpr tStDSP_Table<long> sg_sine_q31 = make_sine_q31();
+static constexpr tStDSP_Table<unsigned short> sg_reverse = make_reverse();
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/******* Public Member function for DSP__ class *******/
+
+/**
+ * @function	fft_q15
+ *
+ * @brief		In place mixed radix-4/2 FFT of Q15 complex samples
+ *
+ * \par<b>Description:</b><br>
+ * 				Twiddles are shared by all groups of a stage, so stage loops
+ * 				over twiddle index first. A complex sample is one word, sums
+ * 				use halving dual 16 bit add and subtract, rotation is one
+ * 				dual MAC for each part. Butterfly outputs 1 and 2 trade
+ * 				places, so radix-4 stages leave bit reversed order just as
+ * 				radix-2 stages do, and odd log2(points) ends with one
+ * 				radix-2 stage without twiddles.
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::fft_q15( short * const p_data, const unsigned short points )
+{
+	/* Local Variables */
+	short * p_a = nullptr;
+	short * p_b = nullptr;
+	short * p_c = nullptr;
+	short * p_d = nullptr;
+#if( 1 == DSP_SIMD_USED )
+	unsigned long a = 0;
+	unsigned long b = 0;
+	unsigned long c = 0;
+	unsigned long d = 0;
+	unsigned long t0 = 0;
+	unsigned long t1 = 0;
+	unsigned long t2 = 0;
+	unsigned long t3 = 0;
+	unsigned long w[3] = { 0 };
+#else
+	long t0r = 0;
+	long t0i = 0;
+	long t1r = 0;
+	long t1i = 0;
+	long t2r = 0;
+	long t2i = 0;
+	long t3r = 0;
+	long t3i = 0;
+	short cosine[3] = { 0 };
+	short sine[3] = { 0 };
+#endif
+	unsigned long twiddle = 0;
+	unsigned short span = 0;
+	unsigned short quarter = 0;
+	unsigned short step = 0;
+	unsigned short k = 0;
+	unsigned short group = 0;
+	unsigned short swap = 0;
+	short value = 0;
+	unsigned char index = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_data) || (false == is_fft_size(points))), 0U );
+
+	for( span = points; span >= 4U; span = span >> 2 )
+	{
+		quarter = span >> 2;
+		step = static_cast<unsigned short>( DSP_FFT_MAX_POINTS / span );
+
+		for( k = 0; k < quarter; ++k )
+		{
+			/* W^k, W^2k, W^3k as cos - j sin */
+			for( index = 0; index < 3U; ++index )
+			{
+				twiddle = (unsigned long) (index + 1U) * k * step;
+#if( 1 == DSP_SIMD_USED )
+				w[index] = __PKHBT( sg_sine_q15.value[(twiddle + DSP_FFT_QUARTER) & DSP_FFT_MASK],
+									sg_sine_q15.value[twiddle], 16 );
+#else
+				cosine[index] = sg_sine_q15.value[(twiddle + DSP_FFT_QUARTER) & DSP_FFT_MASK];
+				sine[index] = sg_sine_q15.value[twiddle];
+#endif
+			}
+
+			for( group = k; group < points; group = group + span )
+			{
+				p_a = &p_data[2U * group];
+				p_b = &p_a[2U * quarter];
+				p_c = &p_b[2U * quarter];
+				p_d = &p_c[2U * quarter];
+
+#if( 1 == DSP_SIMD_USED )
+				memcpy( &a, p_a, 4U );
+				memcpy( &b, p_b, 4U );
+				memcpy( &c, p_c, 4U );
+				memcpy( &d, p_d, 4U );
+
+				t0 = __SHADD16( a, c );
+				t1 = __SHSUB16( a, c );
+				t2 = __SHADD16( b, d );
+				t3 = __SHSUB16( b, d );
+
+				a = __SHADD16( t0, t2 );
+				b = rotate_q15( __SHSUB16( t0, t2 ), w[1] );
+				c = rotate_q15( __SHSAX( t1, t3 ), w[0] );
+				d = rotate_q15( __SHASX( t1, t3 ), w[2] );
+
+				memcpy( p_a, &a, 4U );
+				memcpy( p_b, &b, 4U );
+				memcpy( p_c, &c, 4U );
+				memcpy( p_d, &d, 4U );
+#else
+				/* Same halving sums without DSP extension */
+				t0r = ( (long) p_a[0] + p_c[0] ) >> 1;
+				t0i = ( (long) p_a[1] + p_c[1] ) >> 1;
+				t1r = ( (long) p_a[0] - p_c[0] ) >> 1;
+				t1i = ( (long) p_a[1] - p_c[1] ) >> 1;
+				t2r = ( (long) p_b[0] + p_d[0] ) >> 1;
+				t2i = ( (long) p_b[1] + p_d[1] ) >> 1;
+				t3r = ( (long) p_b[0] - p_d[0] ) >> 1;
+				t3i = ( (long) p_b[1] - p_d[1] ) >> 1;
+
+				p_a[0] = static_cast<short>( (t0r + t2r) >> 1 );
+				p_a[1] = static_cast<short>( (t0i + t2i) >> 1 );
+				rotate_q15( p_b, (t0r - t2r) >> 1, (t0i - t2i) >> 1, cosine[1], sine[1] );
+				rotate_q15( p_c, (t1r + t3i) >> 1, (t1i - t3r) >> 1, cosine[0], sine[0] );
+				rotate_q15( p_d, (t1r - t3i) >> 1, (t1i + t3r) >> 1, cosine[2], sine[2] );
+#endif
+			}
+		}
+	}
+
+	/* Radix-2 stage of pairs, twiddle is 1 */
+	if( 2U == span )
+	{
+		for( group = 0; group < points; group = group + 2U )
+		{
+			p_a = &p_data[2U * group];
+			p_b = &p_a[2U];
+
+#if( 1 == DSP_SIMD_USED )
+			memcpy( &a, p_a, 4U );
+			memcpy( &b, p_b, 4U );
+
+			c = __SHADD16( a, b );
+			d = __SHSUB16( a, b );
+
+			memcpy( p_a, &c, 4U );
+			memcpy( p_b, &d, 4U );
+#else
+			t0r = ( (long) p_a[0] + p_b[0] ) >> 1;
+			t0i = ( (long) p_a[1] + p_b[1] ) >> 1;
+			t1r = ( (long) p_a[0] - p_b[0] ) >> 1;
+			t1i = ( (long) p_a[1] - p_b[1] ) >> 1;
+
+			p_a[0] = static_cast<short>( t0r );
+			p_a[1] = static_cast<short>( t0i );
+			p_b[0] = static_cast<short>( t1r );
+			p_b[1] = static_cast<short>( t1i );
+#endif
+		}
+	}
+	else{	/* Not required */	}
+
+	/*
+	 * Spectrum leaves stages in bit reversed order, reversal of index
+	 * times step over all bits is reversal of index over its own bits
+	 */
+	step = static_cast<unsigned short>( DSP_FFT_MAX_POINTS / points );
+	for( group = 0; group < points; ++group )
+	{
+		swap = sg_reverse.value[group * step];
+
+		if( swap > group )
+		{
+			for( index = 0; index < 2U; ++index )
+			{
+				value = p_data[(2U * group) + index];
+				p_data[(2U * group) + index] = p_data[(2U * swap) + index];
+				p_data[(2U * swap) + index] = value;
+			}
+		}
+		else{	/* Not required */	}
+	}
+
+	return points;
+}
+
+
+/**
+ * @function	fft_q31
+ *
+ * @brief		In place mixed radix-4/2 FFT of Q31 complex samples
+ *
+ * \par<b>Description:</b><br>
+ * 				Same stage, twiddle and output order as fft_q15()
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::fft_q31( long * const p_data, const unsigned short points )
+{
+	/* Local Variables */
+	long * p_a = nullptr;
+	long * p_b = nullptr;
+	long * p_c = nullptr;
+	long * p_d = nullptr;
+	long long t0r = 0;
+	long long t0i = 0;
+	long long t1r = 0;
+	long long t1i = 0;
+	long long t2r = 0;
+	long long t2i = 0;
+	long long t3r = 0;
+	long long t3i = 0;
+	long cosine[3] = { 0 };
+	long sine[3] = { 0 };
+	unsigned long twiddle = 0;
+	unsigned short span = 0;
+	unsigned short quarter = 0;
+	unsigned short step = 0;
+	unsigned short k = 0;
+	unsigned short group = 0;
+	unsigned short swap = 0;
+	long value = 0;
+	unsigned char index = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_data) || (false == is_fft_size(points))), 0U );
+
+	for( span = points; span >= 4U; span = span >> 2 )
+	{
+		quarter = span >> 2;
+		step = static_cast<unsigned short>( DSP_FFT_MAX_POINTS / span );
+
+		for( k = 0; k < quarter; ++k )
+		{
+			/* W^k, W^2k, W^3k as cos - j sin */
+			for( index = 0; index < 3U; ++index )
+			{
+				twiddle = (unsigned long) (index + 1U) * k * step;
+				cosine[index] = sg_sine_q31.value[(twiddle + DSP_FFT_QUARTER) & DSP_FFT_MASK];
+				sine[index] = sg_sine_q31.value[twiddle];
+			}
+
+			for( group = k; group < points; group = group + span )
+			{
+				p_a = &p_data[2U * group];
+				p_b = &p_a[2U * quarter];
+				p_c = &p_b[2U * quarter];
+				p_d = &p_c[2U * quarter];
+
+				t0r = ( (long long) p_a[0] + p_c[0] ) >> 1;
+				t0i = ( (long long) p_a[1] + p_c[1] ) >> 1;
+				t1r = ( (long long) p_a[0] - p_c[0] ) >> 1;
+				t1i = ( (long long) p_a[1] - p_c[1] ) >> 1;
+				t2r = ( (long long) p_b[0] + p_d[0] ) >> 1;
+				t2i = ( (long long) p_b[1] + p_d[1] ) >> 1;
+				t3r = ( (long long) p_b[0] - p_d[0] ) >> 1;
+				t3i = ( (long long) p_b[1] - p_d[1] ) >> 1;
+
+				p_a[0] = static_cast<long>( (t0r + t2r) >> 1 );
+				p_a[1] = static_cast<long>( (t0i + t2i) >> 1 );
+				rotate_q31( p_b, (t0r - t2r) >> 1, (t0i - t2i) >> 1, cosine[1], sine[1] );
+				rotate_q31( p_c, (t1r + t3i) >> 1, (t1i - t3r) >> 1, cosine[0], sine[0] );
+				rotate_q31( p_d, (t1r - t3i) >> 1, (t1i + t3r) >> 1, cosine[2], sine[2] );
+			}
+		}
+	}
+
+	/* Radix-2 stage of pairs, twiddle is 1 */
+	if( 2U == span )
+	{
+		for( group = 0; group < points; group = group + 2U )
+		{
+			p_a = &p_data[2U * group];
+			p_b = &p_a[2U];
+
+			t0r = ( (long long) p_a[0] + p_b[0] ) >> 1;
+			t0i = ( (long long) p_a[1] + p_b[1] ) >> 1;
+			t1r = ( (long long) p_a[0] - p_b[0] ) >> 1;
+			t1i = ( (long long) p_a[1] - p_b[1] ) >> 1;
+
+			p_a[0] = static_cast<long>( t0r );
+			p_a[1] = static_cast<long>( t0i );
+			p_b[0] = static_cast<long>( t1r );
+			p_b[1] = static_cast<long>( t1i );
+		}
+	}
+	else{	/* Not required */	}
+
+	/*
+	 * Spectrum leaves stages in bit reversed order, reversal of index
+	 * times step over all bits is reversal of index over its own bits
+	 */
+	step = static_cast<unsigned short>( DSP_FFT_MAX_POINTS / points );
+	for( group = 0; group < points; ++group )
+	{
+		swap = sg_reverse.value[group * step];
+
+		if( swap > group )
+		{
+			for( index = 0; index < 2U; ++index )
+			{
+				value = p_data[(2U * group) + index];
+				p_data[(2U * group) + index] = p_data[(2U * swap) + index];
+				p_data[(2U * swap) + index] = value;
+			}
+		}
+		else{	/* Not required */	}
+	}
+
+	return points;
+}
+
+
+/**
+ * @function	load_q15
+ *
+ * @brief		Load real Q15 samples as complex FFT input
+ *
+ * \par<b>Description:</b><br>
+ * 				Hann window is 0.5 - 0.5 cos(2 pi n / points). Samples are
+ * 				expanded from last one so that p_out may be same as p_in.
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::load_q15( const short * const p_in, const unsigned short points,
+								const bool window, short * const p_out )
+{
+	/* Local Variables */
+	const unsigned short step = static_cast<unsigned short>( DSP_FFT_MAX_POINTS / ((0U == points) ? 1U : points) );
+	long sample = 0;
+	unsigned short index = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_in) || (nullptr == p_out)), 0U );
+	DRIVER_ASSERT( (false == is_fft_size(points)), 0U );
+
+	for( index = points; index > 0U; --index )
+	{
+		sample = p_in[index - 1U];
+
+		if( true == window )
+		{
+			sample = ( sample * ((32767L - sg_sine_q15.value[(((index - 1U) * step) + DSP_FFT_QUARTER) & DSP_FFT_MASK]) >> 1) ) >> 15;
+		}
+		else{	/* Not required */	}
+
+		p_out[(2U * index) - 1U] = 0;
+		p_out[(2U * index) - 2U] = static_cast<short>( sample );
+	}
+
+	return points;
+}
+
+
+/**
+ * @function	load_adc_q15
+ *
+ * @brief		Load one channel of an ADC sample block as complex FFT input
+ *
+ * \par<b>Description:</b><br>
+ * 				Offset binary result is made signed and shifted up to Q15
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::load_adc_q15( const unsigned short * const p_in, const unsigned char stride,
+									const unsigned short points, const bool window,
+									short * const p_out )
+{
+	/* Local Variables */
+	const unsigned short step = static_cast<unsigned short>( DSP_FFT_MAX_POINTS / ((0U == points) ? 1U : points) );
+	long sample = 0;
+	unsigned short index = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_in) || (nullptr == p_out) || (0U == stride)), 0U );
+	DRIVER_ASSERT( (false == is_fft_size(points)), 0U );
+
+	for( index = 0; index < points; ++index )
+	{
+		sample = ( (long) p_in[(unsigned long) index * stride] - DSP_ADC_OFFSET ) * ( 1L << (16U - DSP_ADC_BITS) );
+
+		if( true == window )
+		{
+			sample = ( sample * ((32767L - sg_sine_q15.value[((index * step) + DSP_FFT_QUARTER) & DSP_FFT_MASK]) >> 1) ) >> 15;
+		}
+		else{	/* Not required */	}
+
+		p_out[2U * index] = static_cast<short>( sample );
+		p_out[(2U * index) + 1U] = 0;
+	}
+
+	return points;
+}
+
+
+/**
+ * @function	load_q31
+ *
+ * @brief		Load real Q31 samples as complex FFT input
+ *
+ * \par<b>Description:</b><br>
+ * 				Samples are expanded from last one so that p_out may be
+ * 				same as p_in
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::load_q31( const long * const p_in, const unsigned short points,
+								const bool window, long * const p_out )
+{
+	/* Local Variables */
+	const unsigned short step = static_cast<unsigned short>( DSP_FFT_MAX_POINTS / ((0U == points) ? 1U : points) );
+	long long sample = 0;
+	unsigned short index = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_in) || (nullptr == p_out)), 0U );
+	DRIVER_ASSERT( (false == is_fft_size(points)), 0U );
+
+	for( index = points; index > 0U; --index )
+	{
+		sample = p_in[index - 1U];
+
+		if( true == window )
+		{
+			sample = ( sample * ((2147483647LL - sg_sine_q31.value[(((index - 1U) * step) + DSP_FFT_QUARTER) & DSP_FFT_MASK]) >> 1) ) >> 31;
+		}
+		else{	/* Not required */	}
+
+		p_out[(2U * index) - 1U] = 0;
+		p_out[(2U * index) - 2U] = static_cast<long>( sample );
+	}
+
+	return points;
+}
+
+
+/**
+ * @function	magnitude_q15
+ *
+ * @brief		Magnitude of Q15 complex samples
+ *
+ * \par<b>Description:</b><br>
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::magnitude_q15( const short * const p_in, const unsigned short count,
+										short * const p_out )
+{
+	/* Local Variables */
+	unsigned long root = 0;
+	unsigned short index = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_in) || (nullptr == p_out)), 0U );
+
+	for( index = 0; index < count; ++index )
+	{
+		root = square_root( ((long long) p_in[2U * index] * p_in[2U * index]) +
+							((long long) p_in[(2U * index) + 1U] * p_in[(2U * index) + 1U]) );
+		p_out[index] = static_cast<short>( (root > 32767U) ? 32767U : root );
+	}
+
+	return count;
+}
+
+
+/**
+ * @function	magnitude_q31
+ *
+ * @brief		Magnitude of Q31 complex samples
+ *
+ * \par<b>Description:</b><br>
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned short DSP__::magnitude_q31( const long * const p_in, const unsigned short count,
+										long * const p_out )
+{
+	/* Local Variables */
+	unsigned long root = 0;
+	unsigned short index = 0;
+
+	/* Check input arguments */
+	DRIVER_ASSERT( ((nullptr == p_in) || (nullptr == p_out)), 0U );
+
+	for( index = 0; index < count; ++index )
+	{
+		root = square_root( (unsigned long long) ((long long) p_in[2U * index] * p_in[2U * index]) +
+							(unsigned long long) ((long long) p_in[(2U * index) + 1U] * p_in[(2U * index) + 1U]) );
+		p_out[index] = static_cast<long>( (root > 2147483647UL) ? 2147483647UL : root );
+	}
+
+	return count;
+}
+
+
+/******* Private Member function for DSP__ class *******/
+
+/**
+ * @function	is_fft_size
+ *
+ * @brief		Check FFT size
+ *
+ * \par<b>Description:</b><br>
+ * 				Power of 2, radix-4 stages with one radix-2 stage for odd
+ * 				log2(points)
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+bool DSP__::is_fft_size( const unsigned short points )
+{
+	return ( (16U <= points) && (DSP_FFT_MAX_POINTS >= points) &&
+			 (0U == (points & (points - 1U))) );
+}
+
+
+/**
+ * @function	square_root
+ *
+ * @brief		Integer square root, rounded down
+ *
+ * \par<b>Description:</b><br>
+ * 				One result bit per step, no division
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned long DSP__::square_root( unsigned long long value )
+{
+	/* Local Variables */
+	unsigned long long root = 0;
+	unsigned long long bit = 1ULL << 62;
+
+	while( bit > value )
+	{
+		bit = bit >> 2;
+	}
+
+	while( 0U != bit )
+	{
+		if( value >= (root + bit) )
+		{
+			value = value - (root + bit);
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root = root >> 1;
+		}
+
+		bit = bit >> 2;
+	}
+
+	return static_cast<unsigned long>( root );
+}
+
+
+#if( 1 == DSP_SIMD_USED )
+/**
+ * @function	rotate_q15
+ *
+ * @brief		Multiply packed complex sample by packed twiddle
+ *
+ * \par<b>Description:</b><br>
+ * 				(re + j im)(cos - j sin), real part by SMUAD and imaginary
+ * 				part by SMUSDX
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned long DSP__::rotate_q15( const unsigned long sample, const unsigned long twiddle )
+{
+	/* Sums are signed 32 bit, also where long is wider */
+	const long real = static_cast<long>( static_cast<int32_t>( __SMUAD( sample, twiddle ) ) ) >> 15;
+	const long imag = static_cast<long>( static_cast<int32_t>( __SMUSDX( twiddle, sample ) ) ) >> 15;
+
+	return __PKHBT( __SSAT( real, 16 ), __SSAT( imag, 16 ), 16 );
+}
+#else
+/**
+ * @function	rotate_q15
+ *
+ * @brief		Multiply complex sample by twiddle
+ *
+ * \par<b>Description:</b><br>
+ * 				Same products and rounding as dual MAC path
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void DSP__::rotate_q15( short * const p_out, const long real, const long imag,
+						const short cosine, const short sine )
+{
+	p_out[0] = saturate_q15( ((real * cosine) + (imag * sine)) >> 15 );
+	p_out[1] = saturate_q15( ((imag * cosine) - (real * sine)) >> 15 );
+}
+#endif
+
+
+/**
+ * @function	rotate_q31
+ *
+ * @brief		Multiply complex sample by twiddle
+ *
+ * \par<b>Description:</b><br>
+ * 				Products are summed in 64 bit
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void DSP__::rotate_q31( long * const p_out, const long long real, const long long imag,
+						const long cosine, const long sine )
+{
+	p_out[0] = saturate_q31( ((real * cosine) + (imag * sine)) >> 31 );
+	p_out[1] = saturate_q31( ((imag * cosine) - (real * sine)) >> 31 );
+}
+
+#endif	/* DSP_USED */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,152 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Gateway data types Header
+* Filename:		mid_gateway_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_gateway_types.h
+ *  @brief:	This file contains data types definitions for CAN and UART
+ *  		gateway routing engine
+ */
+#ifndef MID_GATEWAY_TYPES_H_
+#define MID_GATEWAY_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+/* Include private headers first */
+#include <private/mid_gateway_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+#include <dri_can_types.h>
+#include <dri_uart_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Route keeps identifier of frame */
+#define GATEWAY_NO_REWRITE			0xFFFFFFFFUL
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of Gateway
+ * */
+enum class eGateway_Status_/*	:	unsigned char	*/
+{
+	GATEWAY_STATUS_SUCCESS = 0,
+	GATEWAY_STATUS_FAILED,
+	GATEWAY_STATUS_INVALID_ARGUMENT
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eGateway_Init_/*	:	unsigned char	*/
+{
+	GATEWAY_INIT_CLOSE = 0,
+	GATEWAY_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for gateway ports, CAN ports first and UART ports after them
+ * */
+enum class eGateway_Port_	:	unsigned char
+{
+	GATEWAY_PORT_CAN_0 = 0,
+	GATEWAY_PORT_CAN_1,
+	GATEWAY_PORT_UART_0,
+	GATEWAY_PORT_LOCAL			/**< Local protocol stack, follows UART ports */
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for Gateway
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	Structure for one route
+ *
+ * <i>Imp Note:</i>
+ * 			Every route matching a frame forwards it, a frame can be sent to
+ * 			several destinations. Rewritten identifier is
+ * 			rewrite + ( id - id_first )
+ */
+typedef struct tStGateway_Route_
+{
+	eGateway_Port_ source;			/**< Port frames are taken from */
+	eGateway_Port_ destination;		/**< Port frames are sent to */
+	unsigned char extended;			/**< 1 - 29 bit identifiers */
+	unsigned long id_first;			/**< First identifier of range */
+	unsigned long id_last;			/**< Last identifier of range */
+	unsigned long rewrite;			/**< First identifier on destination, GATEWAY_NO_REWRITE - keep */
+	unsigned short rate_limit;		/**< Frames per rate window, 0 - unlimited */
+} tStGateway_Route;
+
+/*
+ * @brief	Structure for counters of one route
+ */
+typedef struct tStGateway_Counters_
+{
+	unsigned long forwarded = 0U;		/**< Frames handed to destination */
+	unsigned long rate_dropped = 0U;	/**< Frames above rate limit */
+	unsigned long busy_dropped = 0U;	/**< Frames refused by destination */
+	unsigned long long latency_max = 0U;	/**< Worst receive to forward time, CLOCK__ cycles */
+} tStGateway_Counters;
+
+/*
+ * @brief	Structure for UART port
+ */
+typedef struct tStGateway_UartPort_
+{
+	unsigned char object;			/**< Index in g_p_uart_obj */
+	eUART_Channel_ channel;			/**< Channel reported to callback handler */
+} tStGateway_UartPort;
+
+/*
+ * @brief	Structure for UART port control
+ */
+typedef struct tStGateway_UartControl_
+{
+	unsigned char tx_buffer[2][GATEWAY_UART_BUFFER];	/**< One buffer on the wire, one collecting */
+	unsigned short tx_fill = 0U;						/**< Bytes in collecting buffer */
+	unsigned char tx_active = 0U;						/**< Collecting buffer */
+	unsigned char rx_record[GATEWAY_RECORD_SIZE];		/**< Record being received */
+	unsigned char rx_kept = 0U;							/**< Bytes kept after resynchronization */
+	volatile unsigned char rx_ready = 0U;				/**< Record complete, set by UART callback */
+	unsigned long rx_errors = 0U;						/**< Records with wrong sync or checksum */
+} tStGateway_UartControl;
+
+
+#endif /* MID_GATEWAY_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,107 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Gateway Configuration Header
+* Filename:		mid_gateway_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_gateway_conf.h
+ *  @brief:	This file contains static configurations for CAN and UART
+ *  		gateway routing engine
+ */
+#ifndef MID_GATEWAY_CONF_H_
+#define MID_GATEWAY_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+#define GATEWAY_MAX_ROUTES			16
+
+/* Total routes used in system, routes are described in mid_gateway_conf.cpp */
+#define GATEWAY_ROUTES_USED			8
+
+/* Ports 0 to n-1 are CAN objects g_p_can_obj[0 to n-1] */
+#define GATEWAY_CAN_PORTS			2
+
+/* Ports following CAN ports are UART channels of UART port table */
+#define GATEWAY_UART_PORTS			1
+
+/* Last port is local protocol stack (ISO-TP), 1 - used */
+#define GATEWAY_LOCAL_USED			1
+
+/* Frames taken from one CAN node per run, bounds time spent in deferred context */
+#define GATEWAY_FRAMES_PER_RUN		16U
+
+/* Bytes of one frame record on UART */
+#define GATEWAY_RECORD_SIZE			16U
+
+/* First byte of frame record */
+#define GATEWAY_RECORD_SYNC			0xA5U
+
+/* Bytes collected per UART transmission, two buffers per port */
+#define GATEWAY_UART_BUFFER			( 8U * GATEWAY_RECORD_SIZE )
+
+/* Ticks of tick() in one rate limit window */
+#define GATEWAY_RATE_WINDOW			100U
+
+/* Deferred context, software triggered node of unused CAN service request 7 */
+#define GATEWAY_IRQ_NUM				83
+#define GATEWAY_IRQ_PRIORITY		63
+
+
+/* Check routes availability */
+#if (GATEWAY_ROUTES_USED > GATEWAY_MAX_ROUTES)
+	#error	"Cannot instantiate more than available routes"
+#endif
+
+/* Check UART buffer */
+#if ( 0 != (GATEWAY_UART_BUFFER % GATEWAY_RECORD_SIZE) )
+	#error	"Gateway UART buffer must hold whole records"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Defining function for deferred context handler */
+#define GATEWAY_HANDLER				IRQ_Hdlr_83		/* CAN SR7 */
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* MID_GATEWAY_CONF_H_ */
+
+/********************************** End of File ******************************/
@@ -0,0 +1,183 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Gateway Configuration Source
+* Filename:		mid_gateway_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	mid_gateway_conf.cpp
+ *  @brief:	This source file contains route table and deferred context
+ *  		handler of gateway
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_gateway.h>
+#include <mid_isotp.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check routes usage in system */
+#if( GATEWAY_ROUTES_USED > 0 )
+
+#if( GATEWAY_UART_PORTS > 0 )
+/*
+ * @brief	UART port table, entry n is port GATEWAY_CAN_PORTS + n
+ */
+const tStGateway_UartPort g_gateway_uart_ports[GATEWAY_UART_PORTS] =
+{
+		{/**< UART port 0 on UART Channel 2 */
+				1U, eUART_Channel_::UART_CHANNEL_2
+		}
+};
+#endif
+
+/*
+ * @brief	Route table of gateway
+ *
+ * <i>Imp Note:</i>
+ * 			CAN sources only see frames accepted by filter table of their
+ * 			node in dri_can_conf.cpp
+ */
+const tStGateway_Route g_gateway_routes[GATEWAY_ROUTES_USED] =
+{
+		{/**< Route 0, process data from node 0 to node 1 */
+				eGateway_Port_::GATEWAY_PORT_CAN_0, eGateway_Port_::GATEWAY_PORT_CAN_1, 0U,
+				0x100U, 0x10FU, GATEWAY_NO_REWRITE, 0U
+		},
+		{/**< Route 1, sensor data from node 1 to node 0 as 0x300 - 0x3FF, 500 frames/s */
+				eGateway_Port_::GATEWAY_PORT_CAN_1, eGateway_Port_::GATEWAY_PORT_CAN_0, 0U,
+				0x200U, 0x2FFU, 0x300U, 50U
+		},
+		{/**< Route 2, diagnostic requests seen on node 0 to UART */
+				eGateway_Port_::GATEWAY_PORT_CAN_0, eGateway_Port_::GATEWAY_PORT_UART_0, 0U,
+				0x7E0U, 0x7E7U, GATEWAY_NO_REWRITE, 0U
+		},
+		{/**< Route 3, diagnostic responses seen on node 1 to UART */
+				eGateway_Port_::GATEWAY_PORT_CAN_1, eGateway_Port_::GATEWAY_PORT_UART_0, 0U,
+				0x7E8U, 0x7EFU, GATEWAY_NO_REWRITE, 0U
+		},
+		{/**< Route 4, diagnostic requests from UART tester to node 1 */
+				eGateway_Port_::GATEWAY_PORT_UART_0, eGateway_Port_::GATEWAY_PORT_CAN_1, 0U,
+				0x7E0U, 0x7E7U, GATEWAY_NO_REWRITE, 0U
+		},
+		{/**< Route 5, extended physical requests on node 0 to UART, 200 frames/s */
+				eGateway_Port_::GATEWAY_PORT_CAN_0, eGateway_Port_::GATEWAY_PORT_UART_0, 1U,
+				0x18DAF100U, 0x18DAF1FFU, GATEWAY_NO_REWRITE, 20U
+		},
+		{/**< Route 6, diagnostic requests to this device on node 0 */
+				eGateway_Port_::GATEWAY_PORT_CAN_0, eGateway_Port_::GATEWAY_PORT_LOCAL, 0U,
+				0x7E0U, 0x7E0U, GATEWAY_NO_REWRITE, 0U
+		},
+		{/**< Route 7, extended diagnostic requests to this device on node 0 */
+				eGateway_Port_::GATEWAY_PORT_CAN_0, eGateway_Port_::GATEWAY_PORT_LOCAL, 1U,
+				0x18DAF110U, 0x18DAF110U, GATEWAY_NO_REWRITE, 0U
+		}
+};
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+#if( 1 == GATEWAY_LOCAL_USED )
+/**
+ * @function	gateway_local_input
+ *
+ * @brief		Hand routed frame to ISO-TP
+ *
+ * @param[in]	source	-	port of frame, CAN ports are CAN objects
+ * @param[in]	frame	-	routed frame
+ *
+ * @return		true if a session took the frame
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+bool gateway_local_input( const eGateway_Port_ source, const tStCAN_Frame& frame )
+{
+	return ISOTP__::input( static_cast<unsigned char>(source), frame );
+}
+
+
+/**
+ * @function	gateway_local_run
+ *
+ * @brief		Serve ISO-TP timing in each run of gateway
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void gateway_local_run( void )
+{
+	ISOTP__::run();
+}
+#endif	/* GATEWAY_LOCAL_USED */
+
+
+/******* ISR Handler for Gateway__ *******/
+
+extern "C"
+{
+
+#ifdef GATEWAY_HANDLER
+/**
+ * @function	GATEWAY_HANDLER
+ *
+ * @brief		Gateway deferred context handler
+ *
+ * <i>Imp Note:</i>
+ * 				Pended by software only, no CAN object uses its service request
+ *
+ */
+void GATEWAY_HANDLER( void )
+{
+	/* Call ISR entry function */
+	Gateway__::isr_entry();
+}
+#endif	/* GATEWAY_HANDLER */
+
+
+}	/* extern "C"{ */
+
+#endif	/* GATEWAY_ROUTES_USED */
+
+
+/*********************************** End of File ******************************/
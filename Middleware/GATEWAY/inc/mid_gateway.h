@@ -0,0 +1,212 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Gateway API Header
+* Filename:		mid_gateway.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_gateway.h
+ *  @brief:	This file contains API function declarations for CAN and UART
+ *  		gateway routing engine
+ */
+#ifndef MID_GATEWAY_H_
+#define MID_GATEWAY_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_gateway_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+#if( GATEWAY_ROUTES_USED > 0 )
+extern const tStGateway_Route g_gateway_routes[GATEWAY_ROUTES_USED];
+#endif
+
+#if( GATEWAY_UART_PORTS > 0 )
+extern const tStGateway_UartPort g_gateway_uart_ports[GATEWAY_UART_PORTS];
+#endif
+
+/* Local port hooks, called from deferred context */
+#if( 1 == GATEWAY_LOCAL_USED )
+extern bool gateway_local_input( const eGateway_Port_ source, const tStCAN_Frame& frame );
+extern void gateway_local_run( void );
+#endif
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for gateway routing engine
+ *
+ * 			Frames are taken from CAN receive queues and UART records and are
+ * 			forwarded by route table in a low priority interrupt, so receive
+ * 			interrupts only queue and never copy between ports.
+ *
+ ******************************************************************************/
+
+/* Check routes usage in system */
+#if( GATEWAY_ROUTES_USED > 0 )
+
+class Gateway__
+{
+/* public members */
+public:
+	/* Constructors */
+	Gateway__() = delete;
+	Gateway__( Gateway__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for gateway
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eGateway_Init_	-	GATEWAY_INIT_OPEN
+	 * 												GATEWAY_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eGateway_Status_
+	 *          	GATEWAY_STATUS_SUCCESS:				Operation successful.<BR>
+	 *          	GATEWAY_STATUS_INVALID_ARGUMENT:	Route uses unknown port.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function checks route table, arms record reception on
+	 * 				UART ports and enables the deferred context interrupt
+	 *
+	 * <i>Imp Note:</i>
+	 * 				CAN nodes and UART channels have to be initialized first.
+	 * 				Gateway becomes the only reader of CAN receive queues
+	 *
+	 */
+	static eGateway_Status_ init( const eGateway_Init_& init = eGateway_Init_::GATEWAY_INIT_OPEN );
+
+	/**
+	 * @function	tick
+	 *
+	 * @brief		Time base of gateway
+	 *
+	 * @param[in]	ticks	-	ticks passed since previous call
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function advances rate limit windows and requests a
+	 * 				run of deferred context
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from SysTick
+	 *
+	 */
+	static void tick( const unsigned long ticks );
+
+	/**
+	 * @function	uart_event
+	 *
+	 * @brief		UART callback hook
+	 *
+	 * @param[in]	channel	-	UART channel of event
+	 * @param[in]	event	-	UART event
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function marks a received record of a UART port and
+	 * 				requests a run of deferred context
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from uart_callback_handler
+	 *
+	 */
+	static void uart_event( const eUART_Channel_& channel, const eUART_Event_& event );
+
+	/******* Setters and Getters *******/
+	/* Counters of route */
+	static const tStGateway_Counters& get_counters( const unsigned char route ) { return counters[route]; }
+	/* Frames matched by no route */
+	static unsigned long get_unrouted( void ) { return unrouted; }
+	/* Worst receive to forward time over all routes, CLOCK__ cycles */
+	static unsigned long long get_latency_max( void );
+	#if( GATEWAY_UART_PORTS > 0 )
+	/* Rejected records of UART port */
+	static unsigned long get_uart_errors( const unsigned char port ) { return uart[port].rx_errors; }
+	#endif
+
+	/* ISR entry function for deferred context */
+	static void isr_entry( void )
+	{
+		run();
+	}
+
+/* private members */
+private:
+	/** Data Members **/
+	static tStGateway_Counters counters[GATEWAY_ROUTES_USED];
+	static unsigned short window_count[GATEWAY_ROUTES_USED];
+	static unsigned long window_seen;
+	static volatile unsigned long window;
+	static unsigned long unrouted;
+	static unsigned char init_state;
+	#if( GATEWAY_UART_PORTS > 0 )
+	static tStGateway_UartControl uart[GATEWAY_UART_PORTS];
+	#endif
+
+	/******* Private Member Functions *******/
+	static void run( void );
+	static void route( const tStCAN_Frame& frame, const eGateway_Port_ source );
+	static bool forward( const tStGateway_Route& route_l, const tStCAN_Frame& frame );
+	#if( GATEWAY_UART_PORTS > 0 )
+	static bool uart_append( const unsigned char port, const tStCAN_Frame& frame,
+								const eGateway_Port_ source );
+	static void uart_flush( const unsigned char port );
+	static void uart_record( const unsigned char port );
+	#endif
+};
+
+#endif	/* GATEWAY_ROUTES_USED */
+
+
+#endif /* MID_GATEWAY_H_ */
+
+/********************************** End of File *******************************/
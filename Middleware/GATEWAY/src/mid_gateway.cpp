@@ -0,0 +1,666 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Gateway API Source
+* Filename:		mid_gateway.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	mid_gateway.cpp
+ *  @brief:	This source file contains API function definitions for CAN and
+ *  		UART gateway routing engine.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_gateway.h>
+#include <dri_can_extern.h>
+#include <dri_uart_extern.h>
+#include <dri_clock.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Latency is measured against receive timestamp of CAN driver */
+#if( 1 != CAN_TIMESTAMP_USED )
+	#error	"Gateway needs CAN receive timestamps"
+#endif
+
+/* CAN ports are CAN objects */
+#if( GATEWAY_CAN_PORTS > CAN_NODES_USED )
+	#error	"Gateway CAN ports exceed CAN nodes used"
+#endif
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Total ports of gateway */
+#define GATEWAY_PORTS				( GATEWAY_CAN_PORTS + GATEWAY_UART_PORTS + GATEWAY_LOCAL_USED )
+
+/* Local port follows UART ports */
+#define GATEWAY_LOCAL_PORT			( GATEWAY_CAN_PORTS + GATEWAY_UART_PORTS )
+
+/* Frame record on UART
+ * 0 sync, 1 extended flag (bit 7) and dlc, 2-5 identifier little endian,
+ * 6-13 data, 14 source port, 15 checksum making byte sum zero */
+#define GATEWAY_RECORD_FLAGS		1U
+#define GATEWAY_RECORD_ID			2U
+#define GATEWAY_RECORD_DATA			6U
+#define GATEWAY_RECORD_PORT			14U
+#define GATEWAY_RECORD_CHECKSUM		15U
+#define GATEWAY_RECORD_EXTENDED		0x80U
+#define GATEWAY_RECORD_DLC			0x0FU
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Check routes usage in system */
+#if( GATEWAY_ROUTES_USED > 0 )
+
+/* Static members of Gateway__ */
+tStGateway_Counters Gateway__::counters[GATEWAY_ROUTES_USED];
+unsigned short Gateway__::window_count[GATEWAY_ROUTES_USED] = { 0U };
+unsigned long Gateway__::window_seen = 0U;
+volatile unsigned long Gateway__::window = 0U;
+unsigned long Gateway__::unrouted = 0U;
+unsigned char Gateway__::init_state = 0U;
+#if( GATEWAY_UART_PORTS > 0 )
+tStGateway_UartControl Gateway__::uart[GATEWAY_UART_PORTS];
+#endif
+
+
+/******* Public Member function for Gateway__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for gateway
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eGateway_Status_ Gateway__::init( const eGateway_Init_& init )
+{
+	/* Local Variables */
+	eGateway_Status_ ret_status = eGateway_Status_::GATEWAY_STATUS_FAILED;
+	unsigned char index_l = 0U;
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open gateway */
+		case eGateway_Init_::GATEWAY_INIT_OPEN:
+			/* Check for initialization */
+			if( init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			/* Check route table */
+			for( index_l = 0U; index_l < GATEWAY_ROUTES_USED; ++index_l )
+			{
+				if( (static_cast<unsigned char>(g_gateway_routes[index_l].source) >= GATEWAY_PORTS) ||
+					(static_cast<unsigned char>(g_gateway_routes[index_l].destination) >= GATEWAY_PORTS) ||
+					(g_gateway_routes[index_l].id_first > g_gateway_routes[index_l].id_last) )
+				{
+					return eGateway_Status_::GATEWAY_STATUS_INVALID_ARGUMENT;
+				}
+				else{	/* Not required */	}
+
+				counters[index_l] = tStGateway_Counters();
+				window_count[index_l] = 0U;
+			}
+			unrouted = 0U;
+			window_seen = window;
+
+			#if( GATEWAY_UART_PORTS > 0 )
+			/* Arm record reception */
+			for( index_l = 0U; index_l < GATEWAY_UART_PORTS; ++index_l )
+			{
+				uart[index_l].tx_fill = 0U;
+				uart[index_l].rx_kept = 0U;
+				uart[index_l].rx_ready = 0U;
+				uart[index_l].rx_errors = 0U;
+
+				(void) g_p_uart_obj[g_gateway_uart_ports[index_l].object]->receive(
+								uart[index_l].rx_record, GATEWAY_RECORD_SIZE );
+			}
+			#endif
+
+			/* Deferred context runs below every driver interrupt */
+			NVIC_ClearPendingIRQ( static_cast<IRQn_Type>(GATEWAY_IRQ_NUM) );
+			NVIC_SetPriority( static_cast<IRQn_Type>(GATEWAY_IRQ_NUM),
+								NVIC_EncodePriority(NVIC_GetPriorityGrouping(),
+								GATEWAY_IRQ_PRIORITY,
+								0U)
+							);
+			NVIC_EnableIRQ( static_cast<IRQn_Type>(GATEWAY_IRQ_NUM) );
+
+			/* Update initialization state */
+			init_state = 1U;
+			/* Update return status */
+			ret_status = eGateway_Status_::GATEWAY_STATUS_SUCCESS;
+			break;
+
+		/* Close gateway */
+		case eGateway_Init_::GATEWAY_INIT_CLOSE:
+			NVIC_DisableIRQ( static_cast<IRQn_Type>(GATEWAY_IRQ_NUM) );
+
+			#if( GATEWAY_UART_PORTS > 0 )
+			for( index_l = 0U; index_l < GATEWAY_UART_PORTS; ++index_l )
+			{
+				(void) g_p_uart_obj[g_gateway_uart_ports[index_l].object]->abort(
+								eUART_Abort_::UART_ABORT_RX );
+			}
+			#endif
+
+			/* Reset initialization state */
+			init_state = 0U;
+			/* Update return status */
+			ret_status = eGateway_Status_::GATEWAY_STATUS_SUCCESS;
+			break;
+
+		/* Default parameters, invalid argument */
+		default:
+			/* Update return status */
+			ret_status = eGateway_Status_::GATEWAY_STATUS_INVALID_ARGUMENT;
+			break;
+	}
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/**
+ * @function	tick
+ *
+ * @brief		Time base of gateway
+ *
+ * <i>Imp Note:</i>
+ * 				Window number is only written here, deferred context resets
+ * 				its own counts when it sees a new window
+ *
+ */
+void Gateway__::tick( const unsigned long ticks )
+{
+	/* Local Variables */
+	static unsigned long window_ticks = 0U;
+
+	window_ticks += ticks;
+	if( window_ticks >= GATEWAY_RATE_WINDOW )
+	{
+		window = window + ( window_ticks / GATEWAY_RATE_WINDOW );
+		window_ticks %= GATEWAY_RATE_WINDOW;
+	}
+	else{	/* Not required */	}
+
+	if( 0U != init_state )
+	{
+		NVIC_SetPendingIRQ( static_cast<IRQn_Type>(GATEWAY_IRQ_NUM) );
+	}
+	else{	/* Not required */	}
+}
+
+
+/**
+ * @function	uart_event
+ *
+ * @brief		UART callback hook
+ *
+ * <i>Imp Note:</i>
+ * 				Runs in UART receive interrupt, record is checked later
+ *
+ */
+void Gateway__::uart_event( const eUART_Channel_& channel, const eUART_Event_& event )
+{
+	#if( GATEWAY_UART_PORTS > 0 )
+	/* Local Variables */
+	unsigned char port_l = 0U;
+
+	if( (0U == init_state) || (eUART_Event_::UART_EVENT_RX_COMPLETE != event) ){ return; }
+	else{	/* Not required */	}
+
+	for( port_l = 0U; port_l < GATEWAY_UART_PORTS; ++port_l )
+	{
+		if( channel == g_gateway_uart_ports[port_l].channel )
+		{
+			uart[port_l].rx_ready = 1U;
+			NVIC_SetPendingIRQ( static_cast<IRQn_Type>(GATEWAY_IRQ_NUM) );
+		}
+		else{	/* Not required */	}
+	}
+	#else
+	(void) channel;
+	(void) event;
+	#endif
+}
+
+
+/**
+ * @function	get_latency_max
+ *
+ * @brief		Worst receive to forward time over all routes
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned long long Gateway__::get_latency_max( void )
+{
+	/* Local Variables */
+	unsigned long long latency_l = 0U;
+	unsigned char route_l = 0U;
+
+	for( route_l = 0U; route_l < GATEWAY_ROUTES_USED; ++route_l )
+	{
+		if( counters[route_l].latency_max > latency_l )
+		{
+			latency_l = counters[route_l].latency_max;
+		}
+		else{	/* Not required */	}
+	}
+
+	return latency_l;
+}
+
+
+/******* Private Member function for Gateway__ class *******/
+
+/**
+ * @function	run
+ *
+ * @brief		Deferred context of gateway
+ *
+ * <i>Imp Note:</i>
+ * 				Frames are routed straight out of CAN receive queues. Run is
+ * 				requested again when a queue still holds frames
+ *
+ */
+void Gateway__::run( void )
+{
+	/* Local Variables */
+	const tStCAN_Frame * p_frame = nullptr;
+	const unsigned long window_l = window;
+	unsigned char index_l = 0U;
+	unsigned char count_l = 0U;
+	bool again_l = false;
+
+	if( 0U == init_state ){ return; }
+	else{	/* Not required */	}
+
+	/* New rate window */
+	if( window_l != window_seen )
+	{
+		window_seen = window_l;
+		for( index_l = 0U; index_l < GATEWAY_ROUTES_USED; ++index_l )
+		{
+			window_count[index_l] = 0U;
+		}
+	}
+	else{	/* Not required */	}
+
+	#if( GATEWAY_UART_PORTS > 0 )
+	/* Records received on UART ports */
+	for( index_l = 0U; index_l < GATEWAY_UART_PORTS; ++index_l )
+	{
+		if( 0U != uart[index_l].rx_ready )
+		{
+			uart[index_l].rx_ready = 0U;
+			uart_record( index_l );
+		}
+		else{	/* Not required */	}
+	}
+	#endif
+
+	/* Frames received on CAN ports */
+	for( index_l = 0U; index_l < GATEWAY_CAN_PORTS; ++index_l )
+	{
+		for( count_l = 0U; count_l < GATEWAY_FRAMES_PER_RUN; ++count_l )
+		{
+			p_frame = g_p_can_obj[index_l]->peek();
+			if( nullptr == p_frame ){ break; }
+			else{	/* Not required */	}
+
+			route( *p_frame, static_cast<eGateway_Port_>(index_l) );
+			g_p_can_obj[index_l]->release();
+		}
+
+		if( g_p_can_obj[index_l]->get_pending() > 0U )
+		{
+			again_l = true;
+		}
+		else{	/* Not required */	}
+	}
+
+	#if( 1 == GATEWAY_LOCAL_USED )
+	/* Timeouts and pending frames of local stack */
+	gateway_local_run();
+	#endif
+
+	#if( GATEWAY_UART_PORTS > 0 )
+	/* Start collected UART transmissions */
+	for( index_l = 0U; index_l < GATEWAY_UART_PORTS; ++index_l )
+	{
+		uart_flush( index_l );
+	}
+	#endif
+
+	/* Let other interrupts in before remaining frames are served */
+	if( true == again_l )
+	{
+		NVIC_SetPendingIRQ( static_cast<IRQn_Type>(GATEWAY_IRQ_NUM) );
+	}
+	else{	/* Not required */	}
+}
+
+
+/**
+ * @function	route
+ *
+ * @brief		Forward frame by every matching route
+ *
+ * @param[in]	frame	-	received frame
+ * @param[in]	source	-	port of frame
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void Gateway__::route( const tStCAN_Frame& frame, const eGateway_Port_ source )
+{
+	/* Local Variables */
+	bool matched_l = false;
+	unsigned long long latency_l = 0U;
+	unsigned char index_l = 0U;
+
+	for( index_l = 0U; index_l < GATEWAY_ROUTES_USED; ++index_l )
+	{
+		const tStGateway_Route& route_l = g_gateway_routes[index_l];
+
+		if( (source != route_l.source) || (frame.extended != route_l.extended) ||
+			(frame.id < route_l.id_first) || (frame.id > route_l.id_last) )
+		{
+			continue;
+		}
+		else{	/* Not required */	}
+
+		matched_l = true;
+
+		/* Rate limit of route */
+		if( (route_l.rate_limit > 0U) && (window_count[index_l] >= route_l.rate_limit) )
+		{
+			++counters[index_l].rate_dropped;
+			continue;
+		}
+		else{	/* Not required */	}
+		++window_count[index_l];
+
+		if( true == forward( route_l, frame ) )
+		{
+			++counters[index_l].forwarded;
+
+			latency_l = CLOCK__::now() - frame.timestamp;
+			if( latency_l > counters[index_l].latency_max )
+			{
+				counters[index_l].latency_max = latency_l;
+			}
+			else{	/* Not required */	}
+		}
+		else
+		{
+			++counters[index_l].busy_dropped;
+		}
+	}
+
+	if( false == matched_l )
+	{
+		++unrouted;
+	}
+	else{	/* Not required */	}
+}
+
+
+/**
+ * @function	forward
+ *
+ * @brief		Hand frame to destination of route
+ *
+ * @param[in]	route_l	-	route of frame
+ * @param[in]	frame	-	received frame
+ *
+ * @return		true if destination took the frame
+ *
+ * <i>Imp Note:</i>
+ * 				Frame is copied only when identifier is rewritten
+ *
+ */
+bool Gateway__::forward( const tStGateway_Route& route_l, const tStCAN_Frame& frame )
+{
+	/* Local Variables */
+	const unsigned char port_l = static_cast<unsigned char>( route_l.destination );
+	const tStCAN_Frame * p_out = &frame;
+	tStCAN_Frame rewritten_l;
+
+	if( GATEWAY_NO_REWRITE != route_l.rewrite )
+	{
+		rewritten_l = frame;
+		rewritten_l.id = route_l.rewrite + ( frame.id - route_l.id_first );
+		p_out = &rewritten_l;
+	}
+	else{	/* Not required */	}
+
+	if( port_l < GATEWAY_CAN_PORTS )
+	{
+		return ( eCAN_Status_::CAN_STATUS_SUCCESS == g_p_can_obj[port_l]->transmit( *p_out ) );
+	}
+	#if( 1 == GATEWAY_LOCAL_USED )
+	else if( GATEWAY_LOCAL_PORT == port_l )
+	{
+		return gateway_local_input( route_l.source, *p_out );
+	}
+	#endif
+	#if( GATEWAY_UART_PORTS > 0 )
+	else
+	{
+		return uart_append( (unsigned char)( port_l - GATEWAY_CAN_PORTS ), *p_out, route_l.source );
+	}
+	#else
+	else
+	{
+		return false;
+	}
+	#endif
+}
+
+
+#if( GATEWAY_UART_PORTS > 0 )
+
+/**
+ * @function	uart_append
+ *
+ * @brief		Encode frame record into collecting buffer of UART port
+ *
+ * @param[in]	port	-	UART port
+ * @param[in]	frame	-	frame to send
+ * @param[in]	source	-	port frame came from
+ *
+ * @return		false if collecting buffer is full
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+bool Gateway__::uart_append( const unsigned char port, const tStCAN_Frame& frame,
+								const eGateway_Port_ source )
+{
+	/* Local Variables */
+	tStGateway_UartControl& control_l = uart[port];
+	unsigned char * p_record = nullptr;
+	unsigned char sum_l = 0U;
+	unsigned char index_l = 0U;
+
+	if( (control_l.tx_fill + GATEWAY_RECORD_SIZE) > GATEWAY_UART_BUFFER ){ return false; }
+	else{	/* Not required */	}
+
+	p_record = &control_l.tx_buffer[control_l.tx_active][control_l.tx_fill];
+
+	p_record[0] = GATEWAY_RECORD_SYNC;
+	p_record[GATEWAY_RECORD_FLAGS] = (unsigned char)( ((0U != frame.extended) ? GATEWAY_RECORD_EXTENDED : 0U) |
+													(frame.dlc & GATEWAY_RECORD_DLC) );
+	for( index_l = 0U; index_l < 4U; ++index_l )
+	{
+		p_record[GATEWAY_RECORD_ID + index_l] = (unsigned char)( frame.id >> (index_l << 3U) );
+	}
+	for( index_l = 0U; index_l < 8U; ++index_l )
+	{
+		p_record[GATEWAY_RECORD_DATA + index_l] = frame.data[index_l];
+	}
+	p_record[GATEWAY_RECORD_PORT] = static_cast<unsigned char>( source );
+
+	for( index_l = 0U; index_l < GATEWAY_RECORD_CHECKSUM; ++index_l )
+	{
+		sum_l = (unsigned char)( sum_l + p_record[index_l] );
+	}
+	p_record[GATEWAY_RECORD_CHECKSUM] = (unsigned char)( 0U - sum_l );
+
+	control_l.tx_fill = (unsigned short)( control_l.tx_fill + GATEWAY_RECORD_SIZE );
+
+	return true;
+}
+
+
+/**
+ * @function	uart_flush
+ *
+ * @brief		Send collecting buffer of UART port
+ *
+ * @param[in]	port	-	UART port
+ *
+ * <i>Imp Note:</i>
+ * 				UART__ refuses a transmission while previous one is on the
+ * 				wire, so a buffer is only reused after it was sent
+ *
+ */
+void Gateway__::uart_flush( const unsigned char port )
+{
+	/* Local Variables */
+	tStGateway_UartControl& control_l = uart[port];
+	const unsigned long length_l = control_l.tx_fill;
+
+	if( 0U == length_l ){ return; }
+	else{	/* Not required */	}
+
+	if( eUART_Status_::UART_STATUS_SUCCESS ==
+		g_p_uart_obj[g_gateway_uart_ports[port].object]->transmit(
+						control_l.tx_buffer[control_l.tx_active], length_l ) )
+	{
+		control_l.tx_active ^= 1U;
+		control_l.tx_fill = 0U;
+	}
+	else{	/* Not required */	}
+}
+
+
+/**
+ * @function	uart_record
+ *
+ * @brief		Route received record of UART port and receive next one
+ *
+ * @param[in]	port	-	UART port
+ *
+ * <i>Imp Note:</i>
+ * 				A rejected record is searched for next sync byte, bytes from
+ * 				there on are kept and only the rest of record is received
+ *
+ */
+void Gateway__::uart_record( const unsigned char port )
+{
+	/* Local Variables */
+	tStGateway_UartControl& control_l = uart[port];
+	unsigned char * const p_record = control_l.rx_record;
+	tStCAN_Frame frame_l;
+	unsigned char sum_l = 0U;
+	unsigned char index_l = 0U;
+	unsigned char sync_l = 0U;
+
+	for( index_l = 0U; index_l < GATEWAY_RECORD_SIZE; ++index_l )
+	{
+		sum_l = (unsigned char)( sum_l + p_record[index_l] );
+	}
+
+	control_l.rx_kept = 0U;
+
+	if( (GATEWAY_RECORD_SYNC == p_record[0]) && (0U == sum_l) &&
+		((p_record[GATEWAY_RECORD_FLAGS] & GATEWAY_RECORD_DLC) <= 8U) )
+	{
+		frame_l.timestamp = CLOCK__::now();
+		frame_l.extended = ( 0U != (p_record[GATEWAY_RECORD_FLAGS] & GATEWAY_RECORD_EXTENDED) ) ? 1U : 0U;
+		frame_l.dlc = (unsigned char)( p_record[GATEWAY_RECORD_FLAGS] & GATEWAY_RECORD_DLC );
+		frame_l.id = 0U;
+		for( index_l = 0U; index_l < 4U; ++index_l )
+		{
+			frame_l.id |= (unsigned long) p_record[GATEWAY_RECORD_ID + index_l] << (index_l << 3U);
+		}
+		for( index_l = 0U; index_l < 8U; ++index_l )
+		{
+			frame_l.data[index_l] = p_record[GATEWAY_RECORD_DATA + index_l];
+		}
+
+		route( frame_l, static_cast<eGateway_Port_>(GATEWAY_CAN_PORTS + port) );
+	}
+	else
+	{
+		++control_l.rx_errors;
+
+		/* Resynchronize on next sync byte */
+		for( sync_l = 1U; sync_l < GATEWAY_RECORD_SIZE; ++sync_l )
+		{
+			if( GATEWAY_RECORD_SYNC == p_record[sync_l] ){ break; }
+			else{	/* Not required */	}
+		}
+		for( index_l = sync_l; index_l < GATEWAY_RECORD_SIZE; ++index_l )
+		{
+			p_record[index_l - sync_l] = p_record[index_l];
+		}
+		control_l.rx_kept = (unsigned char)( GATEWAY_RECORD_SIZE - sync_l );
+	}
+
+	(void) g_p_uart_obj[g_gateway_uart_ports[port].object]->receive(
+					&p_record[control_l.rx_kept], (unsigned long)( GATEWAY_RECORD_SIZE - control_l.rx_kept ) );
+}
+
+#endif	/* GATEWAY_UART_PORTS */
+
+#endif	/* GATEWAY_ROUTES_USED */
+
+
+/*********************************** End of File ******************************/
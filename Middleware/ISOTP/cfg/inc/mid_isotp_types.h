@@ -0,0 +1,184 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ISO-TP data types Header
+* Filename:		mid_isotp_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_isotp_types.h
+ *  @brief:	This file contains data types definitions for ISO 15765-2
+ *  		transport layer
+ */
+#ifndef MID_ISOTP_TYPES_H_
+#define MID_ISOTP_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+/* Include private headers first */
+#include <private/mid_isotp_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+#include <dri_can_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* No flow control waiting to be sent */
+#define ISOTP_FC_NONE				0xFFU
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of ISO-TP
+ * */
+enum class eISOTP_Status_/*	:	unsigned char	*/
+{
+	ISOTP_STATUS_SUCCESS = 0,
+	ISOTP_STATUS_FAILED,
+	ISOTP_STATUS_BUSY,
+	ISOTP_STATUS_INVALID_ARGUMENT
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eISOTP_Init_/*	:	unsigned char	*/
+{
+	ISOTP_INIT_CLOSE = 0,
+	ISOTP_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for result of a message
+ * */
+enum class eISOTP_Result_	:	unsigned char
+{
+	ISOTP_RESULT_OK = 0,			/**< Message sent or received */
+	ISOTP_RESULT_TIMEOUT_A,			/**< Frame not sent in time, N_As */
+	ISOTP_RESULT_TIMEOUT_BS,		/**< No flow control in time, N_Bs */
+	ISOTP_RESULT_TIMEOUT_CR,		/**< No consecutive frame in time, N_Cr */
+	ISOTP_RESULT_WRONG_SN,			/**< Consecutive frame out of order */
+	ISOTP_RESULT_OVERFLOW,			/**< Receiver has no buffer for message */
+	ISOTP_RESULT_WFT_OVERRUN,		/**< Too many wait flow controls */
+	ISOTP_RESULT_ABORTED			/**< Removed by close */
+};
+
+/*
+ * @brief	Enum for transmit side of session
+ * */
+enum class eISOTP_Tx_	:	unsigned char
+{
+	ISOTP_TX_IDLE = 0,
+	ISOTP_TX_SEND_FIRST,		/**< Single or first frame to be sent */
+	ISOTP_TX_WAIT_FC,			/**< Waiting for flow control */
+	ISOTP_TX_SEND_CF			/**< Sending consecutive frames */
+};
+
+/*
+ * @brief	Enum for receive side of session
+ * */
+enum class eISOTP_Rx_	:	unsigned char
+{
+	ISOTP_RX_IDLE = 0,
+	ISOTP_RX_RECEIVING			/**< Collecting consecutive frames */
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for ISO-TP sessions
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	typedef for transmission completion, called in deferred context
+ * */
+typedef void (*isotp_tx_callback_pointer) ( const unsigned char session, const eISOTP_Result_ result,
+											void * p_arg );
+
+/*
+ * @brief	typedef for received message, called in deferred context
+ *
+ * <i>Imp Note:</i>
+ * 			Buffer belongs to receiver until it is given back by release()
+ * */
+typedef void (*isotp_rx_callback_pointer) ( const unsigned char session, unsigned char * p_data,
+											const unsigned short length );
+
+/*
+ * @brief	Structure for static configuration of one session
+ */
+typedef struct tStISOTP_SessionConfig_
+{
+	unsigned char node;						/**< CAN object index */
+	unsigned char extended;					/**< 1 - 29 bit identifiers */
+	unsigned long rx_id;					/**< Identifier of frames received */
+	unsigned long tx_id;					/**< Identifier of frames sent */
+	unsigned char block_size;				/**< Block size announced in flow control */
+	unsigned char st_min;					/**< STmin announced in flow control, ISO coding */
+	isotp_rx_callback_pointer fp_rx;		/**< Receiver of messages */
+} tStISOTP_SessionConfig;
+
+/*
+ * @brief	Structure for state of one session
+ */
+typedef struct tStISOTP_Session_
+{
+	/* Transmit side */
+	const unsigned char * p_tx = nullptr;			/**< Caller buffer, segmented in place */
+	unsigned short tx_length = 0U;					/**< Message length */
+	unsigned short tx_offset = 0U;					/**< Bytes sent */
+	unsigned long tx_deadline = 0U;					/**< End of running timeout */
+	unsigned long tx_next_cf = 0U;					/**< Time of next consecutive frame */
+	isotp_tx_callback_pointer fp_tx = nullptr;		/**< Completion notification */
+	void * p_arg = nullptr;							/**< User context for callback */
+	volatile eISOTP_Tx_ tx_state = eISOTP_Tx_::ISOTP_TX_IDLE;
+	unsigned char tx_sn = 0U;						/**< Next sequence number */
+	unsigned char tx_block = 0U;					/**< Frames left in block, 0 - no limit */
+	unsigned char tx_block_size = 0U;				/**< Block size of receiver */
+	unsigned char tx_st_min = 0U;					/**< Separation time of receiver, ticks */
+	unsigned char tx_waits = 0U;					/**< Wait flow controls in a row */
+
+	/* Receive side */
+	unsigned char * p_rx = nullptr;					/**< Pool buffer of message */
+	unsigned short rx_length = 0U;					/**< Message length */
+	unsigned short rx_offset = 0U;					/**< Bytes received */
+	unsigned long rx_deadline = 0U;					/**< End of N_Cr */
+	eISOTP_Rx_ rx_state = eISOTP_Rx_::ISOTP_RX_IDLE;
+	unsigned char rx_sn = 0U;						/**< Expected sequence number */
+	unsigned char rx_block = 0U;					/**< Frames left until next flow control */
+	unsigned char fc_pending = ISOTP_FC_NONE;		/**< Flow status still to be sent */
+	unsigned long rx_errors = 0U;					/**< Messages given up */
+} tStISOTP_Session;
+
+
+#endif /* MID_ISOTP_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,96 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ISO-TP Configuration Header
+* Filename:		mid_isotp_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_isotp_conf.h
+ *  @brief:	This file contains static configurations for ISO 15765-2
+ *  		transport layer
+ */
+#ifndef MID_ISOTP_CONF_H_
+#define MID_ISOTP_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+#define ISOTP_MAX_SESSIONS			8
+
+/* Total sessions used in system, sessions are described in mid_isotp_conf.cpp */
+#define ISOTP_SESSIONS_USED			2
+
+/* Receive buffers shared by all sessions */
+#define ISOTP_POOL_BLOCKS			4
+
+/* Bytes of one receive buffer, longer messages are refused with overflow */
+#define ISOTP_POOL_BLOCK_SIZE		512U
+
+/* Timeouts in ticks of tick() (ms), N_As / N_Ar, N_Bs and N_Cr */
+#define ISOTP_TIMEOUT_A				1000U
+#define ISOTP_TIMEOUT_BS			1000U
+#define ISOTP_TIMEOUT_CR			1000U
+
+/* Wait flow controls accepted in a row before transmission is given up */
+#define ISOTP_MAX_WFT				8U
+
+/* Consecutive frames sent per run when receiver asks for STmin 0 */
+#define ISOTP_CF_PER_RUN			8U
+
+/* Byte filling unused data of frames, all frames are sent with 8 bytes */
+#define ISOTP_PADDING				0xCCU
+
+
+/* Check sessions availability */
+#if (ISOTP_SESSIONS_USED > ISOTP_MAX_SESSIONS)
+	#error	"Cannot instantiate more than available sessions"
+#endif
+
+/* Check pool, one bit per block */
+#if ( (ISOTP_POOL_BLOCKS > 32) || (ISOTP_POOL_BLOCK_SIZE > 4095U) )
+	#error	"ISO-TP pool supports 32 blocks of 4095 bytes"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+#endif /* MID_ISOTP_CONF_H_ */
+
+/********************************** End of File ******************************/
@@ -0,0 +1,83 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ISO-TP Configuration Source
+* Filename:		mid_isotp_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	mid_isotp_conf.cpp
+ *  @brief:	This source file contains session table of ISO-TP
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_isotp.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check sessions usage in system */
+#if( ISOTP_SESSIONS_USED > 0 )
+
+/*
+ * @brief	Session table of ISO-TP
+ *
+ * <i>Imp Note:</i>
+ * 			Receive identifiers have to pass CAN filter table of node in
+ * 			dri_can_conf.cpp and be routed to gateway local port
+ */
+const tStISOTP_SessionConfig g_isotp_sessions[ISOTP_SESSIONS_USED] =
+{
+		{/**< Session 0, physical diagnostic requests on node 0, 11 bit */
+				0U, 0U, 0x7E0U, 0x7E8U, 8U, 0U, isotp_rx_handler
+		},
+		{/**< Session 1, physical diagnostic requests on node 0, 29 bit normal fixed */
+				0U, 1U, 0x18DAF110U, 0x18DA10F1U, 8U, 0U, isotp_rx_handler
+		}
+};
+
+#endif	/* ISOTP_SESSIONS_USED */
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/*********************************** End of File ******************************/
@@ -0,0 +1,243 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ISO-TP API Header
+* Filename:		mid_isotp.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_isotp.h
+ *  @brief:	This file contains API function declarations for ISO 15765-2
+ *  		transport layer over CAN__
+ */
+#ifndef MID_ISOTP_H_
+#define MID_ISOTP_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_isotp_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+#if( ISOTP_SESSIONS_USED > 0 )
+extern const tStISOTP_SessionConfig g_isotp_sessions[ISOTP_SESSIONS_USED];
+
+/* Receive handler for user, named in session table */
+extern void isotp_rx_handler( const unsigned char session, unsigned char * p_data, const unsigned short length );
+#endif
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for ISO-TP sessions
+ *
+ * 			Frames come in by input() and protocol timing is served by run(),
+ * 			both from gateway deferred context. Caller buffers are segmented
+ * 			in place and received messages are handed over in pool buffers.
+ *
+ ******************************************************************************/
+
+/* Check sessions usage in system */
+#if( ISOTP_SESSIONS_USED > 0 )
+
+class ISOTP__
+{
+/* public members */
+public:
+	/* Constructors */
+	ISOTP__() = delete;
+	ISOTP__( ISOTP__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for ISO-TP sessions
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eISOTP_Init_	-	ISOTP_INIT_OPEN
+	 * 											ISOTP_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eISOTP_Status_
+	 *          	ISOTP_STATUS_SUCCESS:	Operation successful.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				This function resets all sessions and the buffer pool,
+	 * 				close ends running transmissions with ISOTP_RESULT_ABORTED
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static eISOTP_Status_ init( const eISOTP_Init_& init = eISOTP_Init_::ISOTP_INIT_OPEN );
+
+	/**
+	 * @function	send
+	 *
+	 * @brief		Start transmission of a message
+	 *
+	 * @param[in]	session		-	session index
+	 * @param[in]	p_data		-	message, kept by reference
+	 * @param[in]	length		-	message length, 1 to 4095
+	 * @param[in]	fp_callback	-	completion notification, may be nullptr
+	 * @param[in]	p_arg		-	user context for callback
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eISOTP_Status_
+	 *          	ISOTP_STATUS_SUCCESS:			Transmission started.<BR>
+	 *          	ISOTP_STATUS_FAILED:			Not initialized.<BR>
+	 *          	ISOTP_STATUS_BUSY:				Session is sending.<BR>
+	 *          	ISOTP_STATUS_INVALID_ARGUMENT:	Wrong session or length.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Frames are built straight out of p_data, buffer has to stay
+	 * 				valid until callback
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Can be called from thread context and from callbacks
+	 *
+	 */
+	static eISOTP_Status_ send( const unsigned char session, const unsigned char * p_data,
+								const unsigned short length,
+								isotp_tx_callback_pointer fp_callback = nullptr,
+								void * p_arg = nullptr );
+
+	/**
+	 * @function	release
+	 *
+	 * @brief		Give received message buffer back to pool
+	 *
+	 * @param[in]	p_data	-	buffer handed to receive callback
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Can be called from any context
+	 *
+	 */
+	static void release( unsigned char * p_data );
+
+	/**
+	 * @function	input
+	 *
+	 * @brief		Offer a received frame to sessions
+	 *
+	 * @param[in]	node	-	CAN object index of frame
+	 * @param[in]	frame	-	received frame
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	true if frame belongs to a session
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from gateway deferred context only
+	 *
+	 */
+	static bool input( const unsigned char node, const tStCAN_Frame& frame );
+
+	/**
+	 * @function	run
+	 *
+	 * @brief		Serve timeouts and pending frames of sessions
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from gateway deferred context only
+	 *
+	 */
+	static void run( void );
+
+	/* Time base in ms, to be called from SysTick with ticks passed since previous call */
+	static void tick( const unsigned long ticks ) { time = time + ticks; }
+
+	/******* Setters and Getters *******/
+	/* Session is sending */
+	static bool is_busy( const unsigned char session ) { return ( eISOTP_Tx_::ISOTP_TX_IDLE != sessions[session].tx_state ); }
+	/* Session is collecting consecutive frames */
+	static bool is_receiving( const unsigned char session ) { return ( eISOTP_Rx_::ISOTP_RX_RECEIVING == sessions[session].rx_state ); }
+	/* Messages of session given up while receiving */
+	static unsigned long get_rx_errors( const unsigned char session ) { return sessions[session].rx_errors; }
+	/* Free receive buffers */
+	static unsigned char get_pool_free( void );
+
+/* private members */
+private:
+	/** Data Members **/
+	static tStISOTP_Session sessions[ISOTP_SESSIONS_USED];
+	static unsigned char pool[ISOTP_POOL_BLOCKS][ISOTP_POOL_BLOCK_SIZE];
+	static volatile unsigned long pool_used;
+	static volatile unsigned long time;
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static unsigned char * pool_get( void );
+	static bool send_frame( const unsigned char session, const unsigned char * p_pci,
+							const unsigned char pci_length, const unsigned char * p_data,
+							const unsigned char data_length );
+	static bool send_fc( const unsigned char session, const unsigned char status );
+	static void tx_run( const unsigned char session );
+	static void tx_finish( const unsigned char session, const eISOTP_Result_ result );
+	static void rx_abort( const unsigned char session );
+	static void rx_single( const unsigned char session, const tStCAN_Frame& frame );
+	static void rx_first( const unsigned char session, const tStCAN_Frame& frame );
+	static void rx_consecutive( const unsigned char session, const tStCAN_Frame& frame );
+	static void rx_flow_control( const unsigned char session, const tStCAN_Frame& frame );
+};
+
+#endif	/* ISOTP_SESSIONS_USED */
+
+
+#endif /* MID_ISOTP_H_ */
+
+/********************************** End of File *******************************/
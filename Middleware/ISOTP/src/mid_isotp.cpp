@@ -0,0 +1,960 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ISO-TP API Source
+* Filename:		mid_isotp.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	mid_isotp.cpp
+ *  @brief:	This source file contains API function definitions for ISO 15765-2
+ *  		transport layer over CAN__.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_isotp.h>
+#include <dri_can_extern.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Protocol control information, high nibble of first byte */
+#define ISOTP_PCI_SF				0x00U
+#define ISOTP_PCI_FF				0x10U
+#define ISOTP_PCI_CF				0x20U
+#define ISOTP_PCI_FC				0x30U
+
+/* Flow status of flow control */
+#define ISOTP_FS_CTS				0x00U
+#define ISOTP_FS_WAIT				0x01U
+#define ISOTP_FS_OVERFLOW			0x02U
+
+/* Longest message of 12 bit first frame length */
+#define ISOTP_MAX_LENGTH			4095U
+
+/* Payload of single, first and consecutive frame */
+#define ISOTP_SF_DATA				7U
+#define ISOTP_FF_DATA				6U
+#define ISOTP_CF_DATA				7U
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Wrap safe check of tick deadline */
+#define ISOTP_EXPIRED(now, deadline)	( static_cast<long>((now) - (deadline)) >= 0 )
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Check sessions usage in system */
+#if( ISOTP_SESSIONS_USED > 0 )
+
+/* Static members of ISOTP__ */
+tStISOTP_Session ISOTP__::sessions[ISOTP_SESSIONS_USED];
+unsigned char ISOTP__::pool[ISOTP_POOL_BLOCKS][ISOTP_POOL_BLOCK_SIZE];
+volatile unsigned long ISOTP__::pool_used = 0U;
+volatile unsigned long ISOTP__::time = 0U;
+unsigned char ISOTP__::init_state = 0U;
+
+
+/**
+ * @function	decode_st_min
+ *
+ * @brief		Separation time of flow control in ticks
+ *
+ * @param[in]	st_min	-	STmin byte of flow control
+ *
+ * @return		ticks between consecutive frames
+ *
+ * <i>Imp Note:</i>
+ * 				100 us to 900 us round up to one tick, reserved values are
+ * 				taken as longest time
+ *
+ */
+static unsigned char decode_st_min( const unsigned char st_min )
+{
+	if( st_min <= 0x7FU ){ return st_min; }
+	else if( (st_min >= 0xF1U) && (st_min <= 0xF9U) ){ return 1U; }
+	else{ return 0x7FU; }
+}
+
+
+/******* Public Member function for ISOTP__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for ISO-TP sessions
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eISOTP_Status_ ISOTP__::init( const eISOTP_Init_& init )
+{
+	/* Local Variables */
+	eISOTP_Status_ ret_status = eISOTP_Status_::ISOTP_STATUS_FAILED;
+	unsigned char index_l = 0U;
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open sessions */
+		case eISOTP_Init_::ISOTP_INIT_OPEN:
+			/* Check for initialization */
+			if( init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			/* Check session table */
+			for( index_l = 0U; index_l < ISOTP_SESSIONS_USED; ++index_l )
+			{
+				if( g_isotp_sessions[index_l].node >= CAN_NODES_USED )
+				{
+					return eISOTP_Status_::ISOTP_STATUS_INVALID_ARGUMENT;
+				}
+				else{	/* Not required */	}
+
+				sessions[index_l] = tStISOTP_Session();
+			}
+			pool_used = 0U;
+
+			/* Update initialization state */
+			init_state = 1U;
+			/* Update return status */
+			ret_status = eISOTP_Status_::ISOTP_STATUS_SUCCESS;
+			break;
+
+		/* Close sessions */
+		case eISOTP_Init_::ISOTP_INIT_CLOSE:
+			/* Reset initialization state, frames are not taken any more */
+			init_state = 0U;
+
+			for( index_l = 0U; index_l < ISOTP_SESSIONS_USED; ++index_l )
+			{
+				if( eISOTP_Tx_::ISOTP_TX_IDLE != sessions[index_l].tx_state )
+				{
+					tx_finish( index_l, eISOTP_Result_::ISOTP_RESULT_ABORTED );
+				}
+				else{	/* Not required */	}
+
+				if( nullptr != sessions[index_l].p_rx )
+				{
+					release( sessions[index_l].p_rx );
+				}
+				else{	/* Not required */	}
+
+				sessions[index_l] = tStISOTP_Session();
+			}
+
+			/* Update return status */
+			ret_status = eISOTP_Status_::ISOTP_STATUS_SUCCESS;
+			break;
+
+		/* Default parameters, invalid argument */
+		default:
+			/* Update return status */
+			ret_status = eISOTP_Status_::ISOTP_STATUS_INVALID_ARGUMENT;
+			break;
+	}
+
+	/* Return status */
+	return ret_status;
+}
+
+
+/**
+ * @function	send
+ *
+ * @brief		Start transmission of a message
+ *
+ * <i>Imp Note:</i>
+ * 				Only staged here, frames are sent by run()
+ *
+ */
+eISOTP_Status_ ISOTP__::send( const unsigned char session, const unsigned char * p_data,
+								const unsigned short length,
+								isotp_tx_callback_pointer fp_callback,
+								void * p_arg )
+{
+	/* Local Variables */
+	unsigned long primask_l = 0U;
+
+	/* Check arguments */
+	DRIVER_ASSERT( (session >= ISOTP_SESSIONS_USED) || (nullptr == p_data) ||
+					(0U == length) || (length > ISOTP_MAX_LENGTH),
+					eISOTP_Status_::ISOTP_STATUS_INVALID_ARGUMENT );
+	DRIVER_ASSERT( 0U == init_state, eISOTP_Status_::ISOTP_STATUS_FAILED );
+
+	tStISOTP_Session& session_l = sessions[session];
+
+	primask_l = __get_PRIMASK();
+	__disable_irq();
+
+	if( eISOTP_Tx_::ISOTP_TX_IDLE != session_l.tx_state )
+	{
+		__set_PRIMASK( primask_l );
+		return eISOTP_Status_::ISOTP_STATUS_BUSY;
+	}
+	else{	/* Not required */	}
+
+	session_l.p_tx = p_data;
+	session_l.tx_length = length;
+	session_l.tx_offset = 0U;
+	session_l.fp_tx = fp_callback;
+	session_l.p_arg = p_arg;
+	session_l.tx_deadline = time + ISOTP_TIMEOUT_A;
+	/* Hand over to run() last */
+	session_l.tx_state = eISOTP_Tx_::ISOTP_TX_SEND_FIRST;
+
+	__set_PRIMASK( primask_l );
+
+	return eISOTP_Status_::ISOTP_STATUS_SUCCESS;
+}
+
+
+/**
+ * @function	release
+ *
+ * @brief		Give received message buffer back to pool
+ *
+ * <i>Imp Note:</i>
+ * 				Pointers outside pool are ignored
+ *
+ */
+void ISOTP__::release( unsigned char * p_data )
+{
+	/* Local Variables */
+	unsigned long primask_l = 0U;
+	unsigned long block_l = 0U;
+
+	if( (nullptr == p_data) || (p_data < &pool[0][0]) || (p_data > &pool[ISOTP_POOL_BLOCKS - 1][0]) ){ return; }
+	else{	/* Not required */	}
+
+	block_l = static_cast<unsigned long>( p_data - &pool[0][0] ) / ISOTP_POOL_BLOCK_SIZE;
+
+	primask_l = __get_PRIMASK();
+	__disable_irq();
+	pool_used = pool_used & ~( 1UL << block_l );
+	__set_PRIMASK( primask_l );
+}
+
+
+/**
+ * @function	input
+ *
+ * @brief		Offer a received frame to sessions
+ *
+ * <i>Imp Note:</i>
+ * 				Frames of a session are taken even when they are malformed,
+ * 				so they do not show up as unrouted in gateway
+ *
+ */
+bool ISOTP__::input( const unsigned char node, const tStCAN_Frame& frame )
+{
+	/* Local Variables */
+	unsigned char index_l = 0U;
+
+	if( 0U == init_state ){ return false; }
+	else{	/* Not required */	}
+
+	for( index_l = 0U; index_l < ISOTP_SESSIONS_USED; ++index_l )
+	{
+		const tStISOTP_SessionConfig& config_l = g_isotp_sessions[index_l];
+
+		if( (node != config_l.node) || (frame.extended != config_l.extended) ||
+			(frame.id != config_l.rx_id) )
+		{
+			continue;
+		}
+		else{	/* Not required */	}
+
+		if( 0U == frame.dlc ){ return true; }
+		else{	/* Not required */	}
+
+		switch( frame.data[0] & 0xF0U )
+		{
+			case ISOTP_PCI_SF:
+				rx_single( index_l, frame );
+				break;
+
+			case ISOTP_PCI_FF:
+				rx_first( index_l, frame );
+				break;
+
+			case ISOTP_PCI_CF:
+				rx_consecutive( index_l, frame );
+				break;
+
+			case ISOTP_PCI_FC:
+				rx_flow_control( index_l, frame );
+				break;
+
+			/* Unknown frame type, ignored */
+			default:
+				break;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+
+/**
+ * @function	run
+ *
+ * @brief		Serve timeouts and pending frames of sessions
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void ISOTP__::run( void )
+{
+	/* Local Variables */
+	const unsigned long now_l = time;
+	unsigned char index_l = 0U;
+
+	if( 0U == init_state ){ return; }
+	else{	/* Not required */	}
+
+	for( index_l = 0U; index_l < ISOTP_SESSIONS_USED; ++index_l )
+	{
+		tStISOTP_Session& session_l = sessions[index_l];
+
+		/* Flow control refused by CAN earlier */
+		if( ISOTP_FC_NONE != session_l.fc_pending )
+		{
+			(void) send_fc( index_l, session_l.fc_pending );
+		}
+		else{	/* Not required */	}
+
+		/* N_Cr */
+		if( (eISOTP_Rx_::ISOTP_RX_RECEIVING == session_l.rx_state) &&
+			ISOTP_EXPIRED(now_l, session_l.rx_deadline) )
+		{
+			rx_abort( index_l );
+		}
+		else{	/* Not required */	}
+
+		tx_run( index_l );
+	}
+}
+
+
+/**
+ * @function	get_pool_free
+ *
+ * @brief		Free receive buffers
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned char ISOTP__::get_pool_free( void )
+{
+	/* Local Variables */
+	const unsigned long used_l = pool_used;
+	unsigned char free_l = 0U;
+	unsigned char index_l = 0U;
+
+	for( index_l = 0U; index_l < ISOTP_POOL_BLOCKS; ++index_l )
+	{
+		if( 0U == (used_l & (1UL << index_l)) )
+		{
+			++free_l;
+		}
+		else{	/* Not required */	}
+	}
+
+	return free_l;
+}
+
+
+/******* Private Member function for ISOTP__ class *******/
+
+/**
+ * @function	pool_get
+ *
+ * @brief		Take a receive buffer from pool
+ *
+ * @return		buffer, nullptr if pool is empty
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned char * ISOTP__::pool_get( void )
+{
+	/* Local Variables */
+	unsigned char * p_block = nullptr;
+	unsigned long primask_l = 0U;
+	unsigned char index_l = 0U;
+
+	primask_l = __get_PRIMASK();
+	__disable_irq();
+
+	for( index_l = 0U; index_l < ISOTP_POOL_BLOCKS; ++index_l )
+	{
+		if( 0U == (pool_used & (1UL << index_l)) )
+		{
+			pool_used = pool_used | ( 1UL << index_l );
+			p_block = pool[index_l];
+			break;
+		}
+		else{	/* Not required */	}
+	}
+
+	__set_PRIMASK( primask_l );
+
+	return p_block;
+}
+
+
+/**
+ * @function	send_frame
+ *
+ * @brief		Send one padded frame of session
+ *
+ * @param[in]	session		-	session index
+ * @param[in]	p_pci		-	protocol control bytes
+ * @param[in]	pci_length	-	protocol control bytes count
+ * @param[in]	p_data		-	payload, taken straight from message
+ * @param[in]	data_length	-	payload bytes count
+ *
+ * @return		true if CAN took the frame
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+bool ISOTP__::send_frame( const unsigned char session, const unsigned char * p_pci,
+							const unsigned char pci_length, const unsigned char * p_data,
+							const unsigned char data_length )
+{
+	/* Local Variables */
+	const tStISOTP_SessionConfig& config_l = g_isotp_sessions[session];
+	tStCAN_Frame frame_l;
+	unsigned char index_l = 0U;
+
+	frame_l.id = config_l.tx_id;
+	frame_l.extended = config_l.extended;
+	frame_l.dlc = 8U;
+
+	for( index_l = 0U; index_l < pci_length; ++index_l )
+	{
+		frame_l.data[index_l] = p_pci[index_l];
+	}
+	for( index_l = 0U; index_l < data_length; ++index_l )
+	{
+		frame_l.data[pci_length + index_l] = p_data[index_l];
+	}
+	for( index_l = (unsigned char)( pci_length + data_length ); index_l < 8U; ++index_l )
+	{
+		frame_l.data[index_l] = ISOTP_PADDING;
+	}
+
+	return ( eCAN_Status_::CAN_STATUS_SUCCESS == g_p_can_obj[config_l.node]->transmit( frame_l ) );
+}
+
+
+/**
+ * @function	send_fc
+ *
+ * @brief		Send flow control of session
+ *
+ * @param[in]	session	-	session index
+ * @param[in]	status	-	flow status
+ *
+ * @return		true if CAN took the frame
+ *
+ * <i>Imp Note:</i>
+ * 				A refused flow control is kept pending for run()
+ *
+ */
+bool ISOTP__::send_fc( const unsigned char session, const unsigned char status )
+{
+	/* Local Variables */
+	const tStISOTP_SessionConfig& config_l = g_isotp_sessions[session];
+	const unsigned char pci_l[3] = { (unsigned char)( ISOTP_PCI_FC | status ),
+									config_l.block_size, config_l.st_min };
+
+	if( true == send_frame( session, pci_l, 3U, nullptr, 0U ) )
+	{
+		sessions[session].fc_pending = ISOTP_FC_NONE;
+		return true;
+	}
+	else
+	{
+		sessions[session].fc_pending = status;
+		return false;
+	}
+}
+
+
+/**
+ * @function	tx_run
+ *
+ * @brief		Transmit side of session
+ *
+ * @param[in]	session	-	session index
+ *
+ * <i>Imp Note:</i>
+ * 				A frame refused by CAN is tried again next run until N_As
+ *
+ */
+void ISOTP__::tx_run( const unsigned char session )
+{
+	/* Local Variables */
+	tStISOTP_Session& session_l = sessions[session];
+	const unsigned long now_l = time;
+	unsigned char pci_l[2] = { 0U };
+	unsigned char length_l = 0U;
+	unsigned char count_l = 0U;
+	unsigned char burst_l = 0U;
+
+	switch( session_l.tx_state )
+	{
+		case eISOTP_Tx_::ISOTP_TX_SEND_FIRST:
+			if( session_l.tx_length <= ISOTP_SF_DATA )
+			{
+				pci_l[0] = (unsigned char)( ISOTP_PCI_SF | session_l.tx_length );
+				if( true == send_frame( session, pci_l, 1U, session_l.p_tx, (unsigned char) session_l.tx_length ) )
+				{
+					tx_finish( session, eISOTP_Result_::ISOTP_RESULT_OK );
+					return;
+				}
+				else{	/* Not required */	}
+			}
+			else
+			{
+				pci_l[0] = (unsigned char)( ISOTP_PCI_FF | (session_l.tx_length >> 8U) );
+				pci_l[1] = (unsigned char)( session_l.tx_length );
+				if( true == send_frame( session, pci_l, 2U, session_l.p_tx, ISOTP_FF_DATA ) )
+				{
+					session_l.tx_offset = ISOTP_FF_DATA;
+					session_l.tx_sn = 1U;
+					session_l.tx_waits = 0U;
+					session_l.tx_deadline = now_l + ISOTP_TIMEOUT_BS;
+					session_l.tx_state = eISOTP_Tx_::ISOTP_TX_WAIT_FC;
+					return;
+				}
+				else{	/* Not required */	}
+			}
+
+			if( ISOTP_EXPIRED(now_l, session_l.tx_deadline) )
+			{
+				tx_finish( session, eISOTP_Result_::ISOTP_RESULT_TIMEOUT_A );
+			}
+			else{	/* Not required */	}
+			break;
+
+		case eISOTP_Tx_::ISOTP_TX_WAIT_FC:
+			if( ISOTP_EXPIRED(now_l, session_l.tx_deadline) )
+			{
+				tx_finish( session, eISOTP_Result_::ISOTP_RESULT_TIMEOUT_BS );
+			}
+			else{	/* Not required */	}
+			break;
+
+		case eISOTP_Tx_::ISOTP_TX_SEND_CF:
+			/* Receiver without separation time gets a burst per run */
+			burst_l = ( 0U == session_l.tx_st_min ) ? ISOTP_CF_PER_RUN : 1U;
+
+			for( count_l = 0U; count_l < burst_l; ++count_l )
+			{
+				if( !ISOTP_EXPIRED(now_l, session_l.tx_next_cf) ){ break; }
+				else{	/* Not required */	}
+
+				length_l = (unsigned char)( session_l.tx_length - session_l.tx_offset );
+				if( (unsigned short)( session_l.tx_length - session_l.tx_offset ) > ISOTP_CF_DATA ){ length_l = ISOTP_CF_DATA; }
+				else{	/* Not required */	}
+
+				pci_l[0] = (unsigned char)( ISOTP_PCI_CF | session_l.tx_sn );
+				if( false == send_frame( session, pci_l, 1U, &session_l.p_tx[session_l.tx_offset], length_l ) )
+				{
+					if( ISOTP_EXPIRED(now_l, session_l.tx_deadline) )
+					{
+						tx_finish( session, eISOTP_Result_::ISOTP_RESULT_TIMEOUT_A );
+					}
+					else{	/* Not required */	}
+					return;
+				}
+				else{	/* Not required */	}
+
+				session_l.tx_offset = (unsigned short)( session_l.tx_offset + length_l );
+				session_l.tx_sn = (unsigned char)( (session_l.tx_sn + 1U) & 0x0FU );
+				session_l.tx_deadline = now_l + ISOTP_TIMEOUT_A;
+				/* Frame may have gone out late in tick, one more tick keeps STmin */
+				session_l.tx_next_cf = now_l;
+				if( 0U != session_l.tx_st_min )
+				{
+					session_l.tx_next_cf = now_l + session_l.tx_st_min + 1U;
+				}
+				else{	/* Not required */	}
+
+				if( session_l.tx_offset >= session_l.tx_length )
+				{
+					tx_finish( session, eISOTP_Result_::ISOTP_RESULT_OK );
+					return;
+				}
+				else{	/* Not required */	}
+
+				/* End of block, receiver sends next flow control */
+				if( (0U != session_l.tx_block_size) && (0U == --session_l.tx_block) )
+				{
+					session_l.tx_deadline = now_l + ISOTP_TIMEOUT_BS;
+					session_l.tx_state = eISOTP_Tx_::ISOTP_TX_WAIT_FC;
+					return;
+				}
+				else{	/* Not required */	}
+			}
+			break;
+
+		/* Nothing to send */
+		default:
+			break;
+	}
+}
+
+
+/**
+ * @function	tx_finish
+ *
+ * @brief		End transmission and notify sender
+ *
+ * @param[in]	session	-	session index
+ * @param[in]	result	-	result of transmission
+ *
+ * <i>Imp Note:</i>
+ * 				Session is idle before callback, so callback may send again
+ *
+ */
+void ISOTP__::tx_finish( const unsigned char session, const eISOTP_Result_ result )
+{
+	/* Local Variables */
+	tStISOTP_Session& session_l = sessions[session];
+	const isotp_tx_callback_pointer fp_callback = session_l.fp_tx;
+	void * const p_arg = session_l.p_arg;
+
+	session_l.p_tx = nullptr;
+	session_l.fp_tx = nullptr;
+	session_l.tx_state = eISOTP_Tx_::ISOTP_TX_IDLE;
+
+	if( nullptr != fp_callback )
+	{
+		fp_callback( session, result, p_arg );
+	}
+	else{	/* Not required */	}
+}
+
+
+/**
+ * @function	rx_abort
+ *
+ * @brief		Give up message being received
+ *
+ * @param[in]	session	-	session index
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void ISOTP__::rx_abort( const unsigned char session )
+{
+	/* Local Variables */
+	tStISOTP_Session& session_l = sessions[session];
+
+	release( session_l.p_rx );
+	session_l.p_rx = nullptr;
+	session_l.rx_state = eISOTP_Rx_::ISOTP_RX_IDLE;
+	session_l.fc_pending = ISOTP_FC_NONE;
+	++session_l.rx_errors;
+}
+
+
+/**
+ * @function	rx_deliver
+ *
+ * @brief		Hand complete message to receiver
+ *
+ * @param[in]	session	-	session index
+ * @param[in]	p_data	-	pool buffer of message
+ * @param[in]	length	-	message length
+ *
+ * <i>Imp Note:</i>
+ * 				Buffer goes straight back to pool without receiver
+ *
+ */
+static void rx_deliver( const unsigned char session, unsigned char * p_data, const unsigned short length )
+{
+	if( nullptr != g_isotp_sessions[session].fp_rx )
+	{
+		g_isotp_sessions[session].fp_rx( session, p_data, length );
+	}
+	else
+	{
+		ISOTP__::release( p_data );
+	}
+}
+
+
+/**
+ * @function	rx_single
+ *
+ * @brief		Single frame of session
+ *
+ * @param[in]	session	-	session index
+ * @param[in]	frame	-	received frame
+ *
+ * <i>Imp Note:</i>
+ * 				Ends a reception in progress
+ *
+ */
+void ISOTP__::rx_single( const unsigned char session, const tStCAN_Frame& frame )
+{
+	/* Local Variables */
+	const unsigned char length_l = (unsigned char)( frame.data[0] & 0x0FU );
+	unsigned char * p_block = nullptr;
+	unsigned char index_l = 0U;
+
+	if( (0U == length_l) || (length_l > ISOTP_SF_DATA) || (length_l >= frame.dlc) ){ return; }
+	else{	/* Not required */	}
+
+	if( eISOTP_Rx_::ISOTP_RX_RECEIVING == sessions[session].rx_state )
+	{
+		rx_abort( session );
+	}
+	else{	/* Not required */	}
+
+	p_block = pool_get();
+	if( nullptr == p_block )
+	{
+		++sessions[session].rx_errors;
+		return;
+	}
+	else{	/* Not required */	}
+
+	for( index_l = 0U; index_l < length_l; ++index_l )
+	{
+		p_block[index_l] = frame.data[1U + index_l];
+	}
+
+	rx_deliver( session, p_block, length_l );
+}
+
+
+/**
+ * @function	rx_first
+ *
+ * @brief		First frame of session
+ *
+ * @param[in]	session	-	session index
+ * @param[in]	frame	-	received frame
+ *
+ * <i>Imp Note:</i>
+ * 				Message not fitting one pool buffer is refused with overflow
+ *
+ */
+void ISOTP__::rx_first( const unsigned char session, const tStCAN_Frame& frame )
+{
+	/* Local Variables */
+	tStISOTP_Session& session_l = sessions[session];
+	const unsigned short length_l = (unsigned short)( ((frame.data[0] & 0x0FU) << 8U) | frame.data[1] );
+	unsigned char index_l = 0U;
+
+	if( (frame.dlc < 8U) || (length_l <= ISOTP_SF_DATA) ){ return; }
+	else{	/* Not required */	}
+
+	if( eISOTP_Rx_::ISOTP_RX_RECEIVING == session_l.rx_state )
+	{
+		rx_abort( session );
+	}
+	else{	/* Not required */	}
+
+	if( length_l <= ISOTP_POOL_BLOCK_SIZE )
+	{
+		session_l.p_rx = pool_get();
+	}
+	else{	/* Not required */	}
+
+	if( nullptr == session_l.p_rx )
+	{
+		++session_l.rx_errors;
+		(void) send_fc( session, ISOTP_FS_OVERFLOW );
+		return;
+	}
+	else{	/* Not required */	}
+
+	for( index_l = 0U; index_l < ISOTP_FF_DATA; ++index_l )
+	{
+		session_l.p_rx[index_l] = frame.data[2U + index_l];
+	}
+
+	session_l.rx_length = length_l;
+	session_l.rx_offset = ISOTP_FF_DATA;
+	session_l.rx_sn = 1U;
+	session_l.rx_block = g_isotp_sessions[session].block_size;
+	session_l.rx_deadline = time + ISOTP_TIMEOUT_CR;
+	session_l.rx_state = eISOTP_Rx_::ISOTP_RX_RECEIVING;
+
+	(void) send_fc( session, ISOTP_FS_CTS );
+}
+
+
+/**
+ * @function	rx_consecutive
+ *
+ * @brief		Consecutive frame of session
+ *
+ * @param[in]	session	-	session index
+ * @param[in]	frame	-	received frame
+ *
+ * <i>Imp Note:</i>
+ * 				Out of order frame ends reception
+ *
+ */
+void ISOTP__::rx_consecutive( const unsigned char session, const tStCAN_Frame& frame )
+{
+	/* Local Variables */
+	tStISOTP_Session& session_l = sessions[session];
+	unsigned char * p_block = nullptr;
+	unsigned char length_l = 0U;
+	unsigned char index_l = 0U;
+
+	if( eISOTP_Rx_::ISOTP_RX_RECEIVING != session_l.rx_state ){ return; }
+	else{	/* Not required */	}
+
+	length_l = ISOTP_CF_DATA;
+	if( (unsigned short)( session_l.rx_length - session_l.rx_offset ) < ISOTP_CF_DATA )
+	{
+		length_l = (unsigned char)( session_l.rx_length - session_l.rx_offset );
+	}
+	else{	/* Not required */	}
+
+	if( ((frame.data[0] & 0x0FU) != session_l.rx_sn) || (frame.dlc <= length_l) )
+	{
+		rx_abort( session );
+		return;
+	}
+	else{	/* Not required */	}
+
+	for( index_l = 0U; index_l < length_l; ++index_l )
+	{
+		session_l.p_rx[session_l.rx_offset + index_l] = frame.data[1U + index_l];
+	}
+	session_l.rx_offset = (unsigned short)( session_l.rx_offset + length_l );
+	session_l.rx_sn = (unsigned char)( (session_l.rx_sn + 1U) & 0x0FU );
+
+	/* Message complete */
+	if( session_l.rx_offset >= session_l.rx_length )
+	{
+		p_block = session_l.p_rx;
+		session_l.p_rx = nullptr;
+		session_l.rx_state = eISOTP_Rx_::ISOTP_RX_IDLE;
+		rx_deliver( session, p_block, session_l.rx_length );
+		return;
+	}
+	else{	/* Not required */	}
+
+	session_l.rx_deadline = time + ISOTP_TIMEOUT_CR;
+
+	/* End of block, let sender go on */
+	if( (0U != g_isotp_sessions[session].block_size) && (0U == --session_l.rx_block) )
+	{
+		session_l.rx_block = g_isotp_sessions[session].block_size;
+		(void) send_fc( session, ISOTP_FS_CTS );
+	}
+	else{	/* Not required */	}
+}
+
+
+/**
+ * @function	rx_flow_control
+ *
+ * @brief		Flow control for transmit side of session
+ *
+ * @param[in]	session	-	session index
+ * @param[in]	frame	-	received frame
+ *
+ * <i>Imp Note:</i>
+ * 				Flow control not waited for is ignored
+ *
+ */
+void ISOTP__::rx_flow_control( const unsigned char session, const tStCAN_Frame& frame )
+{
+	/* Local Variables */
+	tStISOTP_Session& session_l = sessions[session];
+	const unsigned long now_l = time;
+
+	if( (eISOTP_Tx_::ISOTP_TX_WAIT_FC != session_l.tx_state) || (frame.dlc < 3U) ){ return; }
+	else{	/* Not required */	}
+
+	switch( frame.data[0] & 0x0FU )
+	{
+		case ISOTP_FS_CTS:
+			session_l.tx_block_size = frame.data[1];
+			session_l.tx_block = frame.data[1];
+			session_l.tx_st_min = decode_st_min( frame.data[2] );
+			session_l.tx_waits = 0U;
+			session_l.tx_next_cf = now_l;
+			session_l.tx_deadline = now_l + ISOTP_TIMEOUT_A;
+			session_l.tx_state = eISOTP_Tx_::ISOTP_TX_SEND_CF;
+			/* First frames of block go out without waiting for a tick */
+			tx_run( session );
+			break;
+
+		case ISOTP_FS_WAIT:
+			if( ++session_l.tx_waits > ISOTP_MAX_WFT )
+			{
+				tx_finish( session, eISOTP_Result_::ISOTP_RESULT_WFT_OVERRUN );
+			}
+			else
+			{
+				session_l.tx_deadline = now_l + ISOTP_TIMEOUT_BS;
+			}
+			break;
+
+		case ISOTP_FS_OVERFLOW:
+			tx_finish( session, eISOTP_Result_::ISOTP_RESULT_OVERFLOW );
+			break;
+
+		/* Reserved flow status, ignored */
+		default:
+			break;
+	}
+}
+
+#endif	/* ISOTP_SESSIONS_USED */
+
+
+/*********************************** End of File ******************************/
@@ -0,0 +1,89 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		PTP data types Header
+* Filename:		mid_ptp_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_ptp_types.h
+ *  @brief:	This file contains data types definitions for IEEE 1588 slave
+ */
+#ifndef MID_PTP_TYPES_H_
+#define MID_PTP_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+/* Include private headers first */
+#include <private/mid_ptp_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+#include <dri_eth_types.h>
+#include <mid_udp_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Length of port identity, clock identity and port number */
+#define PTP_PORT_IDENTITY_SIZE		10U
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of PTP
+ * */
+enum class ePTP_Status_/*	:	unsigned char	*/
+{
+	PTP_STATUS_SUCCESS = 0,
+	PTP_STATUS_FAILED
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class ePTP_Init_/*	:	unsigned char	*/
+{
+	PTP_INIT_CLOSE = 0,
+	PTP_INIT_OPEN
+};
+
+/*
+ * @brief	Enum for port state of slave
+ * */
+enum class ePTP_State_	:	unsigned char
+{
+	PTP_STATE_LISTENING = 0,		/**< No master followed */
+	PTP_STATE_UNCALIBRATED,			/**< Following master, servo not locked */
+	PTP_STATE_SLAVE					/**< Servo locked to master */
+};
+
+
+#endif /* MID_PTP_TYPES_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,84 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		PTP Configuration Header
+* Filename:		mid_ptp_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_ptp_conf.h
+ *  @brief:	This file contains static configurations for IEEE 1588 slave
+ */
+#ifndef MID_PTP_CONF_H_
+#define MID_PTP_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* PTP slave used in system, 0 - not used */
+#define PTP_USED					1
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Domain of master followed */
+#define PTP_DOMAIN					0U
+
+/* PTP over UDP/IPv4, ports and primary multicast group */
+#define PTP_EVENT_PORT				319U
+#define PTP_GENERAL_PORT			320U
+#define PTP_MULTICAST_IP			UDP_IPV4( 224U, 0U, 1U, 129U )
+
+/* Offsets above this are removed by stepping time, ns */
+#define PTP_STEP_THRESHOLD			100000L
+
+/* Servo is locked below this offset, ns */
+#define PTP_LOCK_THRESHOLD			1000L
+
+/*
+ * PI servo gains in ppb per ns of offset, as numerator over PTP_GAIN_DEN.
+ * 0.7 and 0.3 suit one Sync per second.
+ */
+#define PTP_KP_NUM					7L
+#define PTP_KI_NUM					3L
+#define PTP_GAIN_DEN				10L
+
+/* Delay_Req sent after every n Sync messages */
+#define PTP_DELAY_REQ_EVERY			4U
+
+/* Path delay is averaged over 2^n measurements */
+#define PTP_DELAY_FILTER_SHIFT		3U
+
+/* Master is given up without Sync for this time in ticks of tick() (ms) */
+#define PTP_MASTER_TIMEOUT			4000U
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+#endif /* MID_PTP_CONF_H_ */
+
+/********************************** End of File *******************************/
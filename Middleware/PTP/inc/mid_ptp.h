@@ -0,0 +1,273 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		PTP API Header
+* Filename:		mid_ptp.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_ptp.h
+ *  @brief:	This file contains API function declarations for IEEE 1588
+ *  		slave over UDP__
+ */
+#ifndef MID_PTP_H_
+#define MID_PTP_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_ptp_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for IEEE 1588 slave
+ *
+ * 			Ordinary clock in slave state, end to end delay mechanism over
+ * 			UDP/IPv4. System time of ETH__ is stepped once and then steered
+ * 			in rate by a PI servo, Sync and Delay_Req times are taken by MAC.
+ *
+ ******************************************************************************/
+
+/* Check PTP usage in system */
+#if( 1 == PTP_USED )
+
+class PTP__
+{
+/* public members */
+public:
+	/* Constructors */
+	PTP__() = delete;
+	PTP__( PTP__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for IEEE 1588 slave
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							ePTP_Init_	-	PTP_INIT_OPEN
+	 * 										PTP_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	ePTP_Status_
+	 *          	PTP_STATUS_SUCCESS:		Operation successful.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Clock identity is derived from MAC address
+	 *
+	 * <i>Imp Note:</i>
+	 * 				ETH__ and UDP__ have to be initialized first
+	 *
+	 */
+	static ePTP_Status_ init( const ePTP_Init_& init = ePTP_Init_::PTP_INIT_OPEN );
+
+	/**
+	 * @function	event_input
+	 *
+	 * @brief		Receive handler of event port, named in UDP port table
+	 *
+	 * @param[in]	source	-	remote address and port
+	 * @param[in]	p_data	-	PTP message
+	 * @param[in]	length	-	message length
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Sync messages are taken with their receive time
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Called from UDP__::run()
+	 *
+	 */
+	static void event_input( const tStUDP_Endpoint& source, const unsigned char * p_data,
+								const unsigned short length );
+
+	/**
+	 * @function	general_input
+	 *
+	 * @brief		Receive handler of general port, named in UDP port table
+	 *
+	 * @param[in]	source	-	remote address and port
+	 * @param[in]	p_data	-	PTP message
+	 * @param[in]	length	-	message length
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Follow_Up and Delay_Resp messages are taken
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Called from UDP__::run()
+	 *
+	 */
+	static void general_input( const tStUDP_Endpoint& source, const unsigned char * p_data,
+								const unsigned short length );
+
+	/**
+	 * @function	run
+	 *
+	 * @brief		Collect transmit time of Delay_Req
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from the same context as UDP__::run()
+	 *
+	 */
+	static void run( void );
+
+	/**
+	 * @function	tick
+	 *
+	 * @brief		Master supervision, to be called from SysTick
+	 *
+	 * @param[in]	ticks	-	ticks passed since previous call
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Master is given up without Sync for PTP_MASTER_TIMEOUT ticks
+	 *
+	 * <i>Imp Note:</i>
+	 *
+	 */
+	static void tick( const unsigned long ticks );
+
+	/**
+	 * @function	now
+	 *
+	 * @brief		Read disciplined time
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	time	-	system time of ETH__
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Time follows master once state is PTP_STATE_SLAVE
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Can be called from any context
+	 *
+	 */
+	static void now( tStETH_Time& time );
+
+	/**
+	 * @function	now_ns
+	 *
+	 * @brief		Read disciplined time in nanoseconds
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	nanoseconds since epoch of master
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Can be called from any context
+	 *
+	 */
+	static unsigned long long now_ns( void );
+
+	/******* Setters and Getters *******/
+	/* Port state */
+	static ePTP_State_ get_state( void ) { return state; }
+	/* Last offset from master, ns */
+	static long long get_offset( void ) { return offset; }
+	/* Filtered mean path delay, ns */
+	static long long get_path_delay( void ) { return path_delay; }
+	/* Rate correction applied, ppb */
+	static long get_rate( void ) { return rate; }
+
+/* private members */
+private:
+	/** Data Members **/
+	static unsigned char identity[PTP_PORT_IDENTITY_SIZE];
+	static unsigned char master[PTP_PORT_IDENTITY_SIZE];
+	static long long t1;
+	static long long t2;
+	static long long delay_t1;
+	static long long delay_t2;
+	static long long t3;
+	static long long offset;
+	static long long path_delay;
+	static long long integral;
+	static long rate;
+	static unsigned short sync_sequence;
+	static unsigned short delay_sequence;
+	static volatile unsigned short sync_ticks;
+	static unsigned char syncs;
+	static unsigned char follow_up_pending;
+	static unsigned char delay_state;
+	static unsigned char delay_valid;
+	static volatile ePTP_State_ state;
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static void sample( void );
+	static bool servo( void );
+	static void send_delay_request( void );
+	static bool is_master( const unsigned char * p_data );
+};
+
+#endif	/* PTP_USED */
+
+
+#endif /* MID_PTP_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,622 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		PTP API Source
+* Filename:		mid_ptp.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	mid_ptp.cpp
+ *  @brief:	This source file contains API function definitions for IEEE 1588
+ *  		slave over UDP__.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_ptp.h>
+#include <mid_udp.h>
+#include <dri_eth.h>
+#include <string.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Times are taken by MAC */
+#if( (1 == PTP_USED) && (1 != ETH_PTP_USED) )
+	#error	"PTP needs timestamps of ETH__"
+#endif
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Common header, offsets in message */
+#define PTP_MESSAGE_TYPE			0U
+#define PTP_VERSION					1U
+#define PTP_LENGTH					2U
+#define PTP_DOMAIN_NUMBER			4U
+#define PTP_FLAGS					6U
+#define PTP_CORRECTION				8U
+#define PTP_SOURCE_PORT				20U
+#define PTP_SEQUENCE_ID				30U
+#define PTP_CONTROL					32U
+#define PTP_LOG_INTERVAL			33U
+#define PTP_TIMESTAMP				34U
+#define PTP_REQUESTING_PORT			44U
+#define PTP_HEADER					34U
+
+/* Message sizes */
+#define PTP_SYNC_SIZE				44U
+#define PTP_DELAY_REQ_SIZE			44U
+#define PTP_DELAY_RESP_SIZE			54U
+
+/* Message types and control field */
+#define PTP_TYPE_SYNC				0x0U
+#define PTP_TYPE_DELAY_REQ			0x1U
+#define PTP_TYPE_FOLLOW_UP			0x8U
+#define PTP_TYPE_DELAY_RESP			0x9U
+#define PTP_CONTROL_DELAY_REQ		1U
+#define PTP_VERSION_2				2U
+#define PTP_FLAG_TWO_STEP			0x02U
+
+/* Delay_Req states */
+#define PTP_DELAY_IDLE				0U
+#define PTP_DELAY_SENT				1U
+#define PTP_DELAY_TIMED				2U
+
+#define PTP_NS_PER_SECOND			1000000000LL
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Network order field access */
+static inline unsigned short get_16( const unsigned char * p_data )
+{
+	return static_cast<unsigned short>( ( p_data[0] << 8U ) | p_data[1] );
+}
+
+static inline unsigned long get_32( const unsigned char * p_data )
+{
+	return ( (unsigned long)p_data[0] << 24U ) | ( (unsigned long)p_data[1] << 16U ) |
+			( (unsigned long)p_data[2] << 8U ) | (unsigned long)p_data[3];
+}
+
+static inline void put_16( unsigned char * p_data, const unsigned short value )
+{
+	p_data[0] = static_cast<unsigned char>( value >> 8U );
+	p_data[1] = static_cast<unsigned char>( value );
+}
+
+/* Time of ETH__ in ns */
+static inline long long to_ns( const tStETH_Time& time )
+{
+	return ( (long long)time.seconds * PTP_NS_PER_SECOND ) + (long long)time.nanoseconds;
+}
+
+/* Timestamp field, 48 bit seconds and 32 bit ns */
+static inline long long get_timestamp( const unsigned char * p_data )
+{
+	return ( ( ( (long long)get_16( p_data ) << 32U ) | (long long)get_32( &p_data[2] ) ) * PTP_NS_PER_SECOND ) +
+			(long long)get_32( &p_data[6] );
+}
+
+/* Correction field, ns scaled by 2^16 */
+static inline long long get_correction( const unsigned char * p_data )
+{
+	return (long long)( ( (unsigned long long)get_32( &p_data[PTP_CORRECTION] ) << 32U ) |
+						(unsigned long long)get_32( &p_data[PTP_CORRECTION + 4U] ) ) >> 16U;
+}
+
+
+/* Check PTP usage in system */
+#if( 1 == PTP_USED )
+
+/* Static members of PTP__ */
+unsigned char PTP__::identity[PTP_PORT_IDENTITY_SIZE];
+unsigned char PTP__::master[PTP_PORT_IDENTITY_SIZE];
+long long PTP__::t1 = 0;
+long long PTP__::t2 = 0;
+long long PTP__::delay_t1 = 0;
+long long PTP__::delay_t2 = 0;
+long long PTP__::t3 = 0;
+long long PTP__::offset = 0;
+long long PTP__::path_delay = 0;
+long long PTP__::integral = 0;
+long PTP__::rate = 0;
+unsigned short PTP__::sync_sequence = 0U;
+unsigned short PTP__::delay_sequence = 0U;
+volatile unsigned short PTP__::sync_ticks = 0U;
+unsigned char PTP__::syncs = 0U;
+unsigned char PTP__::follow_up_pending = 0U;
+unsigned char PTP__::delay_state = PTP_DELAY_IDLE;
+unsigned char PTP__::delay_valid = 0U;
+volatile ePTP_State_ PTP__::state = ePTP_State_::PTP_STATE_LISTENING;
+unsigned char PTP__::init_state = 0U;
+
+
+/******* Public Member function for PTP__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for IEEE 1588 slave
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+ePTP_Status_ PTP__::init( const ePTP_Init_& init )
+{
+	/* Local Variables */
+	ePTP_Status_ ret_status = ePTP_Status_::PTP_STATUS_FAILED;
+	const unsigned char * p_mac = ETH__::get_address();
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open slave */
+		case ePTP_Init_::PTP_INIT_OPEN:
+			/* Check for initialization */
+			if( init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			/* EUI-64 from MAC address and port number 1 */
+			identity[0] = p_mac[0];
+			identity[1] = p_mac[1];
+			identity[2] = p_mac[2];
+			identity[3] = 0xFFU;
+			identity[4] = 0xFEU;
+			identity[5] = p_mac[3];
+			identity[6] = p_mac[4];
+			identity[7] = p_mac[5];
+			put_16( &identity[8], 1U );
+
+			state = ePTP_State_::PTP_STATE_LISTENING;
+			follow_up_pending = 0U;
+			delay_state = PTP_DELAY_IDLE;
+			delay_valid = 0U;
+			integral = 0;
+			rate = 0;
+			ETH__::adjust_rate( 0 );
+
+			/* Update initialization state */
+			init_state = 1U;
+			/* Update return status */
+			ret_status = ePTP_Status_::PTP_STATUS_SUCCESS;
+			break;
+
+		/* Close slave */
+		case ePTP_Init_::PTP_INIT_CLOSE:
+			/* Reset initialization state */
+			init_state = 0U;
+			state = ePTP_State_::PTP_STATE_LISTENING;
+			/* Update return status */
+			ret_status = ePTP_Status_::PTP_STATUS_SUCCESS;
+			break;
+
+		default:
+			break;
+	}
+
+	return ret_status;
+}
+
+
+/**
+ * @function	event_input
+ *
+ * @brief		Receive handler of event port
+ *
+ * <i>Imp Note:</i>
+ * 				First master heard is followed until it times out, there is
+ * 				no best master clock algorithm
+ *
+ */
+void PTP__::event_input( const tStUDP_Endpoint& source, const unsigned char * p_data,
+							const unsigned short length )
+{
+	/* Local Variables */
+	tStETH_Time time;
+
+	(void) source;
+
+	/* Check Sync of version 2 in domain */
+	if( (0U == init_state) || (length < PTP_SYNC_SIZE) ||
+		(PTP_TYPE_SYNC != ( p_data[PTP_MESSAGE_TYPE] & 0x0FU )) ||
+		(PTP_VERSION_2 != ( p_data[PTP_VERSION] & 0x0FU )) ||
+		(PTP_DOMAIN != p_data[PTP_DOMAIN_NUMBER]) )
+	{
+		return;
+	}
+	else{	/* Not required */	}
+
+	if( false == UDP__::get_rx_time( time ) ){ return; }
+	else{	/* Not required */	}
+
+	/* Follow first master */
+	if( ePTP_State_::PTP_STATE_LISTENING == state )
+	{
+		memcpy( master, &p_data[PTP_SOURCE_PORT], PTP_PORT_IDENTITY_SIZE );
+		state = ePTP_State_::PTP_STATE_UNCALIBRATED;
+		syncs = 0U;
+		delay_valid = 0U;
+		delay_state = PTP_DELAY_IDLE;
+	}
+	else if( false == is_master( p_data ) )
+	{
+		return;
+	}
+	else{	/* Not required */	}
+
+	sync_ticks = 0U;
+	sync_sequence = get_16( &p_data[PTP_SEQUENCE_ID] );
+	t2 = to_ns( time );
+	t1 = get_correction( p_data );
+
+	if( 0U != ( p_data[PTP_FLAGS] & PTP_FLAG_TWO_STEP ) )
+	{
+		/* Origin time follows */
+		follow_up_pending = 1U;
+	}
+	else
+	{
+		follow_up_pending = 0U;
+		t1 += get_timestamp( &p_data[PTP_TIMESTAMP] );
+		sample();
+	}
+}
+
+
+/**
+ * @function	general_input
+ *
+ * @brief		Receive handler of general port
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void PTP__::general_input( const tStUDP_Endpoint& source, const unsigned char * p_data,
+							const unsigned short length )
+{
+	/* Local Variables */
+	tStETH_Time time;
+	long long t4 = 0;
+	long long delay = 0;
+
+	(void) source;
+
+	/* Check message of version 2 from master */
+	if( (0U == init_state) || (length < PTP_HEADER) ||
+		(ePTP_State_::PTP_STATE_LISTENING == state) ||
+		(PTP_VERSION_2 != ( p_data[PTP_VERSION] & 0x0FU )) ||
+		(PTP_DOMAIN != p_data[PTP_DOMAIN_NUMBER]) ||
+		(false == is_master( p_data )) )
+	{
+		return;
+	}
+	else{	/* Not required */	}
+
+	switch( p_data[PTP_MESSAGE_TYPE] & 0x0FU )
+	{
+		case PTP_TYPE_FOLLOW_UP:
+			if( (length < PTP_SYNC_SIZE) || (0U == follow_up_pending) ||
+				(sync_sequence != get_16( &p_data[PTP_SEQUENCE_ID] )) )
+			{
+				break;
+			}
+			else{	/* Not required */	}
+
+			/* Corrections of Sync and Follow_Up both apply */
+			follow_up_pending = 0U;
+			t1 += get_timestamp( &p_data[PTP_TIMESTAMP] ) + get_correction( p_data );
+			sample();
+			break;
+
+		case PTP_TYPE_DELAY_RESP:
+			if( (length < PTP_DELAY_RESP_SIZE) ||
+				(delay_sequence != get_16( &p_data[PTP_SEQUENCE_ID] )) ||
+				(0 != memcmp( &p_data[PTP_REQUESTING_PORT], identity, PTP_PORT_IDENTITY_SIZE )) )
+			{
+				break;
+			}
+			else{	/* Not required */	}
+
+			/* Response may overtake run() */
+			if( (PTP_DELAY_SENT == delay_state) && ETH__::get_tx_time( time ) )
+			{
+				t3 = to_ns( time );
+				delay_state = PTP_DELAY_TIMED;
+			}
+			else{	/* Not required */	}
+
+			if( PTP_DELAY_TIMED != delay_state ){ break; }
+			else{	/* Not required */	}
+
+			delay_state = PTP_DELAY_IDLE;
+			t4 = get_timestamp( &p_data[PTP_TIMESTAMP] ) - get_correction( p_data );
+
+			/* Mean of both directions */
+			delay = ( ( delay_t2 - delay_t1 ) + ( t4 - t3 ) ) / 2;
+			if( delay < 0 ){ break; }
+			else{	/* Not required */	}
+
+			if( 0U == delay_valid )
+			{
+				path_delay = delay;
+				delay_valid = 1U;
+			}
+			else
+			{
+				path_delay += ( delay - path_delay ) / ( 1LL << PTP_DELAY_FILTER_SHIFT );
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+
+/**
+ * @function	run
+ *
+ * @brief		Collect transmit time of Delay_Req
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void PTP__::run( void )
+{
+	/* Local Variables */
+	tStETH_Time time;
+
+	/* Check initialization */
+	if( 0U == init_state ){ return; }
+	else{	/* Not required */	}
+
+	/* Give up silent master, servo keeps last rate */
+	if( (ePTP_State_::PTP_STATE_LISTENING != state) && (sync_ticks >= PTP_MASTER_TIMEOUT) )
+	{
+		state = ePTP_State_::PTP_STATE_LISTENING;
+		follow_up_pending = 0U;
+		delay_state = PTP_DELAY_IDLE;
+		return;
+	}
+	else{	/* Not required */	}
+
+	if( (PTP_DELAY_SENT == delay_state) && ETH__::get_tx_time( time ) )
+	{
+		t3 = to_ns( time );
+		delay_state = PTP_DELAY_TIMED;
+	}
+	else{	/* Not required */	}
+}
+
+
+/**
+ * @function	tick
+ *
+ * @brief		Master supervision, to be called from SysTick
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void PTP__::tick( const unsigned long ticks )
+{
+	/* Local Variables */
+	const unsigned short sync_ticks_l = sync_ticks;
+
+	if( ticks < (PTP_MASTER_TIMEOUT - sync_ticks_l) )
+	{
+		sync_ticks = static_cast<unsigned short>( sync_ticks_l + ticks );
+	}
+	else
+	{
+		sync_ticks = PTP_MASTER_TIMEOUT;
+	}
+}
+
+
+/**
+ * @function	now
+ *
+ * @brief		Read disciplined time
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void PTP__::now( tStETH_Time& time )
+{
+	ETH__::get_time( time );
+}
+
+
+/**
+ * @function	now_ns
+ *
+ * @brief		Read disciplined time in nanoseconds
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned long long PTP__::now_ns( void )
+{
+	/* Local Variables */
+	tStETH_Time time;
+
+	ETH__::get_time( time );
+
+	return static_cast<unsigned long long>( to_ns( time ) );
+}
+
+
+/******* Private Member function for PTP__ class *******/
+
+/**
+ * @function	sample
+ *
+ * @brief		Take Sync with origin and receive time
+ *
+ * <i>Imp Note:</i>
+ * 				Delay is measured every PTP_DELAY_REQ_EVERY samples, offset
+ * 				uses the last filtered delay
+ *
+ */
+void PTP__::sample( void )
+{
+	offset = ( t2 - t1 ) - path_delay;
+	if( true == servo() ){ return; }
+	else{	/* Not required */	}
+
+	syncs = syncs + 1U;
+	if( (1U == syncs) || (0U == ( syncs % PTP_DELAY_REQ_EVERY )) )
+	{
+		send_delay_request();
+	}
+	else{	/* Not required */	}
+}
+
+
+/**
+ * @function	servo
+ *
+ * @brief		Step or steer system time by offset, true if stepped
+ *
+ * <i>Imp Note:</i>
+ * 				Integral holds frequency error in ppb and is kept across
+ * 				steps, so a slave stepped after a lost master needs no
+ * 				new pull in
+ *
+ */
+bool PTP__::servo( void )
+{
+	/* Local Variables */
+	long long ppb = 0;
+
+	if( (offset > PTP_STEP_THRESHOLD) || (offset < -PTP_STEP_THRESHOLD) )
+	{
+		/* Sync taken before step is stale for delay */
+		ETH__::step_time( -offset );
+		delay_state = PTP_DELAY_IDLE;
+		state = ePTP_State_::PTP_STATE_UNCALIBRATED;
+		return true;
+	}
+	else{	/* Not required */	}
+
+	/* Slave ahead of master runs slower */
+	integral += ( offset * PTP_KI_NUM ) / PTP_GAIN_DEN;
+	if( integral > ETH_PTP_MAX_PPB ){ integral = ETH_PTP_MAX_PPB; }
+	else if( integral < -ETH_PTP_MAX_PPB ){ integral = -ETH_PTP_MAX_PPB; }
+	else{	/* Not required */	}
+
+	ppb = -( ( offset * PTP_KP_NUM ) / PTP_GAIN_DEN + integral );
+	if( ppb > ETH_PTP_MAX_PPB ){ ppb = ETH_PTP_MAX_PPB; }
+	else if( ppb < -ETH_PTP_MAX_PPB ){ ppb = -ETH_PTP_MAX_PPB; }
+	else{	/* Not required */	}
+
+	rate = static_cast<long>( ppb );
+	ETH__::adjust_rate( rate );
+
+	state = ( (0U != delay_valid) && (offset < PTP_LOCK_THRESHOLD) && (offset > -PTP_LOCK_THRESHOLD) ) ?
+			ePTP_State_::PTP_STATE_SLAVE : ePTP_State_::PTP_STATE_UNCALIBRATED;
+
+	return false;
+}
+
+
+/**
+ * @function	send_delay_request
+ *
+ * @brief		Send Delay_Req with transmit timestamp
+ *
+ * <i>Imp Note:</i>
+ * 				An unanswered request is replaced by the next one
+ *
+ */
+void PTP__::send_delay_request( void )
+{
+	/* Local Variables */
+	unsigned char * p_message = UDP__::claim();
+	tStUDP_Endpoint destination;
+
+	if( nullptr == p_message ){ return; }
+	else{	/* Not required */	}
+
+	destination.ip = PTP_MULTICAST_IP;
+	destination.port = PTP_EVENT_PORT;
+
+	delay_sequence = delay_sequence + 1U;
+
+	/* Origin timestamp is left 0, time is taken by MAC */
+	memset( p_message, 0, PTP_DELAY_REQ_SIZE );
+	p_message[PTP_MESSAGE_TYPE] = PTP_TYPE_DELAY_REQ;
+	p_message[PTP_VERSION] = PTP_VERSION_2;
+	put_16( &p_message[PTP_LENGTH], PTP_DELAY_REQ_SIZE );
+	p_message[PTP_DOMAIN_NUMBER] = PTP_DOMAIN;
+	memcpy( &p_message[PTP_SOURCE_PORT], identity, PTP_PORT_IDENTITY_SIZE );
+	put_16( &p_message[PTP_SEQUENCE_ID], delay_sequence );
+	p_message[PTP_CONTROL] = PTP_CONTROL_DELAY_REQ;
+	p_message[PTP_LOG_INTERVAL] = 0x7FU;
+
+	if( eUDP_Status_::UDP_STATUS_SUCCESS == UDP__::send( destination, PTP_EVENT_PORT, PTP_DELAY_REQ_SIZE, true ) )
+	{
+		/* Master to slave direction of this exchange */
+		delay_t1 = t1;
+		delay_t2 = t2;
+		delay_state = PTP_DELAY_SENT;
+	}
+	else
+	{
+		delay_state = PTP_DELAY_IDLE;
+	}
+}
+
+
+/**
+ * @function	is_master
+ *
+ * @brief		Check source port identity against followed master
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+bool PTP__::is_master( const unsigned char * p_data )
+{
+	return ( 0 == memcmp( &p_data[PTP_SOURCE_PORT], master, PTP_PORT_IDENTITY_SIZE ) );
+}
+
+#endif	/* PTP_USED */
+
+
+/********************************** End of File *******************************/
@@ -0,0 +1,147 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		UDP data types Header
+* Filename:		mid_udp_types.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_udp_types.h
+ *  @brief:	This file contains data types definitions for UDP/IPv4 layer
+ */
+#ifndef MID_UDP_TYPES_H_
+#define MID_UDP_TYPES_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+/* Include private headers first */
+#include <private/mid_udp_conf.h>
+
+/* Include typedefs */
+#include <dri_types.h>
+#include <dri_eth_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Ethernet, IPv4 without options and UDP headers in front of payload */
+#define UDP_HEADERS_SIZE			42U
+
+/* Largest payload in one frame */
+#define UDP_MAX_PAYLOAD				( 1500U - 28U )
+
+/* Limited broadcast address */
+#define UDP_BROADCAST_IP			0xFFFFFFFFUL
+
+/* Multicast addresses 224.0.0.0/4 */
+#define UDP_MULTICAST_MASK			0xF0000000UL
+#define UDP_MULTICAST_IP			0xE0000000UL
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Enum for Status of UDP
+ * */
+enum class eUDP_Status_/*	:	unsigned char	*/
+{
+	UDP_STATUS_SUCCESS = 0,
+	UDP_STATUS_FAILED,
+	UDP_STATUS_BUSY,
+	UDP_STATUS_INVALID_ARGUMENT,
+	UDP_STATUS_UNREACHABLE
+};
+
+/*
+ * @brief	Enum for Open or close
+ * */
+enum class eUDP_Init_/*	:	unsigned char	*/
+{
+	UDP_INIT_CLOSE = 0,
+	UDP_INIT_OPEN
+};
+
+
+/******************************************************************************
+ *
+ * @brief	Data Types for UDP/IPv4 layer
+ *
+ *****************************************************************************/
+
+/*
+ * @brief	Structure for remote end of a datagram
+ */
+typedef struct tStUDP_Endpoint_
+{
+	unsigned long ip = 0U;					/**< IPv4 address, host order */
+	unsigned short port = 0U;				/**< UDP port */
+} tStUDP_Endpoint;
+
+/*
+ * @brief	typedef for received datagram, called from run()
+ *
+ * <i>Imp Note:</i>
+ * 			Payload points into receive buffer of ETH__ and is valid during
+ * 			call only
+ * */
+typedef void (*udp_rx_callback_pointer) ( const tStUDP_Endpoint& source, const unsigned char * p_data,
+											const unsigned short length );
+
+/*
+ * @brief	Structure for local port
+ */
+typedef struct tStUDP_Port_
+{
+	unsigned short port;					/**< Local UDP port */
+	udp_rx_callback_pointer fp_rx;			/**< Receiver of datagrams */
+} tStUDP_Port;
+
+/*
+ * @brief	Structure for static ARP cache entry
+ */
+typedef struct tStUDP_ArpEntry_
+{
+	unsigned long ip;						/**< IPv4 address, host order */
+	unsigned char mac[6];					/**< MAC address */
+} tStUDP_ArpEntry;
+
+/*
+ * @brief	Structure for statistics
+ */
+typedef struct tStUDP_Counters_
+{
+	unsigned long rx_datagrams = 0U;		/**< Datagrams handed to ports */
+	unsigned long rx_dropped = 0U;			/**< Frames not for a port or failing checks */
+	unsigned long arp_replies = 0U;			/**< ARP requests answered */
+	unsigned long tx_datagrams = 0U;		/**< Datagrams sent */
+	unsigned long tx_unresolved = 0U;		/**< Datagrams without ARP cache entry */
+} tStUDP_Counters;
+
+
+#endif /* MID_UDP_TYPES_H_ */
+
+/********************************** End of File *******************************/
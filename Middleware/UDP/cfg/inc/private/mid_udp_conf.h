@@ -0,0 +1,78 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		UDP Configuration Header
+* Filename:		mid_udp_conf.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_udp_conf.h
+ *  @brief:	This file contains static configurations for UDP/IPv4 layer
+ */
+#ifndef MID_UDP_CONF_H_
+#define MID_UDP_CONF_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+#define UDP_MAX_PORTS				8
+
+/* Total local ports used in system, ports are described in mid_udp_conf.cpp */
+#define UDP_PORTS_USED				3
+
+/* Entries of static ARP cache in mid_udp_conf.cpp */
+#define UDP_ARP_ENTRIES				2
+
+/* Address of device, subnet and router, as UDP_IPV4( a, b, c, d ) */
+#define UDP_LOCAL_IP				UDP_IPV4( 192U, 168U, 0U, 10U )
+#define UDP_NETMASK					UDP_IPV4( 255U, 255U, 255U, 0U )
+#define UDP_ROUTER_IP				UDP_IPV4( 192U, 168U, 0U, 1U )
+
+/* Time to live of sent datagrams */
+#define UDP_TTL						64U
+
+/* Frames taken from ETH__ per run */
+#define UDP_RX_PER_RUN				8U
+
+
+/* Check ports availability */
+#if (UDP_PORTS_USED > UDP_MAX_PORTS)
+	#error	"Cannot instantiate more than available ports"
+#endif
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* IPv4 address in host order */
+#define UDP_IPV4( a, b, c, d )		( ((unsigned long)(a) << 24U) | ((unsigned long)(b) << 16U) | \
+									  ((unsigned long)(c) << 8U) | (unsigned long)(d) )
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+#endif /* MID_UDP_CONF_H_ */
+
+/********************************** End of File *******************************/
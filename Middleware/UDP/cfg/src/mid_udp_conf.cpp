@@ -0,0 +1,97 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		UDP Configuration Source
+* Filename:		mid_udp_conf.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	mid_udp_conf.cpp
+ *  @brief:	This source file contains port table and ARP cache of UDP/IPv4
+ *  		layer
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_udp.h>
+#include <mid_ptp.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Check ports usage in system */
+#if( UDP_PORTS_USED > 0 )
+
+/*
+ * @brief	Local port table of UDP
+ */
+const tStUDP_Port g_udp_ports[UDP_PORTS_USED] =
+{
+		{/**< Port 0, telemetry commands */
+				5000U, udp_rx_handler
+		},
+		{/**< Port 1, PTP event messages */
+				PTP_EVENT_PORT, PTP__::event_input
+		},
+		{/**< Port 2, PTP general messages */
+				PTP_GENERAL_PORT, PTP__::general_input
+		}
+};
+
+/*
+ * @brief	Static ARP cache, destinations outside subnet use router entry
+ */
+const tStUDP_ArpEntry g_udp_arp_cache[UDP_ARP_ENTRIES] =
+{
+		{/**< Entry 0, router */
+				UDP_ROUTER_IP, { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U }
+		},
+		{/**< Entry 1, telemetry host */
+				UDP_IPV4( 192U, 168U, 0U, 2U ), { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U }
+		}
+};
+
+#endif	/* UDP_PORTS_USED */
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+
+/*********************************** End of File ******************************/
@@ -0,0 +1,208 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		UDP API Header
+* Filename:		mid_udp.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	mid_udp.h
+ *  @brief:	This file contains API function declarations for UDP/IPv4 and
+ *  		ARP over ETH__
+ */
+#ifndef MID_UDP_H_
+#define MID_UDP_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_udp_types.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+#if( UDP_PORTS_USED > 0 )
+extern const tStUDP_Port g_udp_ports[UDP_PORTS_USED];
+extern const tStUDP_ArpEntry g_udp_arp_cache[UDP_ARP_ENTRIES];
+
+/* Receive handler for user, named in port table */
+extern void udp_rx_handler( const tStUDP_Endpoint& source, const unsigned char * p_data,
+							const unsigned short length );
+#endif
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+
+/******************************************************************************
+ *
+ * @brief	Class for UDP/IPv4 layer
+ *
+ * 			Datagrams are read in place in receive buffers of ETH__ and built
+ * 			in place in its transmit descriptors. ARP requests for the local
+ * 			address are answered, remote addresses come from a static cache.
+ *
+ ******************************************************************************/
+
+/* Check ports usage in system */
+#if( UDP_PORTS_USED > 0 )
+
+class UDP__
+{
+/* public members */
+public:
+	/* Constructors */
+	UDP__() = delete;
+	UDP__( UDP__& ) = delete;
+
+	/**
+	 * @function	init
+	 *
+	 * @brief		Initialization function for UDP/IPv4 layer
+	 *
+	 * @param[in]	init	-	initialization state
+	 * 							eUDP_Init_	-	UDP_INIT_OPEN
+	 * 										UDP_INIT_CLOSE
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eUDP_Status_
+	 *          	UDP_STATUS_SUCCESS:		Operation successful.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 *
+	 * <i>Imp Note:</i>
+	 * 				ETH__ has to be initialized first
+	 *
+	 */
+	static eUDP_Status_ init( const eUDP_Init_& init = eUDP_Init_::UDP_INIT_OPEN );
+
+	/**
+	 * @function	claim
+	 *
+	 * @brief		Get payload area of next datagram
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	payload of UDP_MAX_PAYLOAD bytes in transmit ring or nullptr
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Headers are written in front of payload by send()
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from the same context as run()
+	 *
+	 */
+	static unsigned char * claim( void );
+
+	/**
+	 * @function	send
+	 *
+	 * @brief		Send payload returned by claim()
+	 *
+	 * @param[in]	destination	-	remote address and port
+	 * @param[in]	source_port	-	local port
+	 * @param[in]	length		-	payload length
+	 * @param[in]	timestamp	-	take transmit time, read by ETH__::get_tx_time()
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	eUDP_Status_
+	 *          	UDP_STATUS_SUCCESS:				Datagram handed to MAC.<BR>
+	 *          	UDP_STATUS_FAILED:				Not initialized or no link.<BR>
+	 *          	UDP_STATUS_BUSY:				Transmit ring is full.<BR>
+	 *          	UDP_STATUS_INVALID_ARGUMENT:	Wrong length.<BR>
+	 *          	UDP_STATUS_UNREACHABLE:			No ARP cache entry.<BR>
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Checksums are inserted by MAC, multicast destinations map
+	 * 				to 01:00:5E MAC addresses
+	 *
+	 * <i>Imp Note:</i>
+	 * 				To be called from the same context as run()
+	 *
+	 */
+	static eUDP_Status_ send( const tStUDP_Endpoint& destination, const unsigned short source_port,
+								const unsigned short length, const bool timestamp = false );
+
+	/**
+	 * @function	run
+	 *
+	 * @brief		Serve received frames
+	 *
+	 * @param[in]	NA
+	 *
+	 * @param[out]	NA
+	 *
+	 * @return  	NA
+	 *
+	 * \par<b>Description:</b><br>
+	 * 				Up to UDP_RX_PER_RUN frames are taken from ETH__, datagrams
+	 * 				go to port handlers and ARP requests are answered
+	 *
+	 * <i>Imp Note:</i>
+	 * 				Only context of ETH__ receive and transmit
+	 *
+	 */
+	static void run( void );
+
+	/******* Setters and Getters *******/
+	/* Receive time of datagram, valid in port handler only */
+	static bool get_rx_time( tStETH_Time& time );
+	/* Statistics */
+	static const tStUDP_Counters& get_counters( void ) { return counters; }
+
+/* private members */
+private:
+	/** Data Members **/
+	static tStUDP_Counters counters;
+	static const tStETH_Frame * p_rx_frame;
+	static unsigned short ip_id;
+	static unsigned char init_state;
+
+	/******* Private Member Functions *******/
+	static const unsigned char * arp_lookup( const unsigned long ip );
+	static void arp_input( const unsigned char * p_frame, const unsigned short length );
+	static void ip_input( const tStETH_Frame& frame );
+};
+
+#endif	/* UDP_PORTS_USED */
+
+
+#endif /* MID_UDP_H_ */
+
+/********************************** End of File *******************************/
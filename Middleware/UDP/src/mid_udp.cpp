@@ -0,0 +1,550 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		UDP API Source
+* Filename:		mid_udp.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	mid_udp.cpp
+ *  @brief:	This source file contains API function definitions for UDP/IPv4
+ *  		and ARP over ETH__.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <mid_udp.h>
+#include <dri_eth.h>
+#include <string.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Frames are handled by ETH__ */
+#if( 1 != ETH_USED )
+	#error	"UDP needs ETH__"
+#endif
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Ethernet header */
+#define UDP_ETH_DESTINATION			0U
+#define UDP_ETH_SOURCE				6U
+#define UDP_ETH_TYPE				12U
+#define UDP_ETH_HEADER				14U
+#define UDP_ETHERTYPE_IPV4			0x0800U
+#define UDP_ETHERTYPE_ARP			0x0806U
+
+/* ARP for IPv4 over Ethernet, offsets in frame */
+#define UDP_ARP_HTYPE				14U
+#define UDP_ARP_PTYPE				16U
+#define UDP_ARP_HLEN				18U
+#define UDP_ARP_PLEN				19U
+#define UDP_ARP_OPER				20U
+#define UDP_ARP_SHA					22U
+#define UDP_ARP_SPA					28U
+#define UDP_ARP_THA					32U
+#define UDP_ARP_TPA					38U
+#define UDP_ARP_SIZE				42U
+#define UDP_ARP_REQUEST				1U
+#define UDP_ARP_REPLY				2U
+
+/* IPv4 header, offsets in frame */
+#define UDP_IP_VERSION_IHL			14U
+#define UDP_IP_TOS					15U
+#define UDP_IP_LENGTH				16U
+#define UDP_IP_ID					18U
+#define UDP_IP_FRAGMENT				20U
+#define UDP_IP_TTL					22U
+#define UDP_IP_PROTOCOL				23U
+#define UDP_IP_CHECKSUM				24U
+#define UDP_IP_SOURCE				26U
+#define UDP_IP_DESTINATION			30U
+#define UDP_IP_HEADER				20U
+#define UDP_IP_DONT_FRAGMENT		0x4000U
+#define UDP_IP_FRAGMENT_MASK		0x3FFFU
+#define UDP_IP_PROTOCOL_UDP			17U
+
+/* UDP header, offsets from its start */
+#define UDP_SOURCE_PORT				0U
+#define UDP_DESTINATION_PORT		2U
+#define UDP_LENGTH					4U
+#define UDP_CHECKSUM				6U
+#define UDP_HEADER					8U
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Ethernet broadcast address */
+static const unsigned char sg_broadcast_mac[6] = { 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU };
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Network order field access */
+static inline unsigned short get_16( const unsigned char * p_data )
+{
+	return static_cast<unsigned short>( ( p_data[0] << 8U ) | p_data[1] );
+}
+
+static inline unsigned long get_32( const unsigned char * p_data )
+{
+	return ( (unsigned long)p_data[0] << 24U ) | ( (unsigned long)p_data[1] << 16U ) |
+			( (unsigned long)p_data[2] << 8U ) | (unsigned long)p_data[3];
+}
+
+static inline void put_16( unsigned char * p_data, const unsigned short value )
+{
+	p_data[0] = static_cast<unsigned char>( value >> 8U );
+	p_data[1] = static_cast<unsigned char>( value );
+}
+
+static inline void put_32( unsigned char * p_data, const unsigned long value )
+{
+	p_data[0] = static_cast<unsigned char>( value >> 24U );
+	p_data[1] = static_cast<unsigned char>( value >> 16U );
+	p_data[2] = static_cast<unsigned char>( value >> 8U );
+	p_data[3] = static_cast<unsigned char>( value );
+}
+
+
+/* Check ports usage in system */
+#if( UDP_PORTS_USED > 0 )
+
+/* Static members of UDP__ */
+tStUDP_Counters UDP__::counters;
+const tStETH_Frame * UDP__::p_rx_frame = nullptr;
+unsigned short UDP__::ip_id = 0U;
+unsigned char UDP__::init_state = 0U;
+
+
+/******* Public Member function for UDP__ class *******/
+
+/**
+ * @function	init
+ *
+ * @brief		Initialization function for UDP/IPv4 layer
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+eUDP_Status_ UDP__::init( const eUDP_Init_& init )
+{
+	/* Local Variables */
+	eUDP_Status_ ret_status = eUDP_Status_::UDP_STATUS_FAILED;
+
+	/* Check input argument */
+	switch( init )
+	{	/* Open layer */
+		case eUDP_Init_::UDP_INIT_OPEN:
+			/* Check for initialization */
+			if( init_state > 0 ){ break; }
+			else{	/* Not required */	}
+
+			counters = tStUDP_Counters();
+			ip_id = 0U;
+
+			/* Update initialization state */
+			init_state = 1U;
+			/* Update return status */
+			ret_status = eUDP_Status_::UDP_STATUS_SUCCESS;
+			break;
+
+		/* Close layer */
+		case eUDP_Init_::UDP_INIT_CLOSE:
+			/* Reset initialization state */
+			init_state = 0U;
+			/* Update return status */
+			ret_status = eUDP_Status_::UDP_STATUS_SUCCESS;
+			break;
+
+		default:
+			break;
+	}
+
+	return ret_status;
+}
+
+
+/**
+ * @function	claim
+ *
+ * @brief		Get payload area of next datagram
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+unsigned char * UDP__::claim( void )
+{
+	/* Local Variables */
+	unsigned char * p_frame = ETH__::claim();
+
+	return ( nullptr == p_frame ) ? nullptr : ( p_frame + UDP_HEADERS_SIZE );
+}
+
+
+/**
+ * @function	send
+ *
+ * @brief		Send payload returned by claim()
+ *
+ * <i>Imp Note:</i>
+ * 				Destinations outside subnet go to router
+ *
+ */
+eUDP_Status_ UDP__::send( const tStUDP_Endpoint& destination, const unsigned short source_port,
+							const unsigned short length, const bool timestamp )
+{
+	/* Local Variables */
+	unsigned char * p_frame = nullptr;
+	unsigned char * p_udp = nullptr;
+	const unsigned char * p_mac = nullptr;
+	unsigned char multicast_mac[6] = { 0x01U, 0x00U, 0x5EU, 0x00U, 0x00U, 0x00U };
+	unsigned long next_hop = destination.ip;
+
+	/* Check initialization and arguments */
+	DRIVER_ASSERT( 0U == init_state, eUDP_Status_::UDP_STATUS_FAILED );
+	DRIVER_ASSERT( (length > UDP_MAX_PAYLOAD) || (0U == destination.port),
+					eUDP_Status_::UDP_STATUS_INVALID_ARGUMENT );
+
+	/* Resolve next hop */
+	if( (UDP_BROADCAST_IP == destination.ip) ||
+		(( UDP_LOCAL_IP | ( UDP_BROADCAST_IP ^ UDP_NETMASK ) ) == destination.ip) )
+	{
+		p_mac = sg_broadcast_mac;
+	}
+	else if( UDP_MULTICAST_IP == ( destination.ip & UDP_MULTICAST_MASK ) )
+	{
+		/* Low 23 bits of group address */
+		multicast_mac[3] = static_cast<unsigned char>( ( destination.ip >> 16U ) & 0x7FU );
+		multicast_mac[4] = static_cast<unsigned char>( destination.ip >> 8U );
+		multicast_mac[5] = static_cast<unsigned char>( destination.ip );
+		p_mac = multicast_mac;
+	}
+	else
+	{
+		if( ( destination.ip & UDP_NETMASK ) != ( UDP_LOCAL_IP & UDP_NETMASK ) )
+		{
+			next_hop = UDP_ROUTER_IP;
+		}
+		else{	/* Not required */	}
+
+		p_mac = arp_lookup( next_hop );
+		if( nullptr == p_mac )
+		{
+			counters.tx_unresolved += 1U;
+			return eUDP_Status_::UDP_STATUS_UNREACHABLE;
+		}
+		else{	/* Not required */	}
+	}
+
+	/* Same buffer as handed out by claim() */
+	p_frame = ETH__::claim();
+	DRIVER_ASSERT( nullptr == p_frame, eUDP_Status_::UDP_STATUS_BUSY );
+
+	/* Ethernet header */
+	memcpy( &p_frame[UDP_ETH_DESTINATION], p_mac, 6U );
+	memcpy( &p_frame[UDP_ETH_SOURCE], ETH__::get_address(), 6U );
+	put_16( &p_frame[UDP_ETH_TYPE], UDP_ETHERTYPE_IPV4 );
+
+	/* IPv4 header without options, checksum inserted by MAC */
+	p_frame[UDP_IP_VERSION_IHL] = 0x45U;
+	p_frame[UDP_IP_TOS] = 0U;
+	put_16( &p_frame[UDP_IP_LENGTH], static_cast<unsigned short>( UDP_IP_HEADER + UDP_HEADER + length ) );
+	put_16( &p_frame[UDP_IP_ID], ip_id );
+	put_16( &p_frame[UDP_IP_FRAGMENT], UDP_IP_DONT_FRAGMENT );
+	p_frame[UDP_IP_TTL] = UDP_TTL;
+	p_frame[UDP_IP_PROTOCOL] = UDP_IP_PROTOCOL_UDP;
+	put_16( &p_frame[UDP_IP_CHECKSUM], 0U );
+	put_32( &p_frame[UDP_IP_SOURCE], UDP_LOCAL_IP );
+	put_32( &p_frame[UDP_IP_DESTINATION], destination.ip );
+
+	/* UDP header, checksum inserted by MAC */
+	p_udp = &p_frame[UDP_ETH_HEADER + UDP_IP_HEADER];
+	put_16( &p_udp[UDP_SOURCE_PORT], source_port );
+	put_16( &p_udp[UDP_DESTINATION_PORT], destination.port );
+	put_16( &p_udp[UDP_LENGTH], static_cast<unsigned short>( UDP_HEADER + length ) );
+	put_16( &p_udp[UDP_CHECKSUM], 0U );
+
+	/* Hand frame to DMA */
+	switch( ETH__::commit( static_cast<unsigned short>( UDP_HEADERS_SIZE + length ), timestamp ) )
+	{
+		case eETH_Status_::ETH_STATUS_SUCCESS:
+			ip_id = ip_id + 1U;
+			counters.tx_datagrams += 1U;
+			return eUDP_Status_::UDP_STATUS_SUCCESS;
+
+		case eETH_Status_::ETH_STATUS_BUSY:
+			return eUDP_Status_::UDP_STATUS_BUSY;
+
+		default:
+			return eUDP_Status_::UDP_STATUS_FAILED;
+	}
+}
+
+
+/**
+ * @function	run
+ *
+ * @brief		Serve received frames
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+void UDP__::run( void )
+{
+	/* Local Variables */
+	tStETH_Frame frame;
+	unsigned char count = 0U;
+
+	/* Check initialization */
+	if( 0U == init_state ){ return; }
+	else{	/* Not required */	}
+
+	while( (count < UDP_RX_PER_RUN) && ETH__::receive( frame ) )
+	{
+		count = count + 1U;
+
+		if( frame.length >= UDP_ETH_HEADER )
+		{
+			switch( get_16( &frame.p_data[UDP_ETH_TYPE] ) )
+			{
+				case UDP_ETHERTYPE_IPV4:
+					ip_input( frame );
+					break;
+
+				case UDP_ETHERTYPE_ARP:
+					arp_input( frame.p_data, frame.length );
+					break;
+
+				default:
+					counters.rx_dropped += 1U;
+					break;
+			}
+		}
+		else
+		{
+			counters.rx_dropped += 1U;
+		}
+
+		/* Datagrams are borrowed during handler call only */
+		ETH__::release( frame.p_data );
+	}
+}
+
+
+/**
+ * @function	get_rx_time
+ *
+ * @brief		Receive time of datagram in port handler
+ *
+ * <i>Imp Note:</i>
+ * 				Only frames timestamped by MAC carry a time
+ *
+ */
+bool UDP__::get_rx_time( tStETH_Time& time )
+{
+	if( (nullptr != p_rx_frame) && (0U != ( p_rx_frame->flags & ETH_FRAME_TIMESTAMP )) )
+	{
+		time = p_rx_frame->time;
+		return true;
+	}
+	else{	/* Not required */	}
+
+	return false;
+}
+
+
+/******* Private Member function for UDP__ class *******/
+
+/**
+ * @function	arp_lookup
+ *
+ * @brief		Find MAC address in static ARP cache
+ *
+ * <i>Imp Note:</i>
+ *
+ */
+const unsigned char * UDP__::arp_lookup( const unsigned long ip )
+{
+	/* Local Variables */
+	unsigned char index_l = 0U;
+
+	for( index_l = 0U; index_l < UDP_ARP_ENTRIES; ++index_l )
+	{
+		if( ip == g_udp_arp_cache[index_l].ip )
+		{
+			return g_udp_arp_cache[index_l].mac;
+		}
+		else{	/* Not required */	}
+	}
+
+	return nullptr;
+}
+
+
+/**
+ * @function	arp_input
+ *
+ * @brief		Answer ARP request for local address
+ *
+ * <i>Imp Note:</i>
+ * 				Reply is built in next transmit descriptor, it is skipped
+ * 				when ring is full and the requester retries
+ *
+ */
+void UDP__::arp_input( const unsigned char * p_frame, const unsigned short length )
+{
+	/* Local Variables */
+	unsigned char * p_reply = nullptr;
+
+	/* Check request for IPv4 over Ethernet to local address */
+	if( (length < UDP_ARP_SIZE) ||
+		(1U != get_16( &p_frame[UDP_ARP_HTYPE] )) ||
+		(UDP_ETHERTYPE_IPV4 != get_16( &p_frame[UDP_ARP_PTYPE] )) ||
+		(6U != p_frame[UDP_ARP_HLEN]) || (4U != p_frame[UDP_ARP_PLEN]) ||
+		(UDP_ARP_REQUEST != get_16( &p_frame[UDP_ARP_OPER] )) ||
+		(UDP_LOCAL_IP != get_32( &p_frame[UDP_ARP_TPA] )) )
+	{
+		counters.rx_dropped += 1U;
+		return;
+	}
+	else{	/* Not required */	}
+
+	p_reply = ETH__::claim();
+	if( nullptr == p_reply ){ return; }
+	else{	/* Not required */	}
+
+	/* Header fields up to operation are the same as in request */
+	memcpy( &p_reply[UDP_ETH_DESTINATION], &p_frame[UDP_ARP_SHA], 6U );
+	memcpy( &p_reply[UDP_ETH_SOURCE], ETH__::get_address(), 6U );
+	memcpy( &p_reply[UDP_ETH_TYPE], &p_frame[UDP_ETH_TYPE], UDP_ARP_OPER - UDP_ETH_TYPE );
+	put_16( &p_reply[UDP_ARP_OPER], UDP_ARP_REPLY );
+	memcpy( &p_reply[UDP_ARP_SHA], ETH__::get_address(), 6U );
+	put_32( &p_reply[UDP_ARP_SPA], UDP_LOCAL_IP );
+	memcpy( &p_reply[UDP_ARP_THA], &p_frame[UDP_ARP_SHA], 10U );
+
+	/* MAC pads frame to minimum size */
+	if( eETH_Status_::ETH_STATUS_SUCCESS == ETH__::commit( UDP_ARP_SIZE ) )
+	{
+		counters.arp_replies += 1U;
+	}
+	else{	/* Not required */	}
+}
+
+
+/**
+ * @function	ip_input
+ *
+ * @brief		Hand UDP datagram to port handler
+ *
+ * <i>Imp Note:</i>
+ * 				Only frames with checksums verified by MAC are taken,
+ * 				fragments are not reassembled
+ *
+ */
+void UDP__::ip_input( const tStETH_Frame& frame )
+{
+	/* Local Variables */
+	const unsigned char * p_udp = nullptr;
+	unsigned long destination = 0U;
+	unsigned short header = 0U;
+	unsigned short total = 0U;
+	unsigned short udp_length = 0U;
+	unsigned short port = 0U;
+	tStUDP_Endpoint source;
+	unsigned char index_l = 0U;
+
+	/* Checksums by MAC, header length and total length */
+	if( ((ETH_FRAME_IPV4 | ETH_FRAME_CHECKSUM_OK) != ( frame.flags & (ETH_FRAME_IPV4 | ETH_FRAME_CHECKSUM_OK) )) ||
+		(frame.length < ( UDP_ETH_HEADER + UDP_IP_HEADER + UDP_HEADER )) )
+	{
+		counters.rx_dropped += 1U;
+		return;
+	}
+	else{	/* Not required */	}
+
+	header = static_cast<unsigned short>( ( frame.p_data[UDP_IP_VERSION_IHL] & 0x0FU ) * 4U );
+	total = get_16( &frame.p_data[UDP_IP_LENGTH] );
+	destination = get_32( &frame.p_data[UDP_IP_DESTINATION] );
+
+	if( (UDP_IP_PROTOCOL_UDP != frame.p_data[UDP_IP_PROTOCOL]) ||
+		(0U != ( get_16( &frame.p_data[UDP_IP_FRAGMENT] ) & UDP_IP_FRAGMENT_MASK )) ||
+		(header < UDP_IP_HEADER) || (total > ( frame.length - UDP_ETH_HEADER )) ||
+		(total < ( header + UDP_HEADER )) ||
+		((UDP_LOCAL_IP != destination) && (UDP_BROADCAST_IP != destination) &&
+		 (( UDP_LOCAL_IP | ( UDP_BROADCAST_IP ^ UDP_NETMASK ) ) != destination) &&
+		 (UDP_MULTICAST_IP != ( destination & UDP_MULTICAST_MASK ))) )
+	{
+		counters.rx_dropped += 1U;
+		return;
+	}
+	else{	/* Not required */	}
+
+	p_udp = &frame.p_data[UDP_ETH_HEADER + header];
+	udp_length = get_16( &p_udp[UDP_LENGTH] );
+	if( (udp_length < UDP_HEADER) || (udp_length > ( total - header )) )
+	{
+		counters.rx_dropped += 1U;
+		return;
+	}
+	else{	/* Not required */	}
+
+	/* Find local port */
+	port = get_16( &p_udp[UDP_DESTINATION_PORT] );
+	for( index_l = 0U; index_l < UDP_PORTS_USED; ++index_l )
+	{
+		if( port == g_udp_ports[index_l].port )
+		{
+			source.ip = get_32( &frame.p_data[UDP_IP_SOURCE] );
+			source.port = get_16( &p_udp[UDP_SOURCE_PORT] );
+			counters.rx_datagrams += 1U;
+
+			p_rx_frame = &frame;
+			g_udp_ports[index_l].fp_rx( source, &p_udp[UDP_HEADER],
+										static_cast<unsigned short>( udp_length - UDP_HEADER ) );
+			p_rx_frame = nullptr;
+			return;
+		}
+		else{	/* Not required */	}
+	}
+
+	counters.rx_dropped += 1U;
+}
+
+#endif	/* UDP_PORTS_USED */
+
+
+/********************************** End of File *******************************/
@@ -0,0 +1,189 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Host Core Intrinsics Header
+* Filename:		core_cm4.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	core_cm4.h
+ *  @brief:	This file wraps CMSIS core header for host tests. Device header
+ *  		includes it by name, so Test/inc is found first. CMSIS GCC
+ *  		intrinsics are ARM assembly, they are kept out by the guard of
+ *  		cmsis_gcc.h and replaced here by host code. PRIMASK is a plain
+ *  		variable, barriers and sleep do nothing. Register definitions
+ *  		come unchanged from CMSIS core header.
+ */
+#ifndef TST_CORE_CM4_H_
+#define TST_CORE_CM4_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* cmsis_gcc.h is replaced by this file */
+#define __CMSIS_GCC_H
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Compiler specific defines of cmsis_gcc.h */
+#define __ASM					__asm
+#define __INLINE				inline
+#define __STATIC_INLINE			static inline
+#define __STATIC_FORCEINLINE	__attribute__((always_inline)) static inline
+#define __NO_RETURN				__attribute__((__noreturn__))
+#define __USED					__attribute__((used))
+#define __WEAK					__attribute__((weak))
+#define __PACKED				__attribute__((packed, aligned(1)))
+#define __PACKED_STRUCT			struct __attribute__((packed, aligned(1)))
+#define __PACKED_UNION			union __attribute__((packed, aligned(1)))
+#define __ALIGNED(x)			__attribute__((aligned(x)))
+#define __RESTRICT				__restrict
+
+/* Hints and barriers */
+#define __NOP()					do{ }while( 0 )
+#define __WFI()					do{ }while( 0 )
+#define __WFE()					do{ }while( 0 )
+#define __SEV()					do{ }while( 0 )
+#define __BKPT(value)			do{ }while( 0 )
+#define __CLZ					__builtin_clz
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* PRIMASK of host model, one for all translation units of a test */
+inline volatile uint32_t& tst_primask( void )
+{
+	static volatile uint32_t primask = 0U;
+	return primask;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK( void ) { return tst_primask(); }
+__STATIC_FORCEINLINE void __set_PRIMASK( uint32_t priMask ) { tst_primask() = priMask; }
+__STATIC_FORCEINLINE void __disable_irq( void ) { tst_primask() = 1U; }
+__STATIC_FORCEINLINE void __enable_irq( void ) { tst_primask() = 0U; }
+__STATIC_FORCEINLINE uint32_t __get_IPSR( void ) { return 0U; }
+
+__STATIC_FORCEINLINE void __ISB( void ) { __atomic_thread_fence( __ATOMIC_SEQ_CST ); }
+__STATIC_FORCEINLINE void __DSB( void ) { __atomic_thread_fence( __ATOMIC_SEQ_CST ); }
+__STATIC_FORCEINLINE void __DMB( void ) { __atomic_thread_fence( __ATOMIC_SEQ_CST ); }
+
+__STATIC_FORCEINLINE uint32_t __REV( uint32_t value ) { return __builtin_bswap32( value ); }
+__STATIC_FORCEINLINE uint32_t __REV16( uint32_t value )
+{
+	return ( ((value & 0x00FF00FFU) << 8U) | ((value >> 8U) & 0x00FF00FFU) );
+}
+__STATIC_FORCEINLINE uint32_t __RBIT( uint32_t value )
+{
+	uint32_t result = 0U;
+
+	for( uint32_t bit = 0U; bit < 32U; ++bit )
+	{
+		result = ( result << 1U ) | ( (value >> bit) & 1U );
+	}
+	return result;
+}
+
+/* Saturate to bits as signed or unsigned number, bits taken as constant */
+__STATIC_FORCEINLINE int32_t __SSAT( int32_t val, uint32_t sat )
+{
+	const int32_t max = (int32_t)( (1UL << (sat - 1U)) - 1U );
+	const int32_t min = -max - 1;
+
+	return ( val > max ) ? max : ( ( val < min ) ? min : val );
+}
+__STATIC_FORCEINLINE uint32_t __USAT( int32_t val, uint32_t sat )
+{
+	const uint32_t max = (uint32_t)( (1UL << sat) - 1U );
+
+	return ( val < 0 ) ? 0U : ( ( (uint32_t)val > max ) ? max : (uint32_t)val );
+}
+
+/* SIMD of DSP extension, halfwords are signed 16 bit lanes */
+__STATIC_FORCEINLINE uint32_t __SMLAD( uint32_t op1, uint32_t op2, uint32_t op3 )
+{
+	return (uint32_t)( (int32_t)op3 +
+						( (int32_t)(int16_t)op1 * (int16_t)op2 ) +
+						( (int32_t)(int16_t)(op1 >> 16U) * (int16_t)(op2 >> 16U) ) );
+}
+__STATIC_FORCEINLINE uint64_t __SMLALD( uint32_t op1, uint32_t op2, uint64_t acc )
+{
+	return (uint64_t)( (int64_t)acc +
+						( (int64_t)(int16_t)op1 * (int16_t)op2 ) +
+						( (int64_t)(int16_t)(op1 >> 16U) * (int16_t)(op2 >> 16U) ) );
+}
+__STATIC_FORCEINLINE uint32_t __QADD16( uint32_t op1, uint32_t op2 )
+{
+	const uint32_t low = (uint32_t)(uint16_t)__SSAT( (int16_t)op1 + (int16_t)op2, 16U );
+	const uint32_t high = (uint32_t)(uint16_t)__SSAT( (int16_t)(op1 >> 16U) + (int16_t)(op2 >> 16U), 16U );
+
+	return ( (high << 16U) | low );
+}
+__STATIC_FORCEINLINE uint32_t __SMUAD( uint32_t op1, uint32_t op2 )
+{
+	return (uint32_t)( ( (int32_t)(int16_t)op1 * (int16_t)op2 ) +
+						( (int32_t)(int16_t)(op1 >> 16U) * (int16_t)(op2 >> 16U) ) );
+}
+__STATIC_FORCEINLINE uint32_t __SMUSDX( uint32_t op1, uint32_t op2 )
+{
+	return (uint32_t)( ( (int32_t)(int16_t)op1 * (int16_t)(op2 >> 16U) ) -
+						( (int32_t)(int16_t)(op1 >> 16U) * (int16_t)op2 ) );
+}
+
+/* Halving add and subtract, lanes as {low, high} */
+__STATIC_FORCEINLINE uint32_t tst_pack16( int32_t low, int32_t high )
+{
+	return ( ((uint32_t)(uint16_t)high << 16U) | (uint32_t)(uint16_t)low );
+}
+__STATIC_FORCEINLINE uint32_t __SHADD16( uint32_t op1, uint32_t op2 )
+{
+	return tst_pack16( ((int16_t)op1 + (int16_t)op2) >> 1,
+						((int16_t)(op1 >> 16U) + (int16_t)(op2 >> 16U)) >> 1 );
+}
+__STATIC_FORCEINLINE uint32_t __SHSUB16( uint32_t op1, uint32_t op2 )
+{
+	return tst_pack16( ((int16_t)op1 - (int16_t)op2) >> 1,
+						((int16_t)(op1 >> 16U) - (int16_t)(op2 >> 16U)) >> 1 );
+}
+__STATIC_FORCEINLINE uint32_t __SHASX( uint32_t op1, uint32_t op2 )
+{
+	return tst_pack16( ((int16_t)op1 - (int16_t)(op2 >> 16U)) >> 1,
+						((int16_t)(op1 >> 16U) + (int16_t)op2) >> 1 );
+}
+__STATIC_FORCEINLINE uint32_t __SHSAX( uint32_t op1, uint32_t op2 )
+{
+	return tst_pack16( ((int16_t)op1 + (int16_t)(op2 >> 16U)) >> 1,
+						((int16_t)(op1 >> 16U) - (int16_t)op2) >> 1 );
+}
+#define __PKHBT( ARG1, ARG2, ARG3 )		( ( ((uint32_t)(ARG1)) & 0x0000FFFFUL ) | \
+										  ( (((uint32_t)(ARG2)) << (ARG3)) & 0xFFFF0000UL ) )
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include_next <core_cm4.h>
+
+
+#endif /* TST_CORE_CM4_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,115 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Host Ethernet MAC Model Header
+* Filename:		tst_eth_model.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	tst_eth_model.h
+ *  @brief:	This file contains host model of ETH MAC DMA for tests of ETH__
+ *  		and layers above it, see tst_eth_model.cpp
+ */
+#ifndef TST_ETH_MODEL_H_
+#define TST_ETH_MODEL_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <dri_eth.h>
+#include <vector>
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* RDES4 extended status written by model */
+#define TST_RDES4_UDP				0x00000001U
+#define TST_RDES4_ICMP				0x00000003U
+#define TST_RDES4_IP_HEADER_ERROR	0x00000008U
+#define TST_RDES4_IP_PAYLOAD_ERROR	0x00000010U
+#define TST_RDES4_IPV4				0x00000040U
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	typedef for frames leaving MAC, frame is valid during call only
+ * */
+typedef void (*tst_wire_pointer) ( const unsigned char * p_data, const unsigned short length );
+
+/*
+ * @brief	State of MAC DMA model
+ */
+typedef struct tStTst_Dma_
+{
+	XMC_ETH_MAC_t * p_mac = nullptr;		/**< MAC handed to XMC_ETH_MAC_Init() */
+	unsigned long events = 0U;				/**< Pending STATUS bits */
+	unsigned long enabled = 0U;				/**< Enabled events */
+	unsigned char rx_index = 0U;			/**< Next receive descriptor of DMA */
+	unsigned char tx_index = 0U;			/**< Next transmit descriptor of DMA */
+	unsigned long seconds = 100U;			/**< System time put into descriptors */
+	unsigned long nanoseconds = 0U;
+	unsigned long frame_ns = 1000U;			/**< System time passing per frame */
+	long drift_ppb = 0;						/**< Oscillator against nominal, tst_clock_advance() */
+	double cycles = 0.0;					/**< Fraction of system clock cycle */
+	unsigned long long accumulator = 0U;	/**< Fine update accumulator */
+	unsigned long interrupts = 0U;			/**< Calls of isr_entry() */
+	unsigned long tx_interrupt_requests = 0U;	/**< Transmit descriptors with IC */
+	XMC_ETH_LINK_STATUS_t link = XMC_ETH_LINK_STATUS_UP;
+	tst_wire_pointer fp_wire = nullptr;		/**< Receiver of sent frames, nullptr - loopback */
+	std::vector<unsigned long> rx_buffers;	/**< Buffer of each received frame */
+} tStTst_Dma;
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+extern tStTst_Dma g_tst_dma;
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Fresh model and ETH__ with link up */
+void tst_dma_open( void );
+
+/* Raise events, interrupt is taken at once when enabled */
+void tst_dma_interrupt( const unsigned long events );
+
+/* Write frame into next receive descriptor with checksum status, false if CPU owns it */
+bool tst_dma_receive( const unsigned char * p_data, const unsigned short length,
+						const unsigned long status = 0U );
+
+/* Receive frame and raise receive or buffer unavailable event */
+bool tst_dma_input( const unsigned char * p_data, const unsigned short length );
+
+/* Send transmit descriptors owned by DMA to wire, then raise events */
+void tst_dma_run( void );
+
+/* Run system time for true nanoseconds on drifting oscillator, apply pending update */
+void tst_clock_advance( const unsigned long long nanoseconds );
+
+/* Insert IPv4 header and UDP or ICMP checksums like MAC checksum offload */
+void tst_checksum_insert( unsigned char * p_data, const unsigned short length );
+
+/* Check checksums like MAC, RDES4 status */
+unsigned long tst_checksum_check( const unsigned char * p_data, const unsigned short length );
+
+
+#endif /* TST_ETH_MODEL_H_ */
+
+/********************************** End of File *******************************/
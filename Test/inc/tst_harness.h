@@ -0,0 +1,147 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Host Test Harness Header
+* Filename:		tst_harness.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	tst_harness.h
+ *  @brief:	This file contains checks, test runner and cycle counter for
+ *  		host tests and benchmarks, see Test/Makefile
+ */
+#ifndef TST_HARNESS_H_
+#define TST_HARNESS_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/* Check condition, test goes on after a failure */
+#define TST_CHECK( cond )														\
+	do{																			\
+		if( !(cond) ){ tst_fail( __FILE__, __LINE__, #cond ); }					\
+	}while( 0 )
+
+/* Check equality of two integral values, both are printed on failure */
+#define TST_CHECK_EQ( expected, actual )										\
+	do{																			\
+		const long long tst_e_l = (long long)(expected);						\
+		const long long tst_a_l = (long long)(actual);							\
+		if( tst_e_l != tst_a_l )												\
+		{																		\
+			tst_fail( __FILE__, __LINE__, #actual );							\
+			printf( "        expected %lld, got %lld\n", tst_e_l, tst_a_l );	\
+		}																		\
+	}while( 0 )
+
+/* Run test function and report it */
+#define TST_RUN( test )		tst_run( #test, test )
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Checks failed in running test and tests failed in total */
+static unsigned long sg_tst_failed_checks = 0U;
+static unsigned long sg_tst_failed_tests = 0U;
+static unsigned long sg_tst_tests = 0U;
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+static inline void tst_fail( const char * p_file, const int line, const char * p_cond )
+{
+	++sg_tst_failed_checks;
+	printf( "    FAIL %s:%d: %s\n", p_file, line, p_cond );
+}
+
+static inline void tst_run( const char * p_name, void (*fp_test)( void ) )
+{
+	sg_tst_failed_checks = 0U;
+	++sg_tst_tests;
+	fp_test();
+	if( 0U != sg_tst_failed_checks )
+	{
+		++sg_tst_failed_tests;
+	}
+	printf( "[%s] %s\n", ( 0U == sg_tst_failed_checks ) ? "PASS" : "FAIL", p_name );
+}
+
+/* Summary line, result to be returned from main() */
+static inline int tst_result( void )
+{
+	printf( "%lu of %lu tests passed\n", sg_tst_tests - sg_tst_failed_tests, sg_tst_tests );
+	return ( ( 0U == sg_tst_failed_tests ) ? 0 : 1 );
+}
+
+/*
+ * Host cycle counter for benchmarks. TSC counts at a constant reference
+ * rate on current x86, other hosts count nanoseconds instead. Numbers
+ * compare paths on one host, target figures come from CLOCK__::now()
+ */
+static inline unsigned long long tst_cycles( void )
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch() ).count();
+#endif
+}
+
+/* Wall clock nanoseconds, for rates per second */
+static inline unsigned long long tst_ns( void )
+{
+	return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+/* Keep benchmark results alive without volatile access in loop */
+template <typename T>
+static inline void tst_keep( const T& value )
+{
+	__asm__ __volatile__( "" : : "g"( &value ) : "memory" );
+}
+
+
+#endif /* TST_HARNESS_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,162 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Host pcap File Header
+* Filename:		tst_pcap.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	tst_pcap.h
+ *  @brief:	This file contains writer and reader of classic pcap files with
+ *  		Ethernet frames, for capture and replay of wire traffic in host
+ *  		tests. Files open in Wireshark and tcpdump.
+ */
+#ifndef TST_PCAP_H_
+#define TST_PCAP_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <stdint.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* File header, microsecond times in writer byte order */
+#define TST_PCAP_MAGIC			0xA1B2C3D4U
+#define TST_PCAP_SWAPPED		0xD4C3B2A1U
+#define TST_PCAP_SNAPLEN		65535U
+#define TST_PCAP_ETHERNET		1U
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+typedef struct tStTst_Pcap_Header_
+{
+	uint32_t magic;
+	uint16_t version_major;
+	uint16_t version_minor;
+	int32_t zone;
+	uint32_t sigfigs;
+	uint32_t snaplen;
+	uint32_t network;
+} tStTst_Pcap_Header;
+
+typedef struct tStTst_Pcap_Record_
+{
+	uint32_t seconds;
+	uint32_t microseconds;
+	uint32_t captured;
+	uint32_t length;
+} tStTst_Pcap_Record;
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/* Create file and write header, nullptr on error */
+static inline FILE * tst_pcap_create( const char * p_path )
+{
+	const tStTst_Pcap_Header header_l = { TST_PCAP_MAGIC, 2U, 4U, 0, 0U, TST_PCAP_SNAPLEN, TST_PCAP_ETHERNET };
+	FILE * const p_file = fopen( p_path, "wb" );
+
+	if( (nullptr != p_file) && (1U != fwrite( &header_l, sizeof(header_l), 1U, p_file )) )
+	{
+		fclose( p_file );
+		return nullptr;
+	}
+	else{	/* Not required */	}
+
+	return p_file;
+}
+
+/* Append frame without FCS */
+static inline void tst_pcap_write( FILE * p_file, const unsigned char * p_data, const unsigned short length,
+									const unsigned long seconds, const unsigned long nanoseconds )
+{
+	const tStTst_Pcap_Record record_l = { (uint32_t)seconds, (uint32_t)(nanoseconds / 1000U), length, length };
+
+	if( nullptr == p_file ){ return; }
+	else{	/* Not required */	}
+
+	(void) fwrite( &record_l, sizeof(record_l), 1U, p_file );
+	(void) fwrite( p_data, 1U, length, p_file );
+}
+
+/* Open Ethernet capture for reading, swapped tells byte order of records */
+static inline FILE * tst_pcap_open( const char * p_path, bool& swapped )
+{
+	tStTst_Pcap_Header header_l;
+	FILE * const p_file = fopen( p_path, "rb" );
+
+	if( nullptr == p_file ){ return nullptr; }
+	else{	/* Not required */	}
+
+	swapped = false;
+	if( 1U == fread( &header_l, sizeof(header_l), 1U, p_file ) )
+	{
+		swapped = ( TST_PCAP_SWAPPED == header_l.magic );
+		if( swapped )
+		{
+			header_l.network = __builtin_bswap32( header_l.network );
+		}
+		else{	/* Not required */	}
+
+		if( ((TST_PCAP_MAGIC == header_l.magic) || swapped) && (TST_PCAP_ETHERNET == header_l.network) )
+		{
+			return p_file;
+		}
+		else{	/* Not required */	}
+	}
+	else{	/* Not required */	}
+
+	fclose( p_file );
+	return nullptr;
+}
+
+/* Read next frame, records longer than buffer are cut, false at end of file */
+static inline bool tst_pcap_read( FILE * p_file, const bool swapped, unsigned char * p_buffer,
+									const unsigned short size, unsigned short& length )
+{
+	tStTst_Pcap_Record record_l;
+	uint32_t keep_l = 0U;
+
+	if( 1U != fread( &record_l, sizeof(record_l), 1U, p_file ) ){ return false; }
+	else{	/* Not required */	}
+
+	if( swapped )
+	{
+		record_l.captured = __builtin_bswap32( record_l.captured );
+	}
+	else{	/* Not required */	}
+
+	keep_l = ( record_l.captured > size ) ? size : record_l.captured;
+	if( (keep_l != fread( p_buffer, 1U, keep_l, p_file )) ||
+		(0 != fseek( p_file, (long)(record_l.captured - keep_l), SEEK_CUR )) )
+	{
+		return false;
+	}
+	else{	/* Not required */	}
+
+	length = (unsigned short)keep_l;
+	return true;
+}
+
+
+#endif /* TST_PCAP_H_ */
+
+/********************************** End of File *******************************/
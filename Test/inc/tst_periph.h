@@ -0,0 +1,71 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Host Peripheral Memory Header
+* Filename:		tst_periph.h
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*******************************************************************************/
+
+/** @file:	tst_periph.h
+ *  @brief:	This file maps zeroed memory at the peripheral and core register
+ *  		addresses of XMC4500, so drivers run unchanged on host. Registers
+ *  		behave as plain memory, bits set by hardware are set by the test.
+ */
+#ifndef TST_PERIPH_H_
+#define TST_PERIPH_H_
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+
+
+/******************************************************************************
+* Configuration Constants
+*******************************************************************************/
+
+/* Peripherals from PBA0 to end of PBA2, and private peripheral bus of core */
+#define TST_PERIPH_BASE			0x40000000UL
+#define TST_PERIPH_SIZE			0x20000000UL
+#define TST_CORE_BASE			0xE0000000UL
+#define TST_CORE_SIZE			0x00100000UL
+
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+static inline void tst_map( const unsigned long base, const unsigned long size )
+{
+	void * const p_map = mmap( reinterpret_cast<void*>(base), size, PROT_READ | PROT_WRITE,
+								MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE | MAP_NORESERVE,
+								-1, 0 );
+
+	if( reinterpret_cast<void*>(base) != p_map )
+	{
+		printf( "cannot map register memory at 0x%08lX\n", base );
+		exit( 2 );
+	}
+}
+
+/* To be called first in main() */
+static inline void tst_map_peripherals( void )
+{
+	tst_map( TST_PERIPH_BASE, TST_PERIPH_SIZE );
+	tst_map( TST_CORE_BASE, TST_CORE_SIZE );
+}
+
+
+#endif /* TST_PERIPH_H_ */
+
+/********************************** End of File *******************************/
@@ -0,0 +1,311 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		CRC Engine Host Test and Benchmark
+* Filename:		tst_crc.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	tst_crc.cpp
+ *  @brief:	This source file contains tests of the software engine of CRC__,
+ *  		which the host build selects as it has no FCE. Results are
+ *  		checked against catalogued check values and a bit wise
+ *  		reference of the FCE kernels, and bytes per cycle of slice-by-8
+ *  		are compared with the byte wise table engine and the bit wise
+ *  		fold used for FCE tails.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <tst_harness.h>
+#include <dri_crc.h>
+#include <string.h>
+#include <vector>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Benchmark buffer and passes */
+#define TST_BENCH_BYTES			4096U
+#define TST_BENCH_PASSES		2000U
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Parameters of CRC in catalogue form
+ */
+typedef struct tStTst_Crc_Model_
+{
+	unsigned char width;
+	unsigned long polynomial;
+	unsigned long seed;
+	bool reflect_in;
+	bool reflect_out;
+	unsigned long xor_out;
+	unsigned long check;					/**< CRC of "123456789" */
+} tStTst_Crc_Model;
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Kernels as configured in g_crc_config, indexed by eCRC_Kernel_ */
+static const tStTst_Crc_Model sg_tst_models[CRC_MAX_KERNELS] =
+{
+	{ 32U, 0x04C11DB7UL, 0xFFFFFFFFUL, true, true, 0xFFFFFFFFUL, 0xCBF43926UL },		/* CRC-32 */
+	{ 32U, 0x04C11DB7UL, 0xFFFFFFFFUL, false, false, 0x00000000UL, 0x0376E6E7UL },	/* CRC-32/MPEG-2 */
+	{ 16U, 0x1021UL, 0xFFFFUL, false, false, 0x0000UL, 0x29B1UL },					/* CRC-16/CCITT-FALSE */
+	{ 8U, 0x1DUL, 0xFFUL, false, false, 0xFFUL, 0x4BUL }							/* CRC-8/SAE-J1850 */
+};
+
+static const unsigned char sg_tst_check[] = "123456789";
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Bit wise reference, one bit per step as the CRC is defined */
+static unsigned long tst_reference( const tStTst_Crc_Model& model, const unsigned char * p_data,
+									const unsigned long length )
+{
+	const unsigned long top_l = 1UL << (model.width - 1U);
+	const unsigned long mask_l = ( 32U == model.width ) ? 0xFFFFFFFFUL : ( (1UL << model.width) - 1UL );
+	unsigned long crc_l = model.seed;
+	unsigned long result_l = 0U;
+
+	for( unsigned long index_l = 0U; index_l < length; ++index_l )
+	{
+		for( unsigned char bit_l = 0U; bit_l < 8U; ++bit_l )
+		{
+			const unsigned long in_l = model.reflect_in ? ( (p_data[index_l] >> bit_l) & 1U ) :
+															( (p_data[index_l] >> (7U - bit_l)) & 1U );
+			const bool feedback_l = ( 0U != (crc_l & top_l) ) != ( 0U != in_l );
+
+			crc_l = ( (crc_l << 1U) ^ ( feedback_l ? model.polynomial : 0U ) ) & mask_l;
+		}
+	}
+
+	if( model.reflect_out )
+	{
+		for( unsigned char bit_l = 0U; bit_l < model.width; ++bit_l )
+		{
+			result_l = (result_l << 1U) | ( (crc_l >> bit_l) & 1U );
+		}
+		crc_l = result_l;
+	}
+	else{	/* Not required */	}
+
+	return ( crc_l ^ model.xor_out ) & mask_l;
+}
+
+/* Byte wise table engine as it was before slice-by-8, for benchmark */
+static unsigned long tst_bytewise( const unsigned long (&table)[256], const unsigned long seed,
+									const unsigned char * p_data, unsigned long length )
+{
+	unsigned long crc_l = seed;
+
+	while( length > 0U )
+	{
+		crc_l = ( ( crc_l << 8U ) & 0xFFFFFFFFUL ) ^ table[( crc_l >> 24U ) ^ *p_data];
+		++p_data;
+		--length;
+	}
+
+	return crc_l;
+}
+
+/* Bit wise fold as used for FCE tails, for benchmark */
+static unsigned long tst_bitwise( const unsigned long seed, const unsigned char * p_data, unsigned long length )
+{
+	unsigned long crc_l = seed;
+
+	while( length > 0U )
+	{
+		crc_l ^= (unsigned long)*p_data << 24U;
+		for( unsigned char bit_l = 0U; bit_l < 8U; ++bit_l )
+		{
+			crc_l = ( 0U != (crc_l & 0x80000000UL) ) ? ( (crc_l << 1U) ^ 0x04C11DB7UL ) : ( crc_l << 1U );
+		}
+		crc_l &= 0xFFFFFFFFUL;
+		++p_data;
+		--length;
+	}
+
+	return crc_l;
+}
+
+static void tst_fill( std::vector<unsigned char>& data, unsigned long seed )
+{
+	for( unsigned char& byte_l : data )
+	{
+		seed = ( seed * 1103515245UL ) + 12345UL;
+		byte_l = static_cast<unsigned char>( seed >> 16U );
+	}
+}
+
+/******* Tests *******/
+
+/* Catalogued check values of all kernels */
+static void test_check_values( void )
+{
+	unsigned long result_l = 0U;
+
+	for( unsigned char kernel_l = 0U; kernel_l < CRC_MAX_KERNELS; ++kernel_l )
+	{
+		TST_CHECK( eCRC_Status_::CRC_STATUS_SUCCESS ==
+					CRC__::compute( static_cast<eCRC_Kernel_>( kernel_l ), sg_tst_check, 9U, result_l ) );
+		TST_CHECK_EQ( sg_tst_models[kernel_l].check, result_l );
+		TST_CHECK_EQ( sg_tst_models[kernel_l].check, tst_reference( sg_tst_models[kernel_l], sg_tst_check, 9U ) );
+	}
+}
+
+/* Every length and alignment around slice boundaries matches reference */
+static void test_lengths( void )
+{
+	std::vector<unsigned char> data_l( 96U );
+	unsigned long result_l = 0U;
+
+	tst_fill( data_l, 7U );
+	for( unsigned char kernel_l = 0U; kernel_l < CRC_MAX_KERNELS; ++kernel_l )
+	{
+		for( unsigned long offset_l = 0U; offset_l < 8U; ++offset_l )
+		{
+			for( unsigned long length_l = 0U; length_l <= 80U; ++length_l )
+			{
+				(void) CRC__::compute( static_cast<eCRC_Kernel_>( kernel_l ), &data_l[offset_l], length_l, result_l );
+				TST_CHECK_EQ( tst_reference( sg_tst_models[kernel_l], &data_l[offset_l], length_l ), result_l );
+			}
+		}
+	}
+}
+
+/* Stream split in any pieces gives CRC of whole */
+static void test_split_updates( void )
+{
+	std::vector<unsigned char> data_l( 1000U );
+	const eCRC_Kernel_ kernel_l = eCRC_Kernel_::CRC_KERNEL_32_0;
+	unsigned long whole_l = 0U;
+	unsigned long position_l = 0U;
+	unsigned long piece_l = 1U;
+
+	tst_fill( data_l, 11U );
+	(void) CRC__::compute( kernel_l, data_l.data(), data_l.size(), whole_l );
+
+	TST_CHECK( eCRC_Status_::CRC_STATUS_SUCCESS == CRC__::start( kernel_l ) );
+	while( position_l < data_l.size() )
+	{
+		const unsigned long length_l = ( piece_l < (data_l.size() - position_l) ) ? piece_l : (data_l.size() - position_l);
+
+		TST_CHECK( eCRC_Status_::CRC_STATUS_SUCCESS == CRC__::update( kernel_l, &data_l[position_l], length_l ) );
+		position_l += length_l;
+		piece_l = ( piece_l % 13U ) + 1U;
+	}
+	TST_CHECK_EQ( whole_l, CRC__::get_result( kernel_l ) );
+
+	/* Kernels keep their own state */
+	TST_CHECK( eCRC_Status_::CRC_STATUS_SUCCESS == CRC__::start( eCRC_Kernel_::CRC_KERNEL_16 ) );
+	TST_CHECK( eCRC_Status_::CRC_STATUS_SUCCESS == CRC__::update( eCRC_Kernel_::CRC_KERNEL_16, sg_tst_check, 4U ) );
+	TST_CHECK_EQ( whole_l, CRC__::get_result( kernel_l ) );
+	TST_CHECK( eCRC_Status_::CRC_STATUS_SUCCESS == CRC__::update( eCRC_Kernel_::CRC_KERNEL_16, &sg_tst_check[4], 5U ) );
+	TST_CHECK_EQ( 0x29B1U, CRC__::get_result( eCRC_Kernel_::CRC_KERNEL_16 ) );
+}
+
+static void test_arguments( void )
+{
+	unsigned long result_l = 0U;
+
+	TST_CHECK( eCRC_Status_::CRC_STATUS_INVALID_ARGUMENT ==
+				CRC__::update( eCRC_Kernel_::CRC_KERNEL_8, nullptr, 1U ) );
+	TST_CHECK( eCRC_Status_::CRC_STATUS_SUCCESS == CRC__::compute( eCRC_Kernel_::CRC_KERNEL_8, nullptr, 0U, result_l ) );
+	TST_CHECK_EQ( 0x00U, result_l );
+	TST_CHECK( eCRC_Status_::CRC_STATUS_SUCCESS == CRC__::init( eCRC_Init_::CRC_INIT_CLOSE ) );
+	TST_CHECK( eCRC_Status_::CRC_STATUS_FAILED == CRC__::start( eCRC_Kernel_::CRC_KERNEL_8 ) );
+	TST_CHECK( eCRC_Status_::CRC_STATUS_SUCCESS == CRC__::init() );
+}
+
+/* Bytes per host cycle of software engines */
+static void bench_throughput( void )
+{
+	std::vector<unsigned char> data_l( TST_BENCH_BYTES );
+	unsigned long table_l[256];
+	unsigned long result_l = 0U;
+	unsigned long long start_l = 0U;
+	double slice_l = 0.0;
+	double byte_l = 0.0;
+	double bit_l = 0.0;
+
+	tst_fill( data_l, 3U );
+
+	/* Byte wise table of CRC-32/MPEG-2 */
+	for( unsigned short index_l = 0U; index_l < 256U; ++index_l )
+	{
+		const unsigned char byte_n = static_cast<unsigned char>( index_l );
+
+		/* Byte into zero register */
+		table_l[index_l] = tst_bitwise( 0U, &byte_n, 1U );
+	}
+
+	start_l = tst_cycles();
+	for( unsigned long pass_l = 0U; pass_l < TST_BENCH_PASSES; ++pass_l )
+	{
+		(void) CRC__::compute( eCRC_Kernel_::CRC_KERNEL_32_1, data_l.data(), TST_BENCH_BYTES, result_l );
+		tst_keep( result_l );
+	}
+	slice_l = (double)( TST_BENCH_BYTES * TST_BENCH_PASSES ) / (double)( tst_cycles() - start_l );
+
+	start_l = tst_cycles();
+	for( unsigned long pass_l = 0U; pass_l < TST_BENCH_PASSES; ++pass_l )
+	{
+		result_l = tst_bytewise( table_l, 0xFFFFFFFFUL, data_l.data(), TST_BENCH_BYTES );
+		tst_keep( result_l );
+	}
+	byte_l = (double)( TST_BENCH_BYTES * TST_BENCH_PASSES ) / (double)( tst_cycles() - start_l );
+	TST_CHECK_EQ( tst_reference( sg_tst_models[1], data_l.data(), TST_BENCH_BYTES ), result_l );
+
+	start_l = tst_cycles();
+	for( unsigned long pass_l = 0U; pass_l < (TST_BENCH_PASSES / 10U); ++pass_l )
+	{
+		result_l = tst_bitwise( 0xFFFFFFFFUL, data_l.data(), TST_BENCH_BYTES );
+		tst_keep( result_l );
+	}
+	bit_l = (double)( TST_BENCH_BYTES * (TST_BENCH_PASSES / 10U) ) / (double)( tst_cycles() - start_l );
+
+	printf( "    CRC-32 bytes/cycle: slice-by-8 %.3f, byte wise table %.3f, bit wise %.3f\n",
+			slice_l, byte_l, bit_l );
+	TST_CHECK( slice_l > byte_l );
+}
+
+int main( void )
+{
+	TST_CHECK( eCRC_Status_::CRC_STATUS_SUCCESS == CRC__::init() );
+
+	TST_RUN( test_check_values );
+	TST_RUN( test_lengths );
+	TST_RUN( test_split_updates );
+	TST_RUN( test_arguments );
+	TST_RUN( bench_throughput );
+
+	return tst_result();
+}
+
+/*********************************** End of File ******************************/
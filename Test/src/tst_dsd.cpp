@@ -0,0 +1,301 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DSD FIR Decimator Host Test
+* Filename:		tst_dsd.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	tst_dsd.cpp
+ *  @brief:	This source file contains host test and benchmark of software
+ *  		FIR decimator of DSD__. Outputs are compared bit exact with a
+ *  		direct form reference over block boundaries, throughput is
+ *  		reported in samples/s per channel against CIC result rate.
+ *  		Built as tst_dsd with plain C pair sums and as tst_dsd_simd
+ *  		with host model of __SMLAD, see Test/Makefile.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <tst_harness.h>
+#include <dri_dsd.h>
+#include <string.h>
+#include <vector>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* CIC result rate of one channel, fDSD / 12 / 64, see dri_dsd_conf.h */
+#define TST_DSD_RESULT_RATE		156250.0
+
+/* Blocks decimated by benchmark */
+#define TST_BENCH_BLOCKS		20000U
+
+/* Accumulation path compiled into DSD__::decimate() */
+#if defined(__ARM_FEATURE_DSP) && ( 1 == __ARM_FEATURE_DSP )
+#define TST_DSD_PATH			"__SMLAD pairs"
+#else
+#define TST_DSD_PATH			"scalar pairs"
+#endif
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Results of CIC filter fed to decimator, with zero history in front */
+static std::vector<short> sg_tst_stream;
+
+/* Pseudo random state of result generator */
+static unsigned long sg_tst_seed = 1U;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Driver parts not used by decimate(), init is not run on host */
+void XMC_DSD_Init( XMC_DSD_t * const dsd ) { (void) dsd; }
+void XMC_DSD_Disable( XMC_DSD_t * const dsd ) { (void) dsd; }
+void XMC_DSD_CH_MainFilter_Init( XMC_DSD_CH_t * const channel, const XMC_DSD_CH_FILTER_CONFIG_t * const init )
+{
+	(void) channel; (void) init;
+}
+void XMC_GPIO_Init( XMC_GPIO_PORT_t * const port, const uint8_t pin, const XMC_GPIO_CONFIG_t * const config )
+{
+	(void) port; (void) pin; (void) config;
+}
+void XMC_DMA_CH_Disable( XMC_DMA_t * const dma, const uint8_t channel ) { (void) dma; (void) channel; }
+void XMC_DMA_ClearRequestLine( XMC_DMA_t * const dma, uint8_t line ) { (void) dma; (void) line; }
+void XMC_DMA_DisableRequestLine( XMC_DMA_t * const dma, uint8_t line ) { (void) dma; (void) line; }
+eDMA_Status_ DMA__::channel_open( XMC_DMA_t * const p_dma, const unsigned char channel,
+									const XMC_DMA_CH_CONFIG_t& config, const unsigned long events,
+									XMC_DMA_CH_EVENT_HANDLER_t handler )
+{
+	(void) p_dma; (void) channel; (void) config; (void) events; (void) handler;
+	return eDMA_Status_::DMA_STATUS_FAILED;
+}
+eDMA_Status_ DMA__::channel_close( XMC_DMA_t * const p_dma, const unsigned char channel )
+{
+	(void) p_dma; (void) channel;
+	return eDMA_Status_::DMA_STATUS_FAILED;
+}
+void dsd_callback_handler( const eDSD_Event_ event, const short * p_block )
+{
+	(void) event; (void) p_block;
+}
+
+/* 16 bit results with full scale steps */
+static short tst_random( void )
+{
+	sg_tst_seed = ( sg_tst_seed * 1103515245UL ) + 12345UL;
+	return static_cast<short>( sg_tst_seed >> 16U );
+}
+
+/* Direct form FIR, output m ends on result ((m + 1) * decimation) - 1 */
+static short tst_reference( const std::vector<short>& stream, const unsigned long first,
+							const unsigned long out )
+{
+	const long last_l = (long) first + ( (long) (out + 1U) * DSD_FIR_DECIMATION ) - 1;
+	long long acc_l = 0;
+
+	for( unsigned long tap_l = 0U; tap_l < DSD_FIR_TAPS; ++tap_l )
+	{
+		const long index_l = last_l - (long) (DSD_FIR_TAPS - 1U) + (long) tap_l;
+
+		if( index_l >= 0 )
+		{
+			acc_l += (long long) stream[index_l] * g_dsd_fir_coeff[tap_l];
+		}
+		else{	/* History before start is zero */	}
+	}
+
+	acc_l >>= 15;
+	return static_cast<short>( ( acc_l > 32767 ) ? 32767 : ( ( acc_l < -32768 ) ? -32768 : acc_l ) );
+}
+
+/* Clear history of decimator and reference stream */
+static void tst_flush( void )
+{
+	short zero_l[DSD_FIR_TAPS] = { 0 };
+	short out_l[DSD_FIR_TAPS / DSD_FIR_DECIMATION];
+
+	(void) DSD__::decimate( zero_l, DSD_FIR_TAPS, out_l );
+	sg_tst_stream.assign( DSD_FIR_TAPS, 0 );
+}
+
+/* Decimate block and compare every output with reference */
+static void tst_block( const short * const p_in, const unsigned short count, short * const p_out )
+{
+	const unsigned long first_l = sg_tst_stream.size();
+
+	sg_tst_stream.insert( sg_tst_stream.end(), p_in, p_in + count );
+	TST_CHECK_EQ( count / DSD_FIR_DECIMATION, DSD__::decimate( p_in, count, p_out ) );
+	for( unsigned short out = 0U; out < (count / DSD_FIR_DECIMATION); ++out )
+	{
+		TST_CHECK_EQ( tst_reference( sg_tst_stream, first_l, out ), p_out[out] );
+	}
+}
+
+/* Unit impulse brings out coefficients, one every decimation step */
+static void test_impulse( void )
+{
+	short in_l[DSD_FIR_TAPS * 2U] = { 0 };
+	short out_l[(DSD_FIR_TAPS * 2U) / DSD_FIR_DECIMATION];
+
+	tst_flush();
+	/* 1.0 is just out of Q15, 0.5 halves coefficients exactly */
+	in_l[DSD_FIR_DECIMATION - 1U] = 16384;
+	TST_CHECK_EQ( sizeof(out_l) / sizeof(short), DSD__::decimate( in_l, sizeof(in_l) / sizeof(short), out_l ) );
+	for( unsigned short out = 0U; out < (DSD_FIR_TAPS / DSD_FIR_DECIMATION); ++out )
+	{
+		TST_CHECK_EQ( g_dsd_fir_coeff[DSD_FIR_TAPS - 1U - (out * DSD_FIR_DECIMATION)] >> 1U, out_l[out] );
+	}
+	TST_CHECK_EQ( 0, out_l[DSD_FIR_TAPS / DSD_FIR_DECIMATION] );
+}
+
+/* Constant input passes with unity gain */
+static void test_dc_gain( void )
+{
+	short in_l[DSD_BLOCK_SIZE];
+	short out_l[DSD_FIR_BLOCK_SIZE];
+	long sum_l = 0;
+
+	for( unsigned short tap = 0U; tap < DSD_FIR_TAPS; ++tap )
+	{
+		sum_l += g_dsd_fir_coeff[tap];
+	}
+	TST_CHECK( (sum_l >= 32700) && (sum_l <= 32768) );
+
+	tst_flush();
+	for( unsigned short index = 0U; index < DSD_BLOCK_SIZE; ++index )
+	{
+		in_l[index] = 10000;
+	}
+	(void) DSD__::decimate( in_l, DSD_BLOCK_SIZE, out_l );
+	/* Settled after one filter length */
+	for( unsigned short out = DSD_FIR_TAPS / DSD_FIR_DECIMATION; out < DSD_FIR_BLOCK_SIZE; ++out )
+	{
+		TST_CHECK( (out_l[out] >= 9970) && (out_l[out] <= 10000) );
+	}
+}
+
+/* Random blocks of all allowed sizes, history carried over boundaries */
+static void test_blocks( void )
+{
+	short in_l[DSD_BLOCK_SIZE];
+	short out_l[DSD_FIR_BLOCK_SIZE];
+
+	tst_flush();
+	for( unsigned short count = DSD_FIR_DECIMATION; count <= DSD_BLOCK_SIZE; count += DSD_FIR_DECIMATION )
+	{
+		for( unsigned short index = 0U; index < count; ++index )
+		{
+			in_l[index] = tst_random();
+		}
+		tst_block( in_l, count, out_l );
+	}
+}
+
+/* Sums past Q15 saturate instead of wrapping */
+static void test_saturation( void )
+{
+	short in_l[DSD_BLOCK_SIZE];
+	short out_l[DSD_FIR_BLOCK_SIZE];
+
+	tst_flush();
+	/*
+	 * Sign of input follows coefficient in window of every eighth output,
+	 * sum of coefficient magnitudes is above 1.0
+	 */
+	for( unsigned short index = 0U; index < DSD_BLOCK_SIZE; ++index )
+	{
+		in_l[index] = ( g_dsd_fir_coeff[index % DSD_FIR_TAPS] < 0 ) ? -32768 : 32767;
+	}
+	tst_block( in_l, DSD_BLOCK_SIZE, out_l );
+	for( unsigned short out = (DSD_FIR_TAPS / DSD_FIR_DECIMATION) - 1U; out < DSD_FIR_BLOCK_SIZE;
+			out += DSD_FIR_TAPS / DSD_FIR_DECIMATION )
+	{
+		TST_CHECK_EQ( 32767, out_l[out] );
+	}
+}
+
+/* Wrong block sizes are refused */
+static void test_arguments( void )
+{
+	short in_l[DSD_BLOCK_SIZE + DSD_FIR_DECIMATION] = { 0 };
+	short out_l[DSD_FIR_BLOCK_SIZE + 1U];
+
+	TST_CHECK_EQ( 0U, DSD__::decimate( nullptr, DSD_FIR_DECIMATION, out_l ) );
+	TST_CHECK_EQ( 0U, DSD__::decimate( in_l, DSD_FIR_DECIMATION, nullptr ) );
+	TST_CHECK_EQ( 0U, DSD__::decimate( in_l, 0U, out_l ) );
+	TST_CHECK_EQ( 0U, DSD__::decimate( in_l, DSD_FIR_DECIMATION + 1U, out_l ) );
+	TST_CHECK_EQ( 0U, DSD__::decimate( in_l, DSD_BLOCK_SIZE + DSD_FIR_DECIMATION, out_l ) );
+}
+
+/* Samples/s of one channel through decimator, full blocks as DMA delivers them */
+static void test_benchmark( void )
+{
+	static short in_l[2U][DSD_BLOCK_SIZE];
+	short out_l[DSD_FIR_BLOCK_SIZE];
+	unsigned long long cycles_l = 0U;
+	unsigned long long ns_l = 0U;
+
+	for( unsigned short index = 0U; index < DSD_BLOCK_SIZE; ++index )
+	{
+		in_l[0][index] = tst_random();
+		in_l[1][index] = tst_random();
+	}
+
+	ns_l = tst_ns();
+	cycles_l = tst_cycles();
+	for( unsigned long block = 0U; block < TST_BENCH_BLOCKS; ++block )
+	{
+		(void) DSD__::decimate( in_l[block & 1U], DSD_BLOCK_SIZE, out_l );
+		tst_keep( out_l );
+	}
+	cycles_l = tst_cycles() - cycles_l;
+	ns_l = tst_ns() - ns_l;
+
+	{
+		const double samples_l = (double) TST_BENCH_BLOCKS * DSD_BLOCK_SIZE;
+		const double rate_l = ( samples_l * 1e9 ) / (double) ns_l;
+
+		printf( "    %s, %u taps, decimation %u\n", TST_DSD_PATH, DSD_FIR_TAPS, DSD_FIR_DECIMATION );
+		printf( "    %.2f cycles/input sample\n", (double) cycles_l / samples_l );
+		printf( "    %.1f MS/s in, %.1f MS/s out per channel\n",
+				rate_l / 1e6, rate_l / ( 1e6 * DSD_FIR_DECIMATION ) );
+		printf( "    %.0f channels at %.2f kS/s CIC rate\n",
+				rate_l / TST_DSD_RESULT_RATE, TST_DSD_RESULT_RATE / 1e3 );
+	}
+	TST_CHECK( 0U != ns_l );
+}
+
+int main( void )
+{
+	TST_RUN( test_impulse );
+	TST_RUN( test_dc_gain );
+	TST_RUN( test_blocks );
+	TST_RUN( test_saturation );
+	TST_RUN( test_arguments );
+	TST_RUN( test_benchmark );
+
+	return tst_result();
+}
+
+/*********************************** End of File ******************************/
@@ -0,0 +1,549 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		DSP Kernels Host Test
+* Filename:		tst_dsp.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	tst_dsp.cpp
+ *  @brief:	This source file contains bit exactness test and benchmark of
+ *  		Q15 kernels of DSP__. Built as tst_dsp with portable C path and
+ *  		as tst_dsp_simd with dual MAC path on host models of __SMLALD
+ *  		and __PKHBT, see Test/Makefile. Both builds are checked against
+ *  		one reference of documented arithmetic, so the two paths give
+ *  		same results as each other. Benchmarks of both builds print
+ *  		cycles per sample of same inputs side by side.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <tst_harness.h>
+#include <mid_dsp.h>
+#include <math.h>
+#include <vector>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Path compiled into DSP__ */
+#if( 1 == DSP_SIMD_USED )
+#define TST_DSP_PATH			"__SMLALD"
+#else
+#define TST_DSP_PATH			"scalar"
+#endif
+
+/* FIR under test */
+#define TST_FIR_TAPS			32U
+#define TST_FIR_BLOCK			256U
+
+/* Biquad cascade under test */
+#define TST_BIQUAD_STAGES		2U
+
+/* Calls of each kernel in benchmark */
+#define TST_BENCH_LOOPS			20000U
+
+/* Transforms of each size in FFT benchmark */
+#define TST_FFT_LOOPS			2000U
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	FIR filter with its buffers
+ */
+typedef struct tStTst_Fir_
+{
+	short coeff[TST_FIR_TAPS];
+	short state[TST_FIR_TAPS + TST_FIR_BLOCK];
+	tStDSP_FirQ15 filter;
+} tStTst_Fir;
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Pseudo random state of sample generator */
+static unsigned long sg_tst_seed = 1U;
+
+/*
+ * Butterworth low pass at 0.05 of sample rate, then high pass at 0.01,
+ * Q14 for post_shift 1, feedback negated as tStDSP_BiquadQ15 documents
+ */
+static const short sg_tst_biquad_coeff[6U * TST_BIQUAD_STAGES] =
+{
+	329,	0,	658,	329,	25571,	-10508,
+	15673,	0,	-31346,	15673,	31315,	-14992
+};
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Full scale Q15 samples */
+static short tst_random( void )
+{
+	sg_tst_seed = ( sg_tst_seed * 1103515245UL ) + 12345UL;
+	return static_cast<short>( sg_tst_seed >> 16U );
+}
+
+static short tst_saturate( const long long value )
+{
+	return static_cast<short>( ( value > 32767 ) ? 32767 : ( ( value < -32768 ) ? -32768 : value ) );
+}
+
+/* Reference dot product, every product summed in 64 bit */
+static long long tst_dot( const short * const p_a, const short * const p_b, const unsigned short count )
+{
+	long long acc_l = 0;
+
+	for( unsigned short index = 0U; index < count; ++index )
+	{
+		acc_l += (long long) p_a[index] * p_b[index];
+	}
+	return acc_l;
+}
+
+/* Reference FIR, output m ends on sample ((m + 1) * factor) - 1 of stream */
+static short tst_fir( const std::vector<short>& stream, const short * const p_coeff,
+						const unsigned long first, const unsigned long out, const unsigned char factor )
+{
+	const long last_l = (long) first + ( (long) (out + 1U) * factor ) - 1;
+	long long acc_l = 0;
+
+	for( unsigned long tap_l = 0U; tap_l < TST_FIR_TAPS; ++tap_l )
+	{
+		const long index_l = last_l - (long) (TST_FIR_TAPS - 1U) + (long) tap_l;
+
+		if( index_l >= 0 )
+		{
+			acc_l += (long long) stream[index_l] * p_coeff[tap_l];
+		}
+		else{	/* History before start is zero */	}
+	}
+	return tst_saturate( acc_l >> 15 );
+}
+
+/* Reference biquad cascade, direct form I */
+static void tst_biquad( short * const p_state, const short * const p_in, const unsigned short count,
+						short * const p_out )
+{
+	const short * p_x = p_in;
+
+	for( unsigned char stage = 0U; stage < TST_BIQUAD_STAGES; ++stage )
+	{
+		const short * const p_c = &sg_tst_biquad_coeff[6U * stage];
+		short * const p_s = &p_state[4U * stage];
+
+		for( unsigned short index = 0U; index < count; ++index )
+		{
+			const long long acc_l = ( (long long) p_c[0] * p_x[index] ) +
+									( (long long) p_c[2] * p_s[0] ) + ( (long long) p_c[3] * p_s[1] ) +
+									( (long long) p_c[4] * p_s[2] ) + ( (long long) p_c[5] * p_s[3] );
+			const short y_l = tst_saturate( acc_l >> 14 );
+
+			p_s[1] = p_s[0];
+			p_s[0] = p_x[index];
+			p_s[3] = p_s[2];
+			p_s[2] = y_l;
+			p_out[index] = y_l;
+		}
+		p_x = p_out;
+	}
+}
+
+/* FIR of random coefficients, sum of magnitudes above 1.0 lets full scale input saturate */
+static void tst_fir_open( tStTst_Fir& fir, const unsigned char factor )
+{
+	for( unsigned short tap = 0U; tap < TST_FIR_TAPS; ++tap )
+	{
+		fir.coeff[tap] = static_cast<short>( tst_random() >> 2 );
+	}
+	fir.filter.p_coeff = fir.coeff;
+	fir.filter.p_state = fir.state;
+	fir.filter.taps = TST_FIR_TAPS;
+	fir.filter.max_block = TST_FIR_BLOCK;
+	fir.filter.factor = factor;
+	DSP__::reset( fir.filter );
+}
+
+/* Lengths 0 to 2 full blocks, odd lengths end on scalar tail */
+static void test_dot_q15( void )
+{
+	short a_l[2U * TST_FIR_BLOCK];
+	short b_l[2U * TST_FIR_BLOCK];
+
+	for( unsigned short index = 0U; index < (2U * TST_FIR_BLOCK); ++index )
+	{
+		a_l[index] = tst_random();
+		b_l[index] = tst_random();
+	}
+	for( unsigned short count = 0U; count <= (2U * TST_FIR_BLOCK); ++count )
+	{
+		TST_CHECK_EQ( tst_dot( a_l, b_l, count ), DSP__::dot_q15( a_l, b_l, count ) );
+	}
+
+	/* Largest magnitudes, -1.0 squared does not wrap */
+	for( unsigned short index = 0U; index < (2U * TST_FIR_BLOCK); ++index )
+	{
+		a_l[index] = -32768;
+		b_l[index] = -32768;
+	}
+	TST_CHECK_EQ( 1073741824LL * 2U * TST_FIR_BLOCK, DSP__::dot_q15( a_l, b_l, 2U * TST_FIR_BLOCK ) );
+	TST_CHECK_EQ( 0, DSP__::dot_q15( nullptr, b_l, 2U ) );
+}
+
+/* FIR and decimator over random block sizes, history carried between calls */
+static void test_fir_q15( void )
+{
+	static const unsigned char factor_l[] = { 1U, 2U, 4U, 8U };
+	short in_l[TST_FIR_BLOCK];
+	short out_l[TST_FIR_BLOCK];
+
+	for( const unsigned char factor : factor_l )
+	{
+		tStTst_Fir fir_l;
+		std::vector<short> stream_l;
+
+		tst_fir_open( fir_l, factor );
+		for( unsigned short call = 0U; call < 40U; ++call )
+		{
+			const unsigned short count_l = static_cast<unsigned short>(
+					factor * ( 1U + (unsigned short) tst_random() % (TST_FIR_BLOCK / factor) ) );
+			const unsigned long first_l = stream_l.size();
+			unsigned short outs_l = 0U;
+
+			for( unsigned short index = 0U; index < count_l; ++index )
+			{
+				/* Every fourth block at full scale to reach saturation */
+				in_l[index] = ( 0U == (call & 3U) ) ? ( (tst_random() < 0) ? -32768 : 32767 ) : tst_random();
+			}
+			stream_l.insert( stream_l.end(), in_l, in_l + count_l );
+
+			outs_l = ( 1U == factor ) ? DSP__::fir_q15( fir_l.filter, in_l, count_l, out_l ) :
+										DSP__::decimate_q15( fir_l.filter, in_l, count_l, out_l );
+			TST_CHECK_EQ( count_l / factor, outs_l );
+			for( unsigned short out = 0U; out < outs_l; ++out )
+			{
+				TST_CHECK_EQ( tst_fir( stream_l, fir_l.coeff, first_l, out, factor ), out_l[out] );
+			}
+		}
+	}
+}
+
+/* Biquad cascade over several blocks, on noise and on full scale steps */
+static void test_biquad_q15( void )
+{
+	short state_l[4U * TST_BIQUAD_STAGES];
+	short reference_l[4U * TST_BIQUAD_STAGES] = { 0 };
+	short in_l[TST_FIR_BLOCK];
+	short out_l[TST_FIR_BLOCK];
+	short expected_l[TST_FIR_BLOCK];
+	tStDSP_BiquadQ15 filter_l;
+
+	filter_l.p_coeff = sg_tst_biquad_coeff;
+	filter_l.p_state = state_l;
+	filter_l.stages = TST_BIQUAD_STAGES;
+	filter_l.post_shift = 1U;
+	DSP__::reset( filter_l );
+
+	for( unsigned short call = 0U; call < 16U; ++call )
+	{
+		const unsigned short count_l = static_cast<unsigned short>(
+				1U + (unsigned short) tst_random() % TST_FIR_BLOCK );
+
+		for( unsigned short index = 0U; index < count_l; ++index )
+		{
+			in_l[index] = ( 0U != (call & 1U) ) ? tst_random() : ( ( 0U != (call & 2U) ) ? 32767 : -32768 );
+		}
+		tst_biquad( reference_l, in_l, count_l, expected_l );
+		TST_CHECK_EQ( count_l, DSP__::biquad_q15( filter_l, in_l, count_l, out_l ) );
+		for( unsigned short index = 0U; index < count_l; ++index )
+		{
+			TST_CHECK_EQ( expected_l[index], out_l[index] );
+		}
+	}
+	for( unsigned char index = 0U; index < (4U * TST_BIQUAD_STAGES); ++index )
+	{
+		TST_CHECK_EQ( reference_l[index], state_l[index] );
+	}
+}
+
+/* Cycles per sample of kernels on same data in both builds */
+static void test_benchmark( void )
+{
+	static short in_l[TST_FIR_BLOCK];
+	static short out_l[TST_FIR_BLOCK];
+	short state_l[4U * TST_BIQUAD_STAGES];
+	tStDSP_BiquadQ15 biquad_l;
+	tStTst_Fir fir_l;
+	tStTst_Fir decimator_l;
+	unsigned long long cycles_l[4] = { 0U };
+	long long dot_l = 0;
+
+	for( unsigned short index = 0U; index < TST_FIR_BLOCK; ++index )
+	{
+		in_l[index] = tst_random();
+	}
+	tst_fir_open( fir_l, 1U );
+	tst_fir_open( decimator_l, 4U );
+	biquad_l.p_coeff = sg_tst_biquad_coeff;
+	biquad_l.p_state = state_l;
+	biquad_l.stages = TST_BIQUAD_STAGES;
+	biquad_l.post_shift = 1U;
+	DSP__::reset( biquad_l );
+
+	cycles_l[0] = tst_cycles();
+	for( unsigned long loop = 0U; loop < TST_BENCH_LOOPS; ++loop )
+	{
+		dot_l += DSP__::dot_q15( in_l, fir_l.state, TST_FIR_BLOCK );
+		tst_keep( dot_l );
+	}
+	cycles_l[0] = tst_cycles() - cycles_l[0];
+
+	cycles_l[1] = tst_cycles();
+	for( unsigned long loop = 0U; loop < TST_BENCH_LOOPS; ++loop )
+	{
+		(void) DSP__::fir_q15( fir_l.filter, in_l, TST_FIR_BLOCK, out_l );
+		tst_keep( out_l );
+	}
+	cycles_l[1] = tst_cycles() - cycles_l[1];
+
+	cycles_l[2] = tst_cycles();
+	for( unsigned long loop = 0U; loop < TST_BENCH_LOOPS; ++loop )
+	{
+		(void) DSP__::decimate_q15( decimator_l.filter, in_l, TST_FIR_BLOCK, out_l );
+		tst_keep( out_l );
+	}
+	cycles_l[2] = tst_cycles() - cycles_l[2];
+
+	cycles_l[3] = tst_cycles();
+	for( unsigned long loop = 0U; loop < TST_BENCH_LOOPS; ++loop )
+	{
+		(void) DSP__::biquad_q15( biquad_l, in_l, TST_FIR_BLOCK, out_l );
+		tst_keep( out_l );
+	}
+	cycles_l[3] = tst_cycles() - cycles_l[3];
+
+	{
+		const double samples_l = (double) TST_BENCH_LOOPS * TST_FIR_BLOCK;
+
+		printf( "    %s path, cycles/input sample, block of %u\n", TST_DSP_PATH, TST_FIR_BLOCK );
+		printf( "    dot_q15                %8.2f\n", (double) cycles_l[0] / samples_l );
+		printf( "    fir_q15 %u taps        %8.2f\n", TST_FIR_TAPS, (double) cycles_l[1] / samples_l );
+		printf( "    decimate_q15 by 4      %8.2f\n", (double) cycles_l[2] / samples_l );
+		printf( "    biquad_q15 %u stages    %8.2f\n", TST_BIQUAD_STAGES, (double) cycles_l[3] / samples_l );
+	}
+	TST_CHECK( 0U != cycles_l[1] );
+}
+
+/* Floating point DFT scaled by 1 / points, as fft_q15() and fft_q31() */
+static void tst_dft( const double * const p_in, const unsigned short points, double * const p_out )
+{
+	for( unsigned short bin = 0U; bin < points; ++bin )
+	{
+		double real_l = 0.0;
+		double imag_l = 0.0;
+
+		for( unsigned short index = 0U; index < points; ++index )
+		{
+			const double angle_l = ( -2.0 * M_PI * (double) ((unsigned long) bin * index % points) ) / points;
+
+			real_l += ( p_in[2U * index] * cos(angle_l) ) - ( p_in[(2U * index) + 1U] * sin(angle_l) );
+			imag_l += ( p_in[2U * index] * sin(angle_l) ) + ( p_in[(2U * index) + 1U] * cos(angle_l) );
+		}
+		p_out[2U * bin] = real_l / points;
+		p_out[(2U * bin) + 1U] = imag_l / points;
+	}
+}
+
+/* Every bin of all sizes, radix-4 only and with radix-2 stage, within rounding of stages from DFT */
+static void test_fft_q15( void )
+{
+	static short data_l[2U * DSP_FFT_MAX_POINTS];
+	static double in_l[2U * DSP_FFT_MAX_POINTS];
+	static double out_l[2U * DSP_FFT_MAX_POINTS];
+
+	for( unsigned short points = 16U; points <= DSP_FFT_MAX_POINTS; points = points << 1 )
+	{
+		double error_l = 0.0;
+		unsigned char stages_l = 0U;
+
+		for( unsigned short span = points; span > 1U; span = span >> 2 )
+		{
+			++stages_l;
+		}
+		for( unsigned short index = 0U; index < (2U * points); ++index )
+		{
+			data_l[index] = tst_random();
+			in_l[index] = data_l[index];
+		}
+		tst_dft( in_l, points, out_l );
+
+		TST_CHECK_EQ( points, DSP__::fft_q15( data_l, points ) );
+		for( unsigned short index = 0U; index < (2U * points); ++index )
+		{
+			error_l = fmax( error_l, fabs( out_l[index] - data_l[index] ) );
+		}
+		/* Truncation of two halvings and one rotation per stage */
+		TST_CHECK( error_l <= (2.0 * stages_l) );
+	}
+
+	TST_CHECK_EQ( 0U, DSP__::fft_q15( data_l, 8U ) );
+	TST_CHECK_EQ( 0U, DSP__::fft_q15( data_l, 48U ) );
+	TST_CHECK_EQ( 0U, DSP__::fft_q15( data_l, 2U * DSP_FFT_MAX_POINTS ) );
+	TST_CHECK_EQ( 0U, DSP__::fft_q15( nullptr, 64U ) );
+}
+
+/* Q31 transform keeps 16 more bits than Q15 */
+static void test_fft_q31( void )
+{
+	static long data_l[2U * DSP_FFT_MAX_POINTS];
+	static double in_l[2U * DSP_FFT_MAX_POINTS];
+	static double out_l[2U * DSP_FFT_MAX_POINTS];
+
+	for( unsigned short points = 16U; points <= DSP_FFT_MAX_POINTS; points = points << 1 )
+	{
+		double error_l = 0.0;
+
+		for( unsigned short index = 0U; index < (2U * points); ++index )
+		{
+			data_l[index] = (long) tst_random() * 65536L;
+			in_l[index] = (double) data_l[index];
+		}
+		tst_dft( in_l, points, out_l );
+
+		TST_CHECK_EQ( points, DSP__::fft_q31( data_l, points ) );
+		for( unsigned short index = 0U; index < (2U * points); ++index )
+		{
+			error_l = fmax( error_l, fabs( out_l[index] - (double) data_l[index] ) );
+		}
+		TST_CHECK( error_l <= 16.0 );
+	}
+}
+
+/* Windowed ADC tone lands on its bin and the two next to it */
+static void test_fft_adc_tone( void )
+{
+	static unsigned short block_l[2U * 256U];
+	static short data_l[2U * 256U];
+	short magnitude_l[128U];
+
+	/* Channel 1 of two interleaved, 10 periods in 256 scans */
+	for( unsigned short index = 0U; index < 256U; ++index )
+	{
+		block_l[2U * index] = 0U;
+		block_l[(2U * index) + 1U] = static_cast<unsigned short>(
+				2048.0 + ( 1800.0 * cos( (2.0 * M_PI * 10.0 * index) / 256.0 ) ) );
+	}
+	TST_CHECK_EQ( 256U, DSP__::load_adc_q15( &block_l[1], 2U, 256U, true, data_l ) );
+	TST_CHECK_EQ( 256U, DSP__::fft_q15( data_l, 256U ) );
+	TST_CHECK_EQ( 128U, DSP__::magnitude_q15( data_l, 128U, magnitude_l ) );
+
+	/* Hann window halves tone into bins 9 and 11, mid scale is gone */
+	TST_CHECK( magnitude_l[10] > 3000 );
+	TST_CHECK( (magnitude_l[9] > 1400) && (magnitude_l[11] > 1400) );
+	for( unsigned short bin = 0U; bin < 128U; ++bin )
+	{
+		if( (bin < 9U) || (bin > 11U) )
+		{
+			TST_CHECK( magnitude_l[bin] < 16 );
+		}
+		else{	/* Tone */	}
+	}
+}
+
+/* Cycles per transform, and per spectrum of one ADC channel */
+static void test_fft_benchmark( void )
+{
+	static short data_q15_l[2U * DSP_FFT_MAX_POINTS];
+	static long data_q31_l[2U * DSP_FFT_MAX_POINTS];
+	static unsigned short block_l[DSP_FFT_MAX_POINTS];
+	short magnitude_l[DSP_FFT_MAX_POINTS / 2U];
+	unsigned long long cycles_l = 0U;
+
+	for( unsigned short index = 0U; index < DSP_FFT_MAX_POINTS; ++index )
+	{
+		block_l[index] = static_cast<unsigned short>( tst_random() ) >> (16U - DSP_ADC_BITS);
+	}
+
+	printf( "    %s path, cycles/transform\n", TST_DSP_PATH );
+	for( unsigned short points = 64U; points <= DSP_FFT_MAX_POINTS; points = points << 2 )
+	{
+		unsigned long long q15_l = 0U;
+		unsigned long long q31_l = 0U;
+		unsigned long long adc_l = 0U;
+
+		for( unsigned short index = 0U; index < (2U * points); ++index )
+		{
+			data_q15_l[index] = tst_random();
+			data_q31_l[index] = (long) tst_random() * 65536L;
+		}
+
+		cycles_l = tst_cycles();
+		for( unsigned long loop = 0U; loop < TST_FFT_LOOPS; ++loop )
+		{
+			(void) DSP__::fft_q15( data_q15_l, points );
+			tst_keep( data_q15_l );
+		}
+		q15_l = ( tst_cycles() - cycles_l ) / TST_FFT_LOOPS;
+
+		cycles_l = tst_cycles();
+		for( unsigned long loop = 0U; loop < TST_FFT_LOOPS; ++loop )
+		{
+			(void) DSP__::fft_q31( data_q31_l, points );
+			tst_keep( data_q31_l );
+		}
+		q31_l = ( tst_cycles() - cycles_l ) / TST_FFT_LOOPS;
+
+		/* Window, transform and magnitude of one channel */
+		cycles_l = tst_cycles();
+		for( unsigned long loop = 0U; loop < TST_FFT_LOOPS; ++loop )
+		{
+			(void) DSP__::load_adc_q15( block_l, 1U, points, true, data_q15_l );
+			(void) DSP__::fft_q15( data_q15_l, points );
+			(void) DSP__::magnitude_q15( data_q15_l, points / 2U, magnitude_l );
+			tst_keep( magnitude_l );
+		}
+		adc_l = ( tst_cycles() - cycles_l ) / TST_FFT_LOOPS;
+
+		printf( "    %4u points  fft_q15 %8llu  fft_q31 %8llu  adc spectrum %8llu\n",
+				points, q15_l, q31_l, adc_l );
+	}
+	TST_CHECK( 0U != cycles_l );
+}
+
+int main( void )
+{
+	TST_RUN( test_dot_q15 );
+	TST_RUN( test_fir_q15 );
+	TST_RUN( test_biquad_q15 );
+	TST_RUN( test_benchmark );
+	TST_RUN( test_fft_q15 );
+	TST_RUN( test_fft_q31 );
+	TST_RUN( test_fft_adc_tone );
+	TST_RUN( test_fft_benchmark );
+
+	return tst_result();
+}
+
+/*********************************** End of File ******************************/
@@ -0,0 +1,317 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Ethernet MAC Host Test
+* Filename:		tst_eth.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	tst_eth.cpp
+ *  @brief:	This source file contains tests of descriptor ring logic of
+ *  		ETH__ on the loopback MAC DMA model of tst_eth_model.cpp
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <tst_harness.h>
+#include <tst_periph.h>
+#include <tst_eth_model.h>
+#include <string.h>
+#include <set>
+#include <vector>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Length of test frames, Ethernet, IPv4 and UDP header with 18 bytes payload */
+#define TST_FRAME_LENGTH		60U
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+static std::vector<eETH_Event_> sg_tst_events;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Event callback of driver */
+void eth_callback_handler( const eETH_Event_ event )
+{
+	sg_tst_events.push_back( event );
+}
+
+/******* Helpers *******/
+
+/* Fresh driver with link up */
+static void tst_open( void )
+{
+	sg_tst_events.clear();
+	tst_dma_open();
+	TST_CHECK( ETH__::is_link_up() );
+}
+
+/* IPv4 UDP broadcast with sequence number in payload, checksums left to MAC */
+static void tst_make_frame( unsigned char * p_frame, const unsigned char sequence )
+{
+	memset( p_frame, 0, TST_FRAME_LENGTH );
+	memset( p_frame, 0xFF, 6U );
+	memcpy( &p_frame[6], ETH__::get_address(), 6U );
+	p_frame[12] = 0x08U;
+	p_frame[14] = 0x45U;
+	p_frame[17] = TST_FRAME_LENGTH - 14U;
+	p_frame[22] = 64U;
+	p_frame[23] = 17U;
+	memset( &p_frame[30], 0xFF, 4U );
+	p_frame[39] = TST_FRAME_LENGTH - 34U;
+	p_frame[TST_FRAME_LENGTH - 1U] = sequence;
+}
+
+static eETH_Status_ tst_send( const unsigned char sequence, const bool timestamp = false )
+{
+	unsigned char * const p_buffer = ETH__::claim();
+
+	if( nullptr == p_buffer ){ return eETH_Status_::ETH_STATUS_BUSY; }
+	else{	/* Not required */	}
+
+	tst_make_frame( p_buffer, sequence );
+	return ETH__::commit( TST_FRAME_LENGTH, timestamp );
+}
+
+/******* Tests *******/
+
+/* Link comes up after poll interval, MAC and coalescing are set up */
+static void test_init( void )
+{
+	(void) ETH__::init( eETH_Init_::ETH_INIT_CLOSE );
+	g_tst_dma = tStTst_Dma();
+	sg_tst_events.clear();
+	TST_CHECK( eETH_Status_::ETH_STATUS_SUCCESS == ETH__::init() );
+	TST_CHECK( eETH_Status_::ETH_STATUS_FAILED == ETH__::init() );
+	TST_CHECK( !ETH__::is_link_up() );
+	TST_CHECK( eETH_Status_::ETH_STATUS_FAILED == tst_send( 0U ) );
+
+	for( unsigned long index_l = 0U; index_l < ETH_LINK_POLL_TICKS; ++index_l )
+	{
+		ETH__::tick( 1U );
+	}
+	TST_CHECK( ETH__::is_link_up() );
+	TST_CHECK_EQ( 1U, sg_tst_events.size() );
+	TST_CHECK( eETH_Event_::ETH_EVENT_LINK_UP == sg_tst_events[0] );
+
+	/* Receive interrupt only by watchdog, 100 us at 60 MHz in units of 256 clocks */
+	for( unsigned long index_l = 0U; index_l < ETH_RX_DESCRIPTORS; ++index_l )
+	{
+		TST_CHECK( 0U != (g_tst_dma.p_mac->rx_desc[index_l].length & 0x80000000U) );
+	}
+	TST_CHECK_EQ( (60U * ETH_RX_COALESCE_US) / 256U, ETH0->RECEIVE_INTERRUPT_WATCHDOG_TIMER );
+
+	g_tst_dma.link = XMC_ETH_LINK_STATUS_DOWN;
+	for( unsigned long index_l = 0U; index_l < ETH_LINK_POLL_TICKS; ++index_l )
+	{
+		ETH__::tick( 1U );
+	}
+	TST_CHECK( !ETH__::is_link_up() );
+	TST_CHECK( eETH_Event_::ETH_EVENT_LINK_DOWN == sg_tst_events.back() );
+}
+
+/* Frame comes back by reference in a receive buffer with checksum result and time */
+static void test_loopback( void )
+{
+	tStETH_Frame frame_l;
+	unsigned char expected_l[TST_FRAME_LENGTH];
+	unsigned char * p_tx = nullptr;
+
+	tst_open();
+	p_tx = ETH__::claim();
+	TST_CHECK( p_tx == ETH__::claim() );
+	TST_CHECK( eETH_Status_::ETH_STATUS_SUCCESS == tst_send( 7U ) );
+	TST_CHECK( !ETH__::receive( frame_l ) );
+
+	tst_dma_run();
+	TST_CHECK( ETH__::receive( frame_l ) );
+	tst_make_frame( expected_l, 7U );
+	tst_checksum_insert( expected_l, TST_FRAME_LENGTH );
+	TST_CHECK_EQ( TST_FRAME_LENGTH, frame_l.length );
+	TST_CHECK_EQ( 0, memcmp( expected_l, frame_l.p_data, TST_FRAME_LENGTH ) );
+	TST_CHECK( p_tx != frame_l.p_data );
+	TST_CHECK_EQ( g_tst_dma.rx_buffers[0], reinterpret_cast<unsigned long>( frame_l.p_data ) );
+	TST_CHECK_EQ( ETH_FRAME_IPV4 | ETH_FRAME_CHECKSUM_OK | ETH_FRAME_TIMESTAMP, frame_l.flags );
+	TST_CHECK_EQ( 100U, frame_l.time.seconds );
+	TST_CHECK( eETH_Event_::ETH_EVENT_RX == sg_tst_events.back() );
+	ETH__::release( frame_l.p_data );
+
+	TST_CHECK_EQ( 1U, ETH__::get_counters().rx_frames );
+	TST_CHECK_EQ( 1U, ETH__::get_counters().tx_frames );
+}
+
+/* Descriptor gets a spare buffer, stack holds at most spare buffers */
+static void test_buffer_swap( void )
+{
+	std::vector<unsigned char *> held_l;
+	std::set<unsigned long> buffers_l;
+	tStETH_Frame frame_l;
+
+	tst_open();
+	for( unsigned char index_l = 0U; index_l < (ETH_RX_SPARE_BUFFERS + 2U); ++index_l )
+	{
+		TST_CHECK( eETH_Status_::ETH_STATUS_SUCCESS == tst_send( index_l ) );
+		tst_dma_run();
+		while( ETH__::receive( frame_l ) )
+		{
+			TST_CHECK_EQ( held_l.size(), frame_l.p_data[TST_FRAME_LENGTH - 1U] );
+			held_l.push_back( frame_l.p_data );
+		}
+	}
+
+	/* Frames beyond spare buffers are dropped in place */
+	TST_CHECK_EQ( ETH_RX_SPARE_BUFFERS, held_l.size() );
+	TST_CHECK_EQ( ETH_RX_SPARE_BUFFERS, ETH__::get_counters().rx_frames );
+	TST_CHECK_EQ( 2U, ETH__::get_counters().rx_dropped );
+
+	for( unsigned char * p_data : held_l )
+	{
+		ETH__::release( p_data );
+	}
+
+	/* Many times round the rings, buffers only circulate */
+	for( unsigned long index_l = 0U; index_l < (8U * ETH_RX_DESCRIPTORS); ++index_l )
+	{
+		TST_CHECK( eETH_Status_::ETH_STATUS_SUCCESS == tst_send( static_cast<unsigned char>(index_l) ) );
+		tst_dma_run();
+		TST_CHECK( ETH__::receive( frame_l ) );
+		TST_CHECK_EQ( index_l & 0xFFU, frame_l.p_data[TST_FRAME_LENGTH - 1U] );
+		ETH__::release( frame_l.p_data );
+	}
+	for( unsigned long buffer_l : g_tst_dma.rx_buffers )
+	{
+		buffers_l.insert( buffer_l );
+	}
+	TST_CHECK_EQ( ETH_RX_DESCRIPTORS + ETH_RX_SPARE_BUFFERS, buffers_l.size() );
+	TST_CHECK_EQ( 0U, ETH__::get_counters().rx_errors );
+}
+
+/* Full transmit ring refuses frames until DMA frees descriptors */
+static void test_tx_ring_full( void )
+{
+	tStETH_Frame frame_l;
+
+	tst_open();
+	for( unsigned char index_l = 0U; index_l < ETH_TX_DESCRIPTORS; ++index_l )
+	{
+		TST_CHECK( eETH_Status_::ETH_STATUS_SUCCESS == tst_send( index_l ) );
+	}
+	TST_CHECK( nullptr == ETH__::claim() );
+	TST_CHECK( eETH_Status_::ETH_STATUS_BUSY == ETH__::commit( TST_FRAME_LENGTH ) );
+
+	tst_dma_run();
+	TST_CHECK( nullptr != ETH__::claim() );
+	for( unsigned char index_l = 0U; index_l < ETH_TX_DESCRIPTORS; ++index_l )
+	{
+		TST_CHECK( ETH__::receive( frame_l ) );
+		TST_CHECK_EQ( index_l, frame_l.p_data[TST_FRAME_LENGTH - 1U] );
+		ETH__::release( frame_l.p_data );
+	}
+}
+
+/* Transmit interrupt every ETH_TX_COALESCE frames and with ring running full */
+static void test_tx_coalesce( void )
+{
+	tStETH_Frame frame_l;
+
+	tst_open();
+	for( unsigned long index_l = 0U; index_l < (4U * ETH_TX_COALESCE); ++index_l )
+	{
+		TST_CHECK( eETH_Status_::ETH_STATUS_SUCCESS == tst_send( 0U ) );
+		tst_dma_run();
+		while( ETH__::receive( frame_l ) ){ ETH__::release( frame_l.p_data ); }
+	}
+	TST_CHECK_EQ( 4U, g_tst_dma.tx_interrupt_requests );
+
+	/* Ring filled before DMA runs, last frame asks for interrupt */
+	g_tst_dma.tx_interrupt_requests = 0U;
+	TST_CHECK( eETH_Status_::ETH_STATUS_SUCCESS == tst_send( 0U ) );
+	for( unsigned char index_l = 1U; index_l < ETH_TX_DESCRIPTORS; ++index_l )
+	{
+		TST_CHECK( eETH_Status_::ETH_STATUS_SUCCESS == tst_send( 0U ) );
+	}
+	tst_dma_run();
+	TST_CHECK( g_tst_dma.tx_interrupt_requests >= 1U );
+	TST_CHECK( 0U != (g_tst_dma.p_mac->tx_desc[ETH_TX_DESCRIPTORS - 1U].status & ETH_MAC_DMA_TDES0_IC) );
+}
+
+/* Bad frames are counted and their descriptor goes straight back to DMA */
+static void test_rx_errors( void )
+{
+	unsigned char data_l[TST_FRAME_LENGTH] = { 0U };
+	tStETH_Frame frame_l;
+
+	tst_open();
+	TST_CHECK( tst_dma_receive( data_l, TST_FRAME_LENGTH, ETH_MAC_DMA_RDES0_ES | ETH_MAC_DMA_RDES0_CE ) );
+	tst_dma_interrupt( ETH_STATUS_RI_Msk );
+	TST_CHECK( !ETH__::receive( frame_l ) );
+	TST_CHECK_EQ( 1U, ETH__::get_counters().rx_errors );
+	TST_CHECK( 0U != (g_tst_dma.p_mac->rx_desc[0].status & ETH_MAC_DMA_RDES0_OWN) );
+
+	/* Frame without IPv4 status is passed without flags but with time */
+	TST_CHECK( tst_dma_receive( data_l, TST_FRAME_LENGTH ) );
+	tst_dma_interrupt( ETH_STATUS_RI_Msk );
+	TST_CHECK( ETH__::receive( frame_l ) );
+	TST_CHECK_EQ( ETH_FRAME_TIMESTAMP, frame_l.flags );
+	ETH__::release( frame_l.p_data );
+}
+
+/* Transmit time is read once, after DMA gave descriptor back */
+static void test_tx_timestamp( void )
+{
+	tStETH_Frame frame_l;
+	tStETH_Time time_l;
+
+	tst_open();
+	g_tst_dma.seconds = 1234U;
+	g_tst_dma.nanoseconds = 5678U;
+	TST_CHECK( eETH_Status_::ETH_STATUS_SUCCESS == tst_send( 0U, true ) );
+	TST_CHECK( !ETH__::get_tx_time( time_l ) );
+
+	tst_dma_run();
+	TST_CHECK( ETH__::get_tx_time( time_l ) );
+	TST_CHECK_EQ( 1234U, time_l.seconds );
+	TST_CHECK_EQ( 5678U, time_l.nanoseconds );
+	TST_CHECK( !ETH__::get_tx_time( time_l ) );
+	while( ETH__::receive( frame_l ) ){ ETH__::release( frame_l.p_data ); }
+}
+
+int main( void )
+{
+	tst_map_peripherals();
+
+	TST_RUN( test_init );
+	TST_RUN( test_loopback );
+	TST_RUN( test_buffer_swap );
+	TST_RUN( test_tx_ring_full );
+	TST_RUN( test_tx_coalesce );
+	TST_RUN( test_rx_errors );
+	TST_RUN( test_tx_timestamp );
+
+	return tst_result();
+}
+
+/*********************************** End of File ******************************/
@@ -0,0 +1,443 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		Host Ethernet MAC Model
+* Filename:		tst_eth_model.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	tst_eth_model.cpp
+ *  @brief:	This source file contains host model of ETH MAC DMA. XMCLib MAC
+ *  		and PHY functions are replaced by the model, which chains
+ *  		descriptors like XMCLib does. tst_dma_run() plays the DMA:
+ *  		transmit descriptors owned by DMA go to the wire, which loops
+ *  		them back into receive descriptors unless a test connects its
+ *  		own wire. Checksums are inserted and checked like the MAC
+ *  		checksum offload engine does for IPv4 with UDP or ICMP.
+ *  		tst_clock_advance() runs system time with fine update and
+ *  		applies updates written by ETH__::step_time().
+ *
+ *  		Descriptors hold 32 bit buffer addresses, so tests are linked
+ *  		without PIE to keep static buffers below 4 GB.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <tst_eth_model.h>
+#include <string.h>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* RDES1 second address chained, private to xmc_eth_mac.c */
+#define TST_RDES1_RCH			0x00004000U
+
+/* System time of XMCLib fine update */
+#define TST_SUB_SECOND_UPDATE_FREQ	50000000U
+#define TST_SUB_SECOND_INCREMENT	20U
+#define TST_NS_PER_SECOND			1000000000ULL
+
+/* Frame offsets */
+#define TST_ETH_TYPE			12U
+#define TST_IP					14U
+#define TST_IP_PROTOCOL_ICMP	1U
+#define TST_IP_PROTOCOL_UDP		17U
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+uint32_t SystemCoreClock = 120000000U;
+
+tStTst_Dma g_tst_dma;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/******* Model of XMCLib MAC and PHY *******/
+
+XMC_ETH_MAC_STATUS_t XMC_ETH_MAC_Init( XMC_ETH_MAC_t * const eth_mac )
+{
+	g_tst_dma.p_mac = eth_mac;
+	g_tst_dma.rx_index = 0U;
+	g_tst_dma.tx_index = 0U;
+
+	for( unsigned long index_l = 0U; index_l < eth_mac->num_rx_buf; ++index_l )
+	{
+		eth_mac->rx_desc[index_l].status = ETH_MAC_DMA_RDES0_OWN;
+		eth_mac->rx_desc[index_l].length = TST_RDES1_RCH | XMC_ETH_MAC_BUF_SIZE;
+		eth_mac->rx_desc[index_l].buffer1 = (uint32_t)(unsigned long)&eth_mac->rx_buf[index_l * XMC_ETH_MAC_BUF_SIZE];
+		eth_mac->rx_desc[index_l].buffer2 = (uint32_t)(unsigned long)&eth_mac->rx_desc[(index_l + 1U) % eth_mac->num_rx_buf];
+	}
+	for( unsigned long index_l = 0U; index_l < eth_mac->num_tx_buf; ++index_l )
+	{
+		eth_mac->tx_desc[index_l].status = ETH_MAC_DMA_TDES0_TCH | ETH_MAC_DMA_TDES0_LS | ETH_MAC_DMA_TDES0_FS;
+		eth_mac->tx_desc[index_l].buffer1 = (uint32_t)(unsigned long)&eth_mac->tx_buf[index_l * XMC_ETH_MAC_BUF_SIZE];
+		eth_mac->tx_desc[index_l].buffer2 = (uint32_t)(unsigned long)&eth_mac->tx_desc[(index_l + 1U) % eth_mac->num_tx_buf];
+	}
+
+	return XMC_ETH_MAC_STATUS_OK;
+}
+
+void XMC_ETH_MAC_Disable( XMC_ETH_MAC_t * const eth_mac ) { (void) eth_mac; }
+/* Fine update at 50 MHz in steps of 20 ns, as set up by XMCLib */
+void XMC_ETH_MAC_InitPTP( XMC_ETH_MAC_t * const eth_mac, uint32_t config )
+{
+	(void) config;
+	eth_mac->regs->SUB_SECOND_INCREMENT = TST_SUB_SECOND_INCREMENT;
+	eth_mac->regs->TIMESTAMP_ADDEND = (uint32_t)( ( ( (double)0x100000000ULL * TST_SUB_SECOND_UPDATE_FREQ ) /
+													(double)SystemCoreClock ) + 0.5 );
+}
+void XMC_ETH_MAC_UpdateAddend( XMC_ETH_MAC_t * const eth_mac, uint32_t addend ) { eth_mac->regs->TIMESTAMP_ADDEND = addend; }
+void XMC_ETH_MAC_EnableEvent( XMC_ETH_MAC_t * const eth_mac, uint32_t event ) { (void) eth_mac; g_tst_dma.enabled |= event; }
+void XMC_ETH_MAC_ClearEventStatus( XMC_ETH_MAC_t * const eth_mac, uint32_t event ) { (void) eth_mac; g_tst_dma.events &= ~event; }
+uint32_t XMC_ETH_MAC_GetEventStatus( const XMC_ETH_MAC_t * const eth_mac ) { (void) eth_mac; return g_tst_dma.events; }
+
+int32_t XMC_ETH_PHY_Init( XMC_ETH_MAC_t * const eth_mac, uint8_t phy_addr, const XMC_ETH_PHY_CONFIG_t * const config )
+{
+	(void) eth_mac; (void) phy_addr; (void) config;
+	return XMC_ETH_PHY_STATUS_OK;
+}
+int32_t XMC_ETH_PHY_PowerDown( XMC_ETH_MAC_t * const eth_mac, uint8_t phy_addr ) { (void) eth_mac; (void) phy_addr; return XMC_ETH_PHY_STATUS_OK; }
+XMC_ETH_LINK_STATUS_t XMC_ETH_PHY_GetLinkStatus( XMC_ETH_MAC_t * const eth_mac, uint8_t phy_addr ) { (void) eth_mac; (void) phy_addr; return g_tst_dma.link; }
+XMC_ETH_LINK_SPEED_t XMC_ETH_PHY_GetLinkSpeed( XMC_ETH_MAC_t * const eth_mac, uint8_t phy_addr ) { (void) eth_mac; (void) phy_addr; return XMC_ETH_LINK_SPEED_100M; }
+XMC_ETH_LINK_DUPLEX_t XMC_ETH_PHY_GetLinkDuplex( XMC_ETH_MAC_t * const eth_mac, uint8_t phy_addr ) { (void) eth_mac; (void) phy_addr; return XMC_ETH_LINK_DUPLEX_FULL; }
+
+void XMC_GPIO_SetHardwareControl( XMC_GPIO_PORT_t * const port, const uint8_t pin, const XMC_GPIO_HWCTRL_t hwctrl )
+{
+	(void) port; (void) pin; (void) hwctrl;
+}
+
+/******* Checksum offload *******/
+
+/* Ones complement sum of network order words, not yet folded */
+static unsigned long tst_sum( const unsigned char * p_data, const unsigned short length, unsigned long sum )
+{
+	for( unsigned short index_l = 0U; index_l < length; index_l += 2U )
+	{
+		sum += (unsigned long)p_data[index_l] << 8U;
+		if( (index_l + 1U) < length )
+		{
+			sum += p_data[index_l + 1U];
+		}
+		else{	/* Not required */	}
+	}
+
+	return sum;
+}
+
+static unsigned short tst_fold( unsigned long sum )
+{
+	while( 0U != (sum >> 16U) )
+	{
+		sum = (sum & 0xFFFFU) + (sum >> 16U);
+	}
+
+	return static_cast<unsigned short>( sum );
+}
+
+/* Sum of IPv4 pseudo header and UDP datagram */
+static unsigned long tst_udp_sum( const unsigned char * p_ip, const unsigned short header, const unsigned short udp_length )
+{
+	unsigned long sum_l = tst_sum( &p_ip[12], 8U, 0U );
+
+	sum_l += TST_IP_PROTOCOL_UDP + udp_length;
+	return tst_sum( &p_ip[header], udp_length, sum_l );
+}
+
+/*
+ * IPv4 frame with complete header, header length and payload length,
+ * false for other frames which MAC leaves alone
+ */
+static bool tst_ipv4( const unsigned char * p_data, const unsigned short length,
+						unsigned short& header, unsigned short& payload )
+{
+	unsigned short total_l = 0U;
+
+	if( (length < (TST_IP + 20U)) || (0x08U != p_data[TST_ETH_TYPE]) || (0x00U != p_data[TST_ETH_TYPE + 1U]) ||
+		(0x40U != (p_data[TST_IP] & 0xF0U)) )
+	{
+		return false;
+	}
+	else{	/* Not required */	}
+
+	header = static_cast<unsigned short>( (p_data[TST_IP] & 0x0FU) * 4U );
+	total_l = static_cast<unsigned short>( (p_data[TST_IP + 2U] << 8U) | p_data[TST_IP + 3U] );
+	if( (header < 20U) || (total_l < header) || ((TST_IP + total_l) > length) )
+	{
+		return false;
+	}
+	else{	/* Not required */	}
+
+	payload = static_cast<unsigned short>( total_l - header );
+	return true;
+}
+
+/* Insert IPv4 header and UDP or ICMP checksums like MAC checksum offload */
+void tst_checksum_insert( unsigned char * p_data, const unsigned short length )
+{
+	unsigned char * const p_ip = &p_data[TST_IP];
+	unsigned short header_l = 0U;
+	unsigned short payload_l = 0U;
+	unsigned short sum_l = 0U;
+
+	if( !tst_ipv4( p_data, length, header_l, payload_l ) ){ return; }
+	else{	/* Not required */	}
+
+	p_ip[10] = 0U;
+	p_ip[11] = 0U;
+	sum_l = static_cast<unsigned short>( ~tst_fold( tst_sum( p_ip, header_l, 0U ) ) );
+	p_ip[10] = static_cast<unsigned char>( sum_l >> 8U );
+	p_ip[11] = static_cast<unsigned char>( sum_l );
+
+	/* Fragments are not touched by MAC */
+	if( 0U != (((p_ip[6] << 8U) | p_ip[7]) & 0x3FFFU) ){ return; }
+	else{	/* Not required */	}
+
+	if( (TST_IP_PROTOCOL_UDP == p_ip[9]) && (payload_l >= 8U) )
+	{
+		p_ip[header_l + 6U] = 0U;
+		p_ip[header_l + 7U] = 0U;
+		sum_l = static_cast<unsigned short>( ~tst_fold( tst_udp_sum( p_ip, header_l, payload_l ) ) );
+		/* Zero means no checksum in UDP */
+		sum_l = ( 0U == sum_l ) ? 0xFFFFU : sum_l;
+		p_ip[header_l + 6U] = static_cast<unsigned char>( sum_l >> 8U );
+		p_ip[header_l + 7U] = static_cast<unsigned char>( sum_l );
+	}
+	else if( (TST_IP_PROTOCOL_ICMP == p_ip[9]) && (payload_l >= 4U) )
+	{
+		p_ip[header_l + 2U] = 0U;
+		p_ip[header_l + 3U] = 0U;
+		sum_l = static_cast<unsigned short>( ~tst_fold( tst_sum( &p_ip[header_l], payload_l, 0U ) ) );
+		p_ip[header_l + 2U] = static_cast<unsigned char>( sum_l >> 8U );
+		p_ip[header_l + 3U] = static_cast<unsigned char>( sum_l );
+	}
+	else{	/* Not required */	}
+}
+
+/* Check checksums like MAC, RDES4 status */
+unsigned long tst_checksum_check( const unsigned char * p_data, const unsigned short length )
+{
+	const unsigned char * const p_ip = &p_data[TST_IP];
+	unsigned short header_l = 0U;
+	unsigned short payload_l = 0U;
+	unsigned long status_l = TST_RDES4_IPV4;
+
+	if( !tst_ipv4( p_data, length, header_l, payload_l ) ){ return 0U; }
+	else{	/* Not required */	}
+
+	if( 0xFFFFU != tst_fold( tst_sum( p_ip, header_l, 0U ) ) )
+	{
+		return status_l | TST_RDES4_IP_HEADER_ERROR;
+	}
+	else{	/* Not required */	}
+
+	/* Payload of fragments is not checked, payload type stays unknown */
+	if( 0U != (((p_ip[6] << 8U) | p_ip[7]) & 0x3FFFU) ){ return status_l; }
+	else{	/* Not required */	}
+
+	if( (TST_IP_PROTOCOL_UDP == p_ip[9]) && (payload_l >= 8U) )
+	{
+		status_l |= TST_RDES4_UDP;
+		if( (0U != ((p_ip[header_l + 6U] << 8U) | p_ip[header_l + 7U])) &&
+			(0xFFFFU != tst_fold( tst_udp_sum( p_ip, header_l, payload_l ) )) )
+		{
+			status_l |= TST_RDES4_IP_PAYLOAD_ERROR;
+		}
+		else{	/* Not required */	}
+	}
+	else if( (TST_IP_PROTOCOL_ICMP == p_ip[9]) && (payload_l >= 4U) )
+	{
+		status_l |= TST_RDES4_ICMP;
+		if( 0xFFFFU != tst_fold( tst_sum( &p_ip[header_l], payload_l, 0U ) ) )
+		{
+			status_l |= TST_RDES4_IP_PAYLOAD_ERROR;
+		}
+		else{	/* Not required */	}
+	}
+	else{	/* Not required */	}
+
+	return status_l;
+}
+
+/******* System time *******/
+
+/* Run system time for true nanoseconds on drifting oscillator, apply pending update */
+void tst_clock_advance( const unsigned long long nanoseconds )
+{
+	ETH_GLOBAL_TypeDef * const p_regs = g_tst_dma.p_mac->regs;
+	const unsigned long update_ns_l = p_regs->SYSTEM_TIME_NANOSECONDS_UPDATE & ETH_SYSTEM_TIME_NANOSECONDS_UPDATE_TSSS_Msk;
+	unsigned long long time_l = ( g_tst_dma.seconds * TST_NS_PER_SECOND ) + g_tst_dma.nanoseconds;
+	double cycles_l = 0.0;
+
+	/* Coarse update of last step_time() */
+	if( 0U != (p_regs->TIMESTAMP_CONTROL & ETH_TIMESTAMP_CONTROL_TSUPDT_Msk) )
+	{
+		if( 0U != (p_regs->SYSTEM_TIME_NANOSECONDS_UPDATE & ETH_SYSTEM_TIME_NANOSECONDS_UPDATE_ADDSUB_Msk) )
+		{
+			/* Digital rollover, nanoseconds are written as 10^9 - value */
+			time_l -= ( p_regs->SYSTEM_TIME_SECONDS_UPDATE * TST_NS_PER_SECOND ) +
+						( ( 0U == update_ns_l ) ? 0U : ( TST_NS_PER_SECOND - update_ns_l ) );
+		}
+		else
+		{
+			time_l += ( p_regs->SYSTEM_TIME_SECONDS_UPDATE * TST_NS_PER_SECOND ) + update_ns_l;
+		}
+		p_regs->TIMESTAMP_CONTROL &= ~ETH_TIMESTAMP_CONTROL_TSUPDT_Msk;
+	}
+	else{	/* Not required */	}
+
+	/* Addend is added every system clock, each carry is one increment */
+	cycles_l = g_tst_dma.cycles + ( ( (double)nanoseconds * (double)SystemCoreClock *
+									( 1.0 + ( (double)g_tst_dma.drift_ppb * 1e-9 ) ) ) / 1e9 );
+	g_tst_dma.cycles = cycles_l - (double)(unsigned long long)cycles_l;
+	g_tst_dma.accumulator += (unsigned long long)cycles_l * p_regs->TIMESTAMP_ADDEND;
+	time_l += ( g_tst_dma.accumulator >> 32U ) * p_regs->SUB_SECOND_INCREMENT;
+	g_tst_dma.accumulator &= 0xFFFFFFFFULL;
+
+	g_tst_dma.seconds = (unsigned long)( time_l / TST_NS_PER_SECOND );
+	g_tst_dma.nanoseconds = (unsigned long)( time_l % TST_NS_PER_SECOND );
+	p_regs->SYSTEM_TIME_SECONDS = g_tst_dma.seconds;
+	p_regs->SYSTEM_TIME_NANOSECONDS = g_tst_dma.nanoseconds;
+}
+
+/******* MAC DMA model *******/
+
+/* Fresh model and ETH__ with link up */
+void tst_dma_open( void )
+{
+	(void) ETH__::init( eETH_Init_::ETH_INIT_CLOSE );
+	g_tst_dma = tStTst_Dma();
+	(void) ETH__::init();
+	for( unsigned long index_l = 0U; index_l < ETH_LINK_POLL_TICKS; ++index_l )
+	{
+		ETH__::tick( 1U );
+	}
+}
+
+/* Raise events, interrupt is taken at once when enabled */
+void tst_dma_interrupt( const unsigned long events )
+{
+	g_tst_dma.events |= events;
+	if( 0U != (g_tst_dma.events & g_tst_dma.enabled) )
+	{
+		++g_tst_dma.interrupts;
+		ETH__::isr_entry();
+	}
+	else{	/* Not required */	}
+}
+
+/* Write frame into next receive descriptor with checksum status, false if CPU owns it */
+bool tst_dma_receive( const unsigned char * p_data, const unsigned short length, const unsigned long status )
+{
+	XMC_ETH_MAC_DMA_DESC_t * const p_desc = &g_tst_dma.p_mac->rx_desc[g_tst_dma.rx_index];
+	const unsigned long extended_l = tst_checksum_check( p_data, length );
+
+	if( 0U == (p_desc->status & ETH_MAC_DMA_RDES0_OWN) ){ return false; }
+	else{	/* Not required */	}
+
+	memcpy( reinterpret_cast<void*>( static_cast<unsigned long>(p_desc->buffer1) ), p_data, length );
+	g_tst_dma.rx_buffers.push_back( p_desc->buffer1 );
+	p_desc->extended_status = extended_l;
+	p_desc->time_stamp_seconds = g_tst_dma.seconds;
+	p_desc->time_stamp_nanoseconds = g_tst_dma.nanoseconds;
+	/* Frame length counts FCS */
+	p_desc->status = ( static_cast<unsigned long>(length + 4U) << 16U ) | ETH_MAC_DMA_RDES0_FS |
+						ETH_MAC_DMA_RDES0_LS | ETH_MAC_DMA_RDES0_TSA |
+						( ( 0U != extended_l ) ? ETH_MAC_DMA_RDES0_ESA : 0U ) | status;
+	g_tst_dma.rx_index = static_cast<unsigned char>( (g_tst_dma.rx_index + 1U) % g_tst_dma.p_mac->num_rx_buf );
+	g_tst_dma.nanoseconds += g_tst_dma.frame_ns;
+
+	return true;
+}
+
+/* Receive frame and raise receive or buffer unavailable event */
+bool tst_dma_input( const unsigned char * p_data, const unsigned short length )
+{
+	const bool received_l = tst_dma_receive( p_data, length );
+
+	tst_dma_interrupt( received_l ? ETH_STATUS_RI_Msk : ETH_STATUS_RU_Msk );
+	return received_l;
+}
+
+/* Send transmit descriptors owned by DMA to wire, then raise events */
+void tst_dma_run( void )
+{
+	unsigned long events_l = 0U;
+
+	while( true )
+	{
+		XMC_ETH_MAC_DMA_DESC_t * const p_desc = &g_tst_dma.p_mac->tx_desc[g_tst_dma.tx_index];
+		const unsigned long control_l = p_desc->status;
+		unsigned char * const p_data = reinterpret_cast<unsigned char*>( static_cast<unsigned long>(p_desc->buffer1) );
+		const unsigned short length_l = static_cast<unsigned short>( p_desc->length & 0x1FFFU );
+
+		if( 0U == (control_l & ETH_MAC_DMA_TDES0_OWN) ){ break; }
+		else{	/* Not required */	}
+
+		if( ETH_MAC_DMA_TDES0_CIC == (control_l & ETH_MAC_DMA_TDES0_CIC) )
+		{
+			tst_checksum_insert( p_data, length_l );
+		}
+		else{	/* Not required */	}
+
+		/* Start of frame on wire */
+		if( 0U != (control_l & ETH_MAC_DMA_TDES0_TTSE) )
+		{
+			p_desc->time_stamp_seconds = g_tst_dma.seconds;
+			p_desc->time_stamp_nanoseconds = g_tst_dma.nanoseconds;
+		}
+		else{	/* Not required */	}
+
+		if( nullptr != g_tst_dma.fp_wire )
+		{
+			g_tst_dma.fp_wire( p_data, length_l );
+			g_tst_dma.nanoseconds += g_tst_dma.frame_ns;
+		}
+		else if( tst_dma_receive( p_data, length_l ) )
+		{
+			events_l |= ETH_STATUS_RI_Msk;
+		}
+		else
+		{
+			events_l |= ETH_STATUS_RU_Msk;
+		}
+
+		if( 0U != (control_l & ETH_MAC_DMA_TDES0_IC) )
+		{
+			++g_tst_dma.tx_interrupt_requests;
+			events_l |= ETH_STATUS_TI_Msk;
+		}
+		else{	/* Not required */	}
+
+		p_desc->status = ( control_l & ~ETH_MAC_DMA_TDES0_OWN ) |
+							( ( 0U != (control_l & ETH_MAC_DMA_TDES0_TTSE) ) ? ETH_MAC_DMA_TDES0_TTSS : 0U );
+		g_tst_dma.tx_index = static_cast<unsigned char>( (g_tst_dma.tx_index + 1U) % g_tst_dma.p_mac->num_tx_buf );
+	}
+
+	if( 0U != events_l )
+	{
+		tst_dma_interrupt( events_l );
+	}
+	else{	/* Not required */	}
+}
+
+/*********************************** End of File ******************************/
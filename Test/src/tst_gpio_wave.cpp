@@ -0,0 +1,240 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		GPIO Waveform Host Test
+* Filename:		tst_gpio_wave.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	tst_gpio_wave.cpp
+ *  @brief:	This source file contains host model of waveform engine output.
+ *  		Words built with GPIO_Wave__::make_word() are applied to a
+ *  		port model with OMR semantics at the times play() documents,
+ *  		and the resulting pin timeline is checked.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <tst_harness.h>
+#include <dri_gpio_wave.h>
+#include <vector>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Pins used by tests, all within GPIO_WAVE_PIN_MASK */
+#define TST_PIN_CLOCK			( 0x1UL << 6U )
+#define TST_PIN_DATA			( 0x1UL << 7U )
+#define TST_PIN_STROBE			( 0x1UL << 10U )
+
+/* Board pins sharing port 1, never addressed by waveform */
+#define TST_PORT1_BOARD_PINS	( (0x1UL << 0U) | (0x1UL << 1U) | (0x1UL << 9U) | \
+								  (0x1UL << 14U) | (0x1UL << 15U) )
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Pin levels of port after a word was written
+ */
+typedef struct tStTst_Edge_
+{
+	unsigned long tick;			/**< Timer ticks since play() */
+	unsigned long levels;		/**< OUT register after write */
+} tStTst_Edge;
+
+/*
+ * @brief	Port model, OUT register changed through OMR writes only
+ */
+class Tst_Port__
+{
+public:
+	explicit Tst_Port__( const unsigned long out ) : out(out) {}
+
+	/* PS sets, PR resets, PS and PR together toggle */
+	void write_omr( const unsigned long word )
+	{
+		const unsigned long set_l = word & 0xFFFFUL;
+		const unsigned long reset_l = (word >> 16U) & 0xFFFFUL;
+
+		out = ( out & ~(set_l | reset_l) ) |
+				( set_l & ~reset_l ) |
+				( set_l & reset_l & ~out );
+	}
+
+	unsigned long out;
+};
+
+/*
+ * @brief	Output model of play(), word n of loop k is written at
+ * 			((k * count) + n + 1) * period ticks. Re-arm in DMA
+ * 			interrupt is taken to be within one period.
+ */
+static std::vector<tStTst_Edge> tst_play( Tst_Port__& port, const unsigned long * const p_words,
+											const unsigned short count, const unsigned short period,
+											const unsigned long repeat )
+{
+	std::vector<tStTst_Edge> timeline_l;
+	unsigned long tick_l = 0U;
+
+	for( unsigned long loop_l = 0U; loop_l < repeat; ++loop_l )
+	{
+		for( unsigned short index_l = 0U; index_l < count; ++index_l )
+		{
+			tick_l += period;
+			port.write_omr( p_words[index_l] );
+			timeline_l.push_back( { tick_l, port.out } );
+		}
+	}
+
+	return timeline_l;
+}
+
+/*
+ * @brief	Shift register pattern, data changes with clock low and is
+ * 			taken on rising clock, MSB first
+ */
+template <unsigned char BITS>
+struct Tst_Shift_Pattern
+{
+	constexpr Tst_Shift_Pattern( const unsigned long value ) : words()
+	{
+		for( unsigned char bit = 0U; bit < BITS; ++bit )
+		{
+			const unsigned long data = ( 0U != ( value & (0x1UL << (BITS - 1U - bit)) ) ) ?
+											TST_PIN_DATA : 0U;
+			words[2U * bit] = GPIO_Wave__::make_word( data, TST_PIN_CLOCK | TST_PIN_DATA );
+			words[(2U * bit) + 1U] = GPIO_Wave__::make_word( TST_PIN_CLOCK, TST_PIN_CLOCK );
+		}
+	}
+
+	unsigned long words[2U * BITS];
+};
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Pattern table as built for flash */
+static constexpr Tst_Shift_Pattern<8U> sg_tst_shift_a5( 0xA5UL );
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Waveform pins must not overlap board pins on port 1 */
+static void test_pin_mask( void )
+{
+	TST_CHECK_EQ( 0U, GPIO_WAVE_PIN_MASK & TST_PORT1_BOARD_PINS );
+	TST_CHECK_EQ( GPIO_WAVE_PIN_MASK, GPIO_WAVE_PIN_MASK & 0xFFFFUL );
+}
+
+/* Words drive masked pins only, other pins keep their levels */
+static void test_make_word( void )
+{
+	Tst_Port__ port_l( 0x0003UL );
+
+	port_l.write_omr( GPIO_Wave__::make_word( 0xFFFFUL ) );
+	TST_CHECK_EQ( 0x0003UL | GPIO_WAVE_PIN_MASK, port_l.out );
+
+	port_l.write_omr( GPIO_Wave__::make_word( 0U ) );
+	TST_CHECK_EQ( 0x0003UL, port_l.out );
+
+	port_l.write_omr( GPIO_Wave__::make_word( TST_PIN_DATA, TST_PIN_DATA | TST_PIN_STROBE ) );
+	TST_CHECK_EQ( 0x0003UL | TST_PIN_DATA, port_l.out );
+
+	/* Empty word is a no operation step */
+	TST_CHECK_EQ( 0U, GPIO_Wave__::make_word( 0xFFFFUL, 0U ) );
+}
+
+/* Toggle words flip pins on every write */
+static void test_make_toggle( void )
+{
+	Tst_Port__ port_l( TST_PIN_CLOCK );
+	const unsigned long toggle_l = GPIO_Wave__::make_toggle( TST_PIN_CLOCK | TST_PIN_STROBE );
+
+	port_l.write_omr( toggle_l );
+	TST_CHECK_EQ( TST_PIN_STROBE, port_l.out );
+	port_l.write_omr( toggle_l );
+	TST_CHECK_EQ( TST_PIN_CLOCK, port_l.out );
+}
+
+/* Serial byte comes out with one edge per period and is read back on clock */
+static void test_shift_timeline( void )
+{
+	Tst_Port__ port_l( 0U );
+	const unsigned short period_l = GPIO_WAVE_MIN_PERIOD;
+	const std::vector<tStTst_Edge> timeline_l =
+			tst_play( port_l, sg_tst_shift_a5.words, 16U, period_l, 1U );
+	unsigned long value_l = 0U;
+	unsigned long clock_l = 0U;
+	unsigned long rising_l = 0U;
+
+	TST_CHECK_EQ( 16U, timeline_l.size() );
+	for( const tStTst_Edge& edge_l : timeline_l )
+	{
+		if( (0U == clock_l) && (0U != (edge_l.levels & TST_PIN_CLOCK)) )
+		{
+			/* Rising clock at end of each bit, 2 words per bit */
+			++rising_l;
+			TST_CHECK_EQ( 2U * rising_l * period_l, edge_l.tick );
+			value_l = (value_l << 1U) | ( (0U != (edge_l.levels & TST_PIN_DATA)) ? 1U : 0U );
+		}
+		clock_l = edge_l.levels & TST_PIN_CLOCK;
+		/* Nothing outside addressed pins moves */
+		TST_CHECK_EQ( 0U, edge_l.levels & ~(TST_PIN_CLOCK | TST_PIN_DATA) );
+	}
+	TST_CHECK_EQ( 8U, rising_l );
+	TST_CHECK_EQ( 0xA5U, value_l );
+}
+
+/* Loops follow each other without gap */
+static void test_repeat_timeline( void )
+{
+	Tst_Port__ port_l( 0U );
+	static const unsigned long square_l[2] =
+	{
+		GPIO_Wave__::make_word( TST_PIN_STROBE, TST_PIN_STROBE ),
+		GPIO_Wave__::make_word( 0U, TST_PIN_STROBE )
+	};
+	const std::vector<tStTst_Edge> timeline_l = tst_play( port_l, square_l, 2U, 100U, 3U );
+
+	TST_CHECK_EQ( 6U, timeline_l.size() );
+	for( unsigned long index_l = 0U; index_l < timeline_l.size(); ++index_l )
+	{
+		TST_CHECK_EQ( (index_l + 1U) * 100U, timeline_l[index_l].tick );
+		TST_CHECK_EQ( ( 0U == (index_l & 1U) ) ? TST_PIN_STROBE : 0U, timeline_l[index_l].levels );
+	}
+}
+
+int main( void )
+{
+	TST_RUN( test_pin_mask );
+	TST_RUN( test_make_word );
+	TST_RUN( test_make_toggle );
+	TST_RUN( test_shift_timeline );
+	TST_RUN( test_repeat_timeline );
+
+	return tst_result();
+}
+
+/*********************************** End of File ******************************/
@@ -0,0 +1,447 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		ISO-TP Host Test
+* Filename:		tst_isotp.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	tst_isotp.cpp
+ *  @brief:	This source file contains host test of ISO-TP sessions against
+ *  		a simulated CAN bus. CAN__::transmit() of the test records frames
+ *  		with time in sub tick steps, so separation of consecutive frames
+ *  		is measured the way a bus analyser sees it and not in ticks.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <tst_harness.h>
+#include <mid_isotp.h>
+#include <dri_can_extern.h>
+#include <string.h>
+#include <vector>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Simulated time steps per tick of ISOTP__::tick() */
+#define TST_STEPS_PER_TICK		10U
+
+/* Identifiers of session 0, tester sends on request identifier */
+#define TST_REQUEST_ID			0x7E0U
+#define TST_RESPONSE_ID			0x7E8U
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Frame seen on simulated bus
+ */
+typedef struct tStTst_BusFrame_
+{
+	unsigned long step;			/**< Simulated time of transmit */
+	unsigned char node;			/**< CAN object index */
+	tStCAN_Frame frame;
+} tStTst_BusFrame;
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+/* Simulated bus */
+static std::vector<tStTst_BusFrame> sg_tst_bus;
+static unsigned long sg_tst_step = 0U;
+static bool sg_tst_can_busy = false;
+
+/* Last completion and last message received */
+static eISOTP_Result_ sg_tst_tx_result = eISOTP_Result_::ISOTP_RESULT_ABORTED;
+static unsigned long sg_tst_tx_done = 0U;
+static std::vector<unsigned char> sg_tst_rx_message;
+static unsigned long sg_tst_rx_done = 0U;
+
+/* CAN objects of simulated bus, only transmit() is used by ISO-TP */
+static CAN__ sg_tst_can_0( eCAN_Node_::CAN_NODE_0 );
+static CAN__ sg_tst_can_1( eCAN_Node_::CAN_NODE_1 );
+CAN__ * g_p_can_obj[CAN_NODES_USED] = { &sg_tst_can_0, &sg_tst_can_1 };
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/* Simulated CAN node, frame goes on bus unless node is set busy */
+eCAN_Status_ CAN__::init( const eCAN_Init_& init )
+{
+	(void) init;
+	return eCAN_Status_::CAN_STATUS_SUCCESS;
+}
+
+eCAN_Status_ CAN__::transmit( const tStCAN_Frame& frame )
+{
+	if( true == sg_tst_can_busy ){ return eCAN_Status_::CAN_STATUS_BUSY; }
+	else{	/* Not required */	}
+
+	sg_tst_bus.push_back( { sg_tst_step, static_cast<unsigned char>(node), frame } );
+	return eCAN_Status_::CAN_STATUS_SUCCESS;
+}
+
+/* Receiver named in session table, message is copied and buffer given back */
+void isotp_rx_handler( const unsigned char session, unsigned char * p_data, const unsigned short length )
+{
+	(void) session;
+	sg_tst_rx_message.assign( p_data, p_data + length );
+	++sg_tst_rx_done;
+	ISOTP__::release( p_data );
+}
+
+static void tst_tx_handler( const unsigned char session, const eISOTP_Result_ result, void * p_arg )
+{
+	(void) session;
+	(void) p_arg;
+	sg_tst_tx_result = result;
+	++sg_tst_tx_done;
+}
+
+/* Fresh sessions and empty bus */
+static void tst_reset( void )
+{
+	(void) ISOTP__::init( eISOTP_Init_::ISOTP_INIT_CLOSE );
+	(void) ISOTP__::init();
+	sg_tst_bus.clear();
+	sg_tst_can_busy = false;
+	sg_tst_tx_done = 0U;
+	sg_tst_rx_done = 0U;
+	sg_tst_rx_message.clear();
+}
+
+/* Advance one step, tick at start of each tick period, deferred context runs every step */
+static void tst_step( void )
+{
+	++sg_tst_step;
+	if( 0U == (sg_tst_step % TST_STEPS_PER_TICK) )
+	{
+		ISOTP__::tick( 1U );
+	}
+	else{	/* Not required */	}
+	ISOTP__::run();
+}
+
+static void tst_steps( const unsigned long steps )
+{
+	for( unsigned long index_l = 0U; index_l < steps; ++index_l )
+	{
+		tst_step();
+	}
+}
+
+/* Advance to last step before next tick */
+static void tst_late_in_tick( void )
+{
+	while( (TST_STEPS_PER_TICK - 1U) != (sg_tst_step % TST_STEPS_PER_TICK) )
+	{
+		tst_step();
+	}
+}
+
+/* Padded frame from tester to session 0 */
+static void tst_input( const std::vector<unsigned char>& bytes )
+{
+	tStCAN_Frame frame_l;
+
+	frame_l.id = TST_REQUEST_ID;
+	frame_l.dlc = 8U;
+	memset( frame_l.data, ISOTP_PADDING, sizeof(frame_l.data) );
+	memcpy( frame_l.data, bytes.data(), bytes.size() );
+	TST_CHECK( ISOTP__::input( 0U, frame_l ) );
+}
+
+/* Consecutive frames of session 0 on bus */
+static unsigned long tst_count_cf( void )
+{
+	unsigned long count_l = 0U;
+
+	for( const tStTst_BusFrame& bus_l : sg_tst_bus )
+	{
+		if( (TST_RESPONSE_ID == bus_l.frame.id) && (0x20U == (bus_l.frame.data[0] & 0xF0U)) ){ ++count_l; }
+		else{	/* Not required */	}
+	}
+	return count_l;
+}
+
+/* Single frame is sent padded and completes at once */
+static void test_single_frame( void )
+{
+	static const unsigned char message_l[5] = { 0x62U, 0xF1U, 0x90U, 0x01U, 0x02U };
+
+	tst_reset();
+	TST_CHECK( eISOTP_Status_::ISOTP_STATUS_SUCCESS == ISOTP__::send( 0U, message_l, 5U, tst_tx_handler ) );
+	TST_CHECK( ISOTP__::is_busy( 0U ) );
+	tst_step();
+
+	TST_CHECK_EQ( 1U, sg_tst_bus.size() );
+	TST_CHECK_EQ( TST_RESPONSE_ID, sg_tst_bus[0].frame.id );
+	TST_CHECK_EQ( 8U, sg_tst_bus[0].frame.dlc );
+	TST_CHECK_EQ( 0x05U, sg_tst_bus[0].frame.data[0] );
+	TST_CHECK_EQ( 0, memcmp( message_l, &sg_tst_bus[0].frame.data[1], 5U ) );
+	TST_CHECK_EQ( ISOTP_PADDING, sg_tst_bus[0].frame.data[7] );
+	TST_CHECK_EQ( 1U, sg_tst_tx_done );
+	TST_CHECK( eISOTP_Result_::ISOTP_RESULT_OK == sg_tst_tx_result );
+	TST_CHECK( !ISOTP__::is_busy( 0U ) );
+}
+
+/*
+ * Consecutive frames keep STmin on bus time. Flow control arrives late in a
+ * tick, so first frame leaves just before tick and a tick counted gap of
+ * STmin alone would be short by almost one tick.
+ */
+static void test_st_min( void )
+{
+	static unsigned char message_l[100];
+	const unsigned char st_min_l = 5U;
+	unsigned long previous_l = 0U;
+	unsigned char sn_l = 1U;
+
+	tst_reset();
+	for( unsigned char index_l = 0U; index_l < sizeof(message_l); ++index_l ){ message_l[index_l] = index_l; }
+	TST_CHECK( eISOTP_Status_::ISOTP_STATUS_SUCCESS == ISOTP__::send( 0U, message_l, sizeof(message_l), tst_tx_handler ) );
+	tst_step();
+	TST_CHECK_EQ( 1U, sg_tst_bus.size() );
+	TST_CHECK_EQ( 0x10U, sg_tst_bus[0].frame.data[0] );
+	TST_CHECK_EQ( 100U, sg_tst_bus[0].frame.data[1] );
+
+	tst_late_in_tick();
+	tst_input( { 0x30U, 0U, st_min_l } );
+	tst_steps( 200U * TST_STEPS_PER_TICK );
+
+	/* 94 bytes after first frame in 14 consecutive frames */
+	TST_CHECK_EQ( 15U, sg_tst_bus.size() );
+	for( unsigned long index_l = 1U; index_l < sg_tst_bus.size(); ++index_l )
+	{
+		TST_CHECK_EQ( 0x20U | sn_l, sg_tst_bus[index_l].frame.data[0] );
+		sn_l = (unsigned char)( (sn_l + 1U) & 0x0FU );
+		if( index_l > 1U )
+		{
+			TST_CHECK( (sg_tst_bus[index_l].step - previous_l) >= (st_min_l * TST_STEPS_PER_TICK) );
+		}
+		else{	/* Not required */	}
+		previous_l = sg_tst_bus[index_l].step;
+	}
+	TST_CHECK_EQ( 0, memcmp( &message_l[97], &sg_tst_bus[14].frame.data[1], 3U ) );
+	TST_CHECK_EQ( 1U, sg_tst_tx_done );
+	TST_CHECK( eISOTP_Result_::ISOTP_RESULT_OK == sg_tst_tx_result );
+}
+
+/* STmin 0 sends a burst per run, block size stops sender until next flow control */
+static void test_block_size( void )
+{
+	static unsigned char message_l[200];
+
+	tst_reset();
+	TST_CHECK( eISOTP_Status_::ISOTP_STATUS_SUCCESS == ISOTP__::send( 0U, message_l, sizeof(message_l), tst_tx_handler ) );
+	tst_step();
+	tst_input( { 0x30U, 4U, 0U } );
+
+	/* Whole block within flow control input, no tick needed */
+	TST_CHECK_EQ( 4U, tst_count_cf() );
+	tst_steps( 50U * TST_STEPS_PER_TICK );
+	TST_CHECK_EQ( 4U, tst_count_cf() );
+	TST_CHECK( ISOTP__::is_busy( 0U ) );
+
+	/* No limit for rest, bursts of ISOTP_CF_PER_RUN */
+	tst_input( { 0x30U, 0U, 0U } );
+	TST_CHECK_EQ( 4U + ISOTP_CF_PER_RUN, tst_count_cf() );
+	tst_steps( 10U );
+	/* 194 bytes in 28 consecutive frames */
+	TST_CHECK_EQ( 28U, tst_count_cf() );
+	TST_CHECK_EQ( 1U, sg_tst_tx_done );
+	TST_CHECK( eISOTP_Result_::ISOTP_RESULT_OK == sg_tst_tx_result );
+}
+
+/* Missing flow control ends transmission with N_Bs */
+static void test_timeout_bs( void )
+{
+	static unsigned char message_l[20];
+
+	tst_reset();
+	TST_CHECK( eISOTP_Status_::ISOTP_STATUS_SUCCESS == ISOTP__::send( 0U, message_l, sizeof(message_l), tst_tx_handler ) );
+	tst_steps( (ISOTP_TIMEOUT_BS - 1U) * TST_STEPS_PER_TICK );
+	TST_CHECK_EQ( 0U, sg_tst_tx_done );
+	tst_steps( 2U * TST_STEPS_PER_TICK );
+	TST_CHECK_EQ( 1U, sg_tst_tx_done );
+	TST_CHECK( eISOTP_Result_::ISOTP_RESULT_TIMEOUT_BS == sg_tst_tx_result );
+}
+
+/* Frame refused by CAN is retried and given up with N_As */
+static void test_timeout_a( void )
+{
+	static const unsigned char message_l[3] = { 1U, 2U, 3U };
+
+	tst_reset();
+	sg_tst_can_busy = true;
+	TST_CHECK( eISOTP_Status_::ISOTP_STATUS_SUCCESS == ISOTP__::send( 0U, message_l, 3U, tst_tx_handler ) );
+	TST_CHECK( eISOTP_Status_::ISOTP_STATUS_BUSY == ISOTP__::send( 0U, message_l, 3U, tst_tx_handler ) );
+	tst_steps( 10U * TST_STEPS_PER_TICK );
+	TST_CHECK_EQ( 0U, sg_tst_tx_done );
+
+	/* Node free again, retry goes out */
+	sg_tst_can_busy = false;
+	tst_step();
+	TST_CHECK_EQ( 1U, sg_tst_bus.size() );
+	TST_CHECK( eISOTP_Result_::ISOTP_RESULT_OK == sg_tst_tx_result );
+
+	sg_tst_can_busy = true;
+	TST_CHECK( eISOTP_Status_::ISOTP_STATUS_SUCCESS == ISOTP__::send( 0U, message_l, 3U, tst_tx_handler ) );
+	tst_steps( (ISOTP_TIMEOUT_A + 1U) * TST_STEPS_PER_TICK );
+	TST_CHECK_EQ( 2U, sg_tst_tx_done );
+	TST_CHECK( eISOTP_Result_::ISOTP_RESULT_TIMEOUT_A == sg_tst_tx_result );
+}
+
+/* Segmented request is collected in a pool buffer with flow control per block */
+static void test_receive( void )
+{
+	const unsigned char length_l = 6U + (9U * 7U);
+	unsigned char value_l = 6U;
+
+	tst_reset();
+	tst_input( { 0x10U, length_l, 0U, 1U, 2U, 3U, 4U, 5U } );
+	TST_CHECK_EQ( 1U, sg_tst_bus.size() );
+	TST_CHECK_EQ( 0x30U, sg_tst_bus[0].frame.data[0] );
+	TST_CHECK_EQ( g_isotp_sessions[0].block_size, sg_tst_bus[0].frame.data[1] );
+	TST_CHECK_EQ( ISOTP_POOL_BLOCKS - 1U, ISOTP__::get_pool_free() );
+
+	for( unsigned char sn_l = 1U; sn_l <= 9U; ++sn_l )
+	{
+		std::vector<unsigned char> frame_l( 1U, (unsigned char)( 0x20U | (sn_l & 0x0FU) ) );
+
+		for( unsigned char index_l = 0U; index_l < 7U; ++index_l ){ frame_l.push_back( value_l++ ); }
+		tst_input( frame_l );
+		tst_step();
+	}
+
+	/* Second flow control after block of 8 */
+	TST_CHECK_EQ( 2U, sg_tst_bus.size() );
+	TST_CHECK_EQ( 1U, sg_tst_rx_done );
+	TST_CHECK_EQ( length_l, sg_tst_rx_message.size() );
+	for( unsigned char index_l = 0U; index_l < length_l; ++index_l )
+	{
+		TST_CHECK_EQ( index_l, sg_tst_rx_message[index_l] );
+	}
+	TST_CHECK_EQ( ISOTP_POOL_BLOCKS, ISOTP__::get_pool_free() );
+}
+
+/* Lost consecutive frame and silent sender both free the buffer */
+static void test_receive_errors( void )
+{
+	tst_reset();
+	tst_input( { 0x10U, 20U, 0U, 0U, 0U, 0U, 0U, 0U } );
+	tst_input( { 0x22U } );
+	TST_CHECK_EQ( 1U, ISOTP__::get_rx_errors( 0U ) );
+	TST_CHECK_EQ( ISOTP_POOL_BLOCKS, ISOTP__::get_pool_free() );
+
+	tst_input( { 0x10U, 20U, 0U, 0U, 0U, 0U, 0U, 0U } );
+	tst_steps( (ISOTP_TIMEOUT_CR + 1U) * TST_STEPS_PER_TICK );
+	TST_CHECK_EQ( 2U, ISOTP__::get_rx_errors( 0U ) );
+	TST_CHECK_EQ( ISOTP_POOL_BLOCKS, ISOTP__::get_pool_free() );
+	TST_CHECK_EQ( 0U, sg_tst_rx_done );
+}
+
+/* Ticks credited after tickless idle arrive in one call and still time out */
+static void test_credited_ticks( void )
+{
+	tst_reset();
+	TST_CHECK( !ISOTP__::is_receiving( 0U ) );
+	tst_input( { 0x10U, 20U, 0U, 0U, 0U, 0U, 0U, 0U } );
+	TST_CHECK( ISOTP__::is_receiving( 0U ) );
+
+	ISOTP__::tick( ISOTP_TIMEOUT_CR - 1U );
+	ISOTP__::run();
+	TST_CHECK( ISOTP__::is_receiving( 0U ) );
+
+	ISOTP__::tick( 2U );
+	ISOTP__::run();
+	TST_CHECK( !ISOTP__::is_receiving( 0U ) );
+	TST_CHECK_EQ( 1U, ISOTP__::get_rx_errors( 0U ) );
+	TST_CHECK_EQ( ISOTP_POOL_BLOCKS, ISOTP__::get_pool_free() );
+}
+
+/* Sessions on one node run side by side without mixing frames */
+static void test_two_sessions( void )
+{
+	static unsigned char message_0_l[30];
+	static unsigned char message_1_l[30];
+	tStCAN_Frame fc_l;
+	unsigned long cf_0_l = 0U;
+	unsigned long cf_1_l = 0U;
+
+	tst_reset();
+	memset( message_0_l, 0xA0, sizeof(message_0_l) );
+	memset( message_1_l, 0xA1, sizeof(message_1_l) );
+	TST_CHECK( eISOTP_Status_::ISOTP_STATUS_SUCCESS == ISOTP__::send( 0U, message_0_l, 30U, tst_tx_handler ) );
+	TST_CHECK( eISOTP_Status_::ISOTP_STATUS_SUCCESS == ISOTP__::send( 1U, message_1_l, 30U, tst_tx_handler ) );
+	tst_step();
+	TST_CHECK_EQ( 2U, sg_tst_bus.size() );
+
+	tst_input( { 0x30U, 0U, 0U } );
+	fc_l.id = g_isotp_sessions[1].rx_id;
+	fc_l.extended = 1U;
+	fc_l.dlc = 3U;
+	fc_l.data[0] = 0x30U;
+	fc_l.data[1] = 0U;
+	fc_l.data[2] = 0U;
+	TST_CHECK( ISOTP__::input( 0U, fc_l ) );
+	tst_steps( 5U );
+
+	for( const tStTst_BusFrame& bus_l : sg_tst_bus )
+	{
+		if( 0x20U != (bus_l.frame.data[0] & 0xF0U) ){ continue; }
+		else if( (TST_RESPONSE_ID == bus_l.frame.id) && (0U == bus_l.frame.extended) )
+		{
+			TST_CHECK_EQ( 0xA0U, bus_l.frame.data[1] );
+			++cf_0_l;
+		}
+		else
+		{
+			TST_CHECK_EQ( g_isotp_sessions[1].tx_id, bus_l.frame.id );
+			TST_CHECK_EQ( 0xA1U, bus_l.frame.data[1] );
+			++cf_1_l;
+		}
+	}
+	TST_CHECK_EQ( 4U, cf_0_l );
+	TST_CHECK_EQ( 4U, cf_1_l );
+	TST_CHECK_EQ( 2U, sg_tst_tx_done );
+}
+
+int main( void )
+{
+	TST_RUN( test_single_frame );
+	TST_RUN( test_st_min );
+	TST_RUN( test_block_size );
+	TST_RUN( test_timeout_bs );
+	TST_RUN( test_timeout_a );
+	TST_RUN( test_receive );
+	TST_RUN( test_receive_errors );
+	TST_RUN( test_credited_ticks );
+	TST_RUN( test_two_sessions );
+
+	return tst_result();
+}
+
+/*********************************** End of File ******************************/
@@ -0,0 +1,422 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		PTP Servo Host Simulation
+* Filename:		tst_ptp.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	tst_ptp.cpp
+ *  @brief:	This source file contains closed loop simulation of PTP__ on
+ *  		UDP__, ETH__ and the MAC model of tst_eth_model.cpp. System time
+ *  		of the model runs on an oscillator off nominal and is steered
+ *  		through the addend register by the servo. A master with a
+ *  		perfect clock sends two step Sync once per second over a path
+ *  		of fixed delay and answers Delay_Req. Pull in, lock, path delay
+ *  		and rate are checked and a summary is printed.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <tst_harness.h>
+#include <tst_periph.h>
+#include <tst_eth_model.h>
+#include <mid_udp.h>
+#include <mid_ptp.h>
+#include <string.h>
+#include <vector>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+#define TST_NS_PER_SECOND		1000000000LL
+
+/* Master in subnet, entry 1 of ARP cache */
+#define TST_MASTER_IP			UDP_IPV4( 192U, 168U, 0U, 2U )
+
+/* One way delay of path, ns */
+#define TST_PATH_DELAY			5000LL
+
+/* Sync interval and ticks of PTP__::tick() per interval */
+#define TST_SYNC_INTERVAL		TST_NS_PER_SECOND
+#define TST_TICKS_PER_SYNC		1000U
+
+/* Servo settles within this many intervals after lock is declared */
+#define TST_SETTLE_INTERVALS	20U
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Simulated network, true time is time of master
+ */
+typedef struct tStTst_Net_
+{
+	long long time = 0;						/**< True time, ns */
+	unsigned short sequence = 0U;			/**< Sync sequence of master */
+	long long jitter = 0;					/**< Peak timestamp noise of master, ns */
+	unsigned long seed = 1U;
+	bool one_step = false;
+	std::vector<std::vector<unsigned char>> requests;	/**< Delay_Req taken off wire */
+} tStTst_Net;
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+static const unsigned char sg_tst_master_mac[6] = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U };
+static const unsigned char sg_tst_master_port[PTP_PORT_IDENTITY_SIZE] =
+		{ 0x02U, 0x00U, 0x00U, 0xFFU, 0xFEU, 0x00U, 0x00U, 0x02U, 0x00U, 0x01U };
+
+static tStTst_Net sg_tst_net;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/******* Handlers *******/
+
+void eth_callback_handler( const eETH_Event_ event )
+{
+	(void) event;
+}
+
+void udp_rx_handler( const tStUDP_Endpoint& source, const unsigned char * p_data, const unsigned short length )
+{
+	(void) source; (void) p_data; (void) length;
+}
+
+/* Delay_Req of slave */
+static void tst_wire( const unsigned char * p_data, const unsigned short length )
+{
+	sg_tst_net.requests.emplace_back( p_data, p_data + length );
+}
+
+/******* Master *******/
+
+static void tst_put_16( unsigned char * p_data, const unsigned long long value )
+{
+	p_data[0] = static_cast<unsigned char>( value >> 8U );
+	p_data[1] = static_cast<unsigned char>( value );
+}
+
+static void tst_put_32( unsigned char * p_data, const unsigned long long value )
+{
+	tst_put_16( p_data, value >> 16U );
+	tst_put_16( &p_data[2], value );
+}
+
+/* Master timestamp with noise */
+static long long tst_master_time( const long long time )
+{
+	if( 0 == sg_tst_net.jitter ){ return time; }
+	else{	/* Not required */	}
+
+	sg_tst_net.seed = ( sg_tst_net.seed * 1103515245UL ) + 12345UL;
+	return time + ( (long long)( (sg_tst_net.seed >> 8U) % (unsigned long)( (2 * sg_tst_net.jitter) + 1 ) ) -
+					sg_tst_net.jitter );
+}
+
+/* PTP message from master in UDP datagram to primary group */
+static std::vector<unsigned char> tst_message( const unsigned short port, const unsigned char type,
+												const unsigned short size, const unsigned short sequence,
+												const long long timestamp )
+{
+	std::vector<unsigned char> frame_l( UDP_HEADERS_SIZE + size, 0U );
+	unsigned char * const p_ptp = &frame_l[UDP_HEADERS_SIZE];
+
+	/* Ethernet, IPv4 and UDP, checksums by peer stack */
+	frame_l[0] = 0x01U;
+	frame_l[2] = 0x5EU;
+	frame_l[4] = 0x01U;
+	frame_l[5] = 0x81U;
+	memcpy( &frame_l[6], sg_tst_master_mac, 6U );
+	tst_put_16( &frame_l[12], 0x0800U );
+	frame_l[14] = 0x45U;
+	tst_put_16( &frame_l[16], 28U + size );
+	frame_l[22] = 1U;
+	frame_l[23] = 17U;
+	tst_put_32( &frame_l[26], TST_MASTER_IP );
+	tst_put_32( &frame_l[30], PTP_MULTICAST_IP );
+	tst_put_16( &frame_l[34], port );
+	tst_put_16( &frame_l[36], port );
+	tst_put_16( &frame_l[38], 8U + size );
+
+	/* Common header and timestamp */
+	p_ptp[0] = type;
+	p_ptp[1] = 2U;
+	tst_put_16( &p_ptp[2], size );
+	p_ptp[4] = PTP_DOMAIN;
+	memcpy( &p_ptp[20], sg_tst_master_port, PTP_PORT_IDENTITY_SIZE );
+	tst_put_16( &p_ptp[30], sequence );
+	tst_put_16( &p_ptp[34], (unsigned long long)timestamp / TST_NS_PER_SECOND >> 32U );
+	tst_put_32( &p_ptp[36], (unsigned long long)timestamp / TST_NS_PER_SECOND );
+	tst_put_32( &p_ptp[40], (unsigned long long)timestamp % TST_NS_PER_SECOND );
+
+	tst_checksum_insert( frame_l.data(), static_cast<unsigned short>( frame_l.size() ) );
+	return frame_l;
+}
+
+/* Frame reaches slave after path delay */
+static void tst_deliver( const std::vector<unsigned char>& frame )
+{
+	(void) tst_dma_input( frame.data(), static_cast<unsigned short>( frame.size() ) );
+	UDP__::run();
+	tst_dma_run();
+	PTP__::run();
+}
+
+/* Let true time pass at slave, SysTick included */
+static void tst_pass( const long long nanoseconds )
+{
+	const long long step_l = TST_SYNC_INTERVAL / TST_TICKS_PER_SYNC;
+	long long left_l = nanoseconds;
+
+	while( left_l > 0 )
+	{
+		const long long now_l = ( left_l < step_l ) ? left_l : step_l;
+
+		tst_clock_advance( static_cast<unsigned long long>( now_l ) );
+		sg_tst_net.time += now_l;
+		left_l -= now_l;
+		if( now_l == step_l )
+		{
+			PTP__::tick( 1U );
+		}
+		else{	/* Not required */	}
+	}
+}
+
+/* One Sync interval: Sync, Follow_Up and answer to a Delay_Req */
+static void tst_sync_interval( void )
+{
+	const long long origin_l = tst_master_time( sg_tst_net.time );
+	const unsigned short sequence_l = ++sg_tst_net.sequence;
+	std::vector<unsigned char> sync_l = tst_message( PTP_EVENT_PORT, 0x0U, 44U, sequence_l,
+													sg_tst_net.one_step ? origin_l : 0 );
+
+	sg_tst_net.requests.clear();
+	if( !sg_tst_net.one_step )
+	{
+		/* Two step flag */
+		sync_l[UDP_HEADERS_SIZE + 6U] = 0x02U;
+		tst_checksum_insert( sync_l.data(), static_cast<unsigned short>( sync_l.size() ) );
+	}
+	else{	/* Not required */	}
+
+	tst_pass( TST_PATH_DELAY );
+	tst_deliver( sync_l );
+	if( !sg_tst_net.one_step )
+	{
+		tst_deliver( tst_message( PTP_GENERAL_PORT, 0x8U, 44U, sequence_l, origin_l ) );
+	}
+	else{	/* Not required */	}
+
+	/* Delay_Req went out at once, answer after path delay */
+	if( !sg_tst_net.requests.empty() )
+	{
+		const std::vector<unsigned char> request_l = sg_tst_net.requests.back();
+		const unsigned char * const p_request = &request_l[UDP_HEADERS_SIZE];
+		std::vector<unsigned char> response_l;
+
+		tst_pass( TST_PATH_DELAY );
+		response_l = tst_message( PTP_GENERAL_PORT, 0x9U, 54U,
+									static_cast<unsigned short>( (p_request[30] << 8U) | p_request[31] ),
+									tst_master_time( sg_tst_net.time ) );
+		memcpy( &response_l[UDP_HEADERS_SIZE + 44U], &p_request[20], PTP_PORT_IDENTITY_SIZE );
+		tst_checksum_insert( response_l.data(), static_cast<unsigned short>( response_l.size() ) );
+		tst_pass( TST_PATH_DELAY );
+		tst_deliver( response_l );
+		tst_pass( TST_SYNC_INTERVAL - (3 * TST_PATH_DELAY) );
+	}
+	else
+	{
+		tst_pass( TST_SYNC_INTERVAL - TST_PATH_DELAY );
+	}
+}
+
+/* Slave time minus true time, ns */
+static long long tst_error( void )
+{
+	return ( (long long)PTP__::now_ns() ) - sg_tst_net.time;
+}
+
+/* Fresh stack, slave clock off master by offset and drift */
+static void tst_open( const long long offset, const long drift_ppb )
+{
+	tst_dma_open();
+	(void) UDP__::init( eUDP_Init_::UDP_INIT_CLOSE );
+	(void) UDP__::init();
+	(void) PTP__::init( ePTP_Init_::PTP_INIT_CLOSE );
+	(void) PTP__::init();
+
+	sg_tst_net = tStTst_Net();
+	sg_tst_net.time = 1000LL * TST_NS_PER_SECOND;
+	g_tst_dma.fp_wire = tst_wire;
+	g_tst_dma.frame_ns = 0U;
+	g_tst_dma.drift_ppb = drift_ppb;
+	g_tst_dma.seconds = (unsigned long)( ( sg_tst_net.time + offset ) / TST_NS_PER_SECOND );
+	g_tst_dma.nanoseconds = (unsigned long)( ( sg_tst_net.time + offset ) % TST_NS_PER_SECOND );
+	tst_clock_advance( 0U );
+}
+
+/* Runs Sync intervals, returns intervals until state is slave or 0 */
+static unsigned long tst_run_until_locked( const unsigned long intervals )
+{
+	for( unsigned long index_l = 1U; index_l <= intervals; ++index_l )
+	{
+		tst_sync_interval();
+		if( ePTP_State_::PTP_STATE_SLAVE == PTP__::get_state() ){ return index_l; }
+		else{	/* Not required */	}
+	}
+
+	return 0U;
+}
+
+/* Peak error over intervals, sampled right before next Sync */
+static long long tst_peak_error( const unsigned long intervals )
+{
+	long long peak_l = 0;
+
+	for( unsigned long index_l = 0U; index_l < intervals; ++index_l )
+	{
+		tst_sync_interval();
+		const long long error_l = tst_error();
+		peak_l = ( error_l > peak_l ) ? error_l : ( ( -error_l > peak_l ) ? -error_l : peak_l );
+	}
+
+	return peak_l;
+}
+
+/******* Tests *******/
+
+/* Time is stepped once, then rate pulls in to oscillator error */
+static void test_pull_in( void )
+{
+	unsigned long locked_l = 0U;
+	long long peak_l = 0;
+
+	tst_open( 300LL * 1000000LL, 50000L );
+	tst_sync_interval();
+	TST_CHECK( ePTP_State_::PTP_STATE_UNCALIBRATED == PTP__::get_state() );
+	/* Step leaves error of one interval of drift */
+	TST_CHECK( tst_error() < 60000 );
+	TST_CHECK( tst_error() > -60000 );
+
+	locked_l = tst_run_until_locked( 60U );
+	TST_CHECK( 0U != locked_l );
+	TST_CHECK( tst_peak_error( TST_SETTLE_INTERVALS ) < PTP_LOCK_THRESHOLD );
+	peak_l = tst_peak_error( 60U );
+	TST_CHECK( ePTP_State_::PTP_STATE_SLAVE == PTP__::get_state() );
+	TST_CHECK( peak_l < 100 );
+	TST_CHECK( PTP__::get_path_delay() >= (TST_PATH_DELAY - 40) );
+	TST_CHECK( PTP__::get_path_delay() <= (TST_PATH_DELAY + 40) );
+	TST_CHECK( PTP__::get_rate() >= (-50000L - 100L) );
+	TST_CHECK( PTP__::get_rate() <= (-50000L + 100L) );
+
+	printf( "    50 ppm, 300 ms off: locked after %lu s, settled peak error %lld ns, rate %ld ppb, delay %lld ns\n",
+			locked_l + 1U, peak_l, PTP__::get_rate(), PTP__::get_path_delay() );
+}
+
+/* Offset below step threshold is steered out without step */
+static void test_steer( void )
+{
+	long long previous_l = 0;
+	unsigned long locked_l = 0U;
+
+	tst_open( -80000LL, -20000L );
+	tst_sync_interval();
+	previous_l = tst_error();
+	TST_CHECK( previous_l < -10000 );
+	locked_l = tst_run_until_locked( 60U );
+	TST_CHECK( 0U != locked_l );
+	(void) tst_peak_error( TST_SETTLE_INTERVALS );
+	TST_CHECK( tst_peak_error( 30U ) < 100 );
+	TST_CHECK( PTP__::get_rate() >= (20000L - 100L) );
+	TST_CHECK( PTP__::get_rate() <= (20000L + 100L) );
+
+	printf( "    -20 ppm, 80 us behind: locked after %lu s without step\n", locked_l + 1U );
+}
+
+/* Lock holds against timestamp noise of master */
+static void test_jitter( void )
+{
+	long long peak_l = 0;
+
+	tst_open( 0, 10000L );
+	sg_tst_net.jitter = 200;
+	TST_CHECK( 0U != tst_run_until_locked( 60U ) );
+	(void) tst_peak_error( TST_SETTLE_INTERVALS );
+	peak_l = tst_peak_error( 120U );
+	TST_CHECK( peak_l < PTP_LOCK_THRESHOLD );
+
+	printf( "    200 ns master noise: peak error %lld ns\n", peak_l );
+}
+
+/* One step Sync carries origin time itself */
+static void test_one_step( void )
+{
+	tst_open( 2LL * TST_NS_PER_SECOND, 30000L );
+	sg_tst_net.one_step = true;
+	TST_CHECK( 0U != tst_run_until_locked( 60U ) );
+	(void) tst_peak_error( TST_SETTLE_INTERVALS );
+	TST_CHECK( tst_peak_error( 30U ) < 100 );
+}
+
+/* Silent master is given up, rate is kept and lock comes back without pull in */
+static void test_master_lost( void )
+{
+	long rate_l = 0;
+	unsigned long locked_l = 0U;
+
+	tst_open( 0, 40000L );
+	TST_CHECK( 0U != tst_run_until_locked( 60U ) );
+	(void) tst_peak_error( TST_SETTLE_INTERVALS );
+	rate_l = PTP__::get_rate();
+
+	tst_pass( (long long)PTP_MASTER_TIMEOUT * (TST_SYNC_INTERVAL / TST_TICKS_PER_SYNC) );
+	PTP__::run();
+	TST_CHECK( ePTP_State_::PTP_STATE_LISTENING == PTP__::get_state() );
+	TST_CHECK_EQ( rate_l, PTP__::get_rate() );
+	/* Holdover on kept rate */
+	TST_CHECK( tst_error() < 1000 );
+	TST_CHECK( tst_error() > -1000 );
+
+	locked_l = tst_run_until_locked( 60U );
+	TST_CHECK( 0U != locked_l );
+	TST_CHECK( locked_l <= 3U );
+}
+
+int main( void )
+{
+	tst_map_peripherals();
+
+	TST_RUN( test_pull_in );
+	TST_RUN( test_steer );
+	TST_RUN( test_jitter );
+	TST_RUN( test_one_step );
+	TST_RUN( test_master_lost );
+
+	return tst_result();
+}
+
+/*********************************** End of File ******************************/
@@ -0,0 +1,529 @@
+/******************************************************************************
+* Copyright (c) 2019 - Hemant Sharma - All Rights Reserved
+*
+* Feel free to use this Code at your own risk for your own purposes.
+*
+*******************************************************************************/
+/******************************************************************************
+* Title:		UDP/IPv4 Host Test
+* Filename:		tst_udp.cpp
+* Author:		HS
+* Origin Date:	10/19/2026
+* Version:		1.0.0
+* Notes:
+*
+* Change History
+* --------------
+*
+*******************************************************************************/
+
+/** @file:	tst_udp.cpp
+ *  @brief:	This source file contains tests of UDP__ on ETH__ and the MAC DMA
+ *  		model of tst_eth_model.cpp. Frames sent by the device are taken
+ *  		off the wire model and written to build/tst_udp.pcap, frames of
+ *  		peers are built here with checksums and fed to receive ring.
+ *  		Peer traffic is replayed from a pcap file as well, the capture
+ *  		named on command line is replayed after tests.
+ */
+
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <tst_harness.h>
+#include <tst_periph.h>
+#include <tst_eth_model.h>
+#include <tst_pcap.h>
+#include <mid_udp.h>
+#include <mid_ptp.h>
+#include <string.h>
+#include <vector>
+
+
+/******************************************************************************
+* Preprocessor Constants
+*******************************************************************************/
+
+/* Peer in subnet, entry 1 of ARP cache */
+#define TST_PEER_IP				UDP_IPV4( 192U, 168U, 0U, 2U )
+#define TST_PEER_PORT			6000U
+
+/* Port of udp_rx_handler() in port table */
+#define TST_LOCAL_PORT			5000U
+
+#define TST_PCAP_WIRE			"build/tst_udp.pcap"
+#define TST_PCAP_PEER			"build/tst_udp_peer.pcap"
+
+
+/******************************************************************************
+* Typedefs
+*******************************************************************************/
+
+/*
+ * @brief	Datagram seen by a port handler
+ */
+typedef struct tStTst_Datagram_
+{
+	tStUDP_Endpoint source;
+	const unsigned char * p_data;			/**< Payload in receive buffer */
+	std::vector<unsigned char> payload;
+	bool timed;								/**< UDP__::get_rx_time() result */
+	tStETH_Time time;
+} tStTst_Datagram;
+
+
+/******************************************************************************
+* Variables
+*******************************************************************************/
+
+static const unsigned char sg_tst_peer_mac[6] = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x02U };
+static const unsigned char sg_tst_router_mac[6] = { 0x02U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U };
+
+static std::vector<std::vector<unsigned char>> sg_tst_wire;
+static std::vector<tStTst_Datagram> sg_tst_datagrams;
+static unsigned long sg_tst_ptp_event = 0U;
+static unsigned long sg_tst_ptp_general = 0U;
+static FILE * sg_tst_capture = nullptr;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+
+/******* Handlers *******/
+
+void eth_callback_handler( const eETH_Event_ event )
+{
+	(void) event;
+}
+
+void udp_rx_handler( const tStUDP_Endpoint& source, const unsigned char * p_data, const unsigned short length )
+{
+	tStTst_Datagram datagram_l;
+
+	datagram_l.source = source;
+	datagram_l.p_data = p_data;
+	datagram_l.payload.assign( p_data, p_data + length );
+	datagram_l.timed = UDP__::get_rx_time( datagram_l.time );
+	sg_tst_datagrams.push_back( datagram_l );
+}
+
+void PTP__::event_input( const tStUDP_Endpoint& source, const unsigned char * p_data, const unsigned short length )
+{
+	(void) source; (void) p_data; (void) length;
+	++sg_tst_ptp_event;
+}
+
+void PTP__::general_input( const tStUDP_Endpoint& source, const unsigned char * p_data, const unsigned short length )
+{
+	(void) source; (void) p_data; (void) length;
+	++sg_tst_ptp_general;
+}
+
+/******* Wire *******/
+
+/* Frames sent by device */
+static void tst_wire( const unsigned char * p_data, const unsigned short length )
+{
+	sg_tst_wire.emplace_back( p_data, p_data + length );
+	tst_pcap_write( sg_tst_capture, p_data, length, g_tst_dma.seconds, g_tst_dma.nanoseconds );
+}
+
+/* Fresh layers, device frames go to tst_wire() */
+static void tst_open( void )
+{
+	tst_dma_open();
+	(void) UDP__::init( eUDP_Init_::UDP_INIT_CLOSE );
+	TST_CHECK( eUDP_Status_::UDP_STATUS_SUCCESS == UDP__::init() );
+	g_tst_dma.fp_wire = tst_wire;
+	sg_tst_wire.clear();
+	sg_tst_datagrams.clear();
+	sg_tst_ptp_event = 0U;
+	sg_tst_ptp_general = 0U;
+}
+
+/* Frame from peer on wire, served by UDP__ */
+static void tst_deliver( const std::vector<unsigned char>& frame )
+{
+	TST_CHECK( tst_dma_input( frame.data(), static_cast<unsigned short>( frame.size() ) ) );
+	tst_pcap_write( sg_tst_capture, frame.data(), static_cast<unsigned short>( frame.size() ),
+					g_tst_dma.seconds, g_tst_dma.nanoseconds );
+	UDP__::run();
+}
+
+/******* Frames of peers *******/
+
+static unsigned short tst_get_16( const unsigned char * p_data )
+{
+	return static_cast<unsigned short>( (p_data[0] << 8U) | p_data[1] );
+}
+
+static unsigned long tst_get_32( const unsigned char * p_data )
+{
+	return ( (unsigned long)tst_get_16( p_data ) << 16U ) | tst_get_16( &p_data[2] );
+}
+
+static void tst_put_16( unsigned char * p_data, const unsigned long value )
+{
+	p_data[0] = static_cast<unsigned char>( value >> 8U );
+	p_data[1] = static_cast<unsigned char>( value );
+}
+
+static void tst_put_32( unsigned char * p_data, const unsigned long value )
+{
+	tst_put_16( p_data, value >> 16U );
+	tst_put_16( &p_data[2], value );
+}
+
+/* Datagram from peer with checksums of peer stack */
+static std::vector<unsigned char> tst_peer_datagram( const unsigned long destination, const unsigned short port,
+														const char * p_payload, const unsigned short fragment = 0U )
+{
+	const unsigned short length_l = static_cast<unsigned short>( strlen( p_payload ) );
+	std::vector<unsigned char> frame_l( UDP_HEADERS_SIZE + length_l, 0U );
+
+	memcpy( &frame_l[0], ETH__::get_address(), 6U );
+	memcpy( &frame_l[6], sg_tst_peer_mac, 6U );
+	tst_put_16( &frame_l[12], 0x0800U );
+	frame_l[14] = 0x45U;
+	tst_put_16( &frame_l[16], 28U + length_l );
+	tst_put_16( &frame_l[20], fragment );
+	frame_l[22] = 64U;
+	frame_l[23] = 17U;
+	tst_put_32( &frame_l[26], TST_PEER_IP );
+	tst_put_32( &frame_l[30], destination );
+	tst_put_16( &frame_l[34], TST_PEER_PORT );
+	tst_put_16( &frame_l[36], port );
+	tst_put_16( &frame_l[38], 8U + length_l );
+	memcpy( &frame_l[UDP_HEADERS_SIZE], p_payload, length_l );
+	tst_checksum_insert( frame_l.data(), static_cast<unsigned short>( frame_l.size() ) );
+
+	return frame_l;
+}
+
+/* ARP request of peer */
+static std::vector<unsigned char> tst_peer_arp( const unsigned long target )
+{
+	std::vector<unsigned char> frame_l( 42U, 0U );
+
+	memset( &frame_l[0], 0xFF, 6U );
+	memcpy( &frame_l[6], sg_tst_peer_mac, 6U );
+	tst_put_16( &frame_l[12], 0x0806U );
+	tst_put_16( &frame_l[14], 1U );
+	tst_put_16( &frame_l[16], 0x0800U );
+	frame_l[18] = 6U;
+	frame_l[19] = 4U;
+	tst_put_16( &frame_l[20], 1U );
+	memcpy( &frame_l[22], sg_tst_peer_mac, 6U );
+	tst_put_32( &frame_l[28], TST_PEER_IP );
+	tst_put_32( &frame_l[38], target );
+
+	return frame_l;
+}
+
+/* Send text from port 5000, single frame expected on wire */
+static eUDP_Status_ tst_send( const unsigned long ip, const char * p_text )
+{
+	tStUDP_Endpoint destination_l;
+	unsigned char * const p_payload = UDP__::claim();
+	eUDP_Status_ status_l = eUDP_Status_::UDP_STATUS_BUSY;
+
+	if( nullptr == p_payload ){ return status_l; }
+	else{	/* Not required */	}
+
+	destination_l.ip = ip;
+	destination_l.port = TST_PEER_PORT;
+	memcpy( p_payload, p_text, strlen( p_text ) );
+	status_l = UDP__::send( destination_l, TST_LOCAL_PORT, static_cast<unsigned short>( strlen( p_text ) ) );
+	tst_dma_run();
+
+	return status_l;
+}
+
+/******* Tests *******/
+
+/* Datagram is built in place behind headers and leaves with MAC checksums */
+static void test_send( void )
+{
+	unsigned char * p_payload = nullptr;
+	unsigned long buffer_l = 0U;
+
+	tst_open();
+	buffer_l = g_tst_dma.p_mac->tx_desc[0].buffer1;
+	p_payload = UDP__::claim();
+	TST_CHECK_EQ( buffer_l + UDP_HEADERS_SIZE, reinterpret_cast<unsigned long>( p_payload ) );
+
+	TST_CHECK( eUDP_Status_::UDP_STATUS_SUCCESS == tst_send( TST_PEER_IP, "hello" ) );
+	TST_CHECK_EQ( 1U, sg_tst_wire.size() );
+	if( 1U != sg_tst_wire.size() ){ return; }
+	else{	/* Not required */	}
+
+	const std::vector<unsigned char>& frame_l = sg_tst_wire[0];
+	TST_CHECK_EQ( UDP_HEADERS_SIZE + 5U, frame_l.size() );
+	TST_CHECK_EQ( 0, memcmp( &frame_l[0], sg_tst_peer_mac, 6U ) );
+	TST_CHECK_EQ( 0, memcmp( &frame_l[6], ETH__::get_address(), 6U ) );
+	TST_CHECK_EQ( 0x0800U, tst_get_16( &frame_l[12] ) );
+	TST_CHECK_EQ( 0x45U, frame_l[14] );
+	TST_CHECK_EQ( 33U, tst_get_16( &frame_l[16] ) );
+	TST_CHECK_EQ( 0x4000U, tst_get_16( &frame_l[20] ) );
+	TST_CHECK_EQ( 64U, frame_l[22] );
+	TST_CHECK_EQ( 17U, frame_l[23] );
+	TST_CHECK_EQ( UDP_LOCAL_IP, tst_get_32( &frame_l[26] ) );
+	TST_CHECK_EQ( TST_PEER_IP, tst_get_32( &frame_l[30] ) );
+	TST_CHECK_EQ( TST_LOCAL_PORT, tst_get_16( &frame_l[34] ) );
+	TST_CHECK_EQ( TST_PEER_PORT, tst_get_16( &frame_l[36] ) );
+	TST_CHECK_EQ( 13U, tst_get_16( &frame_l[38] ) );
+	TST_CHECK_EQ( 0, memcmp( &frame_l[UDP_HEADERS_SIZE], "hello", 5U ) );
+	TST_CHECK_EQ( TST_RDES4_IPV4 | TST_RDES4_UDP,
+					tst_checksum_check( frame_l.data(), static_cast<unsigned short>( frame_l.size() ) ) );
+	TST_CHECK_EQ( 1U, UDP__::get_counters().tx_datagrams );
+
+	/* Identification counts datagrams */
+	TST_CHECK( eUDP_Status_::UDP_STATUS_SUCCESS == tst_send( TST_PEER_IP, "x" ) );
+	TST_CHECK_EQ( tst_get_16( &sg_tst_wire[0][18] ) + 1U, tst_get_16( &sg_tst_wire[1][18] ) );
+}
+
+/* Remote subnets go to router, unknown hosts in subnet are not sent */
+static void test_send_routes( void )
+{
+	tst_open();
+	TST_CHECK( eUDP_Status_::UDP_STATUS_SUCCESS == tst_send( UDP_IPV4( 8U, 8U, 8U, 8U ), "r" ) );
+	TST_CHECK_EQ( 1U, sg_tst_wire.size() );
+	TST_CHECK_EQ( 0, memcmp( &sg_tst_wire[0][0], sg_tst_router_mac, 6U ) );
+	TST_CHECK_EQ( UDP_IPV4( 8U, 8U, 8U, 8U ), tst_get_32( &sg_tst_wire[0][30] ) );
+
+	TST_CHECK( eUDP_Status_::UDP_STATUS_UNREACHABLE == tst_send( UDP_IPV4( 192U, 168U, 0U, 77U ), "u" ) );
+	TST_CHECK_EQ( 1U, sg_tst_wire.size() );
+	TST_CHECK_EQ( 1U, UDP__::get_counters().tx_unresolved );
+	TST_CHECK_EQ( 1U, UDP__::get_counters().tx_datagrams );
+}
+
+/* Broadcast and multicast need no ARP cache entry */
+static void test_send_group( void )
+{
+	static const unsigned char broadcast_l[6] = { 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU };
+	static const unsigned char multicast_l[6] = { 0x01U, 0x00U, 0x5EU, 0x00U, 0x01U, 0x81U };
+
+	tst_open();
+	TST_CHECK( eUDP_Status_::UDP_STATUS_SUCCESS == tst_send( UDP_BROADCAST_IP, "b" ) );
+	TST_CHECK( eUDP_Status_::UDP_STATUS_SUCCESS == tst_send( UDP_IPV4( 192U, 168U, 0U, 255U ), "s" ) );
+	/* PTP primary group */
+	TST_CHECK( eUDP_Status_::UDP_STATUS_SUCCESS == tst_send( UDP_IPV4( 224U, 0U, 1U, 129U ), "m" ) );
+	TST_CHECK_EQ( 3U, sg_tst_wire.size() );
+	if( 3U != sg_tst_wire.size() ){ return; }
+	else{	/* Not required */	}
+
+	TST_CHECK_EQ( 0, memcmp( &sg_tst_wire[0][0], broadcast_l, 6U ) );
+	TST_CHECK_EQ( 0, memcmp( &sg_tst_wire[1][0], broadcast_l, 6U ) );
+	TST_CHECK_EQ( 0, memcmp( &sg_tst_wire[2][0], multicast_l, 6U ) );
+}
+
+/* Request for local address is answered from next transmit descriptor */
+static void test_arp( void )
+{
+	tst_open();
+	tst_deliver( tst_peer_arp( UDP_LOCAL_IP ) );
+	tst_dma_run();
+	TST_CHECK_EQ( 1U, sg_tst_wire.size() );
+	TST_CHECK_EQ( 1U, UDP__::get_counters().arp_replies );
+	if( 1U != sg_tst_wire.size() ){ return; }
+	else{	/* Not required */	}
+
+	const std::vector<unsigned char>& reply_l = sg_tst_wire[0];
+	TST_CHECK_EQ( 42U, reply_l.size() );
+	TST_CHECK_EQ( 0, memcmp( &reply_l[0], sg_tst_peer_mac, 6U ) );
+	TST_CHECK_EQ( 0x0806U, tst_get_16( &reply_l[12] ) );
+	TST_CHECK_EQ( 2U, tst_get_16( &reply_l[20] ) );
+	TST_CHECK_EQ( 0, memcmp( &reply_l[22], ETH__::get_address(), 6U ) );
+	TST_CHECK_EQ( UDP_LOCAL_IP, tst_get_32( &reply_l[28] ) );
+	TST_CHECK_EQ( 0, memcmp( &reply_l[32], sg_tst_peer_mac, 6U ) );
+	TST_CHECK_EQ( TST_PEER_IP, tst_get_32( &reply_l[38] ) );
+
+	/* Requests for other hosts are dropped */
+	tst_deliver( tst_peer_arp( UDP_IPV4( 192U, 168U, 0U, 11U ) ) );
+	tst_dma_run();
+	TST_CHECK_EQ( 1U, sg_tst_wire.size() );
+	TST_CHECK_EQ( 1U, UDP__::get_counters().rx_dropped );
+}
+
+/* Handler reads payload in place in receive buffer, with receive time */
+static void test_receive( void )
+{
+	tst_open();
+	g_tst_dma.seconds = 77U;
+	tst_deliver( tst_peer_datagram( UDP_LOCAL_IP, TST_LOCAL_PORT, "ping" ) );
+	TST_CHECK_EQ( 1U, sg_tst_datagrams.size() );
+	if( 1U != sg_tst_datagrams.size() ){ return; }
+	else{	/* Not required */	}
+
+	const tStTst_Datagram& datagram_l = sg_tst_datagrams[0];
+	TST_CHECK_EQ( TST_PEER_IP, datagram_l.source.ip );
+	TST_CHECK_EQ( TST_PEER_PORT, datagram_l.source.port );
+	TST_CHECK_EQ( 4U, datagram_l.payload.size() );
+	TST_CHECK_EQ( 0, memcmp( datagram_l.payload.data(), "ping", 4U ) );
+	TST_CHECK_EQ( g_tst_dma.rx_buffers.back() + UDP_HEADERS_SIZE, reinterpret_cast<unsigned long>( datagram_l.p_data ) );
+	TST_CHECK( datagram_l.timed );
+	TST_CHECK_EQ( 77U, datagram_l.time.seconds );
+	TST_CHECK_EQ( 1U, UDP__::get_counters().rx_datagrams );
+
+	/* Subnet broadcast and PTP ports */
+	tst_deliver( tst_peer_datagram( UDP_IPV4( 192U, 168U, 0U, 255U ), TST_LOCAL_PORT, "all" ) );
+	tst_deliver( tst_peer_datagram( UDP_IPV4( 224U, 0U, 1U, 129U ), PTP_EVENT_PORT, "sync" ) );
+	tst_deliver( tst_peer_datagram( UDP_IPV4( 224U, 0U, 1U, 129U ), PTP_GENERAL_PORT, "follow" ) );
+	TST_CHECK_EQ( 2U, sg_tst_datagrams.size() );
+	TST_CHECK_EQ( 1U, sg_tst_ptp_event );
+	TST_CHECK_EQ( 1U, sg_tst_ptp_general );
+	TST_CHECK_EQ( 0U, UDP__::get_counters().rx_dropped );
+}
+
+/* Frames failing checks never reach a handler */
+static void test_receive_drops( void )
+{
+	std::vector<unsigned char> frame_l;
+
+	tst_open();
+	frame_l = tst_peer_datagram( UDP_LOCAL_IP, TST_LOCAL_PORT, "bad sum" );
+	frame_l.back() ^= 0x01U;
+	tst_deliver( frame_l );
+	tst_deliver( tst_peer_datagram( UDP_LOCAL_IP, TST_LOCAL_PORT, "fragment", 0x2000U ) );
+	tst_deliver( tst_peer_datagram( UDP_IPV4( 192U, 168U, 0U, 99U ), TST_LOCAL_PORT, "other" ) );
+	tst_deliver( tst_peer_datagram( UDP_LOCAL_IP, 5555U, "closed" ) );
+
+	/* IP header damaged */
+	frame_l = tst_peer_datagram( UDP_LOCAL_IP, TST_LOCAL_PORT, "header" );
+	frame_l[22] = 1U;
+	tst_deliver( frame_l );
+
+	TST_CHECK_EQ( 0U, sg_tst_datagrams.size() );
+	TST_CHECK_EQ( 0U, UDP__::get_counters().rx_datagrams );
+	TST_CHECK_EQ( 5U, UDP__::get_counters().rx_dropped );
+	TST_CHECK_EQ( 0U, ETH__::get_counters().rx_errors );
+}
+
+/* Broadcast of device comes back through MAC loopback to its own port */
+static void test_loopback( void )
+{
+	tst_open();
+	g_tst_dma.fp_wire = nullptr;
+	TST_CHECK( eUDP_Status_::UDP_STATUS_SUCCESS == tst_send( UDP_BROADCAST_IP, "echo" ) );
+	UDP__::run();
+	TST_CHECK_EQ( 0U, sg_tst_datagrams.size() );
+
+	/* Sent to peer port, resend to local port */
+	tStUDP_Endpoint destination_l;
+	unsigned char * const p_payload = UDP__::claim();
+	TST_CHECK( nullptr != p_payload );
+	if( nullptr == p_payload ){ return; }
+	else{	/* Not required */	}
+
+	destination_l.ip = UDP_BROADCAST_IP;
+	destination_l.port = TST_LOCAL_PORT;
+	memcpy( p_payload, "echo", 4U );
+	TST_CHECK( eUDP_Status_::UDP_STATUS_SUCCESS == UDP__::send( destination_l, TST_LOCAL_PORT, 4U ) );
+	tst_dma_run();
+	UDP__::run();
+	TST_CHECK_EQ( 1U, sg_tst_datagrams.size() );
+	if( 1U != sg_tst_datagrams.size() ){ return; }
+	else{	/* Not required */	}
+
+	TST_CHECK_EQ( UDP_LOCAL_IP, sg_tst_datagrams[0].source.ip );
+	TST_CHECK_EQ( TST_LOCAL_PORT, sg_tst_datagrams[0].source.port );
+	TST_CHECK_EQ( 0, memcmp( sg_tst_datagrams[0].payload.data(), "echo", 4U ) );
+	TST_CHECK_EQ( 1U, UDP__::get_counters().rx_dropped );
+}
+
+/* Replay peer traffic from capture file */
+static unsigned long tst_replay( const char * p_path )
+{
+	unsigned char buffer_l[XMC_ETH_MAC_BUF_SIZE];
+	unsigned short length_l = 0U;
+	unsigned long frames_l = 0U;
+	bool swapped_l = false;
+	FILE * const p_file = tst_pcap_open( p_path, swapped_l );
+
+	if( nullptr == p_file ){ return 0U; }
+	else{	/* Not required */	}
+
+	while( tst_pcap_read( p_file, swapped_l, buffer_l, sizeof(buffer_l), length_l ) )
+	{
+		++frames_l;
+		(void) tst_dma_input( buffer_l, length_l );
+		UDP__::run();
+		tst_dma_run();
+	}
+	fclose( p_file );
+
+	return frames_l;
+}
+
+/* Peer traffic written to pcap and replayed gives same results as live */
+static void test_pcap_replay( void )
+{
+	std::vector<unsigned char> bad_l = tst_peer_datagram( UDP_LOCAL_IP, TST_LOCAL_PORT, "bad" );
+	FILE * p_file = tst_pcap_create( TST_PCAP_PEER );
+
+	TST_CHECK( nullptr != p_file );
+	if( nullptr == p_file ){ return; }
+	else{	/* Not required */	}
+
+	bad_l[UDP_HEADERS_SIZE] ^= 0x20U;
+	const std::vector<std::vector<unsigned char>> peer_l =
+	{
+		tst_peer_arp( UDP_LOCAL_IP ),
+		tst_peer_datagram( UDP_LOCAL_IP, TST_LOCAL_PORT, "one" ),
+		bad_l,
+		tst_peer_datagram( UDP_IPV4( 224U, 0U, 1U, 129U ), PTP_EVENT_PORT, "sync" ),
+		tst_peer_datagram( UDP_LOCAL_IP, TST_LOCAL_PORT, "two" )
+	};
+	for( const std::vector<unsigned char>& frame_l : peer_l )
+	{
+		tst_pcap_write( p_file, frame_l.data(), static_cast<unsigned short>( frame_l.size() ), 1U, 0U );
+	}
+	fclose( p_file );
+
+	tst_open();
+	TST_CHECK_EQ( peer_l.size(), tst_replay( TST_PCAP_PEER ) );
+	TST_CHECK_EQ( 2U, sg_tst_datagrams.size() );
+	TST_CHECK_EQ( 1U, sg_tst_ptp_event );
+	TST_CHECK_EQ( 1U, UDP__::get_counters().arp_replies );
+	TST_CHECK_EQ( 1U, UDP__::get_counters().rx_dropped );
+	TST_CHECK_EQ( 1U, sg_tst_wire.size() );
+	if( 2U != sg_tst_datagrams.size() ){ return; }
+	else{	/* Not required */	}
+
+	TST_CHECK_EQ( 0, memcmp( sg_tst_datagrams[0].payload.data(), "one", 3U ) );
+	TST_CHECK_EQ( 0, memcmp( sg_tst_datagrams[1].payload.data(), "two", 3U ) );
+}
+
+int main( int argc, char * argv[] )
+{
+	tst_map_peripherals();
+	sg_tst_capture = tst_pcap_create( TST_PCAP_WIRE );
+
+	TST_RUN( test_send );
+	TST_RUN( test_send_routes );
+	TST_RUN( test_send_group );
+	TST_RUN( test_arp );
+	TST_RUN( test_receive );
+	TST_RUN( test_receive_drops );
+	TST_RUN( test_loopback );
+	TST_RUN( test_pcap_replay );
+
+	/* Field capture, counters only */
+	if( argc > 1 )
+	{
+		tst_open();
+		printf( "replayed %lu frames of %s\n", tst_replay( argv[1] ), argv[1] );
+		printf( "    rx %lu dropped %lu arp %lu, device sent %lu frames\n",
+				UDP__::get_counters().rx_datagrams, UDP__::get_counters().rx_dropped,
+				UDP__::get_counters().arp_replies, (unsigned long)sg_tst_wire.size() );
+	}
+	else{	/* Not required */	}
+
+	if( nullptr != sg_tst_capture ){ fclose( sg_tst_capture ); }
+	else{	/* Not required */	}
+
+	return tst_result();
+}
+
+/*********************************** End of File ******************************/
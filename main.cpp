@@ -28,19 +28,53 @@
 *******************************************************************************/
 
 /* Include peripheral device files */
+#include <string.h>
 #include <dri_gpio.h>
+#include <dri_gpio_event.h>
+#include <dri_gpio_debounce.h>
+#include <dri_gpio_wave.h>
 #include <dri_uart_extern.h>
+#include <dri_spi_extern.h>
+#include <dri_i2c_extern.h>
+#include <dri_can_extern.h>
+#include <mid_gateway.h>
+#include <mid_isotp.h>
+#include <dri_crc.h>
+#include <dri_eth.h>
+#include <mid_udp.h>
+#include <mid_ptp.h>
+#include <dri_adc.h>
+#include <dri_dsd.h>
+#include <mid_control.h>
+#include <dri_pwm.h>
+#include <dri_pwm_motor.h>
+#include <dri_posif.h>
+#include <dri_capture.h>
+#include <dri_dac.h>
+#include <dri_clock.h>
+#include <mid_dsp.h>
 
 
 /******************************************************************************
 * Variables
 *******************************************************************************/
 unsigned char uart_data[13] = {0};
+short dsd_samples[DSD_FIR_BLOCK_SIZE] = {0};
+/* One sine period for DAC stream, built at compile time into flash */
+static constexpr tStDAC_Table<64> dac_sine = DAC__::make_sine<64>();
+/* Core cycles of fft_q15() at 64, 256, 1024 points and fft_q31() at 256 points */
+unsigned long fft_cycles[4] = {0};
+/* Core cycles of PWM__::set_duties() for all channels and of PWM__::set_duty() */
+unsigned long pwm_cycles[2] = {0};
 
 
 /******************************************************************************
 * Function Declarations
 *******************************************************************************/
+static __RAM_FUNC void posif_sample_loop( void * p_context );
+static unsigned long idle_budget( void );
+static void fft_benchmark( void );
+static void pwm_profile( void );
 
 
 /* Extern "C" block for C variables
@@ -75,18 +109,80 @@ void init_user_before_main( void );
 int main(void)
 {
 	/* Local Variables */
+	tStControl_Loop encoder_loop;
+	eClock_Status_ clock_status;
+
+	/* Configure SysTick and cycle counter of system clock first, CAN and
+	 * gateway stamp frames with CLOCK__::now()
+	 * System core clock after PLL would be 120 MHz
+	 *
+	 * We need tick interrupt for every 120000 cycles i.e., 1ms
+	 *  */
+	clock_status = CLOCK__::init();
 
 	/******* Initialize Peripherals *******/
 	g_p_uart_obj[0]->init();
 	g_p_uart_obj[1]->init();
-	g_p_uart_obj[2]->init();
+	g_p_spi_obj[0]->init();
+	g_p_i2c_obj[0]->init();
+	GPIO_Event__::init();
+	/* CAN receive timestamps use CLOCK__ */
+	g_p_can_obj[0]->init();
+	g_p_can_obj[1]->init();
+	/* ISO-TP takes frames routed to gateway local port */
+	ISOTP__::init();
+	/* Gateway reads CAN queues and UART channel 2 from now on */
+	Gateway__::init();
+	GPIO_Debounce__::init();
+	GPIO_Wave__::init();
+	(void) CRC__::init();
+	(void) ETH__::init();
+	/* UDP takes frames of ETH__ in main loop */
+	UDP__::init();
+	/* PTP slave disciplines system time of ETH__ */
+	PTP__::init();
+	/* Sample blocks are handed to adc_callback_handler() */
+	if( eADC_Status_::ADC_STATUS_SUCCESS == ADC__::init() )
+	{
+		(void) ADC__::start();
+	}
+	else{	/* Not required */	}
+	/* Modulator results are decimated in dsd_callback_handler() */
+	if( eDSD_Status_::DSD_STATUS_SUCCESS == DSD__::init() )
+	{
+		(void) DSD__::start();
+	}
+	else{	/* Not required */	}
+	/* Timer loops are registered by CONTROL__::loop_open() */
+	(void) CONTROL__::init();
+	/* All PWM channels start together at 0 % */
+	(void) PWM__::init();
+	/* Motor bridge starts with low sides on, control runs in pwm_motor_callback_handler() */
+	(void) PWM_Motor__::init();
+	/* Encoder counts in hardware, control loop 0 publishes snapshots */
+	if( ePOSIF_Status_::POSIF_STATUS_SUCCESS == POSIF__::init() )
+	{
+		encoder_loop.fp_loop = posif_sample_loop;
+		encoder_loop.rate = 1000U;
+		encoder_loop.priority = 8U;
+		(void) CONTROL__::loop_open( 0U, encoder_loop );
+	}
+	else{	/* Not required */	}
+	/* Edges of P2.15 are stamped into ring, taken by CAPTURE__::read() or measure() */
+	if( eCapture_Status_::CAPTURE_STATUS_SUCCESS == CAPTURE__::init() )
+	{
+		(void) CAPTURE__::start();
+	}
+	else{	/* Not required */	}
+	/* 1 kHz sine from pattern generator and 1 kHz sine streamed from flash table */
+	if( eDAC_Status_::DAC_STATUS_SUCCESS == DAC__::init() )
+	{
+		(void) DAC__::pattern_start( eDAC_Pattern_::DAC_PATTERN_SINE, 1000U );
+		(void) DAC__::stream_start( dac_sine.value, 64U, 64000U );
+	}
+	else{	/* Not required */	}
 
-	/* Configure SysTick
-	 * System core clock after PLL would be 120 MHz
-	 *
-	 * We need tick interrupt for every 1000 ticks i.e., 1ms
-	 *  */
-	if( 1 == SysTick_Config(SystemCoreClock / 1000UL) )
+	if( eClock_Status_::CLOCK_STATUS_SUCCESS != clock_status )
 	{
 		for( ; ; )
 		{
@@ -95,6 +191,11 @@ int main(void)
 	}
 	else
 	{
+		/* Cycles per transform into fft_cycles, check in expressions */
+		fft_benchmark();
+		/* Cycles of duty updates into pwm_cycles */
+		pwm_profile();
+
 		g_p_uart_obj[0]->receive( uart_data, 13 );
 		g_p_uart_obj[0]->transmit( (const unsigned char *)"Hello World\r\n", 13 );
 		g_p_uart_obj[0]->receive( uart_data, 13 );
@@ -113,7 +214,14 @@ int main(void)
 		 * The while loop below can be replaced with user application code. */
 		while(1U)
 		{
-			__asm("NOP");
+			/* Ethernet receive and transmit context */
+			UDP__::run();
+			PTP__::run();
+			/* I2C bus recovery after timeout */
+			g_p_i2c_obj[0]->run();
+
+			/* Sleep till next interrupt, ticks suppressed while nothing is due */
+			(void) CLOCK__::idle( idle_budget );
 		}
 	}
 
@@ -128,25 +236,35 @@ extern "C"{
 
 void SysTick_Handler(void)
 {
-	/* Variables for SysTick interrupt */
-	static unsigned long ticks = 0;
+	/* LED toggle tick, ticks may advance by more than one after idle */
+	static unsigned long led_ticks = 0U;
 
 	/****** Operation in SysTick Interrupt Handler *******/
+	/* Time base first, tick functions below may take timestamps. Ticks
+	 * credited by CLOCK__::idle() come along with this one */
+	const unsigned long ticks = CLOCK__::tick();
+	/* Debounce inputs, one sample per call */
+	GPIO_Debounce__::tick();
+	/* I2C transaction timeouts */
+	g_p_i2c_obj[0]->tick( ticks );
+	/* ISO-TP timeouts */
+	ISOTP__::tick( ticks );
+	/* Gateway rate windows and deferred routing */
+	Gateway__::tick( ticks );
+	/* Ethernet link supervision */
+	ETH__::tick( ticks );
+	/* PTP master timeout */
+	PTP__::tick( ticks );
+
 	/* Check tick counts */
-	if( 500 == ticks )
+	if( (CLOCK__::get_ticks() - led_ticks) >= 500U )
 	{
+		led_ticks += 500U;
 		/* Perform timer interrupt operations */
 		GPIO__::fp_toggle( XMC_GPIO_PORT1, 0 );
 		GPIO__::fp_toggle( XMC_GPIO_PORT1, 1 );
-
-		/* Reset ticks */
-		ticks = 0;
-	}
-	else
-	{
-		/* Increment ticks */
-		ticks += 1;
 	}
+	else{	/* Not required */	}
 }
 
 
@@ -247,6 +365,12 @@ extern "C" void init_user_before_main( void )
 			gpio_init_c();
 			extern void initialize_uart_objects_c( void );
 			initialize_uart_objects_c();
+			extern void initialize_spi_objects_c( void );
+			initialize_spi_objects_c();
+			extern void initialize_i2c_objects_c( void );
+			initialize_i2c_objects_c();
+			extern void initialize_can_objects_c( void );
+			initialize_can_objects_c();
 		}
 
 
@@ -256,6 +380,9 @@ void uart_callback_handler(eUART_Channel_& channel, unsigned char *p_data, eUART
 	/* Can check the events for callback and do processing */
 	(void) p_data;
 
+	/* Gateway records on its UART ports */
+	Gateway__::uart_event( channel, event );
+
 	/* Check events */
 	switch( event )
 	{
@@ -278,4 +405,236 @@ void uart_callback_handler(eUART_Channel_& channel, unsigned char *p_data, eUART
 	}
 }
 
+
+/* ISO-TP transmission completion, echoed buffer goes back to pool */
+static void isotp_tx_handler( const unsigned char session, const eISOTP_Result_ result, void * p_arg )
+{
+	(void) session;
+	(void) result;
+
+	ISOTP__::release( static_cast<unsigned char*>(p_arg) );
+}
+
+/* ISO-TP receive handler for User */
+void isotp_rx_handler( const unsigned char session, unsigned char * p_data, const unsigned short length )
+{
+	/* Echo request back from receive buffer, no copy */
+	if( eISOTP_Status_::ISOTP_STATUS_SUCCESS !=
+		ISOTP__::send( session, p_data, length, isotp_tx_handler, p_data ) )
+	{
+		ISOTP__::release( p_data );
+	}
+	else{	/* Not required */	}
+}
+
+
+/* ETH__ class callback handler function for User */
+void eth_callback_handler( const eETH_Event_ event )
+{
+	/* Check events */
+	switch( event )
+	{
+		default:
+		/* Frames are taken by UDP__::run() in main loop */
+		case eETH_Event_::ETH_EVENT_RX:
+		case eETH_Event_::ETH_EVENT_TX:
+		case eETH_Event_::ETH_EVENT_LINK_UP:
+		case eETH_Event_::ETH_EVENT_LINK_DOWN:
+			__asm("NOP");
+			break;
+	}
+}
+
+
+/* ADC__ class callback handler function for User */
+void adc_callback_handler( const eADC_Event_ event, const unsigned short * p_block )
+{
+	/* Check events */
+	switch( event )
+	{
+		default:
+		/* Block stays valid until next block is filled */
+		case eADC_Event_::ADC_EVENT_BLOCK:
+		case eADC_Event_::ADC_EVENT_ERROR:
+			(void) p_block;
+			__asm("NOP");
+			break;
+	}
+}
+
+
+/* DSD__ class callback handler function for User */
+void dsd_callback_handler( const eDSD_Event_ event, const short * p_block )
+{
+	/* Check events */
+	switch( event )
+	{
+		/* Second stage runs on completed block while DMA fills the other */
+		case eDSD_Event_::DSD_EVENT_BLOCK:
+			(void) DSD__::decimate( p_block, DSD_BLOCK_SIZE, dsd_samples );
+			break;
+
+		default:
+		case eDSD_Event_::DSD_EVENT_ERROR:
+			__asm("NOP");
+			break;
+	}
+}
+
+
+/* CONTROL__ loop body sampling POSIF__ encoder */
+static void posif_sample_loop( void * p_context )
+{
+	(void) p_context;
+	POSIF__::sample();
+}
+
+
+/* Ticks main loop can sleep without tick interrupt, work served on every tick keeps it.
+ * Called by CLOCK__::idle() with interrupts masked */
+static unsigned long idle_budget( void )
+{
+	/* I2C timeouts count ticks */
+	if( g_p_i2c_obj[0]->is_busy() ){ return 1U; }
+	else{	/* Not required */	}
+
+	/* ISO-TP separation time and receive timeouts are served in tick requested gateway runs */
+	for( unsigned char session = 0U; session < ISOTP_SESSIONS_USED; ++session )
+	{
+		if( ISOTP__::is_busy( session ) || ISOTP__::is_receiving( session ) ){ return 1U; }
+		else{	/* Not required */	}
+	}
+
+	/* Changed inputs are counted per sample, not per tick */
+	if( GPIO_Debounce__::is_busy() ){ return 1U; }
+	else{	/* Not required */	}
+
+	/* Frames left in CAN queues wait for next gateway run */
+	for( unsigned char port = 0U; port < GATEWAY_CAN_PORTS; ++port )
+	{
+		if( g_p_can_obj[port]->get_pending() > 0U ){ return 1U; }
+		else{	/* Not required */	}
+	}
+
+	/* Gateway windows, link poll and PTP master timeout get credited ticks
+	 * and run at most CLOCK_IDLE_MAX_TICKS late, a new input edge is sampled
+	 * as late */
+	return CLOCK_IDLE_MAX_TICKS;
+}
+
+
+/* Time DSP__ transforms by cycle counter, same sizes as host benchmark in Test/src/tst_dsp.cpp */
+static void fft_benchmark( void )
+{
+	/* Local Variables */
+	static short data_q15[2U * 1024U] __attribute__((aligned(4)));
+	static long data_q31[2U * 256U];
+	unsigned long long start = 0U;
+
+	/* Ramp input, run time does not depend on data */
+	for( unsigned short index = 0U; index < (2U * 1024U); ++index )
+	{
+		data_q15[index] = static_cast<short>( index << 4U );
+	}
+	for( unsigned short index = 0U; index < (2U * 256U); ++index )
+	{
+		data_q31[index] = static_cast<long>( index ) << 20U;
+	}
+
+	start = CLOCK__::now();
+	(void) DSP__::fft_q15( data_q15, 64U );
+	fft_cycles[0] = static_cast<unsigned long>( CLOCK__::now() - start );
+
+	start = CLOCK__::now();
+	(void) DSP__::fft_q15( data_q15, 256U );
+	fft_cycles[1] = static_cast<unsigned long>( CLOCK__::now() - start );
+
+	start = CLOCK__::now();
+	(void) DSP__::fft_q15( data_q15, 1024U );
+	fft_cycles[2] = static_cast<unsigned long>( CLOCK__::now() - start );
+
+	start = CLOCK__::now();
+	(void) DSP__::fft_q31( data_q31, 256U );
+	fft_cycles[3] = static_cast<unsigned long>( CLOCK__::now() - start );
+}
+
+
+/* Time PWM__ duty updates by cycle counter, 0 % is written so outputs do not change */
+static void pwm_profile( void )
+{
+	/* Local Variables */
+	const unsigned short duty[PWM_CHANNELS] = {0};
+	unsigned long long start = 0U;
+	unsigned long primask = 0U;
+
+	/* No interrupt between the two reads of cycle counter */
+	primask = __get_PRIMASK();
+	__disable_irq();
+
+	start = CLOCK__::now();
+	(void) PWM__::set_duties( duty, PWM_CHANNELS );
+	pwm_cycles[0] = static_cast<unsigned long>( CLOCK__::now() - start );
+
+	start = CLOCK__::now();
+	(void) PWM__::set_duty( 0U, 0U );
+	pwm_cycles[1] = static_cast<unsigned long>( CLOCK__::now() - start );
+
+	__set_PRIMASK( primask );
+}
+
+
+/* PWM_Motor__ class callback handler function for User */
+void pwm_motor_callback_handler( const ePWM_Motor_Event_ event )
+{
+	/* Check events */
+	switch( event )
+	{
+		/* Once per PWM period, new duties apply at next period */
+		case ePWM_Motor_Event_::PWM_MOTOR_EVENT_PERIOD:
+			__asm("NOP");
+			break;
+
+		default:
+		/* Outputs are off already, trap_clear() resumes them */
+		case ePWM_Motor_Event_::PWM_MOTOR_EVENT_TRAP:
+			__asm("NOP");
+			break;
+	}
+}
+
+
+/* DAC__ class callback handler function for User */
+void dac_callback_handler( const eDAC_Event_ event, const unsigned short offset )
+{
+	/* Check events */
+	switch( event )
+	{
+		/* Samples from offset on could be refilled, flash table just loops */
+		case eDAC_Event_::DAC_EVENT_HALF:
+			(void) offset;
+			break;
+
+		default:
+		case eDAC_Event_::DAC_EVENT_ERROR:
+			__asm("NOP");
+			break;
+	}
+}
+
+
+/* UDP receive handler for User */
+void udp_rx_handler( const tStUDP_Endpoint& source, const unsigned char * p_data, const unsigned short length )
+{
+	/* Local Variables */
+	unsigned char * p_payload = UDP__::claim();
+
+	/* Echo datagram back to sender */
+	if( nullptr != p_payload )
+	{
+		memcpy( p_payload, p_data, length );
+		(void) UDP__::send( source, g_udp_ports[0].port, length );
+	}
+	else{	/* Not required */	}
+}
+
 /********************************** End of File *******************************/